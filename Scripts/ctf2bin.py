@@ -13,28 +13,53 @@
 #   <matrix type> is the matrix type, i.e., dense or sparse
 #   <sample dimension> is the dimension of each sample for the input
 #
+# The following options produce a version 2 file, which needs a reader that
+# supports it:
+#   --compress_sparse_indices stores sparse indices as delta encoded var-ints,
+#   --dense_float16 stores the values of dense streams in half precision,
+#   --compression compresses each chunk with lz4 or zstd (requires the lz4 or
+#     zstandard python package, and a reader built with the same library).
+#
 
 import sys
 import argparse
+import io
 import struct
 import os
 from collections import OrderedDict
 
 MAGIC_NUMBER = 0x636e746b5f62696e;
 CBF_VERSION = 1;
+# Version 2 adds compressed sparse indices, half precision values and chunk compression.
+CBF_VERSION_COMPRESSED = 2;
 
 class ElementType:
     FLOAT = 0
     DOUBLE = 1
+    FLOAT16 = 2
 
 class MatrixEncodingType:
     DENSE = 0
     SPARSE = 1
-    # TODO: use varint encoding for sparse indices,
-    # use varint encoding for integer values,
+    COMPRESSED_SPARSE = 2
+    # TODO: use varint encoding for integer values,
     # use a single byte for boolean values (e.g., one-hot values).
-    #COMPRESSED_DENSE = 2
-    #COMPRESSED_SPARSE = 3
+
+class ChunkCompressionType:
+    NONE = 0
+    LZ4 = 1
+    ZSTD = 2
+
+def encode_varint(value):
+    result = bytearray()
+    while True:
+        byte = value & 0x7f
+        value >>= 7
+        if value:
+            result.append(byte | 0x80)
+        else:
+            result.append(byte)
+            return bytes(result)
 
 # This will convert data in the CTF format into the binary format
 class Converter(object):
@@ -60,12 +85,15 @@ class Converter(object):
         output.write(b''.join([struct.pack('<i', x) for x in ints]))
 
     def write_floats(self, output, floats):
-        format = 'f' if self.is_float() else 'd'
+        format = {ElementType.FLOAT: 'f', ElementType.DOUBLE: 'd', ElementType.FLOAT16: 'e'}[self.element_type]
         output.write(b''.join([struct.pack(format, x) for x in floats]))
 
     def is_float(self):
         return self.element_type == ElementType.FLOAT
 
+    def value_size(self):
+        return {ElementType.FLOAT: 4, ElementType.DOUBLE: 8, ElementType.FLOAT16: 2}[self.element_type]
+
     def get_matrix_type(self):
         raise NotImplementedError()
 
@@ -89,7 +117,7 @@ class DenseConverter(Converter):
             raise ValueError(
                 "Invalid sample dimension for input {0}".format(self.name))
 
-        byte_size = len(sample) * (4 if self.is_float() else 8)
+        byte_size = len(sample) * self.value_size()
 
         if(len(self.sequences) == 0):
             self.sequences.append([])
@@ -119,7 +147,7 @@ class SparseConverter(Converter):
                 raise ValueError("Invalid sample dimension for input {0}. Max {1}, given {2}"
                         .format(self.name, self.sample_dim, index))
 
-        byte_size = len(list(pairs)) * (8 if self.is_float() else 12) + 4
+        byte_size = len(list(pairs)) * (self.value_size() + 4) + 4
 
         if(len(self.sequences) == 0):
             self.sequences.append([])
@@ -133,7 +161,6 @@ class SparseConverter(Converter):
         return MatrixEncodingType.SPARSE;
 
     def write_data(self, output):
-        format = 'f' if self.is_float() else 'd'
         for sequence in self.sequences:
             # write out each sequence in sparse format
             values = []
@@ -154,6 +181,30 @@ class SparseConverter(Converter):
             self.write_signed_ints(output, indices)
             self.write_signed_ints(output, sizes)
 
+# Specialization for sparse inputs with var-int encoded counts and delta encoded indices
+class CompressedSparseConverter(SparseConverter):
+
+    def get_matrix_type(self):
+        return MatrixEncodingType.COMPRESSED_SPARSE;
+
+    def write_data(self, output):
+        for sequence in self.sequences:
+            values = []
+            encoded_indices = []
+            for sample in sequence:
+                sample.sort(key=lambda x: x[0])
+                encoded_indices.append(encode_varint(len(sample)))
+                previous = 0
+                for (index, value) in sample:
+                    encoded_indices.append(encode_varint(index - previous))
+                    previous = index
+                    values.append(value)
+
+            output.write(encode_varint(len(sequence))) #number of samples in this sequence
+            output.write(encode_varint(len(values))) #total nnz count for this sequence
+            self.write_floats(output, values)
+            output.write(b''.join(encoded_indices))
+
 # Process the entire sequence
 def process_sequence(data, converters, chunk):
     byte_size = 0;
@@ -172,33 +223,60 @@ def process_sequence(data, converters, chunk):
     chunk.add_sequence(sequence_length_samples)
     return byte_size
 
+def compress_chunk_data(data, compression):
+    if compression == ChunkCompressionType.LZ4:
+        import lz4.block
+        return lz4.block.compress(data, store_size=False)
+    if compression == ChunkCompressionType.ZSTD:
+        import zstandard
+        return zstandard.ZstdCompressor(level=3).compress(data)
+    return data
+
 # Output a binary chunk
-def write_chunk(binfile, converters, chunk):
+def write_chunk(binfile, converters, chunk, version=CBF_VERSION, compression=ChunkCompressionType.NONE):
     binfile.flush()
     chunk.offset = binfile.tell()
     # write out the number of samples for each sequence in the chunk
     binfile.write(b''.join([struct.pack('<I', x) for x in chunk.sequences]))
 
-    for converter in converters.values():
-        converter.write_data(binfile)
-        converter.reset()
+    if version == CBF_VERSION:
+        for converter in converters.values():
+            converter.write_data(binfile)
+            converter.reset()
+    else:
+        data = io.BytesIO()
+        for converter in converters.values():
+            converter.write_data(data)
+            converter.reset()
+        data = data.getvalue()
+        compressed = compress_chunk_data(data, compression)
+        # keep the chunk uncompressed if compression does not pay off
+        if compression == ChunkCompressionType.NONE or len(compressed) >= len(data):
+            compression = ChunkCompressionType.NONE
+            compressed = data
+        # uint8: compression type, uint64: size of the uncompressed data
+        binfile.write(struct.pack('<BQ', compression, len(data)))
+        binfile.write(compressed)
     # TODO: add a hash of the chunk
 
-def get_converter(input_type, name, sample_dim, element_type):
+def get_converter(input_type, name, sample_dim, element_type, compress_sparse_indices=False, dense_float16=False):
     if(input_type.lower() == 'dense'):
-        return DenseConverter(name, sample_dim, element_type)
+        return DenseConverter(name, sample_dim, ElementType.FLOAT16 if dense_float16 else element_type)
     if(input_type.lower() == 'sparse'):
+        if compress_sparse_indices:
+            return CompressedSparseConverter(name, sample_dim, element_type)
         return SparseConverter(name, sample_dim, element_type)
 
     raise ValueError('Invalid input format {0}'.format(input_type))
 
 # parse the header to get the converters for this file
 # <name>    <alias>  <input format>  <sample size>
-def build_converters(streams_header, element_type):
+def build_converters(streams_header, element_type, compress_sparse_indices=False, dense_float16=False):
     converters = OrderedDict();
     for line in streams_header:
         (name, alias, input_type, sample_dim) = line.strip().split()
-        converters[alias] = get_converter(input_type, name, int(sample_dim), element_type)
+        converters[alias] = get_converter(input_type, name, int(sample_dim), element_type,
+            compress_sparse_indices, dense_float16)
     return converters
 
 class Chunk:
@@ -247,14 +325,20 @@ class Header:
 
         output_file.write(struct.pack('<q', header_offset))
 
-def process(input_name, output_name, streams, element_type, chunk_size=32<<20):
-    converters = build_converters(streams, element_type)
+def process(input_name, output_name, streams, element_type, chunk_size=32<<20,
+            compress_sparse_indices=False, dense_float16=False, compression=ChunkCompressionType.NONE):
+    converters = build_converters(streams, element_type, compress_sparse_indices, dense_float16)
+
+    # Only use the new version when one of its features is requested, so that older readers can read the file otherwise.
+    version = CBF_VERSION
+    if compress_sparse_indices or dense_float16 or compression != ChunkCompressionType.NONE:
+        version = CBF_VERSION_COMPRESSED
 
     output = open(output_name, "wb")
     # The very first 8 bytes of the file is the CBF magic number.
     output.write(struct.pack('<Q', MAGIC_NUMBER));
     # Next 4 bytes is the CBF version.
-    output.write(struct.pack('<I', CBF_VERSION));
+    output.write(struct.pack('<I', version));
 
 
     header = Header(converters)
@@ -274,7 +358,7 @@ def process(input_name, output_name, streams, element_type, chunk_size=32<<20):
                     estimated_chunk_size += process_sequence(sequence, converters, chunk)
                     sequence = []
                     if(estimated_chunk_size >= chunk_size):
-                        write_chunk(output, converters, chunk)
+                        write_chunk(output, converters, chunk, version, compression)
                         header.add_chunk(chunk)
                         chunk = Chunk()
                 seq_id = prefix
@@ -284,7 +368,7 @@ def process(input_name, output_name, streams, element_type, chunk_size=32<<20):
         if(len(sequence) > 0):
             process_sequence(sequence, converters, chunk)
 
-        write_chunk(output, converters, chunk)
+        write_chunk(output, converters, chunk, version, compression)
         header.add_chunk(chunk)
 
         header.write(output)
@@ -299,6 +383,12 @@ if __name__ == '__main__':
     parser.add_argument('--output', help='Name of the output file, stdout if not given', required=True)
     parser.add_argument('--precision', help='Floating point precision (double or float). Default is float',
         choices=["float", "double"], default="float", required=False)
+    parser.add_argument('--compress_sparse_indices', action='store_true',
+        help='Store the indices of sparse streams as delta encoded var-ints.', required=False)
+    parser.add_argument('--dense_float16', action='store_true',
+        help='Store the values of dense streams in half precision (requires Python 3.6 or newer).', required=False)
+    parser.add_argument('--compression', help='Compression of the chunks. Default is none',
+        choices=["none", "lz4", "zstd"], default="none", required=False)
     args = parser.parse_args()
 
     with open(args.header) as header:
@@ -306,4 +396,8 @@ if __name__ == '__main__':
     
     element_type = ElementType.FLOAT if args.precision == 'float' else ElementType.DOUBLE
     
-    process(args.input, args.output, streams, element_type, int(args.chunk_size))
\ No newline at end of file
+    compression = {'none': ChunkCompressionType.NONE, 'lz4': ChunkCompressionType.LZ4,
+        'zstd': ChunkCompressionType.ZSTD}[args.compression]
+
+    process(args.input, args.output, streams, element_type, int(args.chunk_size),
+        args.compress_sparse_indices, args.dense_float16, compression)
\ No newline at end of file
@@ -53,11 +53,9 @@ ComputationNetworkPtr SimpleNetworkBuilder<ElemType>::BuildNetworkFromDescriptio
     case ConditionalLSTMNetworkKind:
         net = BuildConditionalLSTMNetworkFromDescription();
         break;
-#ifdef COMING_SOON
     case CRFLSTMNetworkKind:
         net = BuildCRFLSTMNetworkFromDescription();
         break;
-#endif
     default:
         LogicError("BuildNetworkFromDescription: invalid m_standardNetworkKind %d", (int) m_standardNetworkKind);
     }
@@ -954,8 +952,6 @@ shared_ptr<ComputationNode<ElemType>> /*ComputationNodePtr*/ SimpleNetworkBuilde
     return output;
 }
 
-#ifdef COMING_SOON
-
 template <class ElemType>
 ComputationNetworkPtr SimpleNetworkBuilder<ElemType>::BuildCRFLSTMNetworkFromDescription()
 {
@@ -1037,7 +1033,7 @@ ComputationNetworkPtr SimpleNetworkBuilder<ElemType>::BuildCRFLSTMNetworkFromDes
         w = builder.CreateLearnableParameter(msra::strfun::wstrprintf(L"TimesBeforeSoftMax%d", numHiddenLayers), m_layerSizes[numHiddenLayers + 1], m_layerSizes[numHiddenLayers]);
         m_net->RandomInitLearnableParameters(w, m_uniformInit, randomSeed++, m_initValueScale);
 
-        output = builder.Times(w, input, L"outputsBeforeSoftmax");
+        output = builder.Times(w, input, 1, L"outputsBeforeSoftmax");
 
         trans = builder.CreateLearnableParameter(msra::strfun::wstrprintf(L"TransProb%d", numHiddenLayers), m_layerSizes[numHiddenLayers + 1], m_layerSizes[numHiddenLayers + 1]);
         m_net->InitLearnableParameters(trans, L"fixedValue", (ElemType) 1.0 / m_layerSizes[numHiddenLayers + 1]);
@@ -1056,8 +1052,6 @@ ComputationNetworkPtr SimpleNetworkBuilder<ElemType>::BuildCRFLSTMNetworkFromDes
     return m_net;
 }
 
-#endif
-
 template <class ElemType>
 ComputationNetworkPtr SimpleNetworkBuilder<ElemType>::BuildClassLSTMNetworkFromDescription()
 {
@@ -1699,12 +1693,10 @@ shared_ptr<ComputationNode<ElemType>> SimpleNetworkBuilder<ElemType>::AddTrainAn
             tinput = builder.Times(matrix, input);
         output = builder.Logistic(label, tinput, (trainNodeName == L"") ? L"Logistic" : trainNodeName);
         break;
-#ifdef COMING_SOON
     case TrainingCriterion::CRF:
         assert(trans != nullptr);
         output = builder.CRF(label, input, trans, (trainNodeName == L"") ? L"CRF" : trainNodeName);
         break;
-#endif
     case TrainingCriterion::ClassCrossEntropyWithSoftmax:
         output = builder.ClassCrossEntropyWithSoftmax(label, input, matrix, clspostprob, (trainNodeName == L"") ? L"ClassCrossEntropyWithSoftmax" : trainNodeName);
         break;
@@ -1756,14 +1748,12 @@ shared_ptr<ComputationNode<ElemType>> SimpleNetworkBuilder<ElemType>::AddTrainAn
                 tinput = builder.Times(matrix, input);
             output = builder.ClassificationError(label, tinput, (evalNodeName == L"") ? L"EvalClassificationError" : evalNodeName);
             break;
-#ifdef COMING_SOON
         case EvalCriterion::CRF:
             assert(trans != nullptr);
             if (matrix != nullptr && tinput == input)
                 tinput = builder.Times(matrix, input);
             output = builder.CRF(label, tinput, trans, (evalNodeName == L"") ? L"EvalCRF" : evalNodeName);
             break;
-#endif
         default:
             LogicError("Unsupported training criterion.");
         }
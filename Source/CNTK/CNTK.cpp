@@ -24,6 +24,7 @@
 #include "ModelEditLanguage.h"
 #include "CPUMatrix.h" // used for SetNumThreads()
 #include "CommonMatrix.h"
+#include "CPUMemAllocator.h"
 #include "SGD.h"
 #include "MPIWrapper.h"
 #include "EnvironmentUtil.h"
@@ -512,8 +513,13 @@ int wmainWithBS(int argc, wchar_t* argv[]) // called from wmain which is a wrapp
 
     Globals::SetShareNodeValueMatrices(config(L"shareNodeValueMatrices", true));
     Globals::SetGradientAccumulationOptimization(config(L"optimizeGradientAccumulation", true));
+    Globals::SetInterOpThreads(config(L"interOpThreads", 0));
+    Globals::SetOptimizeMemoryPerMinibatchSize(config(L"optimizeMemoryPerMinibatchSize", false));
+    Globals::SetFuseElementwiseOperations(config(L"fuseElementwiseOperations", false));
 
     TracingGPUMemoryAllocator::SetTraceLevel(config(L"traceGPUMemoryAllocations", 0));
+    CPUMemAllocator::SetUseHugePages(config(L"useHugePages", false));
+    CPUMemAllocator::SetMaxCachedBytesPerThread(config(L"cpuMemoryCachePerThreadInMB", (size_t) 256) * 1024 * 1024);
 
     // logging
     wstring logpath = config(L"stderr", L"");
@@ -660,8 +666,13 @@ int wmainOldCNTKConfig(int argc, wchar_t* argv[])
 
     Globals::SetShareNodeValueMatrices(config(L"shareNodeValueMatrices", true));
     Globals::SetGradientAccumulationOptimization(config(L"optimizeGradientAccumulation", true));
+    Globals::SetInterOpThreads(config(L"interOpThreads", 0));
+    Globals::SetOptimizeMemoryPerMinibatchSize(config(L"optimizeMemoryPerMinibatchSize", false));
+    Globals::SetFuseElementwiseOperations(config(L"fuseElementwiseOperations", false));
 
     TracingGPUMemoryAllocator::SetTraceLevel(config(L"traceGPUMemoryAllocations", 0));
+    CPUMemAllocator::SetUseHugePages(config(L"useHugePages", false));
+    CPUMemAllocator::SetMaxCachedBytesPerThread(config(L"cpuMemoryCachePerThreadInMB", (size_t) 256) * 1024 * 1024);
 
     if (logpath != L"")
     {
@@ -0,0 +1,16 @@
+#ifndef _BUILDINFO_H
+#define _BUILDINFO_H
+#define _GIT_EXIST
+#define _MATHLIB_ "openblas"
+#define _BUILDSHA1_ "36985d8a4610e6258f54968be2321cbb417064ff"
+#define _BUILDBRANCH_ "master"
+#define _BUILDTARGET_ "CPU-only"
+#define _BUILDTYPE_ "debug"
+#define _WITH_1BITSGD_ "no"
+#define _WITH_ASGD_ "no"
+#define _BUILDER_ "Source/CNTK/buildinfo.h$$0"
+#define _BUILDMACHINE_ "vm"
+#define _BUILDPATH_ "/root/repo"
+#define _MPI_NAME_ "Open MPI"
+#define _MPI_VERSION_ "4.1.4"
+#endif
@@ -5686,8 +5686,16 @@ namespace CNTK
 
     ///
     /// Built-in MPI-based communicator.
+    /// With useHierarchicalAllReduce, values are first summed through shared memory among the workers on the same host,
+    /// and only one worker per host exchanges them over the network.
     ///
-    CNTK_API DistributedCommunicatorPtr MPICommunicator(size_t packThresholdSizeInBytes = Internal::DefaultPackThresholdSizeInBytes());
+    CNTK_API DistributedCommunicatorPtr MPICommunicator(size_t packThresholdSizeInBytes = Internal::DefaultPackThresholdSizeInBytes(), bool useHierarchicalAllReduce = false);
+
+    ///
+    /// Built-in MPI-based communicator that aggregates dense CPU values quantized to 1, 2, 4 or 8 bits, with error feedback.
+    /// It can be used with the DataParallelDistributedLearner and does not require the 1BitSGD build.
+    ///
+    CNTK_API DistributedCommunicatorPtr CompressedMPICommunicator(size_t numQuantizationBits, bool zeroThresholdFor1Bit = false, size_t packThresholdSizeInBytes = Internal::DefaultPackThresholdSizeInBytes());
 
     ///
     /// Distributed communicator that allows quantized aggregations.
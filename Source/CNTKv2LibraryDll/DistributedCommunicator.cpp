@@ -29,9 +29,9 @@ namespace CNTK
         }
     }
 
-    DistributedCommunicatorPtr MPICommunicator(size_t packThresholdSizeInBytes)
+    DistributedCommunicatorPtr MPICommunicator(size_t packThresholdSizeInBytes, bool useHierarchicalAllReduce)
     {
-        return std::make_shared<MPICommunicatorImpl>(packThresholdSizeInBytes);
+        return std::make_shared<MPICommunicatorImpl>(packThresholdSizeInBytes, useHierarchicalAllReduce);
     }
 
     void DistributedCommunicator::Finalize()
@@ -42,6 +42,11 @@ namespace CNTK
         MPIWrapper::DeleteInstance();
     }
 
+    DistributedCommunicatorPtr CompressedMPICommunicator(size_t numQuantizationBits, bool zeroThresholdFor1Bit, size_t packThresholdSizeInBytes)
+    {
+        return std::make_shared<CompressedMPICommunicatorImpl>(numQuantizationBits, zeroThresholdFor1Bit, packThresholdSizeInBytes);
+    }
+
     MPICommunicatorImpl::Buffer MPICommunicatorImpl::AllocateIntermediateBuffer(int deviceID, size_t totalSize)
     {
         assert(deviceID >= 0);
@@ -69,7 +74,8 @@ namespace CNTK
         return nullptr; // Make compiler happy.
     }
 
-    MPICommunicatorImpl::MPICommunicatorImpl(size_t packThresholdSizeInBytes)
+    MPICommunicatorImpl::MPICommunicatorImpl(size_t packThresholdSizeInBytes, bool useHierarchicalAllReduce)
+        : m_useHierarchicalAllReduce(useHierarchicalAllReduce)
     {
         m_mpi = MPIWrapper::GetInstance();
         if (m_mpi == nullptr)
@@ -365,6 +371,10 @@ namespace CNTK
         // For all values residing on GPU initiate async transfer to CPU buffers if needed
         CopyDataFromGPUToCPU(valuesToAggregate);
 
+        // The hierarchical allreduce is blocking, and takes over all values, as they are all on the CPU without NCCL and GDR.
+        // It is a collective call, so it is used on all workers if any host has several of them.
+        bool useHierarchicalAllReduce = m_useHierarchicalAllReduce && !m_nccl->IsSupported() && !m_mpi->UseGpuGdr() && (m_mpi->MaxNumLocalRanks() > 1);
+
         std::vector<MPI_Request> allReduceRequests;
         for (auto i = 0; i < numValues; ++i)
         {
@@ -388,7 +398,11 @@ namespace CNTK
             void* inputData = (ShouldCopyDataToCPU(inputValue)) ? m_intermediateCPUBuffers[i].data.get() : GetDataBuffer(inputValue);
             void* outputData = (ShouldCopyDataToCPU(inputValue)) ? m_intermediateCPUBuffers[i].data.get() : GetDataBuffer(outputValue);
 
-            if (dataType == DataType::Float)
+            if (dataType == DataType::Float && useHierarchicalAllReduce)
+                HierarchicalAllReduceData(static_cast<float*>(inputData), static_cast<float*>(outputData), numElements);
+            else if (dataType == DataType::Double && useHierarchicalAllReduce)
+                HierarchicalAllReduceData(static_cast<double*>(inputData), static_cast<double*>(outputData), numElements);
+            else if (dataType == DataType::Float)
             {
                 AllReduceData(static_cast<float*>(inputData), static_cast<float*>(outputData), numElements,
                     &allReduceRequests, (inputValue->Device() == DeviceDescriptor::CPUDevice()));
@@ -400,6 +414,13 @@ namespace CNTK
             }
             else
                 LogicError("MPICommunicator: Unknown DataType.");
+
+            // already reduced, so a gpu bound value can be copied back right away
+            if (useHierarchicalAllReduce && ShouldCopyDataToCPU(inputValue))
+            {
+                auto view = valuesAfterAggregate[i];
+                m_gpuDataTransferers[i]->CopyCPUToGPUAsync(m_intermediateCPUBuffers[i].data.get(), GetBufferSize(view), GetDataBuffer(view));
+            }
         }
 
         if (m_nccl->IsSupported())
@@ -719,4 +740,206 @@ namespace CNTK
         else
             m_mpi->AllReduceAsync(inputData, outputData, numElements, &(pAllReduceRequests->back()), op);
     }
+
+    template <typename ElemType>
+    void MPICommunicatorImpl::HierarchicalAllReduceData(ElemType* inputData, ElemType* outputData, size_t numElements)
+    {
+        if (inputData != outputData)
+            memcpy(outputData, inputData, numElements * sizeof(ElemType));
+        m_mpi->HierarchicalAllReduce(outputData, numElements);
+    }
+
+    CompressedMPICommunicatorImpl::CompressedMPICommunicatorImpl(size_t numQuantizationBits, bool zeroThresholdFor1Bit, size_t packThresholdSizeInBytes)
+        : MPICommunicatorImpl(packThresholdSizeInBytes),
+          m_numQuantizationBits(numQuantizationBits),
+          m_zeroThresholdFor1Bit(zeroThresholdFor1Bit)
+    {
+        if (numQuantizationBits != 1 && numQuantizationBits != 2 && numQuantizationBits != 4 && numQuantizationBits != 8)
+            InvalidArgument("CompressedMPICommunicator: numQuantizationBits (%zu) must be 1, 2, 4 or 8.", numQuantizationBits);
+    }
+
+    bool CompressedMPICommunicatorImpl::CanQuantize(const NDArrayViewPtr& value)
+    {
+        if (value->Device() != DeviceDescriptor::CPUDevice() || value->GetStorageFormat() != StorageFormat::Dense)
+            return false;
+
+        // Every worker needs at least one column of its own.
+        if (value->GetDataType() == DataType::Float)
+            return GetMatrix<float>(value)->GetNumCols() >= m_mpi->NumNodesInUse();
+        if (value->GetDataType() == DataType::Double)
+            return GetMatrix<double>(value)->GetNumCols() >= m_mpi->NumNodesInUse();
+        return false;
+    }
+
+    void CompressedMPICommunicatorImpl::Aggregate(
+        const std::vector<NDArrayViewPtr>& inValues,
+        std::vector<NDArrayViewPtr>& outValues,
+        const std::unordered_set<DistributedWorkerDescriptor>& sendToWorkers)
+    {
+        if (outValues.empty())
+            Recreate(inValues, outValues);
+        else if (outValues.size() != inValues.size())
+            NOT_IMPLEMENTED;
+
+        for (size_t i = 0; i < inValues.size(); ++i)
+            outValues[i]->CopyFrom(*inValues[i]);
+
+        AggregateInPlace(outValues, sendToWorkers);
+    }
+
+    void CompressedMPICommunicatorImpl::AggregateInPlace(
+        const std::vector<NDArrayViewPtr>& values,
+        const std::unordered_set<DistributedWorkerDescriptor>& sendToWorkers)
+    {
+        CheckWorkers(sendToWorkers);
+
+        if (m_mpi->NumNodesInUse() == 1) // No need to aggregate anything.
+            return;
+
+        std::vector<size_t> floatIndices;
+        std::vector<size_t> doubleIndices;
+        std::vector<NDArrayViewPtr> fullPrecisionValues;
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (!CanQuantize(values[i]))
+                fullPrecisionValues.push_back(values[i]);
+            else if (values[i]->GetDataType() == DataType::Float)
+                floatIndices.push_back(i);
+            else
+                doubleIndices.push_back(i);
+        }
+
+        if (m_floatStates.size() < values.size())
+            m_floatStates.resize(values.size());
+        if (m_doubleStates.size() < values.size())
+            m_doubleStates.resize(values.size());
+
+        if (!floatIndices.empty())
+            QuantizedAllReduce<float>(values, floatIndices, m_floatStates, m_floatQuantizer);
+        if (!doubleIndices.empty())
+            QuantizedAllReduce<double>(values, doubleIndices, m_doubleStates, m_doubleQuantizer);
+
+        if (!fullPrecisionValues.empty())
+            MPICommunicatorImpl::AggregateInPlace(fullPrecisionValues, sendToWorkers);
+    }
+
+    template <typename ElemType>
+    CompressedMPICommunicatorImpl::QuantizationState<ElemType>& CompressedMPICommunicatorImpl::GetState(
+        std::vector<std::unique_ptr<QuantizationState<ElemType>>>& states, size_t index, size_t numRows, size_t numCols)
+    {
+        auto& state = states[index];
+        if (state && state->numRows == numRows && state->numCols == numCols)
+            return *state;
+
+        // New value or the value at this position has changed: start with zero residuals.
+        auto numWorkers = m_mpi->NumNodesInUse();
+        auto stripe = Stripe(numCols, m_mpi->CurrentNodeRank());
+        auto stripeCols = stripe.second - stripe.first;
+
+        state.reset(new QuantizationState<ElemType>());
+        state->numRows = numRows;
+        state->numCols = numCols;
+        state->residual.reset(new Matrix<ElemType>(numRows, numCols, CPUDEVICE));
+        state->residual->SetValue(0);
+        state->stripeResidual.reset(new Matrix<ElemType>(numRows, stripeCols, CPUDEVICE));
+        state->stripeResidual->SetValue(0);
+        state->stripeSum.reset(new Matrix<ElemType>(numRows, stripeCols, CPUDEVICE));
+        state->quantized.reset(new QuantizedMatrix<ElemType>(numRows, numCols, m_numQuantizationBits, CPUDEVICE));
+        state->received.resize(numWorkers);
+        for (size_t k = 0; k < numWorkers; ++k)
+        {
+            if (k != m_mpi->CurrentNodeRank())
+                state->received[k].reset(new QuantizedMatrix<ElemType>(numRows, stripeCols, m_numQuantizationBits, CPUDEVICE));
+        }
+        return *state;
+    }
+
+    template <typename ElemType>
+    void CompressedMPICommunicatorImpl::QuantizedAllReduce(const std::vector<NDArrayViewPtr>& values, const std::vector<size_t>& indices,
+        std::vector<std::unique_ptr<QuantizationState<ElemType>>>& states,
+        std::unique_ptr<MatrixQuantizerImpl<ElemType>>& quantizer)
+    {
+        if (!quantizer)
+            quantizer.reset(MatrixQuantizerImpl<ElemType>::Create(CPUDEVICE, /*useAsync=*/false));
+
+        auto numWorkers = m_mpi->NumNodesInUse();
+        auto rank = m_mpi->CurrentNodeRank();
+
+        // Messages between two workers are matched in order, so the tags only need to tell the two phases apart.
+        auto tag = [](size_t index, int phase) { return (int)(index % 16384) * 2 + phase; };
+
+        // Reduce-scatter: quantize each value and send every stripe to its owner.
+        std::vector<std::shared_ptr<Matrix<ElemType>>> matrices;
+        std::vector<MPI_Request> requests;
+        for (auto i : indices)
+        {
+            auto matrix = GetWritableMatrix<ElemType>(values[i]);
+            auto& state = GetState(states, i, matrix->GetNumRows(), matrix->GetNumCols());
+            matrices.push_back(matrix);
+
+            quantizer->QuantizeAsync(*matrix, *state.residual, *state.quantized, *state.residual, m_zeroThresholdFor1Bit);
+            quantizer->WaitQuantizeAsyncDone();
+
+            for (size_t k = 0; k < numWorkers; ++k)
+            {
+                if (k == rank)
+                    continue;
+
+                auto stripe = Stripe(state.numCols, k);
+                auto slice = state.quantized->ColumnSlice(stripe.first, stripe.second - stripe.first);
+                requests.push_back(MPI_Request());
+                m_mpi->Isend(slice.Buffer(), (int)slice.GetSize(), MPI_CHAR, (int)k, tag(i, 0), &requests.back());
+
+                auto& received = *state.received[k];
+                requests.push_back(MPI_Request());
+                m_mpi->Irecv(received.Buffer(), (int)received.GetSize(), MPI_CHAR, (int)k, tag(i, 0), &requests.back());
+            }
+        }
+        m_mpi->WaitAll(requests);
+        requests.clear();
+
+        // Sum the contributions to the own stripe, quantize the sum into the own stripe of the quantized value
+        // and send it to all other workers (all-gather).
+        for (auto i : indices)
+        {
+            auto& state = *states[i];
+            auto own = Stripe(state.numCols, rank);
+            auto ownQuantized = state.quantized->ColumnSlice(own.first, own.second - own.first);
+
+            state.stripeSum->SetValue(0);
+            quantizer->UnquantizeAsync(ownQuantized, *state.stripeSum, /*add=*/true);
+            for (size_t k = 0; k < numWorkers; ++k)
+            {
+                if (k != rank)
+                    quantizer->UnquantizeAsync(*state.received[k], *state.stripeSum, /*add=*/true);
+            }
+            quantizer->WaitUnquantizeAsyncDone();
+
+            quantizer->QuantizeAsync(*state.stripeSum, *state.stripeResidual, ownQuantized, *state.stripeResidual, m_zeroThresholdFor1Bit);
+            quantizer->WaitQuantizeAsyncDone();
+
+            for (size_t k = 0; k < numWorkers; ++k)
+            {
+                if (k == rank)
+                    continue;
+
+                requests.push_back(MPI_Request());
+                m_mpi->Isend(ownQuantized.Buffer(), (int)ownQuantized.GetSize(), MPI_CHAR, (int)k, tag(i, 1), &requests.back());
+
+                auto stripe = Stripe(state.numCols, k);
+                auto slice = state.quantized->ColumnSlice(stripe.first, stripe.second - stripe.first);
+                requests.push_back(MPI_Request());
+                m_mpi->Irecv(slice.Buffer(), (int)slice.GetSize(), MPI_CHAR, (int)k, tag(i, 1), &requests.back());
+            }
+        }
+        m_mpi->WaitAll(requests);
+
+        // All workers now hold the same aggregated stripes, including their own one.
+        for (size_t j = 0; j < indices.size(); ++j)
+        {
+            auto& state = *states[indices[j]];
+            quantizer->UnquantizeAsync(*state.quantized, *matrices[j], /*add=*/false);
+        }
+        quantizer->WaitUnquantizeAsyncDone();
+    }
 }
@@ -23,7 +23,7 @@ namespace CNTK
     class MPICommunicatorImpl : public DistributedCommunicator, public std::enable_shared_from_this<MPICommunicatorImpl>
     {
     public:
-        MPICommunicatorImpl(size_t packThresholdSizeInBytes = DEFAULT_PACK_THRESHOLD_SIZE_IN_BYTES);
+        MPICommunicatorImpl(size_t packThresholdSizeInBytes = DEFAULT_PACK_THRESHOLD_SIZE_IN_BYTES, bool useHierarchicalAllReduce = false);
 
         virtual const std::unordered_set<DistributedWorkerDescriptor>& Workers() const override;
 
@@ -90,6 +90,9 @@ namespace CNTK
 
         // Threshold size of a gradient to be packed
         size_t m_packThresholdSizeInBytes;
+
+        // Reduce CPU values with MPIWrapper::HierarchicalAllReduce()
+        bool m_useHierarchicalAllReduce;
         std::unique_ptr<Microsoft::MSR::CNTK::Matrix<float>> m_aggregationBufferFloat;
         std::unique_ptr<Microsoft::MSR::CNTK::Matrix<double>> m_aggregationBufferDouble;
 
@@ -143,5 +146,80 @@ namespace CNTK
 
         template <typename ElemType>
         void AllReduceData(ElemType* inputData, ElemType* outputData, size_t numElements, std::vector<MPI_Request>* pAllReduceRequests, bool dataOnCPU, MPI_Op op = MPI_SUM, bool forceSync = false);
+
+        template <typename ElemType>
+        void HierarchicalAllReduceData(ElemType* inputData, ElemType* outputData, size_t numElements);
+    };
+
+    ///
+    /// MPI communicator that aggregates dense CPU values in 1, 2, 4 or 8 bits.
+    /// Each value is quantized column-wise with error feedback: the quantization error is kept
+    /// as a residual and added to the value of the next aggregation. The columns are split into one stripe per worker.
+    /// Every worker sums the quantized contributions to its own stripe (reduce-scatter), quantizes the sum again
+    /// with a second residual and sends it to all the other workers (all-gather), so that all workers end up with the same values.
+    /// Values that cannot be split into stripes, and values on the GPU, are aggregated in full precision.
+    ///
+    class CompressedMPICommunicatorImpl final : public MPICommunicatorImpl
+    {
+    public:
+        CompressedMPICommunicatorImpl(size_t numQuantizationBits, bool zeroThresholdFor1Bit, size_t packThresholdSizeInBytes = DEFAULT_PACK_THRESHOLD_SIZE_IN_BYTES);
+
+        virtual void AggregateInPlace(
+            const std::vector<NDArrayViewPtr>& values,
+            const std::unordered_set<DistributedWorkerDescriptor>& sendToWorkers) override;
+
+        virtual void Aggregate(
+            const std::vector<NDArrayViewPtr>& inValues,
+            std::vector<NDArrayViewPtr>& outValues,
+            const std::unordered_set<DistributedWorkerDescriptor>& sendToWorkers) override;
+
+    private:
+        // Per value buffers, kept between aggregations.
+        template <typename ElemType>
+        struct QuantizationState
+        {
+            size_t numRows = 0;
+            size_t numCols = 0;
+
+            // Quantization error of the value, and of the aggregated stripe owned by this worker.
+            std::unique_ptr<Microsoft::MSR::CNTK::Matrix<ElemType>> residual;
+            std::unique_ptr<Microsoft::MSR::CNTK::Matrix<ElemType>> stripeResidual;
+
+            // Sum of all contributions to the stripe owned by this worker.
+            std::unique_ptr<Microsoft::MSR::CNTK::Matrix<ElemType>> stripeSum;
+
+            // The quantized value. After the all-gather it holds the aggregated stripes of all workers.
+            std::unique_ptr<Microsoft::MSR::CNTK::QuantizedMatrix<ElemType>> quantized;
+
+            // Contributions of the other workers to the stripe owned by this worker, one per worker.
+            std::vector<std::unique_ptr<Microsoft::MSR::CNTK::QuantizedMatrix<ElemType>>> received;
+        };
+
+        bool CanQuantize(const NDArrayViewPtr& value);
+
+        // Range [begin, end) of the columns of the stripe owned by the worker.
+        std::pair<size_t, size_t> Stripe(size_t numCols, size_t rank) const
+        {
+            auto numWorkers = m_mpi->NumNodesInUse();
+            return std::make_pair(numCols * rank / numWorkers, numCols * (rank + 1) / numWorkers);
+        }
+
+        template <typename ElemType>
+        void QuantizedAllReduce(const std::vector<NDArrayViewPtr>& values, const std::vector<size_t>& indices,
+            std::vector<std::unique_ptr<QuantizationState<ElemType>>>& states,
+            std::unique_ptr<Microsoft::MSR::CNTK::MatrixQuantizerImpl<ElemType>>& quantizer);
+
+        template <typename ElemType>
+        QuantizationState<ElemType>& GetState(std::vector<std::unique_ptr<QuantizationState<ElemType>>>& states, size_t index, size_t numRows, size_t numCols);
+
+        size_t m_numQuantizationBits;
+        bool m_zeroThresholdFor1Bit;
+
+        // Indexed by the position of the value in the aggregated list.
+        std::vector<std::unique_ptr<QuantizationState<float>>> m_floatStates;
+        std::vector<std::unique_ptr<QuantizationState<double>>> m_doubleStates;
+
+        std::unique_ptr<Microsoft::MSR::CNTK::MatrixQuantizerImpl<float>> m_floatQuantizer;
+        std::unique_ptr<Microsoft::MSR::CNTK::MatrixQuantizerImpl<double>> m_doubleQuantizer;
     };
 }
@@ -0,0 +1,2870 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: CNTK.proto
+
+#include "CNTK.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace CNTK {
+namespace proto {
+PROTOBUF_CONSTEXPR NDShape::NDShape(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.shape_dim_)*/{}
+  , /*decltype(_impl_._shape_dim_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NDShapeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NDShapeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NDShapeDefaultTypeInternal() {}
+  union {
+    NDShape _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NDShapeDefaultTypeInternal _NDShape_default_instance_;
+PROTOBUF_CONSTEXPR Axis::Axis(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.static_axis_idx_)*/0
+  , /*decltype(_impl_.is_ordered_dynamic_axis_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AxisDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AxisDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AxisDefaultTypeInternal() {}
+  union {
+    Axis _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AxisDefaultTypeInternal _Axis_default_instance_;
+PROTOBUF_CONSTEXPR NDArrayView_FloatValues::NDArrayView_FloatValues(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NDArrayView_FloatValuesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NDArrayView_FloatValuesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NDArrayView_FloatValuesDefaultTypeInternal() {}
+  union {
+    NDArrayView_FloatValues _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NDArrayView_FloatValuesDefaultTypeInternal _NDArrayView_FloatValues_default_instance_;
+PROTOBUF_CONSTEXPR NDArrayView_DoubleValues::NDArrayView_DoubleValues(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NDArrayView_DoubleValuesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NDArrayView_DoubleValuesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NDArrayView_DoubleValuesDefaultTypeInternal() {}
+  union {
+    NDArrayView_DoubleValues _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NDArrayView_DoubleValuesDefaultTypeInternal _NDArrayView_DoubleValues_default_instance_;
+PROTOBUF_CONSTEXPR NDArrayView::NDArrayView(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.shape_)*/nullptr
+  , /*decltype(_impl_.data_type_)*/0
+  , /*decltype(_impl_.storage_format_)*/0
+  , /*decltype(_impl_.values_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct NDArrayViewDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NDArrayViewDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NDArrayViewDefaultTypeInternal() {}
+  union {
+    NDArrayView _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NDArrayViewDefaultTypeInternal _NDArrayView_default_instance_;
+PROTOBUF_CONSTEXPR Vector::Vector(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VectorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VectorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VectorDefaultTypeInternal() {}
+  union {
+    Vector _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VectorDefaultTypeInternal _Vector_default_instance_;
+PROTOBUF_CONSTEXPR Dictionary_DataEntry_DoNotUse::Dictionary_DataEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Dictionary_DataEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Dictionary_DataEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Dictionary_DataEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Dictionary_DataEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Dictionary_DataEntry_DoNotUseDefaultTypeInternal _Dictionary_DataEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Dictionary::Dictionary(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DictionaryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DictionaryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DictionaryDefaultTypeInternal() {}
+  union {
+    Dictionary _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DictionaryDefaultTypeInternal _Dictionary_default_instance_;
+PROTOBUF_CONSTEXPR DictionaryValue::DictionaryValue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.value_type_)*/0
+  , /*decltype(_impl_.value_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct DictionaryValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DictionaryValueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DictionaryValueDefaultTypeInternal() {}
+  union {
+    DictionaryValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DictionaryValueDefaultTypeInternal _DictionaryValue_default_instance_;
+}  // namespace proto
+}  // namespace CNTK
+static ::_pb::Metadata file_level_metadata_CNTK_2eproto[9];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_CNTK_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_CNTK_2eproto = nullptr;
+
+const uint32_t TableStruct_CNTK_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::NDShape, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::NDShape, _impl_.shape_dim_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::Axis, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::Axis, _impl_.static_axis_idx_),
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::Axis, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::Axis, _impl_.is_ordered_dynamic_axis_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::NDArrayView_FloatValues, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::NDArrayView_FloatValues, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::NDArrayView_DoubleValues, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::NDArrayView_DoubleValues, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::NDArrayView, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::NDArrayView, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::NDArrayView, _impl_.data_type_),
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::NDArrayView, _impl_.storage_format_),
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::NDArrayView, _impl_.shape_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::NDArrayView, _impl_.values_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::Vector, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::Vector, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::Dictionary_DataEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::Dictionary_DataEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::Dictionary_DataEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::Dictionary_DataEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::Dictionary, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::Dictionary, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::Dictionary, _impl_.data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::DictionaryValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::DictionaryValue, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::DictionaryValue, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::DictionaryValue, _impl_.value_type_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::CNTK::proto::DictionaryValue, _impl_.value_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::CNTK::proto::NDShape)},
+  { 7, -1, -1, sizeof(::CNTK::proto::Axis)},
+  { 16, -1, -1, sizeof(::CNTK::proto::NDArrayView_FloatValues)},
+  { 23, -1, -1, sizeof(::CNTK::proto::NDArrayView_DoubleValues)},
+  { 30, -1, -1, sizeof(::CNTK::proto::NDArrayView)},
+  { 42, -1, -1, sizeof(::CNTK::proto::Vector)},
+  { 49, 57, -1, sizeof(::CNTK::proto::Dictionary_DataEntry_DoNotUse)},
+  { 59, -1, -1, sizeof(::CNTK::proto::Dictionary)},
+  { 67, -1, -1, sizeof(::CNTK::proto::DictionaryValue)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::CNTK::proto::_NDShape_default_instance_._instance,
+  &::CNTK::proto::_Axis_default_instance_._instance,
+  &::CNTK::proto::_NDArrayView_FloatValues_default_instance_._instance,
+  &::CNTK::proto::_NDArrayView_DoubleValues_default_instance_._instance,
+  &::CNTK::proto::_NDArrayView_default_instance_._instance,
+  &::CNTK::proto::_Vector_default_instance_._instance,
+  &::CNTK::proto::_Dictionary_DataEntry_DoNotUse_default_instance_._instance,
+  &::CNTK::proto::_Dictionary_default_instance_._instance,
+  &::CNTK::proto::_DictionaryValue_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_CNTK_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\nCNTK.proto\022\nCNTK.proto\" \n\007NDShape\022\025\n\ts"
+  "hape_dim\030\001 \003(\004B\002\020\001\"N\n\004Axis\022\027\n\017static_axi"
+  "s_idx\030\001 \001(\005\022\014\n\004name\030\002 \001(\t\022\037\n\027is_ordered_"
+  "dynamic_axis\030\003 \001(\010\"\337\003\n\013NDArrayView\0223\n\tda"
+  "ta_type\030\001 \001(\0162 .CNTK.proto.NDArrayView.D"
+  "ataType\022=\n\016storage_format\030\002 \001(\0162%.CNTK.p"
+  "roto.NDArrayView.StorageFormat\022\"\n\005shape\030"
+  "\003 \001(\0132\023.CNTK.proto.NDShape\022;\n\014float_valu"
+  "es\030\004 \001(\0132#.CNTK.proto.NDArrayView.FloatV"
+  "aluesH\000\022=\n\rdouble_values\030\005 \001(\0132$.CNTK.pr"
+  "oto.NDArrayView.DoubleValuesH\000\032 \n\013FloatV"
+  "alues\022\021\n\005value\030\001 \003(\002B\002\020\001\032!\n\014DoubleValues"
+  "\022\021\n\005value\030\001 \003(\001B\002\020\001\".\n\010DataType\022\013\n\007Unkno"
+  "wn\020\000\022\t\n\005Float\020\001\022\n\n\006Double\020\002\"=\n\rStorageFo"
+  "rmat\022\t\n\005Dense\020\000\022\r\n\tSparseCSC\020\001\022\022\n\016Sparse"
+  "BlockCol\020\002B\010\n\006values\"4\n\006Vector\022*\n\005value\030"
+  "\001 \003(\0132\033.CNTK.proto.DictionaryValue\"\227\001\n\nD"
+  "ictionary\022\017\n\007version\030\001 \001(\004\022.\n\004data\030\002 \003(\013"
+  "2 .CNTK.proto.Dictionary.DataEntry\032H\n\tDa"
+  "taEntry\022\013\n\003key\030\001 \001(\t\022*\n\005value\030\002 \001(\0132\033.CN"
+  "TK.proto.DictionaryValue:\0028\001\"\362\004\n\017Diction"
+  "aryValue\022\017\n\007version\030\001 \001(\004\0224\n\nvalue_type\030"
+  "\002 \001(\0162 .CNTK.proto.DictionaryValue.Type\022"
+  "\024\n\nbool_value\030\003 \001(\010H\000\022\023\n\tint_value\030\004 \001(\005"
+  "H\000\022\026\n\014size_t_value\030\005 \001(\004H\000\022\025\n\013float_valu"
+  "e\030\006 \001(\002H\000\022\026\n\014double_value\030\007 \001(\001H\000\022\026\n\014str"
+  "ing_value\030\010 \001(\tH\000\022-\n\016nd_shape_value\030\t \001("
+  "\0132\023.CNTK.proto.NDShapeH\000\022&\n\naxis_value\030\n"
+  " \001(\0132\020.CNTK.proto.AxisH\000\022*\n\014vector_value"
+  "\030\013 \001(\0132\022.CNTK.proto.VectorH\000\0222\n\020dictiona"
+  "ry_value\030\014 \001(\0132\026.CNTK.proto.DictionaryH\000"
+  "\0226\n\023nd_array_view_value\030\r \001(\0132\027.CNTK.pro"
+  "to.NDArrayViewH\000\"\225\001\n\004Type\022\010\n\004None\020\000\022\010\n\004B"
+  "ool\020\001\022\007\n\003Int\020\002\022\t\n\005SizeT\020\003\022\t\n\005Float\020\004\022\n\n\006"
+  "Double\020\005\022\n\n\006String\020\006\022\013\n\007NDShape\020\007\022\010\n\004Axi"
+  "s\020\010\022\n\n\006Vector\020\t\022\016\n\nDictionary\020\n\022\017\n\013NDArr"
+  "ayView\020\013B\007\n\005valueB\003\370\001\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_CNTK_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_CNTK_2eproto = {
+    false, false, 1470, descriptor_table_protodef_CNTK_2eproto,
+    "CNTK.proto",
+    &descriptor_table_CNTK_2eproto_once, nullptr, 0, 9,
+    schemas, file_default_instances, TableStruct_CNTK_2eproto::offsets,
+    file_level_metadata_CNTK_2eproto, file_level_enum_descriptors_CNTK_2eproto,
+    file_level_service_descriptors_CNTK_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_CNTK_2eproto_getter() {
+  return &descriptor_table_CNTK_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_CNTK_2eproto(&descriptor_table_CNTK_2eproto);
+namespace CNTK {
+namespace proto {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* NDArrayView_DataType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_CNTK_2eproto);
+  return file_level_enum_descriptors_CNTK_2eproto[0];
+}
+bool NDArrayView_DataType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr NDArrayView_DataType NDArrayView::Unknown;
+constexpr NDArrayView_DataType NDArrayView::Float;
+constexpr NDArrayView_DataType NDArrayView::Double;
+constexpr NDArrayView_DataType NDArrayView::DataType_MIN;
+constexpr NDArrayView_DataType NDArrayView::DataType_MAX;
+constexpr int NDArrayView::DataType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* NDArrayView_StorageFormat_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_CNTK_2eproto);
+  return file_level_enum_descriptors_CNTK_2eproto[1];
+}
+bool NDArrayView_StorageFormat_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr NDArrayView_StorageFormat NDArrayView::Dense;
+constexpr NDArrayView_StorageFormat NDArrayView::SparseCSC;
+constexpr NDArrayView_StorageFormat NDArrayView::SparseBlockCol;
+constexpr NDArrayView_StorageFormat NDArrayView::StorageFormat_MIN;
+constexpr NDArrayView_StorageFormat NDArrayView::StorageFormat_MAX;
+constexpr int NDArrayView::StorageFormat_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DictionaryValue_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_CNTK_2eproto);
+  return file_level_enum_descriptors_CNTK_2eproto[2];
+}
+bool DictionaryValue_Type_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr DictionaryValue_Type DictionaryValue::None;
+constexpr DictionaryValue_Type DictionaryValue::Bool;
+constexpr DictionaryValue_Type DictionaryValue::Int;
+constexpr DictionaryValue_Type DictionaryValue::SizeT;
+constexpr DictionaryValue_Type DictionaryValue::Float;
+constexpr DictionaryValue_Type DictionaryValue::Double;
+constexpr DictionaryValue_Type DictionaryValue::String;
+constexpr DictionaryValue_Type DictionaryValue::NDShape;
+constexpr DictionaryValue_Type DictionaryValue::Axis;
+constexpr DictionaryValue_Type DictionaryValue::Vector;
+constexpr DictionaryValue_Type DictionaryValue::Dictionary;
+constexpr DictionaryValue_Type DictionaryValue::NDArrayView;
+constexpr DictionaryValue_Type DictionaryValue::Type_MIN;
+constexpr DictionaryValue_Type DictionaryValue::Type_MAX;
+constexpr int DictionaryValue::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class NDShape::_Internal {
+ public:
+};
+
+NDShape::NDShape(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CNTK.proto.NDShape)
+}
+NDShape::NDShape(const NDShape& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NDShape* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.shape_dim_){from._impl_.shape_dim_}
+    , /*decltype(_impl_._shape_dim_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CNTK.proto.NDShape)
+}
+
+inline void NDShape::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.shape_dim_){arena}
+    , /*decltype(_impl_._shape_dim_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+NDShape::~NDShape() {
+  // @@protoc_insertion_point(destructor:CNTK.proto.NDShape)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NDShape::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.shape_dim_.~RepeatedField();
+}
+
+void NDShape::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NDShape::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNTK.proto.NDShape)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.shape_dim_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NDShape::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint64 shape_dim = 1 [packed = true];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_shape_dim(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_shape_dim(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NDShape::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNTK.proto.NDShape)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint64 shape_dim = 1 [packed = true];
+  {
+    int byte_size = _impl_._shape_dim_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          1, _internal_shape_dim(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNTK.proto.NDShape)
+  return target;
+}
+
+size_t NDShape::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNTK.proto.NDShape)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 shape_dim = 1 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.shape_dim_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._shape_dim_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NDShape::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NDShape::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NDShape::GetClassData() const { return &_class_data_; }
+
+
+void NDShape::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NDShape*>(&to_msg);
+  auto& from = static_cast<const NDShape&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNTK.proto.NDShape)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.shape_dim_.MergeFrom(from._impl_.shape_dim_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NDShape::CopyFrom(const NDShape& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNTK.proto.NDShape)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NDShape::IsInitialized() const {
+  return true;
+}
+
+void NDShape::InternalSwap(NDShape* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.shape_dim_.InternalSwap(&other->_impl_.shape_dim_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NDShape::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CNTK_2eproto_getter, &descriptor_table_CNTK_2eproto_once,
+      file_level_metadata_CNTK_2eproto[0]);
+}
+
+// ===================================================================
+
+class Axis::_Internal {
+ public:
+};
+
+Axis::Axis(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CNTK.proto.Axis)
+}
+Axis::Axis(const Axis& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Axis* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.static_axis_idx_){}
+    , decltype(_impl_.is_ordered_dynamic_axis_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.static_axis_idx_, &from._impl_.static_axis_idx_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_ordered_dynamic_axis_) -
+    reinterpret_cast<char*>(&_impl_.static_axis_idx_)) + sizeof(_impl_.is_ordered_dynamic_axis_));
+  // @@protoc_insertion_point(copy_constructor:CNTK.proto.Axis)
+}
+
+inline void Axis::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.static_axis_idx_){0}
+    , decltype(_impl_.is_ordered_dynamic_axis_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Axis::~Axis() {
+  // @@protoc_insertion_point(destructor:CNTK.proto.Axis)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Axis::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void Axis::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Axis::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNTK.proto.Axis)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.static_axis_idx_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.is_ordered_dynamic_axis_) -
+      reinterpret_cast<char*>(&_impl_.static_axis_idx_)) + sizeof(_impl_.is_ordered_dynamic_axis_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Axis::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 static_axis_idx = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.static_axis_idx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "CNTK.proto.Axis.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool is_ordered_dynamic_axis = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.is_ordered_dynamic_axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Axis::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNTK.proto.Axis)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 static_axis_idx = 1;
+  if (this->_internal_static_axis_idx() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_static_axis_idx(), target);
+  }
+
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "CNTK.proto.Axis.name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
+  }
+
+  // bool is_ordered_dynamic_axis = 3;
+  if (this->_internal_is_ordered_dynamic_axis() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_is_ordered_dynamic_axis(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNTK.proto.Axis)
+  return target;
+}
+
+size_t Axis::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNTK.proto.Axis)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // int32 static_axis_idx = 1;
+  if (this->_internal_static_axis_idx() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_static_axis_idx());
+  }
+
+  // bool is_ordered_dynamic_axis = 3;
+  if (this->_internal_is_ordered_dynamic_axis() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Axis::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Axis::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Axis::GetClassData() const { return &_class_data_; }
+
+
+void Axis::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Axis*>(&to_msg);
+  auto& from = static_cast<const Axis&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNTK.proto.Axis)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_static_axis_idx() != 0) {
+    _this->_internal_set_static_axis_idx(from._internal_static_axis_idx());
+  }
+  if (from._internal_is_ordered_dynamic_axis() != 0) {
+    _this->_internal_set_is_ordered_dynamic_axis(from._internal_is_ordered_dynamic_axis());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Axis::CopyFrom(const Axis& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNTK.proto.Axis)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Axis::IsInitialized() const {
+  return true;
+}
+
+void Axis::InternalSwap(Axis* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Axis, _impl_.is_ordered_dynamic_axis_)
+      + sizeof(Axis::_impl_.is_ordered_dynamic_axis_)
+      - PROTOBUF_FIELD_OFFSET(Axis, _impl_.static_axis_idx_)>(
+          reinterpret_cast<char*>(&_impl_.static_axis_idx_),
+          reinterpret_cast<char*>(&other->_impl_.static_axis_idx_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Axis::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CNTK_2eproto_getter, &descriptor_table_CNTK_2eproto_once,
+      file_level_metadata_CNTK_2eproto[1]);
+}
+
+// ===================================================================
+
+class NDArrayView_FloatValues::_Internal {
+ public:
+};
+
+NDArrayView_FloatValues::NDArrayView_FloatValues(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CNTK.proto.NDArrayView.FloatValues)
+}
+NDArrayView_FloatValues::NDArrayView_FloatValues(const NDArrayView_FloatValues& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NDArrayView_FloatValues* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){from._impl_.value_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CNTK.proto.NDArrayView.FloatValues)
+}
+
+inline void NDArrayView_FloatValues::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+NDArrayView_FloatValues::~NDArrayView_FloatValues() {
+  // @@protoc_insertion_point(destructor:CNTK.proto.NDArrayView.FloatValues)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NDArrayView_FloatValues::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.~RepeatedField();
+}
+
+void NDArrayView_FloatValues::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NDArrayView_FloatValues::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNTK.proto.NDArrayView.FloatValues)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NDArrayView_FloatValues::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated float value = 1 [packed = true];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_value(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 13) {
+          _internal_add_value(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NDArrayView_FloatValues::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNTK.proto.NDArrayView.FloatValues)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated float value = 1 [packed = true];
+  if (this->_internal_value_size() > 0) {
+    target = stream->WriteFixedPacked(1, _internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNTK.proto.NDArrayView.FloatValues)
+  return target;
+}
+
+size_t NDArrayView_FloatValues::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNTK.proto.NDArrayView.FloatValues)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float value = 1 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_value_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NDArrayView_FloatValues::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NDArrayView_FloatValues::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NDArrayView_FloatValues::GetClassData() const { return &_class_data_; }
+
+
+void NDArrayView_FloatValues::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NDArrayView_FloatValues*>(&to_msg);
+  auto& from = static_cast<const NDArrayView_FloatValues&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNTK.proto.NDArrayView.FloatValues)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.value_.MergeFrom(from._impl_.value_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NDArrayView_FloatValues::CopyFrom(const NDArrayView_FloatValues& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNTK.proto.NDArrayView.FloatValues)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NDArrayView_FloatValues::IsInitialized() const {
+  return true;
+}
+
+void NDArrayView_FloatValues::InternalSwap(NDArrayView_FloatValues* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.value_.InternalSwap(&other->_impl_.value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NDArrayView_FloatValues::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CNTK_2eproto_getter, &descriptor_table_CNTK_2eproto_once,
+      file_level_metadata_CNTK_2eproto[2]);
+}
+
+// ===================================================================
+
+class NDArrayView_DoubleValues::_Internal {
+ public:
+};
+
+NDArrayView_DoubleValues::NDArrayView_DoubleValues(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CNTK.proto.NDArrayView.DoubleValues)
+}
+NDArrayView_DoubleValues::NDArrayView_DoubleValues(const NDArrayView_DoubleValues& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NDArrayView_DoubleValues* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){from._impl_.value_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CNTK.proto.NDArrayView.DoubleValues)
+}
+
+inline void NDArrayView_DoubleValues::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+NDArrayView_DoubleValues::~NDArrayView_DoubleValues() {
+  // @@protoc_insertion_point(destructor:CNTK.proto.NDArrayView.DoubleValues)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NDArrayView_DoubleValues::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.~RepeatedField();
+}
+
+void NDArrayView_DoubleValues::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NDArrayView_DoubleValues::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNTK.proto.NDArrayView.DoubleValues)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NDArrayView_DoubleValues::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated double value = 1 [packed = true];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_value(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 9) {
+          _internal_add_value(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NDArrayView_DoubleValues::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNTK.proto.NDArrayView.DoubleValues)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated double value = 1 [packed = true];
+  if (this->_internal_value_size() > 0) {
+    target = stream->WriteFixedPacked(1, _internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNTK.proto.NDArrayView.DoubleValues)
+  return target;
+}
+
+size_t NDArrayView_DoubleValues::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNTK.proto.NDArrayView.DoubleValues)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated double value = 1 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_value_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NDArrayView_DoubleValues::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NDArrayView_DoubleValues::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NDArrayView_DoubleValues::GetClassData() const { return &_class_data_; }
+
+
+void NDArrayView_DoubleValues::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NDArrayView_DoubleValues*>(&to_msg);
+  auto& from = static_cast<const NDArrayView_DoubleValues&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNTK.proto.NDArrayView.DoubleValues)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.value_.MergeFrom(from._impl_.value_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NDArrayView_DoubleValues::CopyFrom(const NDArrayView_DoubleValues& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNTK.proto.NDArrayView.DoubleValues)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NDArrayView_DoubleValues::IsInitialized() const {
+  return true;
+}
+
+void NDArrayView_DoubleValues::InternalSwap(NDArrayView_DoubleValues* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.value_.InternalSwap(&other->_impl_.value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NDArrayView_DoubleValues::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CNTK_2eproto_getter, &descriptor_table_CNTK_2eproto_once,
+      file_level_metadata_CNTK_2eproto[3]);
+}
+
+// ===================================================================
+
+class NDArrayView::_Internal {
+ public:
+  static const ::CNTK::proto::NDShape& shape(const NDArrayView* msg);
+  static const ::CNTK::proto::NDArrayView_FloatValues& float_values(const NDArrayView* msg);
+  static const ::CNTK::proto::NDArrayView_DoubleValues& double_values(const NDArrayView* msg);
+};
+
+const ::CNTK::proto::NDShape&
+NDArrayView::_Internal::shape(const NDArrayView* msg) {
+  return *msg->_impl_.shape_;
+}
+const ::CNTK::proto::NDArrayView_FloatValues&
+NDArrayView::_Internal::float_values(const NDArrayView* msg) {
+  return *msg->_impl_.values_.float_values_;
+}
+const ::CNTK::proto::NDArrayView_DoubleValues&
+NDArrayView::_Internal::double_values(const NDArrayView* msg) {
+  return *msg->_impl_.values_.double_values_;
+}
+void NDArrayView::set_allocated_float_values(::CNTK::proto::NDArrayView_FloatValues* float_values) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_values();
+  if (float_values) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(float_values);
+    if (message_arena != submessage_arena) {
+      float_values = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, float_values, submessage_arena);
+    }
+    set_has_float_values();
+    _impl_.values_.float_values_ = float_values;
+  }
+  // @@protoc_insertion_point(field_set_allocated:CNTK.proto.NDArrayView.float_values)
+}
+void NDArrayView::set_allocated_double_values(::CNTK::proto::NDArrayView_DoubleValues* double_values) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_values();
+  if (double_values) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(double_values);
+    if (message_arena != submessage_arena) {
+      double_values = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, double_values, submessage_arena);
+    }
+    set_has_double_values();
+    _impl_.values_.double_values_ = double_values;
+  }
+  // @@protoc_insertion_point(field_set_allocated:CNTK.proto.NDArrayView.double_values)
+}
+NDArrayView::NDArrayView(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CNTK.proto.NDArrayView)
+}
+NDArrayView::NDArrayView(const NDArrayView& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NDArrayView* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.shape_){nullptr}
+    , decltype(_impl_.data_type_){}
+    , decltype(_impl_.storage_format_){}
+    , decltype(_impl_.values_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_shape()) {
+    _this->_impl_.shape_ = new ::CNTK::proto::NDShape(*from._impl_.shape_);
+  }
+  ::memcpy(&_impl_.data_type_, &from._impl_.data_type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.storage_format_) -
+    reinterpret_cast<char*>(&_impl_.data_type_)) + sizeof(_impl_.storage_format_));
+  clear_has_values();
+  switch (from.values_case()) {
+    case kFloatValues: {
+      _this->_internal_mutable_float_values()->::CNTK::proto::NDArrayView_FloatValues::MergeFrom(
+          from._internal_float_values());
+      break;
+    }
+    case kDoubleValues: {
+      _this->_internal_mutable_double_values()->::CNTK::proto::NDArrayView_DoubleValues::MergeFrom(
+          from._internal_double_values());
+      break;
+    }
+    case VALUES_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:CNTK.proto.NDArrayView)
+}
+
+inline void NDArrayView::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.shape_){nullptr}
+    , decltype(_impl_.data_type_){0}
+    , decltype(_impl_.storage_format_){0}
+    , decltype(_impl_.values_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_values();
+}
+
+NDArrayView::~NDArrayView() {
+  // @@protoc_insertion_point(destructor:CNTK.proto.NDArrayView)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NDArrayView::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.shape_;
+  if (has_values()) {
+    clear_values();
+  }
+}
+
+void NDArrayView::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NDArrayView::clear_values() {
+// @@protoc_insertion_point(one_of_clear_start:CNTK.proto.NDArrayView)
+  switch (values_case()) {
+    case kFloatValues: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.values_.float_values_;
+      }
+      break;
+    }
+    case kDoubleValues: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.values_.double_values_;
+      }
+      break;
+    }
+    case VALUES_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = VALUES_NOT_SET;
+}
+
+
+void NDArrayView::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNTK.proto.NDArrayView)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.shape_ != nullptr) {
+    delete _impl_.shape_;
+  }
+  _impl_.shape_ = nullptr;
+  ::memset(&_impl_.data_type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.storage_format_) -
+      reinterpret_cast<char*>(&_impl_.data_type_)) + sizeof(_impl_.storage_format_));
+  clear_values();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NDArrayView::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .CNTK.proto.NDArrayView.DataType data_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_data_type(static_cast<::CNTK::proto::NDArrayView_DataType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .CNTK.proto.NDArrayView.StorageFormat storage_format = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_storage_format(static_cast<::CNTK::proto::NDArrayView_StorageFormat>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .CNTK.proto.NDShape shape = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_shape(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CNTK.proto.NDArrayView.FloatValues float_values = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_float_values(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CNTK.proto.NDArrayView.DoubleValues double_values = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_double_values(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NDArrayView::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNTK.proto.NDArrayView)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .CNTK.proto.NDArrayView.DataType data_type = 1;
+  if (this->_internal_data_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_data_type(), target);
+  }
+
+  // .CNTK.proto.NDArrayView.StorageFormat storage_format = 2;
+  if (this->_internal_storage_format() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_storage_format(), target);
+  }
+
+  // .CNTK.proto.NDShape shape = 3;
+  if (this->_internal_has_shape()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::shape(this),
+        _Internal::shape(this).GetCachedSize(), target, stream);
+  }
+
+  // .CNTK.proto.NDArrayView.FloatValues float_values = 4;
+  if (_internal_has_float_values()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::float_values(this),
+        _Internal::float_values(this).GetCachedSize(), target, stream);
+  }
+
+  // .CNTK.proto.NDArrayView.DoubleValues double_values = 5;
+  if (_internal_has_double_values()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::double_values(this),
+        _Internal::double_values(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNTK.proto.NDArrayView)
+  return target;
+}
+
+size_t NDArrayView::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNTK.proto.NDArrayView)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .CNTK.proto.NDShape shape = 3;
+  if (this->_internal_has_shape()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.shape_);
+  }
+
+  // .CNTK.proto.NDArrayView.DataType data_type = 1;
+  if (this->_internal_data_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_data_type());
+  }
+
+  // .CNTK.proto.NDArrayView.StorageFormat storage_format = 2;
+  if (this->_internal_storage_format() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_storage_format());
+  }
+
+  switch (values_case()) {
+    // .CNTK.proto.NDArrayView.FloatValues float_values = 4;
+    case kFloatValues: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.values_.float_values_);
+      break;
+    }
+    // .CNTK.proto.NDArrayView.DoubleValues double_values = 5;
+    case kDoubleValues: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.values_.double_values_);
+      break;
+    }
+    case VALUES_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NDArrayView::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NDArrayView::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NDArrayView::GetClassData() const { return &_class_data_; }
+
+
+void NDArrayView::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NDArrayView*>(&to_msg);
+  auto& from = static_cast<const NDArrayView&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNTK.proto.NDArrayView)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_shape()) {
+    _this->_internal_mutable_shape()->::CNTK::proto::NDShape::MergeFrom(
+        from._internal_shape());
+  }
+  if (from._internal_data_type() != 0) {
+    _this->_internal_set_data_type(from._internal_data_type());
+  }
+  if (from._internal_storage_format() != 0) {
+    _this->_internal_set_storage_format(from._internal_storage_format());
+  }
+  switch (from.values_case()) {
+    case kFloatValues: {
+      _this->_internal_mutable_float_values()->::CNTK::proto::NDArrayView_FloatValues::MergeFrom(
+          from._internal_float_values());
+      break;
+    }
+    case kDoubleValues: {
+      _this->_internal_mutable_double_values()->::CNTK::proto::NDArrayView_DoubleValues::MergeFrom(
+          from._internal_double_values());
+      break;
+    }
+    case VALUES_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NDArrayView::CopyFrom(const NDArrayView& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNTK.proto.NDArrayView)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NDArrayView::IsInitialized() const {
+  return true;
+}
+
+void NDArrayView::InternalSwap(NDArrayView* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NDArrayView, _impl_.storage_format_)
+      + sizeof(NDArrayView::_impl_.storage_format_)
+      - PROTOBUF_FIELD_OFFSET(NDArrayView, _impl_.shape_)>(
+          reinterpret_cast<char*>(&_impl_.shape_),
+          reinterpret_cast<char*>(&other->_impl_.shape_));
+  swap(_impl_.values_, other->_impl_.values_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NDArrayView::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CNTK_2eproto_getter, &descriptor_table_CNTK_2eproto_once,
+      file_level_metadata_CNTK_2eproto[4]);
+}
+
+// ===================================================================
+
+class Vector::_Internal {
+ public:
+};
+
+Vector::Vector(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CNTK.proto.Vector)
+}
+Vector::Vector(const Vector& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Vector* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){from._impl_.value_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CNTK.proto.Vector)
+}
+
+inline void Vector::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Vector::~Vector() {
+  // @@protoc_insertion_point(destructor:CNTK.proto.Vector)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Vector::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.~RepeatedPtrField();
+}
+
+void Vector::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Vector::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNTK.proto.Vector)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Vector::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .CNTK.proto.DictionaryValue value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Vector::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNTK.proto.Vector)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .CNTK.proto.DictionaryValue value = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_value_size()); i < n; i++) {
+    const auto& repfield = this->_internal_value(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNTK.proto.Vector)
+  return target;
+}
+
+size_t Vector::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNTK.proto.Vector)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CNTK.proto.DictionaryValue value = 1;
+  total_size += 1UL * this->_internal_value_size();
+  for (const auto& msg : this->_impl_.value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Vector::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Vector::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Vector::GetClassData() const { return &_class_data_; }
+
+
+void Vector::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Vector*>(&to_msg);
+  auto& from = static_cast<const Vector&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNTK.proto.Vector)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.value_.MergeFrom(from._impl_.value_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Vector::CopyFrom(const Vector& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNTK.proto.Vector)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Vector::IsInitialized() const {
+  return true;
+}
+
+void Vector::InternalSwap(Vector* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.value_.InternalSwap(&other->_impl_.value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Vector::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CNTK_2eproto_getter, &descriptor_table_CNTK_2eproto_once,
+      file_level_metadata_CNTK_2eproto[5]);
+}
+
+// ===================================================================
+
+Dictionary_DataEntry_DoNotUse::Dictionary_DataEntry_DoNotUse() {}
+Dictionary_DataEntry_DoNotUse::Dictionary_DataEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Dictionary_DataEntry_DoNotUse::MergeFrom(const Dictionary_DataEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Dictionary_DataEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CNTK_2eproto_getter, &descriptor_table_CNTK_2eproto_once,
+      file_level_metadata_CNTK_2eproto[6]);
+}
+
+// ===================================================================
+
+class Dictionary::_Internal {
+ public:
+};
+
+Dictionary::Dictionary(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &Dictionary::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:CNTK.proto.Dictionary)
+}
+Dictionary::Dictionary(const Dictionary& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Dictionary* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.data_)*/{}
+    , decltype(_impl_.version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.data_.MergeFrom(from._impl_.data_);
+  _this->_impl_.version_ = from._impl_.version_;
+  // @@protoc_insertion_point(copy_constructor:CNTK.proto.Dictionary)
+}
+
+inline void Dictionary::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.data_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Dictionary::~Dictionary() {
+  // @@protoc_insertion_point(destructor:CNTK.proto.Dictionary)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Dictionary::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destruct();
+  _impl_.data_.~MapField();
+}
+
+void Dictionary::ArenaDtor(void* object) {
+  Dictionary* _this = reinterpret_cast< Dictionary* >(object);
+  _this->_impl_.data_.Destruct();
+}
+void Dictionary::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Dictionary::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNTK.proto.Dictionary)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.Clear();
+  _impl_.version_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Dictionary::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, .CNTK.proto.DictionaryValue> data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.data_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Dictionary::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNTK.proto.Dictionary)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 version = 1;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_version(), target);
+  }
+
+  // map<string, .CNTK.proto.DictionaryValue> data = 2;
+  if (!this->_internal_data().empty()) {
+    using MapType = ::_pb::Map<std::string, ::CNTK::proto::DictionaryValue>;
+    using WireHelper = Dictionary_DataEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_data();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "CNTK.proto.Dictionary.DataEntry.key");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNTK.proto.Dictionary)
+  return target;
+}
+
+size_t Dictionary::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNTK.proto.Dictionary)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, .CNTK.proto.DictionaryValue> data = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_data_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::CNTK::proto::DictionaryValue >::const_iterator
+      it = this->_internal_data().begin();
+      it != this->_internal_data().end(); ++it) {
+    total_size += Dictionary_DataEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // uint64 version = 1;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Dictionary::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Dictionary::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Dictionary::GetClassData() const { return &_class_data_; }
+
+
+void Dictionary::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Dictionary*>(&to_msg);
+  auto& from = static_cast<const Dictionary&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNTK.proto.Dictionary)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.data_.MergeFrom(from._impl_.data_);
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Dictionary::CopyFrom(const Dictionary& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNTK.proto.Dictionary)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Dictionary::IsInitialized() const {
+  return true;
+}
+
+void Dictionary::InternalSwap(Dictionary* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.data_.InternalSwap(&other->_impl_.data_);
+  swap(_impl_.version_, other->_impl_.version_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Dictionary::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CNTK_2eproto_getter, &descriptor_table_CNTK_2eproto_once,
+      file_level_metadata_CNTK_2eproto[7]);
+}
+
+// ===================================================================
+
+class DictionaryValue::_Internal {
+ public:
+  static const ::CNTK::proto::NDShape& nd_shape_value(const DictionaryValue* msg);
+  static const ::CNTK::proto::Axis& axis_value(const DictionaryValue* msg);
+  static const ::CNTK::proto::Vector& vector_value(const DictionaryValue* msg);
+  static const ::CNTK::proto::Dictionary& dictionary_value(const DictionaryValue* msg);
+  static const ::CNTK::proto::NDArrayView& nd_array_view_value(const DictionaryValue* msg);
+};
+
+const ::CNTK::proto::NDShape&
+DictionaryValue::_Internal::nd_shape_value(const DictionaryValue* msg) {
+  return *msg->_impl_.value_.nd_shape_value_;
+}
+const ::CNTK::proto::Axis&
+DictionaryValue::_Internal::axis_value(const DictionaryValue* msg) {
+  return *msg->_impl_.value_.axis_value_;
+}
+const ::CNTK::proto::Vector&
+DictionaryValue::_Internal::vector_value(const DictionaryValue* msg) {
+  return *msg->_impl_.value_.vector_value_;
+}
+const ::CNTK::proto::Dictionary&
+DictionaryValue::_Internal::dictionary_value(const DictionaryValue* msg) {
+  return *msg->_impl_.value_.dictionary_value_;
+}
+const ::CNTK::proto::NDArrayView&
+DictionaryValue::_Internal::nd_array_view_value(const DictionaryValue* msg) {
+  return *msg->_impl_.value_.nd_array_view_value_;
+}
+void DictionaryValue::set_allocated_nd_shape_value(::CNTK::proto::NDShape* nd_shape_value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (nd_shape_value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(nd_shape_value);
+    if (message_arena != submessage_arena) {
+      nd_shape_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, nd_shape_value, submessage_arena);
+    }
+    set_has_nd_shape_value();
+    _impl_.value_.nd_shape_value_ = nd_shape_value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:CNTK.proto.DictionaryValue.nd_shape_value)
+}
+void DictionaryValue::set_allocated_axis_value(::CNTK::proto::Axis* axis_value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (axis_value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(axis_value);
+    if (message_arena != submessage_arena) {
+      axis_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, axis_value, submessage_arena);
+    }
+    set_has_axis_value();
+    _impl_.value_.axis_value_ = axis_value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:CNTK.proto.DictionaryValue.axis_value)
+}
+void DictionaryValue::set_allocated_vector_value(::CNTK::proto::Vector* vector_value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (vector_value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(vector_value);
+    if (message_arena != submessage_arena) {
+      vector_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, vector_value, submessage_arena);
+    }
+    set_has_vector_value();
+    _impl_.value_.vector_value_ = vector_value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:CNTK.proto.DictionaryValue.vector_value)
+}
+void DictionaryValue::set_allocated_dictionary_value(::CNTK::proto::Dictionary* dictionary_value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (dictionary_value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dictionary_value);
+    if (message_arena != submessage_arena) {
+      dictionary_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dictionary_value, submessage_arena);
+    }
+    set_has_dictionary_value();
+    _impl_.value_.dictionary_value_ = dictionary_value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:CNTK.proto.DictionaryValue.dictionary_value)
+}
+void DictionaryValue::set_allocated_nd_array_view_value(::CNTK::proto::NDArrayView* nd_array_view_value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (nd_array_view_value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(nd_array_view_value);
+    if (message_arena != submessage_arena) {
+      nd_array_view_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, nd_array_view_value, submessage_arena);
+    }
+    set_has_nd_array_view_value();
+    _impl_.value_.nd_array_view_value_ = nd_array_view_value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:CNTK.proto.DictionaryValue.nd_array_view_value)
+}
+DictionaryValue::DictionaryValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CNTK.proto.DictionaryValue)
+}
+DictionaryValue::DictionaryValue(const DictionaryValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DictionaryValue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.version_){}
+    , decltype(_impl_.value_type_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.value_type_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.value_type_));
+  clear_has_value();
+  switch (from.value_case()) {
+    case kBoolValue: {
+      _this->_internal_set_bool_value(from._internal_bool_value());
+      break;
+    }
+    case kIntValue: {
+      _this->_internal_set_int_value(from._internal_int_value());
+      break;
+    }
+    case kSizeTValue: {
+      _this->_internal_set_size_t_value(from._internal_size_t_value());
+      break;
+    }
+    case kFloatValue: {
+      _this->_internal_set_float_value(from._internal_float_value());
+      break;
+    }
+    case kDoubleValue: {
+      _this->_internal_set_double_value(from._internal_double_value());
+      break;
+    }
+    case kStringValue: {
+      _this->_internal_set_string_value(from._internal_string_value());
+      break;
+    }
+    case kNdShapeValue: {
+      _this->_internal_mutable_nd_shape_value()->::CNTK::proto::NDShape::MergeFrom(
+          from._internal_nd_shape_value());
+      break;
+    }
+    case kAxisValue: {
+      _this->_internal_mutable_axis_value()->::CNTK::proto::Axis::MergeFrom(
+          from._internal_axis_value());
+      break;
+    }
+    case kVectorValue: {
+      _this->_internal_mutable_vector_value()->::CNTK::proto::Vector::MergeFrom(
+          from._internal_vector_value());
+      break;
+    }
+    case kDictionaryValue: {
+      _this->_internal_mutable_dictionary_value()->::CNTK::proto::Dictionary::MergeFrom(
+          from._internal_dictionary_value());
+      break;
+    }
+    case kNdArrayViewValue: {
+      _this->_internal_mutable_nd_array_view_value()->::CNTK::proto::NDArrayView::MergeFrom(
+          from._internal_nd_array_view_value());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:CNTK.proto.DictionaryValue)
+}
+
+inline void DictionaryValue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.value_type_){0}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_value();
+}
+
+DictionaryValue::~DictionaryValue() {
+  // @@protoc_insertion_point(destructor:CNTK.proto.DictionaryValue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DictionaryValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_value()) {
+    clear_value();
+  }
+}
+
+void DictionaryValue::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DictionaryValue::clear_value() {
+// @@protoc_insertion_point(one_of_clear_start:CNTK.proto.DictionaryValue)
+  switch (value_case()) {
+    case kBoolValue: {
+      // No need to clear
+      break;
+    }
+    case kIntValue: {
+      // No need to clear
+      break;
+    }
+    case kSizeTValue: {
+      // No need to clear
+      break;
+    }
+    case kFloatValue: {
+      // No need to clear
+      break;
+    }
+    case kDoubleValue: {
+      // No need to clear
+      break;
+    }
+    case kStringValue: {
+      _impl_.value_.string_value_.Destroy();
+      break;
+    }
+    case kNdShapeValue: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.nd_shape_value_;
+      }
+      break;
+    }
+    case kAxisValue: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.axis_value_;
+      }
+      break;
+    }
+    case kVectorValue: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.vector_value_;
+      }
+      break;
+    }
+    case kDictionaryValue: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.dictionary_value_;
+      }
+      break;
+    }
+    case kNdArrayViewValue: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.nd_array_view_value_;
+      }
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
+}
+
+
+void DictionaryValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNTK.proto.DictionaryValue)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.value_type_) -
+      reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.value_type_));
+  clear_value();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DictionaryValue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CNTK.proto.DictionaryValue.Type value_type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_value_type(static_cast<::CNTK::proto::DictionaryValue_Type>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool bool_value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _internal_set_bool_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 int_value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _internal_set_int_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 size_t_value = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _internal_set_size_t_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float float_value = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _internal_set_float_value(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // double double_value = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _internal_set_double_value(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // string string_value = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_string_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "CNTK.proto.DictionaryValue.string_value"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .CNTK.proto.NDShape nd_shape_value = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_nd_shape_value(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CNTK.proto.Axis axis_value = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_axis_value(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CNTK.proto.Vector vector_value = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_vector_value(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CNTK.proto.Dictionary dictionary_value = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_dictionary_value(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CNTK.proto.NDArrayView nd_array_view_value = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_nd_array_view_value(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DictionaryValue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNTK.proto.DictionaryValue)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 version = 1;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_version(), target);
+  }
+
+  // .CNTK.proto.DictionaryValue.Type value_type = 2;
+  if (this->_internal_value_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_value_type(), target);
+  }
+
+  // bool bool_value = 3;
+  if (_internal_has_bool_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_bool_value(), target);
+  }
+
+  // int32 int_value = 4;
+  if (_internal_has_int_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_int_value(), target);
+  }
+
+  // uint64 size_t_value = 5;
+  if (_internal_has_size_t_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_size_t_value(), target);
+  }
+
+  // float float_value = 6;
+  if (_internal_has_float_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_float_value(), target);
+  }
+
+  // double double_value = 7;
+  if (_internal_has_double_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_double_value(), target);
+  }
+
+  // string string_value = 8;
+  if (_internal_has_string_value()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_string_value().data(), static_cast<int>(this->_internal_string_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "CNTK.proto.DictionaryValue.string_value");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_string_value(), target);
+  }
+
+  // .CNTK.proto.NDShape nd_shape_value = 9;
+  if (_internal_has_nd_shape_value()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::nd_shape_value(this),
+        _Internal::nd_shape_value(this).GetCachedSize(), target, stream);
+  }
+
+  // .CNTK.proto.Axis axis_value = 10;
+  if (_internal_has_axis_value()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::axis_value(this),
+        _Internal::axis_value(this).GetCachedSize(), target, stream);
+  }
+
+  // .CNTK.proto.Vector vector_value = 11;
+  if (_internal_has_vector_value()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::vector_value(this),
+        _Internal::vector_value(this).GetCachedSize(), target, stream);
+  }
+
+  // .CNTK.proto.Dictionary dictionary_value = 12;
+  if (_internal_has_dictionary_value()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::dictionary_value(this),
+        _Internal::dictionary_value(this).GetCachedSize(), target, stream);
+  }
+
+  // .CNTK.proto.NDArrayView nd_array_view_value = 13;
+  if (_internal_has_nd_array_view_value()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, _Internal::nd_array_view_value(this),
+        _Internal::nd_array_view_value(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNTK.proto.DictionaryValue)
+  return target;
+}
+
+size_t DictionaryValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNTK.proto.DictionaryValue)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 version = 1;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  // .CNTK.proto.DictionaryValue.Type value_type = 2;
+  if (this->_internal_value_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_value_type());
+  }
+
+  switch (value_case()) {
+    // bool bool_value = 3;
+    case kBoolValue: {
+      total_size += 1 + 1;
+      break;
+    }
+    // int32 int_value = 4;
+    case kIntValue: {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_int_value());
+      break;
+    }
+    // uint64 size_t_value = 5;
+    case kSizeTValue: {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size_t_value());
+      break;
+    }
+    // float float_value = 6;
+    case kFloatValue: {
+      total_size += 1 + 4;
+      break;
+    }
+    // double double_value = 7;
+    case kDoubleValue: {
+      total_size += 1 + 8;
+      break;
+    }
+    // string string_value = 8;
+    case kStringValue: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_string_value());
+      break;
+    }
+    // .CNTK.proto.NDShape nd_shape_value = 9;
+    case kNdShapeValue: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.nd_shape_value_);
+      break;
+    }
+    // .CNTK.proto.Axis axis_value = 10;
+    case kAxisValue: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.axis_value_);
+      break;
+    }
+    // .CNTK.proto.Vector vector_value = 11;
+    case kVectorValue: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.vector_value_);
+      break;
+    }
+    // .CNTK.proto.Dictionary dictionary_value = 12;
+    case kDictionaryValue: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.dictionary_value_);
+      break;
+    }
+    // .CNTK.proto.NDArrayView nd_array_view_value = 13;
+    case kNdArrayViewValue: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.nd_array_view_value_);
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DictionaryValue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DictionaryValue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DictionaryValue::GetClassData() const { return &_class_data_; }
+
+
+void DictionaryValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DictionaryValue*>(&to_msg);
+  auto& from = static_cast<const DictionaryValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNTK.proto.DictionaryValue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_value_type() != 0) {
+    _this->_internal_set_value_type(from._internal_value_type());
+  }
+  switch (from.value_case()) {
+    case kBoolValue: {
+      _this->_internal_set_bool_value(from._internal_bool_value());
+      break;
+    }
+    case kIntValue: {
+      _this->_internal_set_int_value(from._internal_int_value());
+      break;
+    }
+    case kSizeTValue: {
+      _this->_internal_set_size_t_value(from._internal_size_t_value());
+      break;
+    }
+    case kFloatValue: {
+      _this->_internal_set_float_value(from._internal_float_value());
+      break;
+    }
+    case kDoubleValue: {
+      _this->_internal_set_double_value(from._internal_double_value());
+      break;
+    }
+    case kStringValue: {
+      _this->_internal_set_string_value(from._internal_string_value());
+      break;
+    }
+    case kNdShapeValue: {
+      _this->_internal_mutable_nd_shape_value()->::CNTK::proto::NDShape::MergeFrom(
+          from._internal_nd_shape_value());
+      break;
+    }
+    case kAxisValue: {
+      _this->_internal_mutable_axis_value()->::CNTK::proto::Axis::MergeFrom(
+          from._internal_axis_value());
+      break;
+    }
+    case kVectorValue: {
+      _this->_internal_mutable_vector_value()->::CNTK::proto::Vector::MergeFrom(
+          from._internal_vector_value());
+      break;
+    }
+    case kDictionaryValue: {
+      _this->_internal_mutable_dictionary_value()->::CNTK::proto::Dictionary::MergeFrom(
+          from._internal_dictionary_value());
+      break;
+    }
+    case kNdArrayViewValue: {
+      _this->_internal_mutable_nd_array_view_value()->::CNTK::proto::NDArrayView::MergeFrom(
+          from._internal_nd_array_view_value());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DictionaryValue::CopyFrom(const DictionaryValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNTK.proto.DictionaryValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DictionaryValue::IsInitialized() const {
+  return true;
+}
+
+void DictionaryValue::InternalSwap(DictionaryValue* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DictionaryValue, _impl_.value_type_)
+      + sizeof(DictionaryValue::_impl_.value_type_)
+      - PROTOBUF_FIELD_OFFSET(DictionaryValue, _impl_.version_)>(
+          reinterpret_cast<char*>(&_impl_.version_),
+          reinterpret_cast<char*>(&other->_impl_.version_));
+  swap(_impl_.value_, other->_impl_.value_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DictionaryValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CNTK_2eproto_getter, &descriptor_table_CNTK_2eproto_once,
+      file_level_metadata_CNTK_2eproto[8]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace CNTK
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::CNTK::proto::NDShape*
+Arena::CreateMaybeMessage< ::CNTK::proto::NDShape >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNTK::proto::NDShape >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNTK::proto::Axis*
+Arena::CreateMaybeMessage< ::CNTK::proto::Axis >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNTK::proto::Axis >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNTK::proto::NDArrayView_FloatValues*
+Arena::CreateMaybeMessage< ::CNTK::proto::NDArrayView_FloatValues >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNTK::proto::NDArrayView_FloatValues >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNTK::proto::NDArrayView_DoubleValues*
+Arena::CreateMaybeMessage< ::CNTK::proto::NDArrayView_DoubleValues >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNTK::proto::NDArrayView_DoubleValues >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNTK::proto::NDArrayView*
+Arena::CreateMaybeMessage< ::CNTK::proto::NDArrayView >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNTK::proto::NDArrayView >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNTK::proto::Vector*
+Arena::CreateMaybeMessage< ::CNTK::proto::Vector >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNTK::proto::Vector >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNTK::proto::Dictionary_DataEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::CNTK::proto::Dictionary_DataEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNTK::proto::Dictionary_DataEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNTK::proto::Dictionary*
+Arena::CreateMaybeMessage< ::CNTK::proto::Dictionary >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNTK::proto::Dictionary >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNTK::proto::DictionaryValue*
+Arena::CreateMaybeMessage< ::CNTK::proto::DictionaryValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNTK::proto::DictionaryValue >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -23,10 +23,12 @@
 #include <VersionHelpers.h>
 #endif
 #include <Shlwapi.h>
+#include <io.h> // for _get_osfhandle()
 #pragma comment(lib, "Shlwapi.lib")
 #endif
 #ifdef __unix__
 #include <unistd.h>
+#include <sys/mman.h>
 #include <linux/limits.h> // for PATH_MAX
 #endif
 
@@ -91,6 +93,8 @@ void File::Init(const wchar_t* filename, int fileOptions)
 {
     m_filename = filename;
     m_options = fileOptions;
+    m_mappingSize = 0;
+    m_shareReadOnlyData = false;
     if (m_filename.empty())
         RuntimeError("File: filename is empty");
     const auto outputPipe = (m_filename.front() == '|');
@@ -670,6 +674,92 @@ int File::EndOfLineOrEOF(bool skip)
         return false;
 }
 
+// MemoryMap - map the whole file into memory for reading
+// shareReadOnlyData - readers may use read-only data in place in the mapping instead of copying it
+// returns - false if the file cannot be mapped; it is then read through the stdio stream as usual
+bool File::MemoryMap(bool shareReadOnlyData)
+{
+    if (IsTextBased() || !CanSeek() || (m_options & (fileOptionsWrite | fileOptionsAppend)))
+        return false;
+    if (!m_mapping)
+    {
+        size_t size = Size();
+        if (size == 0)
+            return false;
+#ifdef _WIN32
+        HANDLE hMapping = CreateFileMapping((HANDLE) _get_osfhandle(_fileno(m_file)), NULL, PAGE_WRITECOPY, 0, 0, NULL);
+        if (hMapping == NULL)
+            return false;
+        void* p = MapViewOfFile(hMapping, FILE_MAP_COPY, 0, 0, size);
+        CloseHandle(hMapping); // the view keeps the mapping object alive
+        if (p == NULL)
+            return false;
+        m_mapping = std::shared_ptr<char>((char*) p, [](char* p) { UnmapViewOfFile(p); });
+#else
+        void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(m_file), 0);
+        if (p == MAP_FAILED)
+            return false;
+        m_mapping = std::shared_ptr<char>((char*) p, [size](char* p) { munmap(p, size); });
+#endif
+        m_mappingSize = size;
+    }
+    m_shareReadOnlyData = shareReadOnlyData;
+    return true;
+}
+
+// GetMappedBlock - get a pointer to the next 'size' bytes of a memory-mapped file, and skip them
+char* File::GetMappedBlock(size_t size)
+{
+    if (!m_mapping)
+        LogicError("File: GetMappedBlock() called on a file that is not memory-mapped");
+    uint64_t pos = GetPosition();
+    if (pos + size > m_mappingSize)
+        RuntimeError("File: unexpected end of file in %ls", m_filename.c_str());
+    SetPosition(pos + size);
+    return m_mapping.get() + pos;
+}
+
+// ReadBlock - read 'size' raw bytes
+void File::ReadBlock(void* data, size_t size)
+{
+    if (size == 0)
+        return;
+    if (m_mapping)
+        memcpy(data, GetMappedBlock(size), size);
+    else
+        freadOrDie(data, 1, size, m_file);
+}
+
+// WriteBlock - write 'size' raw bytes
+void File::WriteBlock(const void* data, size_t size)
+{
+    if (size > 0)
+        fwriteOrDie(data, 1, size, m_file);
+}
+
+// PutPadding - write the number of padding bytes, followed by as many zeros as needed to reach an aligned file position
+void File::PutPadding(size_t alignment)
+{
+    size_t padding = (alignment - (GetPosition() + sizeof(size_t)) % alignment) % alignment;
+    fput(m_file, padding);
+    std::vector<char> zeros(padding, 0);
+    WriteBlock(zeros.data(), padding);
+}
+
+// SkipPadding - skip padding written by PutPadding()
+void File::SkipPadding()
+{
+    size_t padding;
+    fget(m_file, padding);
+    if (m_mapping)
+        GetMappedBlock(padding);
+    else
+    {
+        std::vector<char> zeros(padding);
+        ReadBlock(zeros.data(), padding);
+    }
+}
+
 // Buffer write stream
 int File::Setvbuf()
 {
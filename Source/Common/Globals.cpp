@@ -15,4 +15,7 @@ namespace Microsoft { namespace MSR { namespace CNTK {
 
     std::atomic<bool> Globals::m_enableShareNodeValueMatrices(true);
     std::atomic<bool> Globals::m_optimizeGradientAccumulation(true);
+    std::atomic<size_t> Globals::m_interOpThreads(0);
+    std::atomic<bool> Globals::m_optimizeMemoryPerMinibatchSize(false);
+    std::atomic<bool> Globals::m_fuseElementwiseOperations(false);
 }}}
@@ -0,0 +1,342 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+// AllReduceEngine.h - sum allreduce built only on the point-to-point primitives of MPIWrapper
+//
+// This makes the allreduce performance independent of how well the MPI implementation does MPI_Allreduce.
+// Two algorithms are provided:
+//  - ring: reduce-scatter followed by allgather around the ring of ranks. Each step is pipelined in chunks, so that
+//    accumulating and forwarding a chunk overlaps with the transfer of the next ones. Bandwidth optimal, but with
+//    2 (p-1) steps of latency.
+//  - recursive halving-doubling: reduce-scatter by recursive vector halving and distance doubling, followed by an
+//    allgather in reverse order. Only 2 log(p) steps, for small buffers where the latency dominates.
+// In both, each element of the result is summed up by exactly one rank, so all ranks receive bitwise identical sums.
+//
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "MPIWrapper.h"
+
+namespace Microsoft { namespace MSR { namespace CNTK {
+
+template <class ElemType>
+class AllReduceEngine
+{
+public:
+    // Buffers of at least ringThresholdInBytes use the ring, smaller ones recursive halving-doubling. With
+    // AutoRingThreshold, the threshold is determined by timing both algorithms during the first AllReduce().
+    static const size_t AutoRingThreshold = SIZE_MAX;
+
+    AllReduceEngine(const MPIWrapperPtr& mpi, size_t chunkSizeInBytes = 256 * 1024, size_t ringThresholdInBytes = AutoRingThreshold)
+        : m_mpi(mpi), m_chunkSize(std::max(chunkSizeInBytes / sizeof(ElemType), (size_t) 1)),
+          m_ringThresholdInBytes(ringThresholdInBytes), m_calibrate(ringThresholdInBytes == AutoRingThreshold)
+    {
+    }
+
+    // in-place sum over all ranks; must be called by all ranks in the same order, like MPIWrapper::AllReduce()
+    void AllReduce(ElemType* data, size_t numElements)
+    {
+        if (m_mpi->NumNodesInUse() == 1)
+            return;
+
+        if (m_calibrate)
+        {
+            m_calibrate = false;
+            m_ringThresholdInBytes = Calibrate();
+        }
+
+        if (sizeof(ElemType) * numElements >= m_ringThresholdInBytes)
+            RingAllReduce(data, numElements);
+        else
+            RecursiveHalvingDoublingAllReduce(data, numElements);
+    }
+
+    size_t RingThresholdInBytes() const { return m_ringThresholdInBytes; }
+
+    void RingAllReduce(ElemType* data, size_t numElements)
+    {
+        const size_t numRanks = m_mpi->NumNodesInUse();
+        const size_t rank = m_mpi->CurrentNodeRank();
+        if (numRanks == 1)
+            return;
+
+        // The data is split into one segment per rank. In step s of the reduce-scatter, we send segment (rank - s) to
+        // the right and accumulate segment (rank - s - 1) from the left, which we send on in step s + 1. The chunks of a
+        // step are received into one half of the double buffer, while the other half receives those of the next step.
+        // All messages of both phases go to the same neighbor with the same tag, and MPI matches them in order.
+        const int left = (int) ((rank + numRanks - 1) % numRanks);
+        const int right = (int) ((rank + 1) % numRanks);
+        const size_t numSteps = numRanks - 1;
+        const size_t maxSegmentSize = (numElements + numRanks - 1) / numRanks;
+        auto segmentBegin = [=](size_t k) { return numElements * k / numRanks; };
+        auto segmentSentInStep = [=](size_t s) { return (rank + numRanks - s) % numRanks; };
+        m_buffer.resize(2 * maxSegmentSize);
+
+        std::vector<MPI_Request> sendRequests;
+        std::vector<MPI_Request> recvRequests[2];
+        auto postReceives = [&](size_t s)
+        {
+            size_t k = segmentSentInStep(s + 1);
+            ElemType* buffer = m_buffer.data() + (s % 2) * maxSegmentSize;
+            recvRequests[s % 2].clear();
+            ForEachChunk(segmentBegin(k), segmentBegin(k + 1), [&](size_t begin, size_t end)
+            {
+                recvRequests[s % 2].push_back(MPI_Request());
+                Irecv(buffer + begin - segmentBegin(k), end - begin, left, &recvRequests[s % 2].back());
+            });
+        };
+
+        size_t k = segmentSentInStep(0);
+        ForEachChunk(segmentBegin(k), segmentBegin(k + 1), [&](size_t begin, size_t end)
+        {
+            sendRequests.push_back(MPI_Request());
+            Isend(data + begin, end - begin, right, &sendRequests.back());
+        });
+        postReceives(0);
+        for (size_t s = 0; s < numSteps; s++)
+        {
+            if (s + 1 < numSteps)
+                postReceives(s + 1);
+
+            k = segmentSentInStep(s + 1);
+            const ElemType* buffer = m_buffer.data() + (s % 2) * maxSegmentSize;
+            size_t chunk = 0;
+            ForEachChunk(segmentBegin(k), segmentBegin(k + 1), [&](size_t begin, size_t end)
+            {
+                m_mpi->Wait(&recvRequests[s % 2][chunk++]);
+                Accumulate(data + begin, buffer + begin - segmentBegin(k), end - begin);
+                if (s + 1 < numSteps)
+                {
+                    sendRequests.push_back(MPI_Request());
+                    Isend(data + begin, end - begin, right, &sendRequests.back());
+                }
+            });
+        }
+        // the allgather overwrites the segments we sent
+        WaitAll(sendRequests);
+
+        // Now we own the sum of segment (rank + 1). In step s of the allgather, we send segment (rank + 1 - s) and
+        // receive segment (rank - s) in place, which we forward in step s + 1.
+        std::vector<MPI_Request> gatherRequests;
+        for (size_t s = 0; s < numSteps; s++)
+        {
+            k = segmentSentInStep(s);
+            ForEachChunk(segmentBegin(k), segmentBegin(k + 1), [&](size_t begin, size_t end)
+            {
+                gatherRequests.push_back(MPI_Request());
+                Irecv(data + begin, end - begin, left, &gatherRequests.back());
+            });
+        }
+        k = (rank + 1) % numRanks;
+        ForEachChunk(segmentBegin(k), segmentBegin(k + 1), [&](size_t begin, size_t end)
+        {
+            sendRequests.push_back(MPI_Request());
+            Isend(data + begin, end - begin, right, &sendRequests.back());
+        });
+        size_t request = 0;
+        for (size_t s = 0; s < numSteps; s++)
+        {
+            k = segmentSentInStep(s);
+            ForEachChunk(segmentBegin(k), segmentBegin(k + 1), [&](size_t begin, size_t end)
+            {
+                m_mpi->Wait(&gatherRequests[request++]);
+                if (s + 1 < numSteps)
+                {
+                    sendRequests.push_back(MPI_Request());
+                    Isend(data + begin, end - begin, right, &sendRequests.back());
+                }
+            });
+        }
+        WaitAll(sendRequests);
+    }
+
+    void RecursiveHalvingDoublingAllReduce(ElemType* data, size_t numElements)
+    {
+        const int numRanks = (int) m_mpi->NumNodesInUse();
+        const int rank = (int) m_mpi->CurrentNodeRank();
+        if (numRanks == 1)
+            return;
+
+        int numParticipants = 1; // largest power of 2 not above numRanks
+        while (2 * numParticipants <= numRanks)
+            numParticipants *= 2;
+        const int numExtra = numRanks - numParticipants;
+        m_buffer.resize(numElements);
+
+        // Fold the ranks beyond the power of 2 into their neighbors: of the first 2 * numExtra ranks, the even ones
+        // hand their data to the next odd one, and sit out until they get the result back.
+        int participant = -1;
+        if (rank < 2 * numExtra)
+        {
+            if (rank % 2 == 0)
+                Send(data, numElements, rank + 1);
+            else
+            {
+                Recv(m_buffer.data(), numElements, rank - 1);
+                Accumulate(data, m_buffer.data(), numElements);
+                participant = rank / 2;
+            }
+        }
+        else
+            participant = rank - numExtra;
+
+        if (participant >= 0)
+        {
+            auto rankOf = [=](int p) { return (p < numExtra) ? 2 * p + 1 : p + numExtra; };
+
+            // reduce-scatter: in each step, keep one half of the current range and send the other half to the partner
+            struct Level { size_t begin, end; bool keepLower; };
+            std::vector<Level> levels;
+            size_t begin = 0;
+            size_t end = numElements;
+            for (int mask = 1; mask < numParticipants; mask *= 2)
+            {
+                size_t mid = begin + (end - begin) / 2;
+                bool keepLower = (participant & mask) == 0;
+                size_t keepBegin = keepLower ? begin : mid;
+                size_t keepEnd = keepLower ? mid : end;
+                size_t sendBegin = keepLower ? mid : begin;
+                size_t sendEnd = keepLower ? end : mid;
+                Exchange(data + sendBegin, sendEnd - sendBegin, m_buffer.data(), keepEnd - keepBegin, rankOf(participant ^ mask));
+                Accumulate(data + keepBegin, m_buffer.data(), keepEnd - keepBegin);
+                levels.push_back(Level{begin, end, keepLower});
+                begin = keepBegin;
+                end = keepEnd;
+            }
+
+            // allgather in reverse: exchange our range for the partner's other half
+            for (int mask = numParticipants / 2; mask >= 1; mask /= 2)
+            {
+                const Level& level = levels.back();
+                size_t otherBegin = level.keepLower ? end : level.begin;
+                size_t otherEnd = level.keepLower ? level.end : begin;
+                Exchange(data + begin, end - begin, data + otherBegin, otherEnd - otherBegin, rankOf(participant ^ mask));
+                begin = level.begin;
+                end = level.end;
+                levels.pop_back();
+            }
+        }
+
+        if (rank < 2 * numExtra)
+        {
+            if (rank % 2 == 0)
+                Recv(data, numElements, rank + 1);
+            else
+                Send(data, numElements, rank - 1);
+        }
+    }
+
+private:
+    // tag of all messages of the engine, chosen to stay clear of the small tags used elsewhere
+    static const int s_tag = 30000;
+
+    // Times both algorithms on growing buffers, and picks the ring from the smallest size on that it wins for all
+    // larger sizes. The times are summed over the ranks, so that all of them pick the same threshold.
+    size_t Calibrate()
+    {
+        const size_t numRepetitions = 3;
+        std::vector<size_t> sizesInBytes;
+        for (size_t sizeInBytes = 4096; sizeInBytes <= 16 * 1024 * 1024; sizeInBytes *= 4)
+            sizesInBytes.push_back(sizeInBytes);
+
+        std::vector<double> ringSeconds(sizesInBytes.size());
+        std::vector<double> halvingDoublingSeconds(sizesInBytes.size());
+        std::vector<ElemType> data;
+        for (size_t i = 0; i < sizesInBytes.size(); i++)
+        {
+            data.assign(sizesInBytes[i] / sizeof(ElemType), 0);
+            for (size_t r = 0; r <= numRepetitions; r++) // the first run is a warm-up
+            {
+                auto start = std::chrono::steady_clock::now();
+                RingAllReduce(data.data(), data.size());
+                auto middle = std::chrono::steady_clock::now();
+                RecursiveHalvingDoublingAllReduce(data.data(), data.size());
+                auto stop = std::chrono::steady_clock::now();
+                if (r > 0)
+                {
+                    ringSeconds[i] += std::chrono::duration<double>(middle - start).count();
+                    halvingDoublingSeconds[i] += std::chrono::duration<double>(stop - middle).count();
+                }
+            }
+        }
+        m_mpi->AllReduce(ringSeconds);
+        m_mpi->AllReduce(halvingDoublingSeconds);
+
+        size_t threshold = SIZE_MAX;
+        for (size_t i = sizesInBytes.size(); i-- > 0 && ringSeconds[i] < halvingDoublingSeconds[i];)
+            threshold = sizesInBytes[i];
+
+        if (m_mpi->IsMainNode())
+        {
+            if (threshold == SIZE_MAX)
+                fprintf(stderr, "AllReduceEngine: using recursive halving-doubling for all buffer sizes\n");
+            else
+                fprintf(stderr, "AllReduceEngine: using the ring for buffers of %d KB and more\n", (int) (threshold / 1024));
+            fflush(stderr);
+        }
+        return threshold;
+    }
+
+    // calls f(begin, end) for the chunks of [segmentBegin, segmentEnd)
+    template <class F>
+    void ForEachChunk(size_t segmentBegin, size_t segmentEnd, F&& f) const
+    {
+        for (size_t begin = segmentBegin; begin < segmentEnd; begin += m_chunkSize)
+            f(begin, std::min(begin + m_chunkSize, segmentEnd));
+    }
+
+    static void Accumulate(ElemType* data, const ElemType* other, size_t numElements)
+    {
+        for (size_t j = 0; j < numElements; j++)
+            data[j] += other[j];
+    }
+
+    void Isend(const ElemType* data, size_t numElements, int dest, MPI_Request* request)
+    {
+        m_mpi->Isend(data, (int) numElements, MPIWrapper::GetDataType((ElemType*) data), dest, s_tag, request) || MpiFail("AllReduceEngine: MPI_Isend");
+    }
+
+    void Irecv(ElemType* data, size_t numElements, int source, MPI_Request* request)
+    {
+        m_mpi->Irecv(data, (int) numElements, MPIWrapper::GetDataType(data), source, s_tag, request) || MpiFail("AllReduceEngine: MPI_Irecv");
+    }
+
+    void Send(const ElemType* data, size_t numElements, int dest)
+    {
+        MPI_Request request;
+        Isend(data, numElements, dest, &request);
+        m_mpi->Wait(&request);
+    }
+
+    void Recv(ElemType* data, size_t numElements, int source)
+    {
+        m_mpi->Recv(data, (int) numElements, MPIWrapper::GetDataType(data), source, s_tag, MPI_STATUS_IGNORE) || MpiFail("AllReduceEngine: MPI_Recv");
+    }
+
+    void Exchange(const ElemType* sendData, size_t numSendElements, ElemType* recvData, size_t numRecvElements, int partner)
+    {
+        MPI_Request requests[2];
+        Irecv(recvData, numRecvElements, partner, &requests[0]);
+        Isend(sendData, numSendElements, partner, &requests[1]);
+        m_mpi->Waitall(2, requests, MPI_STATUSES_IGNORE) || MpiFail("AllReduceEngine: MPI_Waitall");
+    }
+
+    void WaitAll(std::vector<MPI_Request>& requests)
+    {
+        if (!requests.empty())
+            m_mpi->WaitAll(requests);
+        requests.clear();
+    }
+
+    MPIWrapperPtr m_mpi;
+    const size_t m_chunkSize; // in elements
+    size_t m_ringThresholdInBytes;
+    bool m_calibrate;
+    std::vector<ElemType> m_buffer;
+};
+
+} } }
@@ -0,0 +1,150 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+// EditDistance.h -- edit distance between two sequences of labels, as used by the EditDistanceError node
+//
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Microsoft { namespace MSR { namespace CNTK {
+
+// Number of edit operations (substitutions, deletions, insertions) that turn 'first' into 'second', on a path of least total penalty.
+// Classic DP as described in https://en.wikipedia.org/wiki/Edit_distance, keeping two rows of the grid only.
+// Among paths of equal penalty, substitution is preferred over deletion, and deletion over insertion.
+template <class T>
+float EditOperationCount(const T* first, size_t firstSize, const T* second, size_t secondSize, float subPen, float delPen, float insPen)
+{
+    // penalty and number of operations of the best path to each cell, previous and current row
+    std::vector<float> prevPen(secondSize + 1), currPen(secondSize + 1);
+    std::vector<float> prevOps(secondSize + 1), currOps(secondSize + 1);
+    for (size_t j = 0; j < secondSize + 1; j++)
+    {
+        prevPen[j] = (float)(j * insPen);
+        prevOps[j] = (float)j;
+    }
+
+    for (size_t i = 1; i < firstSize + 1; i++)
+    {
+        currPen[0] = (float)(i * delPen);
+        currOps[0] = (float)i;
+        for (size_t j = 1; j < secondSize + 1; j++)
+        {
+            if (first[i - 1] == second[j - 1])
+            {
+                currPen[j] = prevPen[j - 1];
+                currOps[j] = prevOps[j - 1];
+                continue;
+            }
+            float del = prevPen[j] + delPen;     // deletion
+            float ins = currPen[j - 1] + insPen; // insertion
+            float sub = prevPen[j - 1] + subPen; // substitution
+            if (sub <= del && sub <= ins)
+            {
+                currPen[j] = sub;
+                currOps[j] = prevOps[j - 1] + 1.0f;
+            }
+            else if (del < ins)
+            {
+                currPen[j] = del;
+                currOps[j] = prevOps[j] + 1.0f;
+            }
+            else
+            {
+                currPen[j] = ins;
+                currOps[j] = currOps[j - 1] + 1.0f;
+            }
+        }
+        std::swap(prevPen, currPen);
+        std::swap(prevOps, currOps);
+    }
+    return prevOps[secondSize];
+}
+
+// Levenshtein distance, by the bit-parallel algorithm of Myers ("A fast bit-vector algorithm for approximate string matching based on
+// dynamic programming", J. ACM 1999) in its block-based form for the distance between whole sequences (Hyyrö, 2003).
+// A column of the grid is kept as bit vectors of its vertical +1/-1 deltas, 64 rows per word, so that the cost is
+// O(ceil(firstSize / 64) * secondSize) word operations.
+// With equal positive penalties, this is the number of operations EditOperationCount() returns.
+template <class T>
+size_t LevenshteinDistance(const T* first, size_t firstSize, const T* second, size_t secondSize)
+{
+    if (firstSize == 0)
+        return secondSize;
+    if (secondSize == 0)
+        return firstSize;
+
+    const size_t numBlocks = (firstSize + 63) / 64;
+    const uint64_t highBit = (uint64_t)1 << 63;
+    const uint64_t lastBit = (uint64_t)1 << ((firstSize - 1) % 64); // the last row, in the last block
+
+    // the distinct symbols of 'first', and for each the bit mask of its positions
+    std::vector<T> symbols(first, first + firstSize);
+    std::sort(symbols.begin(), symbols.end());
+    symbols.erase(std::unique(symbols.begin(), symbols.end()), symbols.end());
+    std::vector<uint64_t> peq(symbols.size() * numBlocks, 0);
+    for (size_t i = 0; i < firstSize; i++)
+    {
+        size_t k = std::lower_bound(symbols.begin(), symbols.end(), first[i]) - symbols.begin();
+        peq[k * numBlocks + i / 64] |= (uint64_t)1 << (i % 64);
+    }
+
+    // vertical deltas of the first column: all +1
+    std::vector<uint64_t> pv(numBlocks, ~(uint64_t)0);
+    std::vector<uint64_t> mv(numBlocks, 0);
+    ptrdiff_t score = (ptrdiff_t)firstSize; // value of the last row in the current column
+
+    for (size_t j = 0; j < secondSize; j++)
+    {
+        auto iter = std::lower_bound(symbols.begin(), symbols.end(), second[j]);
+        const uint64_t* eqs = (iter != symbols.end() && *iter == second[j]) ? &peq[(iter - symbols.begin()) * numBlocks] : nullptr;
+
+        int hin = 1; // horizontal delta entering a block from above; the top row of the grid increases by 1 per column
+        for (size_t b = 0; b < numBlocks; b++)
+        {
+            uint64_t eq = eqs ? eqs[b] : 0;
+            const uint64_t pvb = pv[b];
+            const uint64_t mvb = mv[b];
+
+            const uint64_t xv = eq | mvb;
+            if (hin < 0)
+                eq |= 1;
+            const uint64_t xh = (((eq & pvb) + pvb) ^ pvb) | eq;
+            uint64_t ph = mvb | ~(xh | pvb);
+            uint64_t mh = pvb & xh;
+
+            const uint64_t outBit = (b + 1 < numBlocks) ? highBit : lastBit;
+            const int hout = (ph & outBit) ? 1 : (mh & outBit) ? -1 : 0;
+
+            ph <<= 1;
+            mh <<= 1;
+            if (hin < 0)
+                mh |= 1;
+            else if (hin > 0)
+                ph |= 1;
+            pv[b] = mh | ~(xv | ph);
+            mv[b] = ph & xv;
+            hin = hout;
+        }
+        score += hin;
+    }
+    return (size_t)score;
+}
+
+// Number of edit operations between 'first' and 'second' as defined by EditOperationCount().
+// Uses the bit-parallel algorithm when the penalties are uniform.
+template <class T>
+float EditDistanceErrorCount(const std::vector<T>& first, const std::vector<T>& second, float subPen, float delPen, float insPen)
+{
+    if (subPen == delPen && subPen == insPen && subPen > 0)
+        return (float)LevenshteinDistance(first.data(), first.size(), second.data(), second.size());
+    else
+        return EditOperationCount(first.data(), first.size(), second.data(), second.size(), subPen, delPen, insPen);
+}
+
+} } }
@@ -355,6 +355,22 @@ public:
     // resetRNN - flags whether to reset memory cells of RNN. 
     //
     virtual void ForwardPass(const ValueRefs<ElemType>& inputs, ValueRefs<ElemType>& output, bool resetRNN) = 0;
+
+    //
+    // ForwardPassBatch - Evaluate several independent sequences in one minibatch. inputs[k] and outputs[k] are the
+    // input and output buffers of the k-th sequence, as for ForwardPass(). Every sequence starts with reset RNN state.
+    // Outputs that do not depend on the inputs' dynamic axis are returned in full for every sequence.
+    //
+    virtual void ForwardPassBatch(const std::vector<ValueRefs<ElemType>>& inputs, std::vector<ValueRefs<ElemType>>& outputs) = 0;
+
+    //
+    // CreateSession - create an evaluator for the outputs given to StartForwardEvaluation(), which must have been called before.
+    // The session shares the model parameters with this evaluator, and owns only its inputs, activations and RNN state. 
+    // Creating a session is cheap, and different sessions can call ForwardPass() concurrently. The parameters must not
+    // be modified while sessions are in use.
+    // A session must be released with Destroy() before the evaluator it was created from.
+    //
+    virtual IEvaluateModelExtended<ElemType>* CreateSession() = 0;
 };
 
 template <typename ElemType>
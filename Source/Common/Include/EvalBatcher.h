@@ -0,0 +1,226 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+// EvalBatcher.h - dynamic request batching on top of the extended evaluation interface
+//
+// Concurrent callers submit single sequences with ForwardPass(). A scheduler thread coalesces the pending requests
+// into one minibatch of up to maxBatchSize sequences, waiting at most maxLatency after the oldest pending request
+// arrived, evaluates it with a single ForwardPassBatch(), and hands the outputs back to the callers.
+//
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Eval.h"
+
+namespace Microsoft { namespace MSR { namespace CNTK {
+
+template <typename ElemType>
+class EvalBatcher
+{
+public:
+    // The evaluator must have been started with StartForwardEvaluation(), and must not be used by anyone else while the batcher exists.
+    EvalBatcher(IEvaluateModelExtended<ElemType>* eval, size_t maxBatchSize, std::chrono::microseconds maxLatency)
+        : m_eval(eval), m_maxBatchSize(maxBatchSize), m_maxLatency(maxLatency), m_stop(false)
+    {
+        if (!eval)
+            throw std::invalid_argument("EvalBatcher: No evaluator given.");
+        if (maxBatchSize == 0)
+            throw std::invalid_argument("EvalBatcher: The maximum batch size must be at least 1.");
+        m_inputSchema = eval->GetInputSchema();
+        m_outputSchema = eval->GetOutputSchema();
+        m_scheduler = std::thread([this]() { Run(); });
+    }
+
+    // pending requests are still evaluated
+    ~EvalBatcher()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_requestAdded.notify_one();
+        m_scheduler.join();
+    }
+
+    EvalBatcher(const EvalBatcher&) = delete;
+    EvalBatcher& operator=(const EvalBatcher&) = delete;
+
+    //
+    // ForwardPass - Evaluate a single sequence, like IEvaluateModelExtended::ForwardPass() with reset RNN state.
+    // Blocks until the minibatch that contains the sequence has been evaluated. Can be called concurrently.
+    // Buffers that do not match the schemas of the evaluator are rejected before the request is batched. If the
+    // evaluation of a minibatch fails, its requests are evaluated one by one, so that only the callers whose
+    // requests cause an error get it.
+    //
+    void ForwardPass(const ValueRefs<ElemType>& inputs, ValueRefs<ElemType>& outputs)
+    {
+        Validate(inputs, outputs);
+
+        Request request(inputs, outputs);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_stop)
+            throw std::logic_error("EvalBatcher: ForwardPass() called during shutdown.");
+        m_queue.push_back(&request);
+        m_requestAdded.notify_one();
+        m_requestDone.wait(lock, [&request]() { return request.m_done; });
+        if (request.m_error)
+            std::rethrow_exception(request.m_error);
+    }
+
+private:
+    struct Request
+    {
+        Request(const ValueRefs<ElemType>& inputs, ValueRefs<ElemType>& outputs)
+            : m_inputs(inputs), m_outputs(outputs), m_arrival(std::chrono::steady_clock::now()), m_done(false)
+        {
+        }
+
+        const ValueRefs<ElemType>& m_inputs;
+        ValueRefs<ElemType>& m_outputs;
+        std::chrono::steady_clock::time_point m_arrival;
+        bool m_done;
+        std::exception_ptr m_error;
+    };
+
+    // Same checks of the buffers as the evaluator does, so that they fail for this request only.
+    void Validate(const ValueRefs<ElemType>& inputs, const ValueRefs<ElemType>& outputs) const
+    {
+        if (inputs.size() != m_inputSchema.size())
+            throw std::invalid_argument("EvalBatcher: Expected " + std::to_string(m_inputSchema.size()) + " inputs, but got " + std::to_string(inputs.size()) + ".");
+        if (outputs.size() != m_outputSchema.size())
+            throw std::invalid_argument("EvalBatcher: Expected " + std::to_string(m_outputSchema.size()) + " outputs, but got " + std::to_string(outputs.size()) + ".");
+
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            const auto& buffer = inputs[i];
+            const auto& layout = m_inputSchema[i];
+            std::string prefix = "EvalBatcher: Input " + std::to_string(i) + ": ";
+            if (buffer.m_buffer.data() == nullptr)
+                throw std::invalid_argument(prefix + "Buffer is not allocated.");
+
+            if (layout.m_storageType == VariableLayout::Sparse)
+            {
+                if (buffer.m_colIndices.data() == nullptr || buffer.m_indices.data() == nullptr)
+                    throw std::invalid_argument(prefix + "Due to sparse input format, expected colIndices and indices arrays.");
+                if (buffer.m_colIndices.size() < 2)
+                    throw std::invalid_argument(prefix + "Expected at least one element (2 entries in colIndices array).");
+                if (buffer.m_colIndices[0] != 0)
+                    throw std::invalid_argument(prefix + "First element of column indices must be 0.");
+                if ((size_t)buffer.m_colIndices[buffer.m_colIndices.size() - 1] != buffer.m_indices.size())
+                    throw std::invalid_argument(prefix + "Last element of column indices must be equal to the size of indices.");
+            }
+            else
+            {
+                if (buffer.m_buffer.size() == 0)
+                    throw std::invalid_argument(prefix + "Expected at least one element.");
+                if (layout.m_numElements != 0 && buffer.m_buffer.size() % layout.m_numElements != 0)
+                    throw std::invalid_argument(prefix + "Expected input data to be a multiple of " + std::to_string(layout.m_numElements) +
+                                                ", but it is " + std::to_string(buffer.m_buffer.size()) + ".");
+            }
+        }
+    }
+
+    void Run()
+    {
+        std::vector<Request*> batch;
+        std::vector<ValueRefs<ElemType>> inputs;
+        std::vector<ValueRefs<ElemType>> outputs;
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_requestAdded.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+                if (m_queue.empty())
+                    return; // stopped and drained
+
+                // wait for a full batch, but no longer than the latency budget of the oldest request
+                auto deadline = m_queue.front()->m_arrival + m_maxLatency;
+                m_requestAdded.wait_until(lock, deadline, [this]() { return m_stop || m_queue.size() >= m_maxBatchSize; });
+
+                size_t batchSize = std::min(m_queue.size(), m_maxBatchSize);
+                batch.assign(m_queue.begin(), m_queue.begin() + batchSize);
+                m_queue.erase(m_queue.begin(), m_queue.begin() + batchSize);
+            }
+
+            // ValueRefs only reference the callers' memory, so these copies are shallow
+            inputs.clear();
+            outputs.clear();
+            for (const auto& request : batch)
+            {
+                inputs.push_back(request->m_inputs);
+                outputs.push_back(request->m_outputs);
+            }
+
+            std::vector<std::exception_ptr> errors(batch.size());
+            try
+            {
+                m_eval->ForwardPassBatch(inputs, outputs);
+            }
+            catch (...)
+            {
+                if (batch.size() == 1)
+                    errors[0] = std::current_exception();
+                else
+                    EvaluateOneByOne(batch, outputs, errors);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (size_t k = 0; k < batch.size(); k++)
+                {
+                    if (!errors[k])
+                        batch[k]->m_outputs = outputs[k]; // takes over the sizes of the outputs
+                    batch[k]->m_error = errors[k];
+                    batch[k]->m_done = true;
+                }
+            }
+            m_requestDone.notify_all();
+        }
+    }
+
+    void EvaluateOneByOne(const std::vector<Request*>& batch, std::vector<ValueRefs<ElemType>>& outputs, std::vector<std::exception_ptr>& errors)
+    {
+        std::vector<ValueRefs<ElemType>> input(1);
+        std::vector<ValueRefs<ElemType>> output(1);
+        for (size_t k = 0; k < batch.size(); k++)
+        {
+            input[0] = batch[k]->m_inputs;
+            output[0] = batch[k]->m_outputs; // the failed minibatch may have changed the sizes of outputs[k]
+            try
+            {
+                m_eval->ForwardPassBatch(input, output);
+                outputs[k] = output[0];
+            }
+            catch (...)
+            {
+                errors[k] = std::current_exception();
+            }
+        }
+    }
+
+    IEvaluateModelExtended<ElemType>* m_eval;
+    VariableSchema m_inputSchema;
+    VariableSchema m_outputSchema;
+    const size_t m_maxBatchSize;
+    const std::chrono::microseconds m_maxLatency;
+
+    std::mutex m_mutex;
+    std::condition_variable m_requestAdded;
+    std::condition_variable m_requestDone;
+    std::deque<Request*> m_queue;
+    bool m_stop;
+    std::thread m_scheduler;
+};
+
+} } }
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <string>
 #include <vector>
+#include <memory>
 #include <stdint.h>
 #ifdef _WIN32
 #ifndef NOMINMAX
@@ -102,6 +103,9 @@ private:
     bool m_pcloseNeeded; // was opened with popen(), use pclose() when destructing
     bool m_seekable;     // this stream is seekable
     int m_options;       // FileOptions ored togther
+    std::shared_ptr<char> m_mapping; // whole file, if memory-mapped for reading
+    size_t m_mappingSize;
+    bool m_shareReadOnlyData;        // readers may use read-only data in place in the mapping
     void Init(const wchar_t* filename, int fileOptions);
 
 public:
@@ -120,6 +124,27 @@ public:
 
     bool IsTextBased();
 
+    // memory-mapped reading
+    // MemoryMap() maps the whole file (binary, seekable, read-only access) once. Afterwards, ReadBlock() copies from the mapping,
+    // and GetMappedBlock() returns pointers into it. The mapping is private to the process: writes to it are copy-on-write.
+    // With 'shareReadOnlyData', readers of read-only data such as model parameters are asked to use the mapping in place instead of
+    // copying it, so that all processes that load the same file share its pages. Returns false if the file cannot be mapped.
+    bool MemoryMap(bool shareReadOnlyData = false);
+    bool IsMemoryMapped() const { return !!m_mapping; }
+    bool ShareReadOnlyData() const { return m_shareReadOnlyData; }
+    // the mapping stays valid as long as the File or a copy of this pointer exists
+    std::shared_ptr<char> GetMapping() const { return m_mapping; }
+    // returns a pointer to the next 'size' bytes in the mapping and advances the file position past them
+    char* GetMappedBlock(size_t size);
+
+    // bulk reading and writing of raw bytes (binary files)
+    void ReadBlock(void* data, size_t size);
+    void WriteBlock(const void* data, size_t size);
+    // PutPadding() writes zeros up to the next file position that is a multiple of 'alignment', preceded by their count, so that
+    // SkipPadding() can skip them without knowing the position (e.g. when reading from a pipe)
+    void PutPadding(size_t alignment = 64);
+    void SkipPadding();
+
     bool IsUnicodeBOM(bool skip = false);
     bool IsEOF();
     bool IsWhiteSpace(bool skip = false);
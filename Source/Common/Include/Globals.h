@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 
 namespace Microsoft { namespace MSR { namespace CNTK {
 
@@ -28,11 +29,26 @@ namespace Microsoft { namespace MSR { namespace CNTK {
         static void SetShareNodeValueMatrices(bool enable) { m_enableShareNodeValueMatrices = enable; }
         static bool ShouldEnableShareNodeValueMatrices() { return m_enableShareNodeValueMatrices; }
 
+        // number of threads used to execute independent nodes of a network concurrently (CPU only); 0 or 1 means sequential execution
+        static void SetInterOpThreads(size_t numThreads) { m_interOpThreads = numThreads; }
+        static size_t GetInterOpThreads() { return m_interOpThreads; }
+
+        // re-plan memory sharing of node matrices for the actual minibatch size (see MatrixPool::OptimizeMemoryForNumColumns())
+        static void SetOptimizeMemoryPerMinibatchSize(bool enable) { m_optimizeMemoryPerMinibatchSize = enable; }
+        static bool ShouldOptimizeMemoryPerMinibatchSize() { return m_optimizeMemoryPerMinibatchSize; }
+
+        // fuse chains of elementwise nodes into single nodes when compiling a network (see ComputationNetwork::FuseElementwiseOperations())
+        static void SetFuseElementwiseOperations(bool enable) { m_fuseElementwiseOperations = enable; }
+        static bool ShouldFuseElementwiseOperations() { return m_fuseElementwiseOperations; }
+
     private:
         static std::atomic<bool> m_forceDeterministicAlgorithms;
         // The global flag to enable matrices values in forward and backward prop
         static std::atomic<bool> m_enableShareNodeValueMatrices;
         static std::atomic<bool> m_forceConstantRandomSeed;
         static std::atomic<bool> m_optimizeGradientAccumulation;
+        static std::atomic<size_t> m_interOpThreads;
+        static std::atomic<bool> m_optimizeMemoryPerMinibatchSize;
+        static std::atomic<bool> m_fuseElementwiseOperations;
     };
 }}}
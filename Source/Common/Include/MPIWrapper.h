@@ -99,6 +99,7 @@ public:
 
     virtual int Finalize(void) = 0;
     virtual int Wait(MPI_Request* request, MPI_Status* status) = 0;
+    virtual int Test(MPI_Request* request, int* flag, MPI_Status* status) = 0;
     virtual int Waitany(int count, MPI_Request array_of_requests[], int* index, MPI_Status* status) = 0;
     virtual int Waitall(int count, MPI_Request array_of_requests[], MPI_Status array_of_statuses[]) = 0;
     virtual int Isend(const void* buf, int count, MPI_Datatype datatype, int dest, int tag, /*MPI_Comm comm,*/ MPI_Request* request) = 0;
@@ -142,6 +143,18 @@ public:
     virtual void AllReduceAsync(double* sendData, double* receiveData, size_t numElements, MPI_Request* request, MPI_Op op = MPI_SUM) const = 0;
     virtual void AllReduceAsync(float* sendData, float* receiveData, size_t numElements, MPI_Request* request, MPI_Op op = MPI_SUM) const = 0;
 
+    // Sum over all ranks in place, with only one copy of the data per host crossing the network: the ranks on a host
+    // reduce through a shared memory segment, one leader rank per host allreduces the partial sums across hosts, and
+    // the other ranks on the host read the result back from shared memory. Must be called by all ranks, like AllReduce().
+    virtual void HierarchicalAllReduce(float* data, size_t numElements) = 0;
+    virtual void HierarchicalAllReduce(double* data, size_t numElements) = 0;
+
+    // number of ranks on the host of this rank, including this one
+    virtual size_t NumLocalRanks() const = 0;
+
+    // largest NumLocalRanks() of all ranks, the same on every rank; decide on HierarchicalAllReduce() by this one
+    virtual size_t MaxNumLocalRanks() const = 0;
+
     virtual void Bcast(size_t* sendData, size_t numElements, size_t srcRank) = 0;
     virtual void Bcast(double* sendData, size_t numElements, size_t srcRank) = 0;
     virtual void Bcast(float* sendData, size_t numElements, size_t srcRank) = 0;
@@ -157,6 +170,7 @@ public:
     virtual void AllGather(const float *sendData, size_t numSendElements, float *receiveData, size_t numRecvElements) const = 0;
     virtual void AllGather(const double *sendData, size_t numSendElements, double *receiveData, size_t numRecvElements) const = 0;
     virtual void Allgather(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount, MPI_Datatype recvtype) const = 0;
+    virtual void AllGatherv(const int *sendData, size_t numSendElements, int *receiveData, int recvCounts[], int offsets[]) const = 0;
 
     virtual void Gather(const size_t *sendData, size_t numSendElements, size_t *receiveData, size_t numRecvElements, size_t rootRank) const = 0;
     virtual void Gather(const int *sendData, size_t numSendElements, int *receiveData, size_t numRecvElements, size_t rootRank) const = 0;
@@ -0,0 +1,235 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace Microsoft { namespace MSR { namespace CNTK {
+
+// -----------------------------------------------------------------------
+// WorkStealingThreadPool -- small fixed-size thread pool with per-worker task queues.
+//
+// Each worker owns a deque. Tasks submitted from a worker go to the back of its own
+// deque and are popped LIFO (good cache locality for dependent tasks); idle workers
+// steal from the front of other workers' deques. Tasks submitted from outside the
+// pool are distributed round-robin.
+//
+// Threads waiting for work to complete should use WaitWhileHelping(), which executes
+// pending tasks on the calling thread instead of blocking. This also makes it safe to
+// wait from inside a task.
+//
+// Tasks must not throw; callers that need error propagation wrap their task bodies.
+// Kept header-only, like conc_stack, since it only depends on the standard library.
+// -----------------------------------------------------------------------
+
+class WorkStealingThreadPool
+{
+public:
+    typedef std::function<void()> Task;
+
+    // 'ompThreadsPerWorker' sets the OpenMP team size used by parallel regions started from
+    // a task, to avoid oversubscription when tasks themselves use OpenMP. This holds for the
+    // workers and for threads that run tasks while waiting. 0 means to split the cores
+    // available to the creating thread evenly across the workers.
+    explicit WorkStealingThreadPool(size_t numThreads, int ompThreadsPerWorker = 0)
+        : m_stop(false), m_pendingTasks(0), m_nextQueue(0)
+    {
+        numThreads = std::max<size_t>(numThreads, 1);
+#ifdef _OPENMP
+        if (ompThreadsPerWorker <= 0)
+            ompThreadsPerWorker = std::max(1, omp_get_max_threads() / (int)numThreads);
+#endif
+        m_ompThreadsPerWorker = ompThreadsPerWorker;
+        for (size_t i = 0; i < numThreads; i++)
+            m_queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+        for (size_t i = 0; i < numThreads; i++)
+            m_workers.push_back(std::thread([this, i]() { WorkerLoop(i); }));
+    }
+
+    ~WorkStealingThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_stop = true;
+        }
+        m_wakeUp.notify_all();
+        for (auto& worker : m_workers)
+            worker.join();
+    }
+
+    size_t NumThreads() const { return m_workers.size(); }
+    int OmpThreadsPerWorker() const { return m_ompThreadsPerWorker; }
+
+    void Submit(Task task)
+    {
+        size_t queueIndex = (CurrentPool() == this) ? CurrentWorkerIndex() : (m_nextQueue++ % m_queues.size());
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_pendingTasks++;
+        }
+        {
+            auto& queue = *m_queues[queueIndex];
+            std::lock_guard<std::mutex> lock(queue.m_mutex);
+            queue.m_tasks.push_back(std::move(task));
+        }
+        m_wakeUp.notify_one();
+    }
+
+    // run one pending task on the calling thread, if there is any
+    // A thread outside the pool runs it with the OpenMP team size of the workers.
+    bool TryRunOne()
+    {
+        Task task;
+        bool isWorker = CurrentPool() == this;
+        size_t startIndex = isWorker ? CurrentWorkerIndex() : 0;
+        if (!TryPop(startIndex, task))
+            return false;
+        if (isWorker)
+        {
+            task();
+            return true;
+        }
+#ifdef _OPENMP
+        int ompThreads = omp_get_max_threads();
+        omp_set_num_threads(m_ompThreadsPerWorker);
+#endif
+        task();
+#ifdef _OPENMP
+        omp_set_num_threads(ompThreads);
+#endif
+        return true;
+    }
+
+    // block until 'isDone()' returns true, executing pending tasks in the meantime
+    template <class Predicate>
+    void WaitWhileHelping(const Predicate& isDone)
+    {
+        while (!isDone())
+        {
+            if (!TryRunOne())
+                std::this_thread::yield();
+        }
+    }
+
+    // convenience: run f(i) for i in [begin, end), split into at most 'numChunks' contiguous ranges
+    // f must not throw. Returns when all ranges are done.
+    template <class Function>
+    void ParallelFor(size_t begin, size_t end, size_t numChunks, const Function& f)
+    {
+        if (end <= begin)
+            return;
+        numChunks = std::max<size_t>(1, std::min(numChunks, end - begin));
+        auto remaining = std::make_shared<std::atomic<size_t>>(numChunks);
+        size_t chunkSize = (end - begin + numChunks - 1) / numChunks;
+        for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += chunkSize)
+        {
+            size_t chunkEnd = std::min(end, chunkBegin + chunkSize);
+            Submit([&f, chunkBegin, chunkEnd, remaining]()
+            {
+                for (size_t i = chunkBegin; i < chunkEnd; i++)
+                    f(i);
+                (*remaining)--;
+            });
+        }
+        WaitWhileHelping([&remaining]() { return *remaining == 0; });
+    }
+
+private:
+    struct WorkerQueue
+    {
+        std::mutex m_mutex;
+        std::deque<Task> m_tasks;
+    };
+
+    // identity of the pool and worker that the current thread belongs to (if any)
+    static WorkStealingThreadPool*& CurrentPool()
+    {
+        static thread_local WorkStealingThreadPool* pool = nullptr;
+        return pool;
+    }
+    static size_t& CurrentWorkerIndex()
+    {
+        static thread_local size_t index = 0;
+        return index;
+    }
+
+    // pop from the back of our own queue, otherwise steal from the front of the others
+    bool TryPop(size_t ownIndex, Task& task)
+    {
+        const size_t numQueues = m_queues.size();
+        for (size_t k = 0; k < numQueues; k++)
+        {
+            auto& queue = *m_queues[(ownIndex + k) % numQueues];
+            std::lock_guard<std::mutex> lock(queue.m_mutex);
+            if (queue.m_tasks.empty())
+                continue;
+            if (k == 0)
+            {
+                task = std::move(queue.m_tasks.back());
+                queue.m_tasks.pop_back();
+            }
+            else
+            {
+                task = std::move(queue.m_tasks.front());
+                queue.m_tasks.pop_front();
+            }
+            m_pendingTasks--;
+            return true;
+        }
+        return false;
+    }
+
+    void WorkerLoop(size_t index)
+    {
+        CurrentPool() = this;
+        CurrentWorkerIndex() = index;
+#ifdef _OPENMP
+        omp_set_num_threads(m_ompThreadsPerWorker);
+#endif
+        for (;;)
+        {
+            Task task;
+            if (TryPop(index, task))
+            {
+                task();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            if (m_stop)
+                return;
+            // the pending count may briefly be ahead of the queues (Submit() counts before pushing), hence the timeout
+            m_wakeUp.wait_for(lock, std::chrono::milliseconds(10), [this]() { return m_stop || m_pendingTasks > 0; });
+        }
+    }
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wakeUp;
+    bool m_stop;
+    int m_ompThreadsPerWorker;
+    std::atomic<size_t> m_pendingTasks;
+    std::atomic<size_t> m_nextQueue;
+
+public:
+    WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+};
+
+}}}
@@ -34,6 +34,19 @@ class MPIWrapperMpi : public MPIWrapper
     // MPI communicator that reflects the current subset selection
     MPI_Comm m_currentComm;
 
+    // ranks that can share memory with this one, determined by RequestNodes()
+    int m_numLocalRanks;
+    int m_localRank;         // index of this rank among them
+    int m_maxNumLocalRanks;  // largest m_numLocalRanks of all ranks
+    int m_numHosts;
+    MPI_Comm m_localComm;    // ranks on this host
+    MPI_Comm m_leaderComm;   // local rank 0 of each host; MPI_COMM_NULL on the other ranks
+
+    // Shared memory for HierarchicalAllReduce(), set up on first use. Each local rank owns one slot in the window.
+    static const size_t s_sharedSlotSizeInBytes = 4 * 1024 * 1024;
+    MPI_Win m_sharedWindow;
+    std::vector<char*> m_sharedSlots;
+
     // MPI_Init() is loading the msmpi.dll. Failing to load the dll will terminate the
     // application.
     int MPI_Init_DL();
@@ -60,6 +73,13 @@ private:
     MPI_Comm Communicator() const;
 
     void RequestNodes(const char *msg, size_t requestednodes = SIZE_MAX /*default: all*/);
+    void SplitByHost();
+
+    void InitializeSharedMemory();
+    void FinalizeSharedMemory();
+    void SyncLocalRanks();
+    template <class ElemType>
+    void HierarchicalAllReduceT(ElemType* data, size_t numElements);
 
 public:
 
@@ -81,6 +101,7 @@ public:
 
     virtual int Finalize(void);
     virtual int Wait(MPI_Request* request, MPI_Status* status);
+    virtual int Test(MPI_Request* request, int* flag, MPI_Status* status);
     virtual int Waitany(int count, MPI_Request array_of_requests[], int* index, MPI_Status* status);
     virtual int Waitall(int count, MPI_Request array_of_requests[], MPI_Status array_of_statuses[]);
     virtual int Isend(const void* buf, int count, MPI_Datatype datatype, int dest, int tag, /*MPI_Comm comm,*/ MPI_Request* request);
@@ -117,6 +138,11 @@ public:
     virtual void AllReduceAsync(double* sendData, double* receiveData, size_t numElements, MPI_Request* request, MPI_Op op = MPI_SUM) const;
     virtual void AllReduceAsync(float* sendData, float* receiveData, size_t numElements, MPI_Request* request, MPI_Op op = MPI_SUM) const;
 
+    virtual void HierarchicalAllReduce(float* data, size_t numElements);
+    virtual void HierarchicalAllReduce(double* data, size_t numElements);
+    virtual size_t NumLocalRanks() const;
+    virtual size_t MaxNumLocalRanks() const;
+
     virtual void Bcast(size_t* sendData, size_t numElements, size_t srcRank);
     virtual void Bcast(double* sendData, size_t numElements, size_t srcRank);
     virtual void Bcast(float* sendData, size_t numElements, size_t srcRank);
@@ -132,6 +158,7 @@ public:
     virtual void AllGather(const float *sendData, size_t numSendElements, float *receiveData, size_t numRecvElements) const;
     virtual void AllGather(const double *sendData, size_t numSendElements, double *receiveData, size_t numRecvElements) const;
     virtual void Allgather(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount, MPI_Datatype recvtype) const;
+    virtual void AllGatherv(const int *sendData, size_t numSendElements, int *receiveData, int recvCounts[], int offsets[]) const;
 
     virtual void Gather(const size_t *sendData, size_t numSendElements, size_t *receiveData, size_t numRecvElements, size_t rootRank) const;
     virtual void Gather(const int *sendData, size_t numSendElements, int *receiveData, size_t numRecvElements, size_t rootRank) const;
@@ -178,6 +205,7 @@ public:
 
     virtual int Finalize(void);
     virtual int Wait(MPI_Request* request, MPI_Status* status);
+    virtual int Test(MPI_Request* request, int* flag, MPI_Status* status);
     virtual int Waitany(int count, MPI_Request array_of_requests[], int* index, MPI_Status* status);
     virtual int Waitall(int count, MPI_Request array_of_requests[], MPI_Status array_of_statuses[]);
     virtual int Isend(const void* buf, int count, MPI_Datatype datatype, int dest, int tag, /*MPI_Comm comm,*/ MPI_Request* request);
@@ -214,6 +242,11 @@ public:
     virtual void AllReduceAsync(double* sendData, double* receiveData, size_t numElements, MPI_Request* request, MPI_Op op = MPI_SUM) const;
     virtual void AllReduceAsync(float* sendData, float* receiveData, size_t numElements, MPI_Request* request, MPI_Op op = MPI_SUM) const;
 
+    virtual void HierarchicalAllReduce(float* data, size_t numElements);
+    virtual void HierarchicalAllReduce(double* data, size_t numElements);
+    virtual size_t NumLocalRanks() const;
+    virtual size_t MaxNumLocalRanks() const;
+
     virtual void Bcast(size_t* sendData, size_t numElements, size_t srcRank);
     virtual void Bcast(double* sendData, size_t numElements, size_t srcRank);
     virtual void Bcast(float* sendData, size_t numElements, size_t srcRank);
@@ -224,6 +257,7 @@ public:
     virtual void AllGatherAsync(const float *sendData, size_t numSendElements, float *receiveData, size_t numRecvElements, MPI_Request* request) const;
     virtual void AllGatherAsync(const double *sendData, size_t numSendElements, double *receiveData, size_t numRecvElements, MPI_Request* request) const;
     virtual void Allgather(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount, MPI_Datatype recvtype) const;
+    virtual void AllGatherv(const int *sendData, size_t numSendElements, int *receiveData, int recvCounts[], int offsets[]) const;
 
     virtual void AllGather(const size_t *sendData, size_t numSendElements, size_t *receiveData, size_t numRecvElements) const;
     virtual void AllGather(const int *sendData, size_t numSendElements, int *receiveData, size_t numRecvElements) const;
@@ -373,7 +407,8 @@ MPI_Datatype MPIWrapper::GetDataType(size_t *)
 int MPIWrapperMpi::s_myRank = -1;
 
 MPIWrapperMpi::MPIWrapperMpi()
-    : m_currentComm(MPI_COMM_WORLD)
+    : m_currentComm(MPI_COMM_WORLD), m_numLocalRanks(1), m_localRank(0), m_maxNumLocalRanks(1), m_numHosts(1),
+      m_localComm(MPI_COMM_NULL), m_leaderComm(MPI_COMM_NULL), m_sharedWindow(MPI_WIN_NULL)
 {
     static bool initialized = false;
     if (initialized)
@@ -579,12 +614,37 @@ void MPIWrapperMpi::RequestNodes(const char *msg, size_t requestednodes /*defaul
         }
     }
 
+    SplitByHost();
+
     fprintf(stderr, "requestnodes [%s]: using %d out of %d MPI nodes on %s (%d requested); we (%d) are %s\n",
         msg, (int)m_numNodesInUse, (int)m_numMPINodes, m_multiHost ? "multiple hosts" : "a single host",
         (int)requestednodes, (int)CurrentNodeRank(), IsIdle() ? "out (idle)" : "in (participating)");
     fflush(stderr);
 }
 
+// Groups the ranks that can share memory, and picks the first of each group as its leader. Every rank learns the
+// largest group, so that all ranks agree on whether to use HierarchicalAllReduce(), which they must call together.
+void MPIWrapperMpi::SplitByHost()
+{
+    FinalizeSharedMemory();
+
+    MPI_Comm_split_type(Communicator(), MPI_COMM_TYPE_SHARED, m_myRank, MPI_INFO_NULL, &m_localComm) || MpiFail("SplitByHost: MPI_Comm_split_type");
+    MPI_Comm_size(m_localComm, &m_numLocalRanks) || MpiFail("SplitByHost: MPI_Comm_size");
+    MPI_Comm_rank(m_localComm, &m_localRank) || MpiFail("SplitByHost: MPI_Comm_rank");
+    MPI_Comm_split(Communicator(), (m_localRank == 0) ? 0 : MPI_UNDEFINED, m_myRank, &m_leaderComm) || MpiFail("SplitByHost: MPI_Comm_split");
+
+    int isLeader = (m_localRank == 0) ? 1 : 0;
+    MPI_Allreduce(&m_numLocalRanks, &m_maxNumLocalRanks, 1, MPI_INT, MPI_MAX, Communicator()) || MpiFail("SplitByHost: MPI_Allreduce");
+    MPI_Allreduce(&isLeader, &m_numHosts, 1, MPI_INT, MPI_SUM, Communicator()) || MpiFail("SplitByHost: MPI_Allreduce");
+
+    if (GetMathLibTraceLevel() > 0)
+    {
+        fprintf(stderr, "SplitByHost: rank %d is local rank %d of %d on its host; %d hosts with up to %d ranks\n",
+                m_myRank, m_localRank, m_numLocalRanks, m_numHosts, m_maxNumLocalRanks);
+        fflush(stderr);
+    }
+}
+
 bool MPIWrapperMpi::IsMultiHost() const
 {
     return m_multiHost;
@@ -597,6 +657,7 @@ MPI_Comm MPIWrapperMpi::Communicator() const
 
 int MPIWrapperMpi::Finalize(void)
 {
+    FinalizeSharedMemory();
     return MPI_Finalize();
 }
 
@@ -611,6 +672,11 @@ int MPIWrapperMpi::Wait(MPI_Request* request, MPI_Status* status)
     return MPI_Wait(request, status);
 }
 
+int MPIWrapperMpi::Test(MPI_Request* request, int* flag, MPI_Status* status)
+{
+    return MPI_Test(request, flag, status);
+}
+
 int MPIWrapperMpi::WaitAll(std::vector<MPI_Request>& requests)
 {
     return MPI_Waitall((int)requests.size(), &requests[0], MPI_STATUSES_IGNORE) || MpiFail("waitall: MPI_Waitall");
@@ -780,6 +846,117 @@ void MPIWrapperMpi::AllReduce(float* sendData, float* receiveData, size_t numEle
     MPI_Allreduce(sendData, receiveData, (int)numElements, GetDataType(sendData), op, Communicator()) || MpiFail("Allreduce: MPI_Allreduce");
 }
 
+void MPIWrapperMpi::HierarchicalAllReduce(float* data, size_t numElements)
+{
+    HierarchicalAllReduceT(data, numElements);
+}
+
+void MPIWrapperMpi::HierarchicalAllReduce(double* data, size_t numElements)
+{
+    HierarchicalAllReduceT(data, numElements);
+}
+
+size_t MPIWrapperMpi::NumLocalRanks() const
+{
+    return m_numLocalRanks;
+}
+
+size_t MPIWrapperMpi::MaxNumLocalRanks() const
+{
+    return m_maxNumLocalRanks;
+}
+
+template <class ElemType>
+void MPIWrapperMpi::HierarchicalAllReduceT(ElemType* data, size_t numElements)
+{
+    // Nothing to share if every rank is alone on its host. Otherwise a rank that is alone takes part as the leader
+    // of its host, whose local steps are trivial. (This must be decided alike on all ranks.)
+    if (m_maxNumLocalRanks == 1)
+        return AllReduce(data, numElements);
+
+    if (m_sharedWindow == MPI_WIN_NULL)
+        InitializeSharedMemory();
+
+    // The data is processed in chunks of one slot. The leader's slot receives the sum of the chunk.
+    ElemType* mySlot = reinterpret_cast<ElemType*>(m_sharedSlots[m_localRank]);
+    ElemType* leaderSlot = reinterpret_cast<ElemType*>(m_sharedSlots[0]);
+    const size_t chunkSize = s_sharedSlotSizeInBytes / sizeof(ElemType);
+    for (size_t chunkBegin = 0; chunkBegin < numElements; chunkBegin += chunkSize)
+    {
+        size_t n = min(chunkSize, numElements - chunkBegin);
+        memcpy(mySlot, data + chunkBegin, n * sizeof(ElemType));
+        SyncLocalRanks();
+
+        // reduce-scatter within the host: each local rank sums its share of the chunk over all slots
+        size_t begin = n * m_localRank / m_numLocalRanks;
+        size_t end = n * (m_localRank + 1) / m_numLocalRanks;
+        for (int r = 1; r < m_numLocalRanks; r++)
+        {
+            const ElemType* slot = reinterpret_cast<const ElemType*>(m_sharedSlots[r]);
+            for (size_t j = begin; j < end; j++)
+                leaderSlot[j] += slot[j];
+        }
+        SyncLocalRanks();
+
+        // only the leaders communicate across hosts
+        if (m_numHosts > 1)
+        {
+            if (m_leaderComm != MPI_COMM_NULL)
+                MPI_Allreduce(MPI_IN_PLACE, leaderSlot, (int)n, GetDataType(data), MPI_SUM, m_leaderComm) || MpiFail("HierarchicalAllReduce: MPI_Allreduce");
+            SyncLocalRanks();
+        }
+
+        memcpy(data + chunkBegin, leaderSlot, n * sizeof(ElemType));
+        // the next chunk overwrites the slots
+        SyncLocalRanks();
+    }
+}
+
+void MPIWrapperMpi::InitializeSharedMemory()
+{
+    void* mySlot = nullptr;
+    MPI_Win_allocate_shared((MPI_Aint)s_sharedSlotSizeInBytes, 1, MPI_INFO_NULL, m_localComm, &mySlot, &m_sharedWindow) || MpiFail("InitializeSharedMemory: MPI_Win_allocate_shared");
+    // one passive target epoch for the lifetime of the window; the local ranks synchronize with SyncLocalRanks()
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, m_sharedWindow) || MpiFail("InitializeSharedMemory: MPI_Win_lock_all");
+
+    m_sharedSlots.resize(m_numLocalRanks);
+    for (int r = 0; r < m_numLocalRanks; r++)
+    {
+        MPI_Aint size;
+        int displacementUnit;
+        MPI_Win_shared_query(m_sharedWindow, r, &size, &displacementUnit, &m_sharedSlots[r]) || MpiFail("InitializeSharedMemory: MPI_Win_shared_query");
+    }
+
+    if (GetMathLibTraceLevel() > 0)
+    {
+        fprintf(stderr, "InitializeSharedMemory: rank %d is local rank %d of %d on its host\n", m_myRank, m_localRank, m_numLocalRanks);
+        fflush(stderr);
+    }
+}
+
+// release what SplitByHost() and InitializeSharedMemory() created; must happen before MPI_Finalize()
+void MPIWrapperMpi::FinalizeSharedMemory()
+{
+    if (m_sharedWindow != MPI_WIN_NULL)
+    {
+        MPI_Win_unlock_all(m_sharedWindow) || MpiFail("FinalizeSharedMemory: MPI_Win_unlock_all");
+        MPI_Win_free(&m_sharedWindow) || MpiFail("FinalizeSharedMemory: MPI_Win_free"); // will leave MPI_WIN_NULL here
+        m_sharedSlots.clear();
+    }
+    if (m_leaderComm != MPI_COMM_NULL)
+        MPI_Comm_free(&m_leaderComm) || MpiFail("FinalizeSharedMemory: MPI_Comm_free");
+    if (m_localComm != MPI_COMM_NULL)
+        MPI_Comm_free(&m_localComm) || MpiFail("FinalizeSharedMemory: MPI_Comm_free");
+}
+
+// make the stores of each local rank to the shared window visible to all others
+void MPIWrapperMpi::SyncLocalRanks()
+{
+    MPI_Win_sync(m_sharedWindow) || MpiFail("SyncLocalRanks: MPI_Win_sync");
+    MPI_Barrier(m_localComm) || MpiFail("SyncLocalRanks: MPI_Barrier");
+    MPI_Win_sync(m_sharedWindow) || MpiFail("SyncLocalRanks: MPI_Win_sync");
+}
+
 void MPIWrapperMpi::Bcast(size_t* sendData, size_t numElements, size_t srcRank)
 {
     MPI_Bcast(sendData, (int)numElements, GetDataType(sendData), (int)srcRank, Communicator()) || MpiFail("Bcast: MPI_Bcast");
@@ -884,6 +1061,11 @@ void MPIWrapperMpi::Allgather(const void* sendbuf, int sendcount, MPI_Datatype s
     MPI_Allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, Communicator()) || MpiFail("AllReduceAsync: MPI_Allgather");
 }
 
+void MPIWrapperMpi::AllGatherv(const int *sendData, size_t numSendElements, int *receiveData, int recvCounts[], int offsets[]) const
+{
+    MPI_Allgatherv(sendData, (int)numSendElements, GetDataType(receiveData), receiveData, recvCounts, offsets, GetDataType(receiveData), Communicator()) || MpiFail("AllGatherv: MPI_Allgatherv");
+}
+
 void MPIWrapperMpi::Gather(const size_t *sendData, size_t numSendElements, size_t *receiveData, size_t numRecvElements, size_t rootRank) const
 {
     MPI_Gather(sendData, (int)numSendElements, GetDataType(receiveData), receiveData, (int)numRecvElements, GetDataType(receiveData), (int)rootRank, Communicator()) || MpiFail("AllReduceAsync: MPI_Gather");
@@ -993,6 +1175,11 @@ int MPIWrapperEmpty::Wait(MPI_Request* request, MPI_Status* status)
     return MPI_UNDEFINED;
 }
 
+int MPIWrapperEmpty::Test(MPI_Request* request, int* flag, MPI_Status* status)
+{
+    return MPI_UNDEFINED;
+}
+
 int MPIWrapperEmpty::WaitAll(std::vector<MPI_Request>& requests)
 {
     return MPI_UNDEFINED;
@@ -1130,6 +1317,24 @@ void MPIWrapperEmpty::AllReduce(float* sendData, float* receiveData, size_t numE
 {
 }
 
+void MPIWrapperEmpty::HierarchicalAllReduce(float* data, size_t numElements)
+{
+}
+
+void MPIWrapperEmpty::HierarchicalAllReduce(double* data, size_t numElements)
+{
+}
+
+size_t MPIWrapperEmpty::NumLocalRanks() const
+{
+    return 1;
+}
+
+size_t MPIWrapperEmpty::MaxNumLocalRanks() const
+{
+    return 1;
+}
+
 void MPIWrapperEmpty::AllReduceAsync(size_t* sendData, size_t numElements, MPI_Request* request, MPI_Op op) const
 {
 }
@@ -1212,6 +1417,10 @@ void MPIWrapperEmpty::Allgather(const void* sendbuf, int sendcount, MPI_Datatype
 {
 }
 
+void MPIWrapperEmpty::AllGatherv(const int *sendData, size_t numSendElements, int *receiveData, int recvCounts[], int offsets[]) const
+{
+}
+
 void MPIWrapperEmpty::Gather(const size_t *sendData, size_t numSendElements, size_t *receiveData, size_t numRecvElements, size_t rootRank) const
 {
 }
@@ -47,6 +47,18 @@ vector<MemRequestInfo<double>>& MatrixPool::GetMemRequestInfoVec<double>()
     return m_memRequestInfoDoubleVec;
 }
 
+template <>
+map<size_t, MatrixPool::MemoryPlan>& MatrixPool::GetMemoryPlans<float>()
+{
+    return m_floatMemoryPlans;
+}
+
+template <>
+map<size_t, MatrixPool::MemoryPlan>& MatrixPool::GetMemoryPlans<double>()
+{
+    return m_doubleMemoryPlans;
+}
+
 // -----------------------------------------------------------------------
 // construction
 // -----------------------------------------------------------------------
@@ -115,13 +127,28 @@ void ComputationNetwork::SaveToFileImpl(const wstring& fileName, const FileOptio
     fstream << (size_t) CURRENT_CNTK_MODEL_VERSION;
     fstream.PutMarker(FileMarker::fileMarkerEndSection, L"EVersion");
 
-    fstream << (size_t) m_nameToNodeMap.size();
+    // fused nodes are saved as the nodes they replaced (see IFusedNode)
+    vector<ComputationNodeBasePtr> nodes;
+    for (auto nodeIter = m_nameToNodeMap.begin(); nodeIter != m_nameToNodeMap.end(); nodeIter++)
+    {
+        auto fusedNode = dynamic_pointer_cast<IFusedNode>(nodeIter->second);
+        if (!fusedNode)
+        {
+            nodes.push_back(nodeIter->second);
+            continue;
+        }
+        const auto& unfusedNodes = fusedNode->GetUnfusedNodes();
+        if (unfusedNodes.empty() || unfusedNodes.front()->NodeName() != nodeIter->first)
+            LogicError("Save: The fused node %ls does not know the nodes it replaced.", nodeIter->first.c_str());
+        nodes.insert(nodes.end(), unfusedNodes.begin(), unfusedNodes.end());
+    }
+
+    fstream << (size_t) nodes.size();
 
     // put all node info first
     fstream.PutMarker(FileMarker::fileMarkerBeginSection, L"BNodeList");
-    for (auto nodeIter = m_nameToNodeMap.begin(); nodeIter != m_nameToNodeMap.end(); nodeIter++)
+    for (const auto& nodePtr : nodes)
     {
-        ComputationNodeBasePtr nodePtr = nodeIter->second;
         // type
 #if CURRENT_CNTK_MODEL_VERSION >= CNTK_MODEL_VERSION_7
         wstring precision;
@@ -143,9 +170,8 @@ void ComputationNetwork::SaveToFileImpl(const wstring& fileName, const FileOptio
 
     // put relationship
     fstream.PutMarker(FileMarker::fileMarkerBeginSection, L"BRelation");
-    for (auto nodeIter = m_nameToNodeMap.begin(); nodeIter != m_nameToNodeMap.end(); nodeIter++)
+    for (const auto& nodePtr : nodes)
     {
-        ComputationNodeBasePtr nodePtr = nodeIter->second;
         fstream << nodePtr->NodeName() << nodePtr->GetNumInputs();
         for (size_t i = 0; i < nodePtr->GetNumInputs(); i++)
         {
@@ -275,6 +301,7 @@ void ComputationNetwork::Read(const wstring& fileName)
     ClearNetwork();
 
     File fstream(fileName, FileOptions::fileOptionsBinary | FileOptions::fileOptionsRead);
+    fstream.MemoryMap(m_useMappedParameters); // one mapping; parameter payloads are then read in bulk (or used in place)
 
     auto modelVersion = GetModelVersion(fstream);
 
@@ -464,9 +491,7 @@ bool ComputationNetwork::IsTypicalCriterionNode(ComputationNodeBasePtr nodePtr)
         nodePtr->OperationName() == OperationNameOf(ClassBasedCrossEntropyWithSoftmaxNode) ||
         nodePtr->OperationName() == OperationNameOf(ClassificationErrorNode) ||
         nodePtr->OperationName() == OperationNameOf(ForwardBackwardNode) ||
-#ifdef COMING_SOON
         nodePtr->OperationName() == OperationNameOf(CRFNode) ||
-#endif
         nodePtr->OperationName() == OperationNameOf(DummyCriterionNode))
         return true;
 
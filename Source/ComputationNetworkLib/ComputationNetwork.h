@@ -29,8 +29,10 @@
 #include <chrono>
 #include <unordered_map>
 #include <set>
+#include <mutex>
 
 #include "ComputationGraphAlgorithms.h"
+#include "WorkStealingThreadPool.h"
 
 namespace Microsoft { namespace MSR { namespace CNTK {
 
@@ -57,6 +59,7 @@ public:
 
     ComputationNetwork() :
         m_randomSeedOffset(0),
+        m_useMappedParameters(false),
         m_isCompiled(false),
         m_areMatricesAllocated(false),
         m_pMBLayoutOfNetwork(make_shared<MBLayout>(1, 0, ComputationNodeBase::DefaultDynamicAxisName)),
@@ -102,6 +105,7 @@ public:
     void RereadPersistableParameters(const std::wstring& fileName)
     {
         File fstream(fileName, FileOptions::fileOptionsBinary | FileOptions::fileOptionsRead);
+        fstream.MemoryMap(m_useMappedParameters);
         auto modelVersion = GetModelVersion(fstream);
         ReadPersistableParameters<ElemType>(modelVersion, fstream, false);
     }
@@ -146,7 +150,11 @@ public:
     void PostForwardAndBackProp(const ComputationNodeBasePtr rootNode);
 
     // main entry point for backprop
-    void Backprop(const ComputationNodeBasePtr rootNode);
+    // If given, onGradientReady() is called for every node as soon as its gradient is final, that is, once it has
+    // been back-propagated itself. This allows to start communicating parameter gradients while backprop continues.
+    // With inter-op parallelism, it may be called concurrently from multiple threads.
+    typedef std::function<void(const ComputationNodeBasePtr&)> GradientReadyCallback;
+    void Backprop(const ComputationNodeBasePtr rootNode, const GradientReadyCallback& onGradientReady = nullptr);
 
     template <class NODESET> // version that takes multiple nodes
     void TravserseInSortedGlobalEvalOrder(const NODESET& nodes, const std::function<void(const ComputationNodeBasePtr&)>& action)
@@ -265,6 +273,7 @@ private:
     void VerifyIsCompiled(const char* where) const;
 public:
     void AllocateAllMatrices(const std::vector<ComputationNodeBasePtr>& evalRootNodes, const std::vector<ComputationNodeBasePtr>& outValueRootNodes, ComputationNodeBasePtr trainRootNode);
+    void OptimizeMemoryForMinibatchSize();
 
     // From the set of nodes extract all nodes which are used as accumulator nodes.
     std::set<ComputationNodeBasePtr> ExtractNodesWhichAccumulateResult(std::set<ComputationNodeBasePtr> nodes);
@@ -280,6 +289,7 @@ public:
 
     void FormNestedNetwork(const ComputationNodeBasePtr& rootNode);
     ComputationNodeBasePtr GetNestedNetwork(const ComputationNodeBasePtr& rootNode);
+    bool UsesInterOpParallelism() const;
 
 private:
     // The method below determines evaluation order, which is tricky in presence of recurrent loops.
@@ -461,6 +471,7 @@ public:
 
     ComputationNodeBasePtr CopyNode(const ComputationNetwork& fromNet, const std::wstring fromName, std::wstring toName, const CopyNodeFlags flags);
     void CopySubTree(const ComputationNetwork& fromNet, const std::wstring fromName, std::wstring toNamePrefix, const CopyNodeFlags flags);
+    ComputationNetworkPtr CloneSharingParameters() const;
     void CopyInputs(const std::wstring fromName, std::wstring toName);
     void RenameNode(const std::wstring& nodeNameOrig, const std::wstring& nodeNameNew);
     void RenameNode(ComputationNodeBasePtr node, const std::wstring& newNodeName);
@@ -472,6 +483,7 @@ public:
     void AddFeatureNode(ComputationNodeBasePtr featureNode);
     //ComputationNodeBasePtr RemoveFeatureNode(ComputationNodeBasePtr featureNode);
     void SetLearnableNodesBelowLearningRateMultiplier(const float learningRateMultiplier, const ComputationNodeBasePtr& rootNode = nullptr);
+    size_t FuseElementwiseOperations();
 
     // -----------------------------------------------------------------------
     // node access
@@ -1210,6 +1222,32 @@ protected:
         // There is currently no other constructor for inner nested PAR-traversed sub-networks, but there will be.
         PARTraversalFlowControlNode(const std::vector<shared_ptr<SEQTraversalFlowControlNode>>& recurrentInfo, const std::list<ComputationNodeBasePtr>& allNodes);
         // Base::m_nestedNodes contains all top-level nodes, in evaluation order
+
+        // -------------------------------------------------------------------
+        // inter-op parallel execution (opt-in, CPU only)
+        // Every entry of m_nestedNodes (a node or a whole SEQ loop) is a schedulable unit.
+        // ForwardProp() runs a unit as soon as all units it consumes are done; Backprop()
+        // runs it once all its consumers are done. Units that back-propagate into the same
+        // input are serialized through per-unit gradient locks.
+        // -------------------------------------------------------------------
+
+        void EnableInterOpParallelism(const shared_ptr<WorkStealingThreadPool>& threadPool);
+        bool IsInterOpParallel() const { return m_threadPool != nullptr; }
+        size_t GetNumUnits() const { return m_nestedNodes.size(); }
+        size_t GetCriticalPathLength() const; // longest chain of dependent units (for logging)
+
+        // called by Backprop() for each unit once its gradient is final
+        void SetGradientReadyCallback(const GradientReadyCallback& onGradientReady) { m_onGradientReady = onGradientReady; }
+
+    private:
+        void ForwardPropInterOp(const FrameRange& fr);
+        void BackpropInterOp(const FrameRange& fr);
+
+        shared_ptr<WorkStealingThreadPool> m_threadPool;
+        std::vector<std::vector<size_t>> m_unitInputs;    // [unit] -> units whose output this unit consumes (sorted, unique)
+        std::vector<std::vector<size_t>> m_unitConsumers; // [unit] -> units that consume this unit's output
+        std::unique_ptr<std::mutex[]> m_gradientLocks;    // [unit] -> guards accumulation into the unit's gradients
+        GradientReadyCallback m_onGradientReady;
     };
 
 public:
@@ -1226,9 +1264,21 @@ public:
         m_randomSeedOffset = value;
     }
 
+    // Model files are memory-mapped when read. If enabled, parameters on the CPU keep using the mapped pages instead of copies,
+    // so that processes that load the same model share its memory. Meant for inference; updates make private copies of the pages.
+    bool GetUseMappedParameters() const
+    {
+        return m_useMappedParameters;
+    }
+    void SetUseMappedParameters(bool enable)
+    {
+        m_useMappedParameters = enable;
+    }
+
 private:
     DEVICEID_TYPE m_deviceId; // TODO: is this shared by all nodes?
     unsigned long m_randomSeedOffset;
+    bool m_useMappedParameters;
 
     // main node holder
     std::map<const std::wstring, ComputationNodeBasePtr, nocase_compare> m_nameToNodeMap; // [name] -> node; this is the main container that holds this networks' nodes
@@ -10,6 +10,8 @@
 #include "ComputationNetwork.h"
 #include "InputAndParamNodes.h"
 #include "TrainingNodes.h"
+#include "LinearAlgebraNodes.h"
+#include "NonlinearityNodes.h"
 #include <string>
 #include <vector>
 #include <list>
@@ -97,6 +99,73 @@ void ComputationNetwork::CopySubTree(const ComputationNetwork& fromNet,
     }
 }
 
+static bool IsFloatNode(const ComputationNodeBasePtr& node)
+{
+    return dynamic_pointer_cast<ComputationNode<float>>(node) != nullptr;
+}
+
+// give a node of a network clone a value matrix of its own
+// Values that live in the matrix pool are left to the pool of the clone. Others (e.g. inputs) get a new empty matrix of the same storage type.
+template <class ElemType>
+static void DetachValue(const ComputationNodeBasePtr& nodeBase)
+{
+    auto node = dynamic_pointer_cast<ComputationNode<ElemType>>(nodeBase);
+    auto& value = node->ValuePtrRef();
+    if (!value || node->IsValueSharable())
+        value = nullptr;
+    else
+        value = make_shared<Matrix<ElemType>>(value->GetNumRows(), 0, value->GetDeviceId(), value->GetMatrixType(), value->GetFormat());
+}
+
+// Create a compiled copy of this network for concurrent evaluation.
+// The values of parameters and precomputed statistics are shared with this network and must not be modified while the clone is in use.
+// Everything else (inputs, activations, recurrent state) is owned by the clone, and its activations come from the clone's own matrix pool.
+// Cloning does not copy any parameter data, so it is cheap enough to do per evaluation request.
+ComputationNetworkPtr ComputationNetwork::CloneSharingParameters() const
+{
+    auto net = make_shared<ComputationNetwork>(m_deviceId);
+    net->SetTraceLevel(TraceLevel());
+    net->SetRandomSeedOffset(m_randomSeedOffset);
+
+    for (const auto& iter : m_nameToNodeMap)
+    {
+        const auto& node = iter.second;
+        auto newNode = node->Duplicate(node->NodeName(), CopyNodeFlags(CopyNodeFlags::copyNodeValue | CopyNodeFlags::copyNodeShareValue));
+        bool isShared = node->OperationName() == OperationNameOf(LearnableParameter) || node->Is<IPreComputeNode>();
+        if (!isShared)
+        {
+            if (IsFloatNode(newNode))
+                DetachValue<float>(newNode);
+            else
+                DetachValue<double>(newNode);
+        }
+        net->AddNodeToNet(newNode);
+    }
+
+    // link the new nodes the same way as the old ones
+    for (const auto& iter : m_nameToNodeMap)
+    {
+        const auto& inputs = iter.second->GetInputs();
+        if (inputs.empty())
+            continue;
+        vector<ComputationNodeBasePtr> newInputs;
+        for (const auto& input : inputs)
+            newInputs.push_back(net->GetNodeFromName(input->NodeName()));
+        net->GetNodeFromName(iter.first)->AttachInputs(newInputs);
+    }
+
+    auto oldGroups = const_cast<ComputationNetwork*>(this)->GetAllNodeGroups();
+    auto newGroups = net->GetAllNodeGroups();
+    for (size_t i = 0; i < oldGroups.size(); i++)
+    {
+        for (const auto& node : *oldGroups[i])
+            newGroups[i]->push_back(net->GetNodeFromName(node->NodeName()));
+    }
+
+    net->CompileNetwork();
+    return net;
+}
+
 // you can only copy inputs from nodes in the same network
 void ComputationNetwork::CopyInputs(const std::wstring fromName, std::wstring toName)
 {
@@ -367,4 +436,165 @@ void ComputationNetwork::SetLearnableNodesBelowLearningRateMultiplier(const floa
     }
 }
 
+
+// -----------------------------------------------------------------------
+// elementwise fusion
+// -----------------------------------------------------------------------
+
+// the operation of an elementwise node that can be part of a FusedElementwiseNode, or opNone
+static ElementWiseOperator GetFusibleOperation(const ComputationNodeBasePtr& node)
+{
+    static const map<wstring, ElementWiseOperator> fusibleOperations =
+    {
+        { OperationNameOf(PlusNode),            ElementWiseOperator::opSum                },
+        { OperationNameOf(MinusNode),           ElementWiseOperator::opDifference         },
+        { OperationNameOf(ElementTimesNode),    ElementWiseOperator::opElementwiseProduct },
+        { OperationNameOf(NegateNode),          ElementWiseOperator::opNegate             },
+        { OperationNameOf(PassNode),            ElementWiseOperator::opCopy               },
+        { OperationNameOf(SigmoidNode),         ElementWiseOperator::opSigmoid            },
+        { OperationNameOf(StableSigmoidNode),   ElementWiseOperator::opStableSigmoid      },
+        { OperationNameOf(TanhNode),            ElementWiseOperator::opTanh               },
+        { OperationNameOf(RectifiedLinearNode), ElementWiseOperator::opLinearRectifier    },
+        { OperationNameOf(ExpNode),             ElementWiseOperator::opExp                },
+    };
+    auto iter = fusibleOperations.find(node->OperationName());
+    return iter != fusibleOperations.end() ? iter->second : ElementWiseOperator::opNone;
+}
+
+// Determine the inputs of a chain of fused nodes (in depth-first order from the chain's root), and if requested,
+// the program that computes the chain from them.
+static void FormFusedElementwiseProgram(const ComputationNodeBasePtr& root, const set<ComputationNodeBasePtr>& chain,
+                                        vector<ComputationNodeBasePtr>& inputs, ElementWiseProgram* program)
+{
+    function<void(const ComputationNodeBasePtr&)> collectInputs = [&](const ComputationNodeBasePtr& node)
+    {
+        for (const auto& input : node->GetInputs())
+        {
+            if (chain.find(input) != chain.end())
+                collectInputs(input);
+            else if (find(inputs.begin(), inputs.end(), input) == inputs.end())
+                inputs.push_back(input);
+        }
+    };
+    inputs.clear();
+    collectInputs(root);
+    if (!program)
+        return;
+
+    *program = ElementWiseProgram();
+    program->numInputs = inputs.size();
+    function<size_t(const ComputationNodeBasePtr&)> emit = [&](const ComputationNodeBasePtr& node)
+    {
+        size_t args[2] = { 0, 0 };
+        for (size_t i = 0; i < node->GetNumInputs(); i++)
+        {
+            const auto& input = node->GetInputs()[i];
+            args[i] = chain.find(input) != chain.end() ? emit(input) : find(inputs.begin(), inputs.end(), input) - inputs.begin();
+        }
+        return program->Add(GetFusibleOperation(node), args[0], args[1]);
+    };
+    emit(root);
+}
+
+// Merge chains of elementwise nodes into FusedElementwiseNodes, which compute them in a single pass over the data without
+// materializing the intermediate values. A node is merged into the node that consumes it only if that is its only consumer,
+// and if it is neither a root nor a member of a node group, so that no value of a fused-away node is ever needed elsewhere.
+// The fused node replaces the last node of the chain under the same name. Nodes that are evaluated by name without being
+// tagged as outputs may have been fused away. The fused node keeps the chain, which Save() writes in its place.
+// Returns the number of fused nodes. This invalidates the compiled network; CompileNetwork() calls this when enabled.
+size_t ComputationNetwork::FuseElementwiseOperations()
+{
+    const size_t maxChainLength = 8;
+    const size_t maxInputs = ElementWiseProgram::MaxInputs - 1; // the gradient programs have the output gradient as an additional input
+
+    // nodes whose values must remain accessible
+    set<ComputationNodeBasePtr> pinnedNodes(m_allRoots.begin(), m_allRoots.end());
+    for (auto groupIter : GetAllNodeGroups())
+        pinnedNodes.insert(groupIter->begin(), groupIter->end());
+
+    map<ComputationNodeBasePtr, vector<ComputationNodeBasePtr>> consumers;
+    for (const auto& node : GetAllNodes())
+        for (const auto& input : node->GetInputs())
+            consumers[input].push_back(node);
+
+    // can 'node' be merged into its consumer 'consumer'?
+    auto canMergeInto = [&](const ComputationNodeBasePtr& node, const ComputationNodeBasePtr& consumer)
+    {
+        const auto& nodeConsumers = consumers[node];
+        return GetFusibleOperation(node) != ElementWiseOperator::opNone && pinnedNodes.find(node) == pinnedNodes.end() &&
+               nodeConsumers.size() == 1 && nodeConsumers.front() == consumer && IsFloatNode(node) == IsFloatNode(consumer);
+    };
+
+    // visit consumers before their inputs, such that each chain is grown from its last node
+    const auto& evalOrder = GetEvalOrder(nullptr);
+    vector<ComputationNodeBasePtr> nodes(evalOrder.rbegin(), evalOrder.rend());
+    set<ComputationNodeBasePtr> fusedNodes;
+    size_t numFusedNodes = 0, numFusedOperations = 0;
+    for (const auto& root : nodes)
+    {
+        if (fusedNodes.find(root) != fusedNodes.end() || GetFusibleOperation(root) == ElementWiseOperator::opNone)
+            continue;
+
+        // grow the chain breadth-first, as long as it stays within the limits of ElementWiseProgram
+        vector<ComputationNodeBasePtr> chainNodes{ root };
+        set<ComputationNodeBasePtr> chain{ root };
+        vector<ComputationNodeBasePtr> inputs;
+        for (size_t k = 0; k < chainNodes.size(); k++)
+        {
+            auto consumer = chainNodes[k];
+            for (const auto& input : consumer->GetInputs())
+            {
+                if (chainNodes.size() >= maxChainLength || chain.find(input) != chain.end() || !canMergeInto(input, consumer))
+                    continue;
+                chain.insert(input);
+                FormFusedElementwiseProgram(root, chain, inputs, nullptr);
+                if (inputs.size() > maxInputs)
+                    chain.erase(input);
+                else
+                    chainNodes.push_back(input);
+            }
+        }
+        if (chainNodes.size() == 1)
+            continue;
+
+        ElementWiseProgram program;
+        FormFusedElementwiseProgram(root, chain, inputs, &program);
+        if (!FusedElementwiseNode<float>::CanFuse(program))
+            continue;
+
+        ComputationNodeBasePtr fusedNode;
+        if (IsFloatNode(root))
+            fusedNode = New<FusedElementwiseNode<float>>(root->GetDeviceId(), root->NodeName(), program, chainNodes);
+        else
+            fusedNode = New<FusedElementwiseNode<double>>(root->GetDeviceId(), root->NodeName(), program, chainNodes);
+        fusedNode->AttachInputs(inputs);
+        for (const auto& tag : root->GetTags())
+            fusedNode->SetTag(tag);
+
+        // replace the chain by the fused node
+        ChangeNodeInputs(root, fusedNode);
+        for (auto groupIter : GetAllNodeGroups())
+            replace(groupIter->begin(), groupIter->end(), root, fusedNode);
+        for (auto& namedCriterion : m_namedCriterionNodes)
+            replace(namedCriterion.second.begin(), namedCriterion.second.end(), root, fusedNode);
+        for (const auto& node : chainNodes)
+        {
+            RemoveNodeFromNet(node);
+            fusedNodes.insert(node);
+        }
+        AddNodeToNet(fusedNode);
+
+        numFusedNodes++;
+        numFusedOperations += chainNodes.size();
+    }
+
+    if (numFusedNodes > 0)
+    {
+        InvalidateCompiledNetwork();
+        if (TraceLevel() > 0)
+            fprintf(stderr, "FuseElementwiseOperations: Fused %d elementwise operations into %d nodes.\n", (int) numFusedOperations, (int) numFusedNodes);
+    }
+    return numFusedNodes;
+}
+
 }}}
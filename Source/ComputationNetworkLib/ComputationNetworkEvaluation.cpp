@@ -17,6 +17,9 @@
 #include <set>
 #include <algorithm>
 #include <map>
+#include <atomic>
+#include <mutex>
+#include <functional>
 
 using namespace std;
 
@@ -40,6 +43,9 @@ void ComputationNetwork::ForwardProp(const ComputationNodeBasePtr rootNode)
 {
     VerifyIsCompiled("ForwardProp");
 
+    if (m_areMatricesAllocated && Globals::ShouldOptimizeMemoryPerMinibatchSize())
+        OptimizeMemoryForMinibatchSize();
+
     // traverse all nodes in the pre-determined evaluation order
     GetNestedNetwork(rootNode)->ForwardProp(FrameRange(nullptr));
 }
@@ -72,7 +78,8 @@ static bool SetRootGradientToScalarOne(ComputationNodeBasePtr nodep)
 //  - ForwardProp() for eval nodes
 //  - ForwardProp() for the training criterion (which will reuse computation results from the previous step)
 //  - Backprop() for the training criterion
-void ComputationNetwork::Backprop(const ComputationNodeBasePtr rootNode) // training criterion to compute the gradients for
+void ComputationNetwork::Backprop(const ComputationNodeBasePtr rootNode, // training criterion to compute the gradients for
+                                  const GradientReadyCallback& onGradientReady)
 {
     if (!Environment().IsTraining())
         LogicError("Backprop: Requires network is to be in training mode.");
@@ -85,7 +92,38 @@ void ComputationNetwork::Backprop(const ComputationNodeBasePtr rootNode) // trai
     ZeroInputGradients(rootNode);
 
     // backpropagate through the network
-    GetNestedNetwork(rootNode)->Backprop(FrameRange(nullptr), true, true);
+    auto network = GetNestedNetwork(rootNode);
+    auto parNetwork = dynamic_pointer_cast<PARTraversalFlowControlNode>(network);
+    if (parNetwork && onGradientReady)
+        parNetwork->SetGradientReadyCallback(onGradientReady);
+    auto resetCallback = MakeScopeExit([&parNetwork]()
+    {
+        if (parNetwork)
+            parNetwork->SetGradientReadyCallback(nullptr);
+    });
+    network->Backprop(FrameRange(nullptr), true, true);
+}
+
+// thread pool shared by all networks that use inter-op parallelism, so that multiple networks in one process do not oversubscribe the cores
+// It is recreated if the requested number of threads changes.
+static shared_ptr<WorkStealingThreadPool> GetInterOpThreadPool(size_t numThreads)
+{
+    static mutex s_mutex;
+    static weak_ptr<WorkStealingThreadPool> s_threadPool;
+    lock_guard<mutex> lock(s_mutex);
+    auto threadPool = s_threadPool.lock();
+    if (!threadPool || threadPool->NumThreads() != numThreads)
+    {
+        threadPool = make_shared<WorkStealingThreadPool>(numThreads);
+        s_threadPool = threadPool;
+    }
+    return threadPool;
+}
+
+// inter-op parallelism is opt-in (config 'interOpThreads') and only supported on the CPU
+bool ComputationNetwork::UsesInterOpParallelism() const
+{
+    return Globals::GetInterOpThreads() > 1 && m_deviceId == CPUDEVICE;
 }
 
 void ComputationNetwork::FormNestedNetwork(const ComputationNodeBasePtr& rootNode)
@@ -93,7 +131,16 @@ void ComputationNetwork::FormNestedNetwork(const ComputationNodeBasePtr& rootNod
     if (m_nestedNetworks.find(rootNode) != m_nestedNetworks.end())
         fprintf(stderr, "FormNestedNetwork: WARNING: Was called twice for %ls %ls operation\n", rootNode->NodeName().c_str(), rootNode->OperationName().c_str());
 
-    m_nestedNetworks[rootNode] = make_shared<PARTraversalFlowControlNode>(m_allSEQNodes, GetEvalOrder(rootNode));
+    auto nestedNetwork = make_shared<PARTraversalFlowControlNode>(m_allSEQNodes, GetEvalOrder(rootNode));
+    if (UsesInterOpParallelism())
+    {
+        nestedNetwork->EnableInterOpParallelism(GetInterOpThreadPool(Globals::GetInterOpThreads()));
+        if (TraceLevel() > 0)
+            fprintf(stderr, "FormNestedNetwork: %ls %ls operation: inter-op parallel execution on %d threads, %d units, critical path %d units.\n",
+                    rootNode->NodeName().c_str(), rootNode->OperationName().c_str(),
+                    (int)Globals::GetInterOpThreads(), (int)nestedNetwork->GetNumUnits(), (int)nestedNetwork->GetCriticalPathLength());
+    }
+    m_nestedNetworks[rootNode] = nestedNetwork;
 }
 
 ComputationNodeBasePtr ComputationNetwork::GetNestedNetwork(const ComputationNodeBasePtr& rootNode)
@@ -159,6 +206,9 @@ ComputationNetwork::PARTraversalFlowControlNode::PARTraversalFlowControlNode(con
 
 /*virtual*/ void ComputationNetwork::PARTraversalFlowControlNode::ForwardProp(const FrameRange& fr) /*override*/
 {
+    if (IsInterOpParallel())
+        return ForwardPropInterOp(fr);
+
     for (auto& node : m_nestedNodes)
         ForwardProp(node, fr);
 }
@@ -177,6 +227,9 @@ ComputationNetwork::PARTraversalFlowControlNode::PARTraversalFlowControlNode(con
 /*virtual*/ void ComputationNetwork::PARTraversalFlowControlNode::Backprop(const FrameRange& fr, bool childrenInThisLoop, bool childrenInOuterLoop) /*override*/
 {
     childrenInThisLoop, childrenInOuterLoop; // TODO: think through what these mean when coming from PAR mode
+    if (IsInterOpParallel())
+        return BackpropInterOp(fr);
+
     // process nodes in pre-determined order
     for (auto pnode = m_nestedNodes.rbegin(); pnode != m_nestedNodes.rend(); pnode++) // iterate backwards over evaluation order
     {
@@ -189,6 +242,9 @@ ComputationNetwork::PARTraversalFlowControlNode::PARTraversalFlowControlNode(con
         // Extreme Tracing, part 2/4
         if (node->HasEnvironmentPtr() && node->Environment().ShouldDumpNode() && node->NeedsGradient())
             DumpNode<float>(node, /*dumpGradient=*/true) || DumpNode<double>(node, true);
+
+        if (m_onGradientReady)
+            m_onGradientReady(node);
     }
 }
 /*virtual*/ void ComputationNetwork::PARTraversalFlowControlNode::RequestMatricesBeforeForwardProp(MatrixPool& matrixPool) /*override*/
@@ -207,6 +263,192 @@ ComputationNetwork::PARTraversalFlowControlNode::PARTraversalFlowControlNode(con
 {
 }
 
+// -----------------------------------------------------------------------
+// PARTraversalFlowControlNode inter-op parallel execution
+// -----------------------------------------------------------------------
+
+// build the unit dependency graph over m_nestedNodes
+// A unit is either a regular node or a SEQTraversalFlowControlNode that stands for all nodes of its loop.
+void ComputationNetwork::PARTraversalFlowControlNode::EnableInterOpParallelism(const shared_ptr<WorkStealingThreadPool>& threadPool)
+{
+    const size_t numUnits = m_nestedNodes.size();
+
+    // map every node to the unit that computes it
+    unordered_map<const ComputationNodeBase*, size_t> unitOf;
+    for (size_t u = 0; u < numUnits; u++)
+    {
+        const auto& unit = m_nestedNodes[u];
+        if (unit->Is<SEQTraversalFlowControlNode>())
+        {
+            for (const auto& node : unit->As<SEQTraversalFlowControlNode>()->m_nestedNodes)
+                unitOf[node.get()] = u;
+        }
+        else
+            unitOf[unit.get()] = u;
+    }
+
+    m_unitInputs.assign(numUnits, vector<size_t>());
+    m_unitConsumers.assign(numUnits, vector<size_t>());
+    for (size_t u = 0; u < numUnits; u++)
+    {
+        const auto& unit = m_nestedNodes[u];
+        vector<ComputationNodeBasePtr> nodes;
+        if (unit->Is<SEQTraversalFlowControlNode>())
+            nodes = unit->As<SEQTraversalFlowControlNode>()->m_nestedNodes;
+        else
+            nodes.push_back(unit);
+
+        auto& unitInputs = m_unitInputs[u];
+        for (const auto& node : nodes)
+        {
+            for (const auto& input : node->GetInputs())
+            {
+                auto iter = unitOf.find(input.get());
+                if (iter == unitOf.end())
+                    LogicError("EnableInterOpParallelism: Input %ls of %ls %ls operation is not part of the evaluation order.",
+                               input->NodeName().c_str(), node->NodeName().c_str(), node->OperationName().c_str());
+                if (iter->second == u) // within the same loop
+                    continue;
+                if (iter->second > u)
+                    LogicError("EnableInterOpParallelism: Evaluation order is not topological at %ls %ls operation.", node->NodeName().c_str(), node->OperationName().c_str());
+                unitInputs.push_back(iter->second);
+            }
+        }
+        sort(unitInputs.begin(), unitInputs.end());
+        unitInputs.erase(unique(unitInputs.begin(), unitInputs.end()), unitInputs.end());
+        for (auto v : unitInputs)
+            m_unitConsumers[v].push_back(u);
+    }
+
+    m_gradientLocks.reset(new mutex[numUnits]);
+    m_threadPool = threadPool;
+}
+
+size_t ComputationNetwork::PARTraversalFlowControlNode::GetCriticalPathLength() const
+{
+    // m_nestedNodes is in topological order, so a single pass suffices
+    vector<size_t> depth(m_unitInputs.size(), 1);
+    size_t maxDepth = 0;
+    for (size_t u = 0; u < m_unitInputs.size(); u++)
+    {
+        for (auto v : m_unitInputs[u])
+            depth[u] = max(depth[u], depth[v] + 1);
+        maxDepth = max(maxDepth, depth[u]);
+    }
+    return maxDepth;
+}
+
+// Execute body(u) for all units on the thread pool, where u may only start after all of dependencies[u] have completed.
+// The first exception thrown by any unit is rethrown on the calling thread after all started units have finished;
+// units that have not started at that point are skipped.
+static void RunDependencyGraph(WorkStealingThreadPool& threadPool,
+                               const vector<vector<size_t>>& dependencies, const vector<vector<size_t>>& dependents,
+                               const function<void(size_t)>& body)
+{
+    const size_t numUnits = dependencies.size();
+    if (numUnits == 0)
+        return;
+
+    // state is reference-counted by the tasks, since the last task may still be unwinding when the caller returns
+    struct State
+    {
+        unique_ptr<atomic<size_t>[]> numPending; // [unit] -> number of dependencies not yet completed
+        atomic<size_t> numRemaining;
+        atomic<bool> failed;
+        mutex errorMutex;
+        exception_ptr error;
+    };
+    auto state = make_shared<State>();
+    state->numPending.reset(new atomic<size_t>[numUnits]);
+    state->numRemaining = numUnits;
+    state->failed = false;
+    for (size_t u = 0; u < numUnits; u++)
+        state->numPending[u] = dependencies[u].size();
+
+    auto run = make_shared<function<void(size_t)>>();
+    weak_ptr<function<void(size_t)>> weakRun = run; // (avoid a reference cycle through the captured closure)
+    *run = [&threadPool, &dependents, &body, state, weakRun](size_t u)
+    {
+        if (!state->failed)
+        {
+            try
+            {
+                body(u);
+            }
+            catch (...)
+            {
+                lock_guard<mutex> lock(state->errorMutex);
+                if (!state->error)
+                    state->error = current_exception();
+                state->failed = true;
+            }
+        }
+        auto run = weakRun.lock(); // valid as long as the caller is waiting, which is until numRemaining hits 0 below
+        for (auto v : dependents[u])
+        {
+            if (--state->numPending[v] == 0)
+                threadPool.Submit([run, v]() { (*run)(v); });
+        }
+        state->numRemaining--;
+    };
+
+    for (size_t u = 0; u < numUnits; u++)
+    {
+        if (dependencies[u].empty())
+            threadPool.Submit([run, u]() { (*run)(u); });
+    }
+    threadPool.WaitWhileHelping([&state]() { return state->numRemaining == 0; });
+
+    if (state->error)
+        rethrow_exception(state->error);
+}
+
+// Lazily computed MBLayout caches (column validity mask) are not thread-safe.
+// We compute them right after a unit is done and before any of its consumers may run.
+static void PrimeLayoutCaches(const ComputationNodeBasePtr& unit)
+{
+    const auto& pMBLayout = unit->GetMBLayout();
+    if (pMBLayout && pMBLayout->HasGaps())
+        pMBLayout->GetColumnsValidityMask(CPUDEVICE);
+}
+
+void ComputationNetwork::PARTraversalFlowControlNode::ForwardPropInterOp(const FrameRange& fr)
+{
+    RunDependencyGraph(*m_threadPool, m_unitInputs, m_unitConsumers, [this, &fr](size_t u)
+    {
+        const auto& node = m_nestedNodes[u];
+        ForwardProp(node, fr);
+        PrimeLayoutCaches(node);
+    });
+}
+
+void ComputationNetwork::PARTraversalFlowControlNode::BackpropInterOp(const FrameRange& fr)
+{
+    // reverse dependencies: a unit back-propagates once all units consuming it are done
+    RunDependencyGraph(*m_threadPool, m_unitConsumers, m_unitInputs, [this, &fr](size_t u)
+    {
+        const auto& node = m_nestedNodes[u];
+
+        // Consumers that share an input both accumulate into its gradient. Serialize them by locking
+        // the gradient locks of all inputs, in ascending unit order to prevent deadlocks.
+        vector<unique_lock<mutex>> locks;
+        locks.reserve(m_unitInputs[u].size());
+        for (auto v : m_unitInputs[u])
+            locks.push_back(unique_lock<mutex>(m_gradientLocks[v]));
+
+        node->BeginBackprop();
+        node->Backprop(fr.WithLayout(node->GetMBLayout()), true /*childrenInThisLoop*/, true /*childrenInOuterLoop*/);
+        node->EndBackprop();
+
+        // Extreme Tracing, part 2/4
+        if (node->HasEnvironmentPtr() && node->Environment().ShouldDumpNode() && node->NeedsGradient())
+            DumpNode<float>(node, /*dumpGradient=*/true) || DumpNode<double>(node, true);
+
+        if (m_onGradientReady)
+            m_onGradientReady(node);
+    });
+}
+
 // helper for logging. Returns false if it was not able to dynamic-cast nodep to ComputationNode<ElemType>
 template<class ElemType>
 static bool DumpNode(ComputationNodeBasePtr nodep, bool dumpGradient)
@@ -530,7 +772,10 @@ void ComputationNetwork::CompileNetwork()
     ValidateNetwork();
 
     // STEP: Optimize the network.
-    // :)
+    // Fusion edits the network, which then is compiled anew. Fused nodes are not fused any further,
+    // so this recurses at most once.
+    if (Globals::ShouldFuseElementwiseOperations() && FuseElementwiseOperations() > 0)
+        return CompileNetwork();
 
     // STEP: Some final details.
     ResetEvalTimeStamps(); // invalidate all m_value fields. Really belongs into StartEvaluateMinibatchLoop()
@@ -1135,6 +1380,7 @@ void ComputationNetwork::AllocateAllMatrices(const std::vector<ComputationNodeBa
     }
 
     m_matrixPool.Reset();
+    m_matrixPool.EnableMemorySharing(!UsesInterOpParallelism()); // the pool's step order is not the execution order when nodes run concurrently
 
     TravserseInSortedGlobalEvalOrder(forwardPropRoots, [&outputValueNeededDuringBackProp, &parentsMap, this](const ComputationNodeBasePtr& node) {
         if (node->Is<SEQTraversalFlowControlNode>())
@@ -1249,9 +1495,9 @@ void ComputationNetwork::AllocateAllMatrices(const std::vector<ComputationNodeBa
     m_matrixPool.OptimizedMemoryAllocation(); 
     m_areMatricesAllocated = true;
 
-    // TO DO: At the time of AllocateAllMatrices we don't know the minibatch size. In theory one may allocate memory again once we start to receive
-    // data from the reader (and the minibatch size is known). For some problems, minibatch size can change constantly, and there needs to be a 
-    // tradeoff in deciding how frequent to run optimized memory allocation. For now, we do it only once at the very beginning for speed concerns. 
+    // At the time of AllocateAllMatrices we don't know the minibatch size. With optimizeMemoryPerMinibatchSize, memory sharing is
+    // re-planned once the minibatch size is known (see OptimizeMemoryForMinibatchSize()); plans are cached per minibatch size bucket,
+    // so a constantly changing minibatch size does not cause constant re-planning.
 
     // TO DO: when some matrices are sparse, the memory size request may be wrong. One may need to call OptimizedMemoryAllocation later again 
     // if the requests of sparse allocation and release are re-processed correctly. Future work. 
@@ -1261,6 +1507,20 @@ void ComputationNetwork::AllocateAllMatrices(const std::vector<ComputationNodeBa
         PrintMemorySharingStructure(GetAllNodes());
 }
 
+// re-plan memory sharing for the minibatch size of the current features, if it falls into a different bucket than the current plan
+void ComputationNetwork::OptimizeMemoryForMinibatchSize()
+{
+    size_t numColumns = DetermineActualMBSizeFromFeatures();
+    if (!m_matrixPool.OptimizeMemoryForNumColumns(numColumns) || TraceLevel() == 0)
+        return;
+
+    numColumns = m_matrixPool.GetPlannedNumColumns();
+    auto stats = m_matrixPool.GetMemoryPlanStatistics(numColumns);
+    const double MB = 1024.0 * 1024.0;
+    fprintf(stderr, "\nMemory sharing re-planned for minibatches of up to %d columns: %d matrices for %d requests, %.1f MB (%.1f MB without sharing, %.1f MB at peak)\n",
+            (int)numColumns, (int)stats.numMatrices, (int)stats.numRequests, stats.plannedMemory / MB, stats.sumOfRequests / MB, stats.peakOfRequests / MB);
+}
+
 void ComputationNetwork::ReleaseMatricesAfterEvalForChildren(ComputationNodeBasePtr n, std::unordered_map<ComputationNodeBasePtr, std::unordered_set<ComputationNodeBasePtr>>& parentsMap)
 {
     for (int i = 0; i < n->GetNumInputs(); i++)
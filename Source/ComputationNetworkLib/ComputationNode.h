@@ -59,7 +59,8 @@
 #define CNTK_MODEL_VERSION_27 27 // Slice: support stride_multiplier, and to_batch / unpack_bach axis ops;
                                  // Reduction: Add reduction over multiple axes
 #define CNTK_MODEL_VERSION_28 28 // Padding op
-#define CURRENT_CNTK_MODEL_VERSION CNTK_MODEL_VERSION_28
+#define CNTK_MODEL_VERSION_29 29 // dense matrices: contiguous 64-byte aligned payloads for bulk and memory-mapped loading
+#define CURRENT_CNTK_MODEL_VERSION CNTK_MODEL_VERSION_29
 
 // helper mode for debugging
 // If TRACK_GAP_NANS is defined then initialize layout gaps to NaN and do NaN checks. Also do detailed logging of node computations.
@@ -73,7 +74,8 @@ enum CopyNodeFlags // flags to be passed to the CopyTo() function
     copyNodeValue          = 1, // copy everything except for the input links
     copyNodeInputLinks     = 2, // copy over input links
     copyNodeAll            = 3, // copy everything
-    copyNodeAcrossNetworks = 4  // allow a cross network child copy
+    copyNodeAcrossNetworks = 4, // allow a cross network child copy
+    copyNodeShareValue     = 8  // with copyNodeValue: reference the value matrix instead of copying it, and don't copy the gradient
 };
 
 #pragma region base computation class
@@ -1280,14 +1282,16 @@ public:
         if (flags & CopyNodeFlags::copyNodeValue)
         {
             auto node = DownCast(nodeP);
-            if (m_value)
+            if (flags & CopyNodeFlags::copyNodeShareValue)
+                node->m_value = m_value;
+            else if (m_value)
             {
                 node->CreateValueMatrixIfNull();
                 node->m_value->SetValue(*m_value);
             }
             else
                 node->m_value = nullptr;
-            if (m_gradient)
+            if (m_gradient && !(flags & CopyNodeFlags::copyNodeShareValue))
             {
                 node->CreateGradientMatrixIfNull();
                 node->m_gradient->SetValue(*m_gradient);
@@ -1327,10 +1331,11 @@ public:
     // This function updates the dimensions to a 2D matrix.
     // If a different tensor layout is associated with this, it must be implanted afterwards.
     // Nodes that call this never have an MB layout.
-    void LoadValue(File& fstream)
+    // useMappedStorage: see Matrix::Read()
+    void LoadValue(File& fstream, bool useMappedStorage = false)
     {
         CreateMatrixIfNull(m_value);
-        fstream >> Value();
+        Value().Read(fstream, useMappedStorage);
         // above reads dimensions, so we must update our own dimensions
         SetDims(TensorShape(Value().GetNumRows(), Value().GetNumCols()), false);
     }
@@ -2281,6 +2286,14 @@ struct IRecurrentNode { virtual int GetRecurrenceSteppingDirection() const = 0;
 
 struct IFreezable { virtual void FreezeParameters() { } };
 
+// =======================================================================
+// IFusedNode -- nodes that stand in for a group of nodes merged when compiling
+// the network. Saving writes the original nodes instead, so that the model
+// file does not depend on whether fusion was enabled.
+// =======================================================================
+
+struct IFusedNode { virtual const std::vector<ComputationNodeBasePtr>& GetUnfusedNodes() const = 0; };
+
 // =======================================================================
 // PreComputedNodeBase -- interface implemented by ComputationNodes that precompute
 // TODO: We can use this interface in more places.
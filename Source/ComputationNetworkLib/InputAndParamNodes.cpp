@@ -460,7 +460,11 @@ void LearnableParameter<ElemType>::Load(File& fstream, size_t modelVersion) /*ov
         }
     }
 
-    LoadValue(fstream);
+    // with a shared mapping, the value stays in the model file's pages (a reload into a mapped value writes its private copy instead)
+    bool useMappedStorage = fstream.ShareReadOnlyData() && !m_valueMapping;
+    LoadValue(fstream, useMappedStorage);
+    if (useMappedStorage && !Value().OwnBuffer())
+        m_valueMapping = fstream.GetMapping();
     SetDims(sampleLayout, false); // note: call this after LoadValue() since LoadValue() overwrites m_sampleLayout
     VerifyDataSize(Value());      // sanity check
 
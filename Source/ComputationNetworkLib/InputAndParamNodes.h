@@ -177,6 +177,9 @@ private:
 
     // flags related to gradient update
     float m_regMultiplier; // The multiplier to adjust the L1Reg and L2Reg for Learnable node
+
+    // memory-mapped model file that Value() points into, if loaded with File::ShareReadOnlyData()
+    std::shared_ptr<char> m_valueMapping;
 };
 
 // -----------------------------------------------------------------------
@@ -350,6 +353,16 @@ public:
         Init(sampleLayout, m_isSparse, m_dynamicAxisNodeName, learningRateMultiplier);
     }
 
+    virtual void CopyTo(ComputationNodeBasePtr nodeP, const std::wstring& newName, const CopyNodeFlags flags) const override
+    {
+        Base::CopyTo(nodeP, newName, flags);
+        if (flags & CopyNodeFlags::copyNodeValue)
+        {
+            auto node = dynamic_pointer_cast<InputValueBase<ElemType>>(nodeP);
+            node->m_dynamicAxisNodeName = m_dynamicAxisNodeName;
+        }
+    }
+
     // InputValue must not resize its inputs because that might destroy it. It should already have the correct size.
     virtual void UpdateFunctionMBSize() override
     {
@@ -9,6 +9,7 @@
 #include <stdexcept>
 #include <vector>
 #include <set>
+#include <map>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -61,6 +62,25 @@ struct MemAllocInfo
     }
 };
 
+// statistics of a memory sharing plan, in bytes, summed over devices and element types
+struct MemoryPlanStatistics
+{
+    size_t numRequests = 0;    // requests that take part in memory sharing
+    size_t numMatrices = 0;    // matrices they are mapped to
+    size_t sumOfRequests = 0;  // memory needed without any sharing
+    size_t peakOfRequests = 0; // memory of the requests that are live at the same step, at the worst step; a lower bound for any plan
+    size_t plannedMemory = 0;  // memory of the planned matrices
+
+    void Add(const MemoryPlanStatistics& other)
+    {
+        numRequests += other.numRequests;
+        numMatrices += other.numMatrices;
+        sumOfRequests += other.sumOfRequests;
+        peakOfRequests += other.peakOfRequests;
+        plannedMemory += other.plannedMemory;
+    }
+};
+
 // MatrixPool -- class to support memory sharing
 // Despite the gather general name of this class, it is specifically designed to support the memory sharing of ComputationNodes.
 // Note: see #define SUPRESS_MEMSHARING below as for how to temporarily disable memory sharing altogether, for debugging
@@ -74,6 +94,7 @@ protected:
     vector<MemRequestInfo<double>> m_memRequestInfoDoubleVec;
     set<DEVICEID_TYPE> m_deviceIDSet; 
     int m_stepCounter; 
+    bool m_memorySharingEnabled = true; // false: every request gets its own matrix (needed when nodes may execute concurrently)
 
     template <class ElemType>
     vector<MemRequestInfo<ElemType>>& GetMemRequestInfoVec();
@@ -94,8 +115,28 @@ protected:
     unordered_map<AliasNodePtr, AliasInfo> m_aliasGroups;
     unordered_map<AliasNodePtr, AliasNodePtr> m_aliasLookup;
 
+    // A plan maps each request (by index into the request vector) to a matrix, and gives the size of each matrix.
+    struct MemoryPlan
+    {
+        vector<int> memoryIds;     // per request
+        vector<size_t> matrixSizes; // per memory id, in elements
+    };
+
+    // plans for minibatch-size-aware memory sharing, by (bucketed) number of minibatch columns
+    map<size_t, MemoryPlan> m_floatMemoryPlans;
+    map<size_t, MemoryPlan> m_doubleMemoryPlans;
+    size_t m_plannedNumColumns = 0; // 0: planned without knowing the minibatch size
+
+    template <class ElemType>
+    map<size_t, MemoryPlan>& GetMemoryPlans();
+
 public:
 
+    // Memory sharing assumes the sequential step order in which requests were made. Disable it when that order is not
+    // the execution order, e.g. for inter-op parallel execution.
+    void EnableMemorySharing(bool enable) { m_memorySharingEnabled = enable; }
+    bool IsMemorySharingEnabled() const { return m_memorySharingEnabled; }
+
     void Reset()
     {
         m_stepCounter = 0;
@@ -151,9 +192,50 @@ public:
         // MatrixPool is not templated, so we call both float and double versions here 
         OptimizedMemoryAllocationFunc<float>(); 
         OptimizedMemoryAllocationFunc<double>();
+        m_floatMemoryPlans.clear();
+        m_doubleMemoryPlans.clear();
+        m_plannedNumColumns = 0;
         return; 
     }
 
+    // Once the minibatch size is known, the memory sharing done by OptimizedMemoryAllocation() can be re-planned with the
+    // actual sizes of the minibatch-scaled requests. Plans are made for buckets of minibatch sizes (four per power of two)
+    // and cached, and the matrices of the previous plan are recycled, so switching between sizes costs little.
+    // Returns true if a new plan was computed.
+    bool OptimizeMemoryForNumColumns(size_t numColumns)
+    {
+        numColumns = GetNumColumnsBucket(numColumns);
+        if (!m_memorySharingEnabled || numColumns == 0 || numColumns == m_plannedNumColumns)
+            return false;
+
+        bool newPlan = ReplanMemory<float>(numColumns);
+        newPlan = ReplanMemory<double>(numColumns) || newPlan;
+        m_plannedNumColumns = numColumns;
+        return newPlan;
+    }
+
+    size_t GetPlannedNumColumns() const { return m_plannedNumColumns; }
+
+    // statistics of the current assignment of matrices, with minibatch-scaled requests evaluated for 'numColumns' columns
+    MemoryPlanStatistics GetMemoryPlanStatistics(size_t numColumns)
+    {
+        MemoryPlanStatistics stats;
+        stats.Add(GetMemoryPlanStatisticsFunc<float>(numColumns));
+        stats.Add(GetMemoryPlanStatisticsFunc<double>(numColumns));
+        return stats;
+    }
+
+    // the upper end of the bucket of minibatch sizes that 'numColumns' falls into
+    static size_t GetNumColumnsBucket(size_t numColumns)
+    {
+        if (numColumns <= 4)
+            return numColumns;
+        size_t step = 1;
+        while ((step << 3) <= numColumns)
+            step <<= 1;
+        return (numColumns + step - 1) / step * step;
+    }
+
     void SetAliasInfo(
         const unordered_map<AliasNodePtr, unordered_set<AliasNodePtr>>& groupMap,
         const unordered_map<AliasNodePtr, AliasNodePtr>& rootLookupMap)
@@ -226,6 +308,257 @@ public:
     }
 
 private: 
+    template <class ElemType>
+    static size_t RequestSize(const MemRequestInfo<ElemType>& memInfo, size_t numColumns)
+    {
+        return memInfo.mbScale ? memInfo.matrixSize * numColumns : memInfo.matrixSize;
+    }
+
+    // Requests that are never released (e.g. gradients of parameters) keep their matrix across plans,
+    // since other code may hold on to it.
+    template <class ElemType>
+    static bool IsPinned(const MemRequestInfo<ElemType>& memInfo)
+    {
+        return memInfo.releaseStep == INT_MAX;
+    }
+
+    // remove all requests that have been marked as sparse matrices, those will not participate in memory sharing
+    // Returns true if any were removed.
+    template <class ElemType>
+    static bool RemoveSparseRequests(vector<MemRequestInfo<ElemType>>& memInfoVec)
+    {
+        bool removed = false;
+        for (auto iter = memInfoVec.begin(); iter != memInfoVec.end(); )
+        {
+            bool hasSparse = false;
+            for (auto matPtr : iter->pMatrixPtrs)
+            {
+                if (*matPtr && (*matPtr)->GetMatrixType() == SPARSE)
+                {
+                    hasSparse = true;
+                    break;
+                }
+            }
+
+            if (hasSparse)
+            {
+                iter = memInfoVec.erase(iter);
+                removed = true;
+            }
+            else
+                iter++; 
+        }
+        return removed;
+    }
+
+    // whether [allocStep, releaseStep] overlaps any of the disjoint occupancy intervals (keyed by their first step)
+    bool CheckOverlap(int allocStep, int releaseStep, const map<int, int>& occupancy) const
+    {
+        if (!m_memorySharingEnabled)
+            return true;
+#ifdef SUPRESS_MEMSHARING
+        return true;
+#endif
+        // only the last interval that starts no later than releaseStep can overlap
+        auto iter = occupancy.upper_bound(releaseStep);
+        if (iter == occupancy.begin())
+            return false;
+        --iter;
+        return iter->second >= allocStep;
+    }
+
+    // Lifetime-aware best-fit packing of the requests into shared matrices, for minibatches of 'numColumns' columns.
+    // Requests are placed from the largest to the smallest, each into the matrix that is not in use during its lifetime
+    // [allocStep, releaseStep] and fits its size most tightly (or needs to grow the least). Workspace and other
+    // requests, and requests on different devices, are not mixed, as in OptimizedMemoryAllocationFunc().
+    template <class ElemType>
+    MemoryPlan PlanMemory(const vector<MemRequestInfo<ElemType>>& memInfoVec, size_t numColumns) const
+    {
+        struct Buffer
+        {
+            DEVICEID_TYPE deviceId;
+            bool isWorkSpace;
+            size_t size;
+            map<int, int> occupancy;
+        };
+        vector<Buffer> buffers;
+        MemoryPlan plan;
+        plan.memoryIds.assign(memInfoVec.size(), -1);
+
+        auto addToBuffer = [&](size_t i, int id)
+        {
+            const auto& memInfo = memInfoVec[i];
+            if (id < 0)
+            {
+                id = (int)buffers.size();
+                buffers.push_back(Buffer{ memInfo.deviceId, memInfo.isWorkSpace, 0, map<int, int>() });
+            }
+            buffers[id].size = max(buffers[id].size, RequestSize(memInfo, numColumns));
+            buffers[id].occupancy[memInfo.allocStep] = memInfo.releaseStep;
+            plan.memoryIds[i] = id;
+        };
+
+        // pinned requests are placed first, each with its own matrix
+        vector<size_t> order;
+        for (size_t i = 0; i < memInfoVec.size(); i++)
+        {
+            if (IsPinned(memInfoVec[i]))
+                addToBuffer(i, -1);
+            else
+                order.push_back(i);
+        }
+
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b)
+        {
+            return RequestSize(memInfoVec[a], numColumns) > RequestSize(memInfoVec[b], numColumns);
+        });
+
+        for (auto i : order)
+        {
+            const auto& memInfo = memInfoVec[i];
+            size_t size = RequestSize(memInfo, numColumns);
+            int best = -1;
+            for (int id = 0; id < (int)buffers.size(); id++)
+            {
+                const auto& buffer = buffers[id];
+                if (buffer.deviceId != memInfo.deviceId || buffer.isWorkSpace != memInfo.isWorkSpace ||
+                    CheckOverlap(memInfo.allocStep, memInfo.releaseStep, buffer.occupancy))
+                    continue;
+                if (best < 0)
+                    best = id;
+                else if (buffer.size >= size) // fits: prefer the smallest that fits
+                {
+                    if (buffers[best].size < size || buffer.size < buffers[best].size)
+                        best = id;
+                }
+                else if (buffers[best].size < size && buffer.size > buffers[best].size) // none fits so far: prefer the one that grows the least
+                    best = id;
+            }
+            addToBuffer(i, best);
+        }
+
+        for (const auto& buffer : buffers)
+            plan.matrixSizes.push_back(buffer.size);
+        return plan;
+    }
+
+    // Points all requests to the matrices of the given plan. Pinned requests keep their matrix; the other existing
+    // matrices are recycled, largest ones for the largest planned sizes, so that little memory needs to be reallocated.
+    template <class ElemType>
+    void AssignMatrices(vector<MemRequestInfo<ElemType>>& memInfoVec, const MemoryPlan& plan)
+    {
+        vector<shared_ptr<Matrix<ElemType>>> matrices(plan.matrixSizes.size());
+        vector<DEVICEID_TYPE> deviceIds(plan.matrixSizes.size());
+        set<const Matrix<ElemType>*> usedMatrices;
+        for (size_t i = 0; i < memInfoVec.size(); i++)
+        {
+            deviceIds[plan.memoryIds[i]] = memInfoVec[i].deviceId;
+            if (IsPinned(memInfoVec[i]))
+            {
+                matrices[plan.memoryIds[i]] = *memInfoVec[i].pMatrixPtrs[0];
+                usedMatrices.insert(memInfoVec[i].pMatrixPtrs[0]->get());
+            }
+        }
+
+        map<DEVICEID_TYPE, vector<shared_ptr<Matrix<ElemType>>>> spareMatrices;
+        for (const auto& memInfo : memInfoVec)
+        {
+            const auto& matrix = *memInfo.pMatrixPtrs[0];
+            if (matrix && usedMatrices.insert(matrix.get()).second)
+                spareMatrices[memInfo.deviceId].push_back(matrix);
+        }
+        for (auto& spare : spareMatrices)
+        {
+            std::stable_sort(spare.second.begin(), spare.second.end(), [](const shared_ptr<Matrix<ElemType>>& a, const shared_ptr<Matrix<ElemType>>& b)
+            {
+                return a->GetNumElements() < b->GetNumElements(); // largest last, to be taken first
+            });
+        }
+
+        vector<int> idsBySize(plan.matrixSizes.size());
+        for (int id = 0; id < (int)idsBySize.size(); id++)
+            idsBySize[id] = id;
+        std::stable_sort(idsBySize.begin(), idsBySize.end(), [&](int a, int b) { return plan.matrixSizes[a] > plan.matrixSizes[b]; });
+        for (auto id : idsBySize)
+        {
+            if (matrices[id])
+                continue;
+            auto& spare = spareMatrices[deviceIds[id]];
+            if (!spare.empty())
+            {
+                matrices[id] = spare.back();
+                spare.pop_back();
+            }
+            else
+                matrices[id] = make_shared<Matrix<ElemType>>(deviceIds[id]);
+        }
+
+        for (size_t i = 0; i < memInfoVec.size(); i++)
+        {
+            memInfoVec[i].SetMemoryId(plan.memoryIds[i]);
+            for (auto pOutMatrixPtr : memInfoVec[i].pMatrixPtrs)
+                *pOutMatrixPtr = matrices[plan.memoryIds[i]];
+        }
+    }
+
+    template <class ElemType>
+    bool ReplanMemory(size_t numColumns)
+    {
+        vector<MemRequestInfo<ElemType>>& memInfoVec = GetMemRequestInfoVec<ElemType>();
+        auto& plans = GetMemoryPlans<ElemType>();
+        // matrices may have been turned into sparse ones since the last plan, e.g. by sparse gradient optimizations
+        if (RemoveSparseRequests(memInfoVec))
+            plans.clear();
+        if (memInfoVec.empty())
+            return false;
+
+        auto iter = plans.find(numColumns);
+        bool newPlan = iter == plans.end();
+        if (newPlan)
+            iter = plans.insert(make_pair(numColumns, PlanMemory(memInfoVec, numColumns))).first;
+        AssignMatrices(memInfoVec, iter->second);
+        return newPlan;
+    }
+
+    template <class ElemType>
+    MemoryPlanStatistics GetMemoryPlanStatisticsFunc(size_t numColumns)
+    {
+        MemoryPlanStatistics stats;
+        const vector<MemRequestInfo<ElemType>>& memInfoVec = GetMemRequestInfoVec<ElemType>();
+        map<const Matrix<ElemType>*, size_t> matrixSizes;
+        map<DEVICEID_TYPE, vector<pair<int64_t, int64_t>>> events; // (step, size change) per device
+        for (const auto& memInfo : memInfoVec)
+        {
+            size_t size = RequestSize(memInfo, numColumns);
+            stats.numRequests++;
+            stats.sumOfRequests += size;
+            auto& matrixSize = matrixSizes[memInfo.pMatrixPtrs[0]->get()];
+            matrixSize = max(matrixSize, size);
+            events[memInfo.deviceId].push_back(make_pair((int64_t)memInfo.allocStep, (int64_t)size));
+            events[memInfo.deviceId].push_back(make_pair((int64_t)memInfo.releaseStep + 1, -(int64_t)size));
+        }
+        stats.numMatrices = matrixSizes.size();
+        for (const auto& matrixSize : matrixSizes)
+            stats.plannedMemory += matrixSize.second;
+        for (auto& deviceEvents : events)
+        {
+            // releases are sorted before allocations at the same step
+            std::sort(deviceEvents.second.begin(), deviceEvents.second.end());
+            int64_t live = 0, peak = 0;
+            for (const auto& event : deviceEvents.second)
+            {
+                live += event.second;
+                peak = max(peak, live);
+            }
+            stats.peakOfRequests += (size_t)peak;
+        }
+
+        stats.sumOfRequests *= sizeof(ElemType);
+        stats.peakOfRequests *= sizeof(ElemType);
+        stats.plannedMemory *= sizeof(ElemType);
+        return stats;
+    }
+
     bool CheckOverlap(pair<int, int>occ, vector<pair<int, int>>&occVec)
     {
         bool bRet = false;
@@ -238,10 +571,11 @@ private:
             }
         }
 //#define SUPRESS_MEMSHARING // #define this to disable memory sharing by always return true 
-// TODO: Make this a runtime option.
 #ifdef SUPRESS_MEMSHARING
         bRet = true; 
 #endif
+        if (!m_memorySharingEnabled)
+            bRet = true;
         return bRet;
     }
 
@@ -252,24 +586,7 @@ private:
         if (memInfoVec.empty())
             return; 
 
-        // remove all requests that has been marked as sparse matrices, those will not participate in memory sharing 
-        for (auto iter = memInfoVec.begin(); iter != memInfoVec.end(); )
-        {
-            bool hasSparse = false;
-            for (auto matPtr : iter->pMatrixPtrs)
-            {
-                if ((*matPtr)->GetMatrixType() == SPARSE)
-                {
-                    hasSparse = true;
-                    break;
-                }
-            }
-
-            if (hasSparse)
-                memInfoVec.erase(iter);
-            else
-                iter++; 
-        }
+        RemoveSparseRequests(memInfoVec);
 
         // sort the memory request from largest size to smallest 
         std::sort(memInfoVec.begin(), memInfoVec.end(), greater_than_mem_req_size<ElemType>());
@@ -663,4 +663,260 @@ DefineComparisonNode(GreaterNode,       1, 0)
 DefineComparisonNode(GreaterEqualNode, -1, 1)
 DefineComparisonNode(NotEqualNode,      0, 1)
 DefineComparisonNode(LessEqualNode,     1, 1)
+
+// -----------------------------------------------------------------------
+// FusedElementwiseNode (input0, input1, ...)
+// A chain of elementwise nodes that ComputationNetwork::FuseElementwiseOperations()
+// has merged into one node. The chain is kept as an ElementWiseProgram over
+// its inputs, which is evaluated without materializing the intermediate
+// values. The gradient w.r.t. each input is derived symbolically from that
+// program, as another program over the inputs and the output gradient.
+// The node only exists in compiled networks. It keeps the nodes of the chain,
+// which are saved in its place.
+// -----------------------------------------------------------------------
+
+template <class ElemType>
+class FusedElementwiseNode : public ComputationNode<ElemType>, public IFusedNode
+{
+    typedef ComputationNode<ElemType> Base;
+    UsingComputationNodeMembersBoilerplate;
+
+    static const std::wstring TypeName()
+    {
+        return L"FusedElementwise";
+    }
+
+public:
+    DeclareConstructorFromConfig(FusedElementwiseNode);
+    FusedElementwiseNode(DEVICEID_TYPE deviceId, const wstring& name)
+        : Base(deviceId, name)
+    {
+    }
+    // unfusedNodes: the nodes of the chain, starting with its last node, which has the same name as this node
+    FusedElementwiseNode(DEVICEID_TYPE deviceId, const wstring& name, const ElementWiseProgram& program, const vector<ComputationNodeBasePtr>& unfusedNodes)
+        : Base(deviceId, name), m_unfusedNodes(unfusedNodes)
+    {
+        SetProgram(program);
+    }
+
+    virtual const vector<ComputationNodeBasePtr>& GetUnfusedNodes() const override { return m_unfusedNodes; }
+
+    const ElementWiseProgram& GetProgram() const { return m_program; }
+
+    void SetProgram(const ElementWiseProgram& program)
+    {
+        if (!CanFuse(program))
+            InvalidArgument("%ls: The elementwise program cannot be fused.", NodeDescription().c_str());
+        m_program = program;
+        m_gradientPrograms.resize(program.numInputs);
+        for (size_t i = 0; i < program.numInputs; i++)
+            DeriveGradientProgram(m_program, i, m_gradientPrograms[i]);
+    }
+
+    // check whether the gradients of a program can be derived, and whether they fit into the limits of ElementWiseProgram
+    static bool CanFuse(const ElementWiseProgram& program)
+    {
+        if (program.numInputs == 0 || program.instructions.empty())
+            return false;
+        ElementWiseProgram gradientProgram;
+        for (size_t i = 0; i < program.numInputs; i++)
+            if (!DeriveGradientProgram(program, i, gradientProgram))
+                return false;
+        return true;
+    }
+
+    virtual void CopyTo(ComputationNodeBasePtr nodeP, const std::wstring& newName, const CopyNodeFlags flags) const override
+    {
+        Base::CopyTo(nodeP, newName, flags);
+        if (flags & CopyNodeFlags::copyNodeValue)
+        {
+            auto node = dynamic_pointer_cast<FusedElementwiseNode<ElemType>>(nodeP);
+            node->m_program = m_program;
+            node->m_gradientPrograms = m_gradientPrograms;
+            node->m_unfusedNodes = m_unfusedNodes;
+        }
+    }
+
+    // the chain may contain the inputs of a loop through this node
+    virtual void DetachInputs() override
+    {
+        Base::DetachInputs();
+        for (const auto& node : m_unfusedNodes)
+            node->DetachInputs();
+        m_unfusedNodes.clear();
+    }
+
+    virtual void /*IComputationNode::*/ BeginForwardProp() override // called before first iteration step of ForwardProp()
+    {
+        Base::BeginForwardProp();
+        // we switch result to dense as a work-around because ColumnSlice doesn't support all the sparse formats
+        // TODO: This is a stopgap. Is this the right thing to do? It changes the matrix type in-place.
+        Value().SwitchToMatrixType(MatrixType::DENSE, MatrixFormat::matrixFormatDense, false);
+    }
+
+    virtual void /*ComputationNodeBase::*/ Validate(bool isFinalValidationPass) override
+    {
+        if (GetNumInputs() != m_program.numInputs || m_program.instructions.empty())
+            InvalidArgument("%ls: The number of inputs does not match the elementwise program.", NodeDescription().c_str());
+        ValidateNaryZip(isFinalValidationPass, /*allowBroadcast=*/ true, GetNumInputs());
+    }
+
+    virtual void /*ComputationNode::*/ ForwardProp(const FrameRange& fr) override
+    {
+        size_t rank = DetermineElementwiseTensorRank();
+        auto result = ValueTensorFor(rank, fr);
+        vector<TensorView<ElemType>> inputs;
+        for (size_t i = 0; i < GetNumInputs(); i++)
+            inputs.push_back(InputRef(i).ValueTensorFor(rank, fr.AllowBroadcast()));
+        result.DoFusedOpOf(0, inputs, 1, m_program);
+    }
+
+    virtual void /*ComputationNode::*/ BackpropTo(const size_t inputIndex, const FrameRange& fr) override
+    {
+        size_t rank = DetermineElementwiseTensorRank();
+        auto inputGradient = InputRef(inputIndex).GradientTensorFor(rank, fr.AllowBroadcast());
+
+        // if reduction then mask the respective input(s) (zero out the gaps)
+        // The gradient program also reads the other inputs, which must not inject NaNs from the gaps.
+        if (InputRef(inputIndex).ReducesInTimeWrt(shared_from_this()))
+        {
+            MaskMissingGradientColumnsToZero(fr);
+            for (size_t i = 0; i < GetNumInputs(); i++)
+                if (i != inputIndex && InputRef(i).HasMBLayout())
+                    InputRef(i).MaskMissingValueColumnsToZero(fr);
+        }
+
+        // operands of the gradient program: all inputs, then the output gradient
+        vector<TensorView<ElemType>> operands;
+        for (size_t i = 0; i < GetNumInputs(); i++)
+            operands.push_back(InputRef(i).ValueTensorFor(rank, fr.AllowBroadcast()));
+        operands.push_back(GradientTensorFor(rank, fr));
+        inputGradient.DoFusedOpOf(InputRef(inputIndex).IsGradientInitializedBy(this) ? 0.0f : 1.0f, operands, 1, m_gradientPrograms[inputIndex]);
+    }
+
+    // the output is recomputed by the gradient programs as far as needed
+    virtual bool OutputUsedInComputingInputNodesGradients() const override { return false; }
+    virtual bool InputUsedInComputingInputNodesGradients(size_t /*childIndex*/) const override { return true; }
+    virtual ParentGradientOptimization ImplementsGradientOptimization(const ComputationNodeBase*) const override { return ParentGradientOptimization::Overwrite; }
+
+private:
+    // Reverse-mode differentiation of 'program' w.r.t. input 'inputIndex'. The inputs of the resulting program are the
+    // inputs of 'program' followed by the output gradient. Intermediate values are recomputed where the gradient needs them.
+    // Returns false if an operation has no gradient rule here, or if the result exceeds the limits of ElementWiseProgram.
+    static bool DeriveGradientProgram(const ElementWiseProgram& program, size_t inputIndex, ElementWiseProgram& gradientProgram)
+    {
+        const size_t numInputs = program.numInputs;
+        const size_t numInstructions = program.instructions.size();
+        const size_t outputGradient = numInputs; // register of the output gradient
+        if (numInputs + 1 > ElementWiseProgram::MaxInputs || inputIndex >= numInputs)
+            return false;
+
+        // registers: [0, numInputs) inputs, then the output gradient, then code[]
+        struct Instruction
+        {
+            ElementWiseOperator op;
+            size_t args[3];
+        };
+        vector<Instruction> code;
+        auto emit = [&](ElementWiseOperator op, size_t a, size_t b)
+        {
+            code.push_back(Instruction{ op, { a, b, 0 } });
+            return numInputs + code.size(); // (== numInputs + 1 + index in code[])
+        };
+
+        // recompute the forward values; register j of 'program' becomes forwardRegisters[j]
+        vector<size_t> forwardRegisters(numInputs + numInstructions);
+        for (size_t j = 0; j < numInputs; j++)
+            forwardRegisters[j] = j;
+        for (size_t k = 0; k < numInstructions; k++)
+        {
+            const auto& instruction = program.instructions[k];
+            if (instruction.args[0] >= numInputs + k || instruction.args[1] >= numInputs + k)
+                return false;
+            forwardRegisters[numInputs + k] = emit(instruction.op, forwardRegisters[instruction.args[0]], forwardRegisters[instruction.args[1]]);
+        }
+
+        // propagate the gradient backwards through the instructions
+        const size_t none = SIZE_MAX;
+        vector<size_t> gradients(numInputs + numInstructions, none);
+        gradients.back() = outputGradient;
+        auto accumulate = [&](size_t j, size_t gradient)
+        {
+            gradients[j] = gradients[j] == none ? gradient : emit(ElementWiseOperator::opSum, gradients[j], gradient);
+        };
+        for (size_t k = numInstructions; k-- > 0;)
+        {
+            const size_t g = gradients[numInputs + k];
+            if (g == none)
+                continue;
+            const auto& instruction = program.instructions[k];
+            const size_t a = instruction.args[0];
+            const size_t b = instruction.args[1];
+            const size_t output = forwardRegisters[numInputs + k];
+            switch (instruction.op)
+            {
+            case ElementWiseOperator::opCopy:              accumulate(a, g); break;
+            case ElementWiseOperator::opNegate:            accumulate(a, emit(ElementWiseOperator::opNegate, g, 0)); break;
+            case ElementWiseOperator::opSigmoid:           accumulate(a, emit(ElementWiseOperator::opElementwiseProductWithSigmoidDerivativeFromOutput, g, output)); break;
+            case ElementWiseOperator::opStableSigmoid:     accumulate(a, emit(ElementWiseOperator::opElementwiseProductWithSigmoidDerivativeFromOutput, g, output)); break;
+            case ElementWiseOperator::opTanh:              accumulate(a, emit(ElementWiseOperator::opElementwiseProductWithTanhDerivativeFromOutput, g, output)); break;
+            case ElementWiseOperator::opLinearRectifier:   accumulate(a, emit(ElementWiseOperator::opElementwiseProductWithLinearRectifierDerivativeFromOutput, g, output)); break;
+            case ElementWiseOperator::opExp:               accumulate(a, emit(ElementWiseOperator::opElementwiseProduct, g, output)); break;
+            case ElementWiseOperator::opSum:               accumulate(a, g); accumulate(b, g); break;
+            case ElementWiseOperator::opDifference:        accumulate(a, g); accumulate(b, emit(ElementWiseOperator::opNegate, g, 0)); break;
+            case ElementWiseOperator::opElementwiseProduct:
+                accumulate(a, emit(ElementWiseOperator::opElementwiseProduct, g, forwardRegisters[b]));
+                accumulate(b, emit(ElementWiseOperator::opElementwiseProduct, g, forwardRegisters[a]));
+                break;
+            default:
+                return false;
+            }
+        }
+        size_t result = gradients[inputIndex];
+        if (result == none) // input is not used
+            return false;
+        if (result <= numInputs) // the gradient is an operand itself
+            result = emit(ElementWiseOperator::opCopy, result, 0);
+
+        // drop the code that the result does not depend on
+        const size_t numOperands = numInputs + 1;
+        vector<bool> isNeeded(numOperands + code.size(), false);
+        isNeeded[result] = true;
+        for (size_t j = result + 1; j-- > numOperands;)
+        {
+            if (!isNeeded[j])
+                continue;
+            const auto& instruction = code[j - numOperands];
+            for (size_t n = 0; n < GetElementWiseOperatorArity(instruction.op); n++)
+                isNeeded[instruction.args[n]] = true;
+        }
+        size_t numNeeded = 0;
+        for (size_t j = numOperands; j <= result; j++)
+            numNeeded += isNeeded[j];
+        if (numOperands + numNeeded > ElementWiseProgram::MaxRegisters)
+            return false;
+
+        gradientProgram = ElementWiseProgram();
+        gradientProgram.numInputs = numOperands;
+        vector<size_t> newRegisters(numOperands + code.size());
+        for (size_t j = 0; j < numOperands; j++)
+            newRegisters[j] = j;
+        for (size_t j = numOperands; j <= result; j++)
+        {
+            if (!isNeeded[j])
+                continue;
+            const auto& instruction = code[j - numOperands];
+            newRegisters[j] = gradientProgram.Add(instruction.op, newRegisters[instruction.args[0]], newRegisters[instruction.args[1]]);
+        }
+        return true;
+    }
+
+    ElementWiseProgram m_program;
+    vector<ElementWiseProgram> m_gradientPrograms; // [inputIndex]
+    vector<ComputationNodeBasePtr> m_unfusedNodes;
+};
+
+template class FusedElementwiseNode<float>;
+template class FusedElementwiseNode<double>;
+
 }}}
@@ -12,6 +12,7 @@
 #include "CPURNGHandle.h"
 
 #define __STDC_FORMAT_MACROS
+#include <algorithm>
 #include <inttypes.h>
 #include <map>
 #include <string>
@@ -1489,39 +1490,102 @@ public:
           m_softMax(deviceId),
           m_grdToSoftMaxInput(deviceId),
           m_clsLogSoftmax(deviceId),
-          m_clsSoftmax(deviceId)
+          m_clsSoftmax(deviceId),
+          m_frameColumns(deviceId),
+          m_wordLabels(deviceId),
+          m_clsLabels(deviceId),
+          m_obsByClass(deviceId),
+          m_grdToObsByClass(deviceId),
+          m_grdToClsSoftMaxInput(deviceId)
     {
     }
 
 private:
-    // iterate over a large workspace that contains all class-conditioned probs concatenated
-    // 'sz' is the offset into that vector. We will iterate over these vectors at a few places. Always use this same boilerplate code.
-    template<class F>
-    size_t ForColumnsWithClass(const F& op)
-    {
-        const size_t nT = Input(LABELDATA)->GetNumTimeSteps();
-        const size_t nS = Input(LABELDATA)->GetNumParallelSequences();
-        size_t sz = 0; // iterate over the packed concatenated class-conditioned prob vectors
-        for (size_t s = 0; s < nS; s++)
-            for (size_t t = 0; t < nT; t++)
+    // The frames of the minibatch are grouped by class (by the range of words of the class), so that the class-conditional scores
+    // of all frames of a class come from one matrix product with the weights of the class members, followed by one column-wise log softmax.
+    // A large workspace contains all class-conditioned probs concatenated. The frames of a group are consecutive in it, and
+    // the group is a [nbrWrd x numFrames] column-major matrix.
+    struct ClassGroup
+    {
+        size_t lftBnd;     // index of the first word belonging to the class
+        size_t nbrWrd;     // number of words in the class
+        size_t firstFrame; // offset of the group's frames in m_frameColumns
+        size_t numFrames;
+        size_t firstWord;  // offset of the group into the concatenated class-conditioned prob vectors
+    };
+
+    // view of one group in the concatenated class-conditioned prob vectors
+    static Matrix<ElemType> GroupSlice(const Matrix<ElemType>& concatenated, const ClassGroup& group)
+    {
+        return concatenated.ColumnSlice(group.firstWord, group.nbrWrd * group.numFrames).Reshaped(group.nbrWrd, group.numFrames);
+    }
+
+    // determine the class groups from the labels, and the matrices that map the groups' frames to minibatch columns and hold the one-hot labels
+    void GroupFramesByClass()
+    {
+        const auto& pMBLayout = InputRef(LABELDATA).GetMBLayout();
+        const Matrix<ElemType>& lbls = InputRef(LABELDATA).Value(); // on the CPU, see ForwardPropNonLooping()
+        const size_t nT = pMBLayout->GetNumTimeSteps();
+        const size_t nS = pMBLayout->GetNumParallelSequences();
+
+        struct Frame
+        {
+            size_t j, y_t, c_t, lft_bnd, nbr_wrd;
+        };
+        vector<Frame> frames;
+        frames.reserve(nT * nS);
+        for (size_t t = 0; t < nT; t++)
+            for (size_t s = 0; s < nS; s++)
             {
-                FrameRange fr = FrameRange(Input(LABELDATA)->GetMBLayout(), t).Sequence(s);
-                if (Input(LABELDATA)->GetMBLayout()->IsGap(fr)) // skip gaps
+                if (pMBLayout->IsGap(FrameRange(pMBLayout, t).Sequence(s))) // skip gaps
                     continue;
 
-                const Matrix<ElemType>& lbl_t = Input(LABELDATA)->ValueFor(fr);
-                size_t y_t = (size_t)lbl_t(0, 0);     // current word token index
-                size_t c_t = (size_t)lbl_t(1, 0);     // current word token's class index
-                size_t lft_bnd = (size_t)lbl_t(2, 0); // index of first word belonging to current word token's class
-                size_t rgt_bnd = (size_t)lbl_t(3, 0); // and end of that range
+                size_t j = t * nS + s;
+                size_t y_t = (size_t)lbls(0, j);     // current word token index
+                size_t c_t = (size_t)lbls(1, j);     // current word token's class index
+                size_t lft_bnd = (size_t)lbls(2, j); // index of first word belonging to current word token's class
+                size_t rgt_bnd = (size_t)lbls(3, j); // and end of that range
                 size_t nbr_wrd = (rgt_bnd - lft_bnd); // number of words in the class
 
-                // perform the operation
-                op(s, t, fr, y_t, c_t, sz, lft_bnd, nbr_wrd);
+                if (nbr_wrd == 0)
+                    LogicError("ClassBasedCrossEntropyWithSoftmax: Encountered a class of size 0.");
+                if (y_t < lft_bnd || y_t >= lft_bnd + nbr_wrd)
+                    LogicError("ClassBasedCrossEntropyWithSoftmax: Word index out of bounds of class-member index range (word not a class member).");
+                if (c_t >= m_nbrCls)
+                    LogicError("ClassBasedCrossEntropyWithSoftmax: Class index out of bounds.");
 
-                sz += nbr_wrd;
+                frames.push_back(Frame{ j, y_t, c_t, lft_bnd, nbr_wrd });
             }
-        return sz;
+        std::stable_sort(frames.begin(), frames.end(), [](const Frame& a, const Frame& b)
+        {
+            return a.lft_bnd < b.lft_bnd || (a.lft_bnd == b.lft_bnd && a.nbr_wrd < b.nbr_wrd);
+        });
+
+        m_classGroups.clear();
+        m_totalNbrWords = 0;
+        vector<ElemType> frameColumns(frames.size());
+        vector<ElemType> wordLabels;                      // one-hot word within its class, concatenated like the class-conditioned probs
+        vector<ElemType> clsLabels(m_nbrCls * nT * nS, 0); // one-hot class, zero in gaps
+        for (size_t i = 0; i < frames.size(); i++)
+        {
+            const auto& frame = frames[i];
+            if (m_classGroups.empty() || m_classGroups.back().lftBnd != frame.lft_bnd || m_classGroups.back().nbrWrd != frame.nbr_wrd)
+                m_classGroups.push_back(ClassGroup{ frame.lft_bnd, frame.nbr_wrd, i, 0, m_totalNbrWords });
+            m_classGroups.back().numFrames++;
+
+            frameColumns[i] = (ElemType)frame.j;
+            wordLabels.resize(m_totalNbrWords + frame.nbr_wrd, 0);
+            wordLabels[m_totalNbrWords + frame.y_t - frame.lft_bnd] = 1;
+            clsLabels[frame.j * m_nbrCls + frame.c_t] = 1;
+            m_totalNbrWords += frame.nbr_wrd;
+        }
+        // now m_totalNbrWords = total size of concatenated vector
+
+        if (frames.empty()) // nothing but gaps
+            return;
+        m_frameColumns.SetValue(1, frameColumns.size(), m_deviceId, frameColumns.data());
+        m_wordLabels.SetValue(1, wordLabels.size(), m_deviceId, wordLabels.data());
+        m_clsLabels.SetValue(m_nbrCls, nT * nS, m_deviceId, clsLabels.data());
     }
 
     // compute gradients to input observations, the weights to the observations, and the class log posterior probabilities
@@ -1531,67 +1595,61 @@ private:
         if (inputIndex != 1 && inputIndex != 2 && inputIndex != 3)
             InvalidArgument("ClassCrossEntropyWithSoftmaxNode criterion only takes with respect to input, weight to the input and class log posterior probability.");
 
+        if (m_classGroups.empty())
+            return;
+
         ComputeSoftMaxPartial(); // Note: Flag m_needRecomputeGradientToSoftmaxInput guards so that this computes only once.
 
-        ForColumnsWithClass([&](size_t /*s*/, size_t /*t*/, const FrameRange& fr, size_t /*y_t*/, size_t c_t, size_t sz, size_t lft_bnd, size_t nbr_wrd)
+        switch (inputIndex)
         {
-            // compute prb - 1 and prb
-            Matrix<ElemType> weightForClass = InputRef(EMBEDDINGMATRIX).ValueAsMatrix().ColumnSlice(lft_bnd, nbr_wrd);
-            Matrix<ElemType> obs = InputRef(INPUTDATA).ValueFor(fr); // hidden activation vector for current word token
-            Matrix<ElemType> grd_to_soft_max_input = m_grdToSoftMaxInput.ColumnSlice(sz, nbr_wrd);
-
-            switch (inputIndex)
+            case 1:
             {
-                case 1:
+                // gradient to input, for all frames of a class at once, then scattered back to the frames' columns
+                m_grdToObsByClass.Resize(m_obsByClass.GetNumRows(), m_obsByClass.GetNumCols());
+                for (const auto& group : m_classGroups)
                 {
-                    // gradient to input
-                    Matrix<ElemType> grd_t = InputRef(INPUTDATA).GradientFor(fr);
-                    Matrix<ElemType>::MultiplyAndAdd(weightForClass, false, grd_to_soft_max_input, true, grd_t);
-                    break;
+                    Matrix<ElemType> weightForClass = InputRef(EMBEDDINGMATRIX).ValueAsMatrix().ColumnSlice(group.lftBnd, group.nbrWrd);
+                    Matrix<ElemType> grd_to_obs = m_grdToObsByClass.ColumnSlice(group.firstFrame, group.numFrames);
+                    Matrix<ElemType>::Multiply(weightForClass, false, GroupSlice(m_grdToSoftMaxInput, group), false, grd_to_obs);
                 }
-                case 2:
-                {
-                    // gradient to input weight
-                    Matrix<ElemType> grd_to_wgt_t = InputRef(EMBEDDINGMATRIX).GradientAsMatrix().ColumnSlice(lft_bnd, nbr_wrd);
-                    Matrix<ElemType>::MultiplyAndAdd(obs, false, grd_to_soft_max_input, false, grd_to_wgt_t);
-                    break;
-                }
-                case 3:
+                InputRef(INPUTDATA).Gradient().DoScatterColumnsOf(1, m_frameColumns, m_grdToObsByClass, 1);
+                break;
+            }
+            case 2:
+            {
+                // gradient to input weight, summed over the frames of a class by the matrix product
+                for (const auto& group : m_classGroups)
                 {
-                    Matrix<ElemType> grd_t = InputRef(CLASSPROBINDATA).GradientFor(fr);
-                    grd_t.AssignValuesOf(InputRef(CLASSPROBINDATA).DataFor(m_clsSoftmax, fr));
-                    ComputeCEPartialToSoftmaxInputs(grd_t, Gradient(), c_t);
-                    break;
+                    Matrix<ElemType> obs = m_obsByClass.ColumnSlice(group.firstFrame, group.numFrames);
+                    Matrix<ElemType> grd_to_wgt = InputRef(EMBEDDINGMATRIX).GradientAsMatrix().ColumnSlice(group.lftBnd, group.nbrWrd);
+                    Matrix<ElemType>::MultiplyAndAdd(obs, false, GroupSlice(m_grdToSoftMaxInput, group), true, grd_to_wgt);
                 }
+                break;
             }
-        });
+            case 3:
+            {
+                // prb - 1 at the class, and prb elsewhere
+                const auto& pMBLayout = InputRef(CLASSPROBINDATA).GetMBLayout();
+                m_grdToClsSoftMaxInput.AssignDifferenceOf(m_clsSoftmax, m_clsLabels);
+                MaskMissingColumnsToZero(m_grdToClsSoftMaxInput, pMBLayout, FrameRange(pMBLayout));
+                Matrix<ElemType>::Scale(Gradient(), m_grdToClsSoftMaxInput);
+                InputRef(CLASSPROBINDATA).Gradient() += m_grdToClsSoftMaxInput;
+                break;
+            }
+        }
     }
 
     virtual bool OutputUsedInComputingInputNodesGradients() const override { return false; }
 
 private:
-    void ComputeCEPartialToSoftmaxInputs(Matrix<ElemType>& inputGradientValues, Matrix<ElemType>& gradientValues, size_t y_t)
-    {
-        Matrix<ElemType>::MinusOneAt(inputGradientValues, y_t);
-        Matrix<ElemType>::Scale(gradientValues, inputGradientValues);
-    }
-
     // gradient of cross entropy w.r.t. to input to softmax
     void ComputeSoftMaxPartial()
     {
         if (m_needRecomputeGradientToSoftmaxInput)
         {
-            m_grdToSoftMaxInput.Resize(1, m_totalNbrWords); // buffer that contains a concatenation of class-conditional values
-
-            ForColumnsWithClass([&](size_t /*s*/, size_t /*t*/, const FrameRange& /*fr*/, size_t y_t, size_t /*c_t*/, size_t sz, size_t lft_bnd, size_t nbr_wrd)
-            {
-                Matrix<ElemType> softMax = m_softMax.ColumnSlice(sz, nbr_wrd);
-
-                size_t idx_in_class = y_t - lft_bnd;
-                ComputeCEPartialToSoftmaxInputs(softMax, Gradient(), idx_in_class);
-
-                m_grdToSoftMaxInput.ColumnSlice(sz, nbr_wrd).AssignValuesOf(softMax);
-            });
+            // buffer that contains a concatenation of class-conditional values
+            m_grdToSoftMaxInput.AssignDifferenceOf(m_softMax, m_wordLabels);
+            Matrix<ElemType>::Scale(Gradient(), m_grdToSoftMaxInput);
 
             m_needRecomputeGradientToSoftmaxInput = false;
         }
@@ -1611,71 +1669,49 @@ public:
 
         auto& functionValues = Value();
 
-        const size_t hdSize = InputRef(INPUTDATA).GetSampleMatrixNumRows();
         assert(m_nbrCls == InputRef(CLASSPROBINDATA).GetSampleMatrixNumRows());
 
+        GroupFramesByClass();
+        m_needRecomputeGradientToSoftmaxInput = true;
+        if (m_classGroups.empty())
+        {
+            functionValues.SetValue(0);
+            return;
+        }
+
         // compute the class posteriors
+        const auto& pMBLayout = InputRef(CLASSPROBINDATA).GetMBLayout();
         m_clsLogSoftmax.SetValue(InputRef(CLASSPROBINDATA).Value());
-        m_clsLogSoftmax.InplaceLogSoftmax(true);   // log
-        m_clsSoftmax.AssignExpOf(m_clsLogSoftmax); // non-log
+        m_clsLogSoftmax.InplaceLogSoftmax(true);                                     // log
+        MaskMissingColumnsToZero(m_clsLogSoftmax, pMBLayout, FrameRange(pMBLayout)); // so that gaps do not enter the objective
+        m_clsSoftmax.AssignExpOf(m_clsLogSoftmax);                                   // non-log
 
-        // create a large workspace to contain all class-conditioned probs concatenated
-        m_totalNbrWords = ForColumnsWithClass([](size_t /*s*/, size_t /*t*/, const FrameRange& /*fr*/, size_t y_t, size_t /*c_t*/, size_t /*sz*/, size_t lft_bnd, size_t nbr_wrd)
-        {
-            if (nbr_wrd == 0)
-                LogicError("ClassBasedCrossEntropyWithSoftmax: Encountered a class of size 0.");
-            if (y_t < lft_bnd || y_t >= lft_bnd + nbr_wrd)
-                LogicError("ClassBasedCrossEntropyWithSoftmax: Word index out of bounds of class-member index range (word not a class member).");
-        });
-        // now m_totalNbrWords = total size of concatenated vector
+        // hidden activation vectors of all word tokens, grouped by class
+        m_obsByClass.DoGatherColumnsOf(0, m_frameColumns, InputRef(INPUTDATA).Value(), 1); // [hdSize x #frames]
 
         // buffer to hold the concatenated class-conditioned prob vectors
-        m_softMax.Resize(1, m_totalNbrWords);
         m_logSoftmax.Resize(1, m_totalNbrWords);
-
-        // accumulate objective
-        functionValues.SetValue(0);
-        ForColumnsWithClass([&](size_t s, size_t t, const FrameRange& fr, size_t y_t, size_t c_t, size_t sz, size_t lft_bnd, size_t nbr_wrd)
+        for (const auto& group : m_classGroups)
         {
-            // now get views of various arrays that correspond to the index range of words belonging to this class
-
-            // get hidden vectors for the words in this class
-            Matrix<ElemType> weightForClass = InputRef(EMBEDDINGMATRIX).ValueAsMatrix().ColumnSlice(lft_bnd, nbr_wrd); // [hdSize x nbr_wrd]
-
-            // buffer to hold the class-conditional distribution
-            Matrix<ElemType> softMax_t = m_softMax.ColumnSlice(sz, nbr_wrd); // TODO: declare these outside of the loop to avoid the malloc
-            Matrix<ElemType> logSoftMax_t = m_logSoftmax.ColumnSlice(sz, nbr_wrd);
-
-            Matrix<ElemType> obs = InputRef(INPUTDATA).ValueFor(fr); // hidden activation vector for current word token
-
-            // multiply hidden activation with weight matrix (the slice of the weight matrix for the range of class members)
-            // TODO: can we use 'true' here instead? Above transposition hack won't work with row slices. 'obs' not used elsewhere
-            obs.Reshape(1, hdSize);                                                                                // transpose it (make it a column vector)
-            logSoftMax_t.AssignProductOf(obs /*(1 x hdSize)*/, false, weightForClass /*hdSize x nbr_wrd*/, false); // -> 1 x nbr_word
-
-            // log softmax(W x_t)
-            logSoftMax_t.InplaceLogSoftmax(false);
-
-            // and non-log version
-            softMax_t.SetValue(logSoftMax_t);
-            softMax_t.InplaceExp();
-            // we now have a column vector of class-conditional probabilities over the class members
-
-            // add  the word's class-conditional log posterior
-            size_t idx_in_class = y_t - lft_bnd;
-            Matrix<ElemType>::AddElementToElement(logSoftMax_t, 0, idx_in_class, functionValues, 0, 0); // (1x1)
-
-            // add the class log posterior probability (for backprop)
-            auto clsLogSoftmax_t = InputRef(CLASSPROBINDATA).DataFor(m_clsLogSoftmax, fr);
-            Matrix<ElemType>::AddElementToElement(clsLogSoftmax_t, c_t, 0, functionValues, 0, 0); // (1x1)
-        });
+            // weights for the words in this class
+            Matrix<ElemType> weightForClass = InputRef(EMBEDDINGMATRIX).ValueAsMatrix().ColumnSlice(group.lftBnd, group.nbrWrd); // [hdSize x nbrWrd]
+            Matrix<ElemType> obs = m_obsByClass.ColumnSlice(group.firstFrame, group.numFrames);                                   // [hdSize x numFrames]
+
+            // log softmax(W' x_t) for all word tokens of this class
+            Matrix<ElemType> logSoftMax = GroupSlice(m_logSoftmax, group);
+            Matrix<ElemType>::Multiply(weightForClass, true, obs, false, logSoftMax); // -> [nbrWrd x numFrames]
+            logSoftMax.InplaceLogSoftmax(true);
+        }
+        // and non-log version
+        m_softMax.AssignExpOf(m_logSoftmax);
 
-        functionValues *= (-1);
+        // the words' class-conditional log posteriors and the class log posteriors
+        ElemType logLikelihood = Matrix<ElemType>::InnerProductOfMatrices(m_wordLabels, m_logSoftmax) + Matrix<ElemType>::InnerProductOfMatrices(m_clsLabels, m_clsLogSoftmax);
+        functionValues.SetValue(-logLikelihood);
 
 #if NANCHECK
         functionValues.HasNan("ClassBasedCrossEntropyWithSoftmax");
 #endif
-        m_needRecomputeGradientToSoftmaxInput = true;
     }
 
     virtual void /*ComputationNodeBase::*/ Validate(bool isFinalValidationPass) override
@@ -1711,6 +1747,15 @@ protected:
     Matrix<ElemType> m_grdToSoftMaxInput;
     bool m_needRecomputeGradientToSoftmaxInput;
 
+    // the frames grouped by class
+    vector<ClassGroup> m_classGroups;
+    Matrix<ElemType> m_frameColumns;    // [1 x #frames] minibatch column of each frame
+    Matrix<ElemType> m_wordLabels;      // [1 x m_totalNbrWords] one-hot word labels, concatenated like m_softMax
+    Matrix<ElemType> m_clsLabels;       // [nbr_cls x T] one-hot class labels
+    Matrix<ElemType> m_obsByClass;      // [hdsize x #frames] hidden activations of the frames
+    Matrix<ElemType> m_grdToObsByClass; // and their gradient
+    Matrix<ElemType> m_grdToClsSoftMaxInput;
+
     size_t m_nbrCls;
     size_t m_totalNbrWords;
 };
@@ -1718,8 +1763,6 @@ protected:
 template class ClassBasedCrossEntropyWithSoftmaxNode<float>;
 template class ClassBasedCrossEntropyWithSoftmaxNode<double>;
 
-#ifdef COMING_SOON
-
 // -----------------------------------------------------------------------
 // CRFNode (labels, position_dependent_scores, transition_scores)
 //  - labels: output label vector of [0:T-1]
@@ -1727,7 +1770,7 @@ template class ClassBasedCrossEntropyWithSoftmaxNode<double>;
 //    in the R-CRF case, it is the RNN output score before softmax
 //  - transition scores: square transition matrix,  --TODO: log?
 //    in the R-CRF case, it is the transition probability between labels
-// BUGBUG: This node cannot operate with truncated BPTT, but does not detect it. It also does not handle gaps or test boundary flags.
+// All sequences of a minibatch are processed at once, and gaps are skipped. Truncated BPTT is not supported.
 // -----------------------------------------------------------------------
 
 /**
@@ -1765,39 +1808,19 @@ public:
     {
     }
 
-    // compute posterior probability of label y at position t
+    // compute posterior probability of label y at position t, for all sequences of the minibatch at once
     virtual void /*ComputationNodeNonLooping::*/ ForwardPropNonLooping() override
     {
         FrameRange fr(InputRef(0).GetMBLayout());
-        size_t nrow = InputRef(0).Value().GetNumRows();
-        size_t ncol = InputRef(0).Value().GetNumCols();
-
-        mAlpha.Resize(nrow, ncol);
-        mBeta.Resize(nrow, ncol);
-        mPostProb.Resize(nrow, ncol);
-
-        Value().SetValue(0.0);
-        Matrix<ElemType> funcVal = Value(); // TODO: This just creates a 1x1 matrix set to 0.
+        GetSequences(InputRef(0).GetMBLayout(), m_uttToChanInd, m_uttBeginFrame, m_uttFrameNum);
+        InputRef(0).MaskMissingValueColumnsToZero(fr); // labels in gaps would otherwise leak into the gradient
 
-        size_t nS = InputRef(0).GetNumParallelSequences();
-        if (nS != 1)
-            LogicError("CRFNode: >1 parallel sequences are currently not implemented correctly.");
-        for (size_t i = 0; i < nS; i++) // process parallel sequences one by one  --BUGBUG: We should loop over individual sequences.
-        {
-            FrameRange sequenceRange = fr.Sequence(i); // FrameRange to select one sequence
-            // BUGBUG: This ^^ is neither supported nor correct, since this code does not handle gaps or start/end flags.
-            ForwardPropS(
-                DataWithMBLayoutFor(mPostProb, sequenceRange, InputRef(0).GetMBLayout()),
-                DataWithMBLayoutFor(mAlpha, sequenceRange, InputRef(0).GetMBLayout()),
-                DataWithMBLayoutFor(mBeta, sequenceRange, InputRef(0).GetMBLayout()),
-                funcVal,
-                InputRef(0).ValueFor(sequenceRange),
-                InputRef(1).ValueFor(sequenceRange),
-                InputRef(2).ValueAsMatrix(), mStartLbl,
-                mEndLbl);
-
-            Value() += funcVal; // aggregate over sequences
-        }
+        // runs on the CPU; mBeta holds the log posteriors, which are LZERO in gaps
+        ElemType totalScore = Matrix<ElemType>::RCRFForwardBackwardCompute(InputRef(0).ValueFor(fr), InputRef(1).ValueFor(fr), InputRef(2).ValueAsMatrix(),
+                                                                           mAlpha, mBeta,
+                                                                           m_uttToChanInd, m_uttBeginFrame, m_uttFrameNum, InputRef(0).GetNumParallelSequences());
+        mPostProb.AssignExpOf(mBeta);
+        Value().SetValue(totalScore);
     }
 
     virtual void BackpropToNonLooping(size_t inputIndex) override // scaled by 2*number of colmns (samples) in the Matrix<ElemType>
@@ -1815,21 +1838,10 @@ public:
         else if (inputIndex == 2)
         {
             assert(InputRef(inputIndex).GradientFor(fr).GetNumElements() > 0);
-            size_t nS = InputRef(0).GetNumParallelSequences();
-            for (size_t i = 0; i < nS; i++) // process all sequences one by one
-            {
-                FrameRange sequenceRange = fr.Sequence(i); // FrameRange to select one sequence
-                auto& gradient = InputRef(2).GradientAsMatrix();
-                TransGrdCompute(InputRef(0).ValueFor(sequenceRange),
-                                DataWithMBLayoutFor(mAlpha, sequenceRange, InputRef(0).GetMBLayout()),
-                                DataWithMBLayoutFor(mBeta, sequenceRange, InputRef(0).GetMBLayout()),
-                                InputRef(2).ValueAsMatrix(),
-                                gradient,
-                                mStartLbl, 1);
-            }
+            Matrix<ElemType>::RCRFTransGrdCompute(InputRef(0).ValueFor(fr), InputRef(1).ValueFor(fr), mAlpha, mBeta, InputRef(2).ValueAsMatrix(),
+                                                  InputRef(2).GradientAsMatrix(),
+                                                  m_uttToChanInd, m_uttBeginFrame, m_uttFrameNum, InputRef(0).GetNumParallelSequences());
         }
-        else
-            return;
     }
 
     virtual bool OutputUsedInComputingInputNodesGradients() const override
@@ -1837,145 +1849,22 @@ public:
         return false;
     }
 
-    // compute forward backward algorithm
-    /*TODO: merge with call site*/ void ForwardPropS(Matrix<ElemType> postprob, Matrix<ElemType> alpha, Matrix<ElemType> beta, Matrix<ElemType>& functionValues, const Matrix<ElemType>& lbls, const Matrix<ElemType>& pos_scores, const Matrix<ElemType>& pair_scores, int& firstLbl, int& lastLbl, const int iStep = 1)
+    // the sequences of the minibatch, in the form taken by the batched RCRF functions
+    static void GetSequences(const MBLayoutPtr& pMBLayout, vector<size_t>& uttToChanInd, vector<size_t>& uttBeginFrame, vector<size_t>& uttFrameNum)
     {
-        // to-do, each slice is for one sentence
-        // to-do, number of slices correspond to number of frames
-        // this implementation only supports one sentence per minibatch
-
-        int nObs = lbls.GetNumCols();
-
-        // change to other values so can support multiple sentences in each minibatch
-        assert(iStep == 1);
-        ForwardCompute(alpha, lbls, pos_scores, pair_scores);
-        BackwardCompute(alpha, beta, functionValues, lbls, pos_scores, pair_scores, iStep);
-        PostProbCompute(postprob, alpha, beta);
-
-        firstLbl = -1;
-        for (int ik = 0; ik < lbls.GetNumRows(); ik++)
-            if (lbls(ik, 0) != 0)
-            {
-                firstLbl = ik;
-                break;
-            }
-
-        lastLbl = -1;
-        for (int ik = 0; ik < lbls.GetNumRows(); ik++)
-            if (lbls(ik, nObs - 1) != 0)
-            {
-                lastLbl = ik;
-                break;
-            }
-
-        functionValues.AssignInnerProductOfMatrices(lbls, pos_scores);
-
-        Matrix<ElemType> a = alpha.ColumnSlice(nObs - 1, 1);
-        ElemType fAlpha;
-        fAlpha = a.LogSumOfElements();
-
-        // transition score
-        ElemType tscore = 0;
-        for (int t = 0; t < nObs - 1; t++)
+        uttToChanInd.clear();
+        uttBeginFrame.clear();
+        uttFrameNum.clear();
+        for (const auto& seq : pMBLayout->GetAllSequences())
         {
-            int i = -1;
-            for (int ik = 0; ik < lbls.GetNumRows(); ik++)
-                if (lbls(ik, t) != 0)
-                {
-                    i = ik;
-                    break;
-                }
-            int j = -1;
-            for (int ik = 0; ik < lbls.GetNumRows(); ik++)
-                if (lbls(ik, t + 1) != 0)
-                {
-                    j = ik;
-                    break;
-                }
-            tscore += pair_scores(j, i);
+            if (seq.seqId == GAP_SEQUENCE_ID)
+                continue;
+            if (seq.tBegin < 0 || seq.tEnd > (ptrdiff_t) pMBLayout->GetNumTimeSteps())
+                InvalidArgument("CRF: Sequences must lie within the minibatch; truncated BPTT is not supported.");
+            uttToChanInd.push_back(seq.s);
+            uttBeginFrame.push_back(seq.tBegin);
+            uttFrameNum.push_back(seq.GetNumTimeSteps());
         }
-        tscore += functionValues.Get00Element(); // correct path score
-        tscore -= fAlpha;                        // reduced by the scores from all paths
-        functionValues.SetValue(tscore);
-
-        functionValues *= (-1);
-    }
-
-    // compute forward backward algorithm
-    static void ForwardCompute(Matrix<ElemType>& alpha,
-                               const Matrix<ElemType>& lbls,
-                               const Matrix<ElemType>& pos_scores, const Matrix<ElemType>& pair_scores)
-    {
-        // to-do, shift more than 1 to support muliple sentences per minibatch
-        int iNumPos = lbls.GetNumCols();
-        int iNumLab = lbls.GetNumRows();
-
-        int firstLbl = -1;
-        for (int ik = 0; ik < lbls.GetNumRows(); ik++)
-            if (lbls(ik, 0) != 0)
-            {
-                firstLbl = ik;
-                break;
-            }
-
-        // need to have
-        alpha.Resize(iNumLab, iNumPos);
-
-        for (int t = 0; t < iNumPos; t++)
-        {
-            for (int k = 0; k < iNumLab; k++)
-            {
-                ElemType fTmp = (ElemType) LZERO;
-                for (int j = 0; j < iNumLab; j++)
-                {
-                    ElemType fAlpha = (j == firstLbl) ? (ElemType) 0.0 : (ElemType) LZERO;
-                    if (t > 0)
-                        fAlpha = alpha(j, t - 1);
-                    fTmp = alpha.LogAdd(fTmp, fAlpha + pair_scores(k, j));
-                }
-                fTmp += pos_scores(k, t); // include position dependent score
-                alpha(k, t) = fTmp;
-            }
-        }
-    }
-
-    // compute backward algorithm
-    static void BackwardCompute(const Matrix<ElemType>& alpha, Matrix<ElemType>& beta,
-                                Matrix<ElemType>& functionValues, const Matrix<ElemType>& lbls,
-                                const Matrix<ElemType>& pos_scores, const Matrix<ElemType>& pair_scores, const int shift = 1)
-    {
-        assert(shift == 1);
-
-        alpha.RCRFBackwardCompute(alpha, beta, functionValues, lbls, pos_scores, pair_scores, shift);
-    }
-
-    static void TransGrdCompute(const Matrix<ElemType>& lbls,
-                                const Matrix<ElemType>& alpha,
-                                const Matrix<ElemType>& beta,
-                                const Matrix<ElemType>& pair_scores,
-                                Matrix<ElemType>& grd,
-                                const int startLbl,
-                                const int shift = 1)
-    {
-        assert(shift == 1);
-
-        alpha.RCRFTransGrdCompute(lbls,
-                                  alpha,
-                                  beta,
-                                  pair_scores,
-                                  grd,
-                                  startLbl, shift);
-    }
-
-    // compute forward backward algorithm
-    static void PostProbCompute(Matrix<ElemType>& postprob, const Matrix<ElemType>& alpha, const Matrix<ElemType>& beta)
-    {
-        int iNumPos = alpha.GetNumCols();
-        int iNumLab = alpha.GetNumRows();
-
-        postprob.Resize(iNumLab, iNumPos);
-        postprob.SetValue(beta);
-        postprob.InplaceExp();
     }
 
     virtual void /*ComputationNodeBase::*/ Validate(bool isFinalValidationPass) override
@@ -2002,12 +1891,12 @@ public:
         if (flags & CopyNodeFlags::copyNodeValue)
         {
             auto node = dynamic_pointer_cast<CRFNode<ElemType>>(nodeP);
-            node->mAlpha = mAlpha;
-            node->mBeta = mBeta;
-            node->mPostProb = mPostProb;
-
-            node->mStartLbl = mStartLbl;
-            node->mEndLbl = mEndLbl;
+            node->mAlpha.SetValue(mAlpha);
+            node->mBeta.SetValue(mBeta);
+            node->mPostProb.SetValue(mPostProb);
+            node->m_uttToChanInd = m_uttToChanInd;
+            node->m_uttBeginFrame = m_uttBeginFrame;
+            node->m_uttFrameNum = m_uttFrameNum;
         }
     }
 
@@ -2015,11 +1904,13 @@ private:
     Matrix<ElemType> mAlpha; // TODO: m_Alpha etc.
     Matrix<ElemType> mBeta;
     Matrix<ElemType> mPostProb;
-    int mStartLbl;
-    int mEndLbl;
+    vector<size_t> m_uttToChanInd; // sequences of the minibatch
+    vector<size_t> m_uttBeginFrame;
+    vector<size_t> m_uttFrameNum;
 };
 
-#endif
+template class CRFNode<float>;
+template class CRFNode<double>;
 
 // -----------------------------------------------------------------------
 // Logistic (labels, prediction, weight)
@@ -37,6 +37,9 @@ void CNTKEvalBase<ElemType>::Init(const std::string& config)
     CPUMatrix<ElemType>::SetNumThreads(nThreads);
 
     Globals::SetShareNodeValueMatrices(m_config(L"shareNodeValueMatrices", true));
+    size_t nInterOpThreads = m_config("interOpThreads", "0");
+    Globals::SetInterOpThreads(nInterOpThreads);
+    Globals::SetFuseElementwiseOperations(m_config(L"fuseElementwiseOperations", false));
 }
 
 
@@ -300,6 +303,47 @@ VariableSchema CNTKEvalExtended<ElemType>::GetInputSchema() const
     return inputLayouts;
 }
 
+template<typename ElemType>
+template<template<typename> class ValueContainer>
+size_t CNTKEvalExtended<ElemType>::GetNumSamples(size_t inputIndex, const ValueBuffer<ElemType, ValueContainer>& buffer) const
+{
+    const auto& inputNode = m_inputNodes[inputIndex];
+    auto matrix = dynamic_pointer_cast<Matrix<ElemType>>(inputNode->ValuePtr());
+    auto type = matrix->GetMatrixType();
+    size_t numRows = inputNode->GetSampleLayout().GetNumElements();
+
+    if (buffer.m_buffer.data() == nullptr)
+        RuntimeError("Input %ls: Buffer is not allocated.", inputNode->GetName().c_str());
+    if (type == MatrixType::DENSE)
+    {
+        if (buffer.m_buffer.size() % numRows != 0)
+            RuntimeError("Input %ls: Expected input data to be a multiple of %" PRIu64 ", but it is %" PRIu64 ".", 
+                         inputNode->GetName().c_str(), numRows, buffer.m_buffer.size());
+        if (buffer.m_buffer.size() == 0)
+            RuntimeError("Input %ls: Expected at least one element.", inputNode->GetName().c_str());
+    }
+    else if (type == MatrixType::SPARSE)
+    {
+        if (buffer.m_colIndices.data() == nullptr)
+            RuntimeError("Input %ls: Due to sparse input format, expected colIndices array, but was nullptr.", inputNode->GetName().c_str());
+        if (buffer.m_indices.data() == nullptr)
+            RuntimeError("Input %ls: Due to sparse input format, expected Indices array, but was nullptr.", inputNode->GetName().c_str());
+        if (buffer.m_colIndices.size() < 2)
+            RuntimeError("Input %ls: Expected at least one element (2 entries in colIndices array).", inputNode->GetName().c_str());
+        if (buffer.m_colIndices[0] != 0)
+            RuntimeError("Input %ls: First element of column indices must be 0", inputNode->GetName().c_str());
+        if (buffer.m_colIndices[buffer.m_colIndices.size() - 1] != buffer.m_indices.size())
+            RuntimeError("Input %ls: Last element of column indices must be equal to the size of indices (%ld), but was %d", 
+                         inputNode->GetName().c_str(), buffer.m_indices.size(), 
+                         buffer.m_colIndices[buffer.m_colIndices.size() - 1]);
+    }
+
+    int numCols = type == MatrixType::DENSE ? buffer.m_buffer.size() / numRows : buffer.m_colIndices.size() - 1;
+    if (numCols < 1)
+        RuntimeError("Input: the number of column must be greater than or equal to 1.");
+    return numCols;
+}
+
 template<typename ElemType>
 template<template<typename> class ValueContainer>
 void CNTKEvalExtended<ElemType>::ForwardPassT(const std::vector<ValueBuffer<ElemType, ValueContainer> >& inputs, std::vector<ValueBuffer<ElemType, ValueContainer> >& outputs, bool resetRNN)
@@ -322,36 +366,8 @@ void CNTKEvalExtended<ElemType>::ForwardPassT(const std::vector<ValueBuffer<Elem
         auto matrix = dynamic_pointer_cast<Matrix<ElemType>>(inputNode->ValuePtr());
         auto type = matrix->GetMatrixType();
         size_t numRows = inputNode->GetSampleLayout().GetNumElements();
+        size_t numCols = GetNumSamples(i, buffer);
 
-        if (buffer.m_buffer.data() == nullptr)
-            RuntimeError("Input %ls: Buffer is not allocated.", m_inputNodes[i]->GetName().c_str());
-        if (type == MatrixType::DENSE)
-        {
-            if (buffer.m_buffer.size() % numRows != 0)
-                RuntimeError("Input %ls: Expected input data to be a multiple of %" PRIu64 ", but it is %" PRIu64 ".", 
-                             m_inputNodes[i]->GetName().c_str(), numRows, buffer.m_buffer.size());
-            if (buffer.m_buffer.size() == 0)
-                RuntimeError("Input %ls: Expected at least one element.", m_inputNodes[i]->GetName().c_str());
-        }
-        else if (type == MatrixType::SPARSE)
-        {
-            if (buffer.m_colIndices.data() == nullptr)
-                RuntimeError("Input %ls: Due to sparse input format, expected colIndices array, but was nullptr.", m_inputNodes[i]->GetName().c_str());
-            if (buffer.m_indices.data() == nullptr)
-                RuntimeError("Input %ls: Due to sparse input format, expected Indices array, but was nullptr.", m_inputNodes[i]->GetName().c_str());
-            if (buffer.m_colIndices.size() < 2)
-                RuntimeError("Input %ls: Expected at least one element (2 entries in colIndices array).", m_inputNodes[i]->GetName().c_str());
-            if (buffer.m_colIndices[0] != 0)
-                RuntimeError("Input %ls: First element of column indices must be 0", m_inputNodes[i]->GetName().c_str());
-            if (buffer.m_colIndices[buffer.m_colIndices.size() - 1] != buffer.m_indices.size())
-                RuntimeError("Input %ls: Last element of column indices must be equal to the size of indices (%ld), but was %d", 
-                             m_inputNodes[i]->GetName().c_str(), buffer.m_indices.size(), 
-                             buffer.m_colIndices[buffer.m_colIndices.size() - 1]);
-        }
-
-        int numCols = type == MatrixType::DENSE ? buffer.m_buffer.size() / numRows : buffer.m_colIndices.size() - 1;
-        if (numCols < 1)
-            RuntimeError("Input: the number of column must be greater than or equal to 1.");
         inputNode->GetMBLayout()->Init(1, numCols);
         
         // SentinelValueIndicatingUnspecifedSequenceBeginIdx is used to specify the lower bound of look-back step of recurrent nodes
@@ -405,6 +421,153 @@ void CNTKEvalExtended<ElemType>::ForwardPassT(const std::vector<ValueBuffer<Elem
     }
 }
 
+// Evaluate several sequences in one minibatch. Sequence k is placed into parallel sequence k of the input layouts,
+// and padded with gaps to the length of the longest sequence.
+template<typename ElemType>
+void CNTKEvalExtended<ElemType>::ForwardPassBatch(const std::vector<ValueRefs<ElemType>>& inputs, std::vector<ValueRefs<ElemType>>& outputs)
+{
+    if (!m_started)
+        RuntimeError("ForwardPassBatch() called before StartForwardEvaluation()");
+
+    const size_t numSequences = inputs.size();
+    if (numSequences == 0)
+        RuntimeError("ForwardPassBatch: Expected at least one sequence.");
+    if (outputs.size() != numSequences)
+        RuntimeError("ForwardPassBatch: Expected outputs for %d sequences, but got %d.", (int)numSequences, (int)outputs.size());
+    for (size_t k = 0; k < numSequences; k++)
+    {
+        if (inputs[k].size() != m_inputNodes.size())
+            RuntimeError("Expected %d inputs, but got %d.", (int)m_inputNodes.size(), (int)inputs[k].size());
+        if (outputs[k].size() != m_outputNodes.size())
+            RuntimeError("Expected %d outputs, but got %d.", (int)m_outputNodes.size(), (int)outputs[k].size());
+    }
+
+    // Inputs that share an MBLayout must agree on the sequence lengths; the first of them initializes the layout.
+    std::map<MBLayoutPtr, std::vector<size_t>> layoutLengths;
+    for (size_t i = 0; i < m_inputNodes.size(); i++)
+    {
+        const auto& inputNode = m_inputNodes[i];
+        std::vector<size_t> lengths(numSequences);
+        for (size_t k = 0; k < numSequences; k++)
+            lengths[k] = GetNumSamples(i, inputs[k][i]);
+
+        auto pMBLayout = inputNode->GetMBLayout();
+        auto iter = layoutLengths.find(pMBLayout);
+        if (iter != layoutLengths.end())
+        {
+            if (iter->second != lengths)
+                RuntimeError("Input %ls: Sequence lengths differ from those of other inputs with the same dynamic axis.", inputNode->GetName().c_str());
+            continue;
+        }
+        layoutLengths[pMBLayout] = lengths;
+
+        size_t numTimeSteps = *std::max_element(lengths.begin(), lengths.end());
+        pMBLayout->Init(numSequences, numTimeSteps);
+        for (size_t k = 0; k < numSequences; k++)
+        {
+            pMBLayout->AddSequence(k, k, 0, lengths[k]);
+            pMBLayout->AddGap(k, lengths[k], numTimeSteps);
+        }
+    }
+
+    // Column t * numSequences + k of an input holds sample t of sequence k.
+    for (size_t i = 0; i < m_inputNodes.size(); i++)
+    {
+        const auto& inputNode = m_inputNodes[i];
+        auto matrix = dynamic_pointer_cast<Matrix<ElemType>>(inputNode->ValuePtr());
+        size_t numRows = inputNode->GetSampleLayout().GetNumElements();
+        const auto& lengths = layoutLengths[inputNode->GetMBLayout()];
+        size_t numTimeSteps = inputNode->GetMBLayout()->GetNumTimeSteps();
+        size_t numCols = numTimeSteps * numSequences;
+
+        if (matrix->GetMatrixType() == MatrixType::DENSE)
+        {
+            std::vector<ElemType> data(numRows * numCols, 0);
+            for (size_t k = 0; k < numSequences; k++)
+            {
+                const ElemType* sequence = inputs[k][i].m_buffer.data();
+                for (size_t t = 0; t < lengths[k]; t++)
+                    memcpy(&data[(t * numSequences + k) * numRows], sequence + t * numRows, numRows * sizeof(ElemType));
+            }
+            matrix->SetValue(numRows, numCols, matrix->GetDeviceId(), data.data(), matrixFlagNormal);
+        }
+        else
+        {
+            std::vector<int> colIndices(numCols + 1, 0);
+            std::vector<int> indices;
+            std::vector<ElemType> values;
+            for (size_t t = 0; t < numTimeSteps; t++)
+            {
+                for (size_t k = 0; k < numSequences; k++)
+                {
+                    if (t < lengths[k])
+                    {
+                        const auto& buffer = inputs[k][i];
+                        for (int j = buffer.m_colIndices[t]; j < buffer.m_colIndices[t + 1]; j++)
+                        {
+                            indices.push_back(buffer.m_indices[j]);
+                            values.push_back(buffer.m_buffer[j]);
+                        }
+                    }
+                    colIndices[t * numSequences + k + 1] = (int)indices.size();
+                }
+            }
+            matrix->SetMatrixFromCSCFormat(colIndices.data(), indices.data(), values.data(), values.size(), numRows, numCols);
+        }
+    }
+
+    ComputationNetwork::BumpEvalTimeStamp(m_inputNodes);
+    this->m_net->ForwardProp(m_outputNodes);
+
+    // Hand every sequence of the outputs back to the request it came from, as identified by its sequence id.
+    std::vector<ElemType> outputData;
+    for (size_t i = 0; i < m_outputNodes.size(); i++)
+    {
+        auto node = m_outputNodes[i];
+        shared_ptr<Matrix<ElemType>> outputMatrix = dynamic_pointer_cast<Matrix<ElemType>>(node->ValuePtr());
+        size_t numRows = outputMatrix->GetNumRows();
+        size_t numElements = outputMatrix->GetNumElements();
+        outputData.resize(numElements);
+        ElemType* data = outputData.data();
+        outputMatrix->CopyToArray(data, numElements);
+
+        for (size_t k = 0; k < numSequences; k++)
+            outputs[k][i].m_buffer.resize(0);
+
+        auto pMBLayout = node->GetMBLayout();
+        if (!pMBLayout)
+        {
+            // not a function of the sequences, e.g. a constant: every request gets all of it
+            for (size_t k = 0; k < numSequences; k++)
+            {
+                auto& vec = outputs[k][i].m_buffer;
+                if (vec.capacity() < outputData.size())
+                    RuntimeError("Not enough space in output buffer for output '%ls'.", node->GetName().c_str());
+                vec.resize(outputData.size());
+                std::copy(outputData.begin(), outputData.end(), vec.data());
+            }
+            continue;
+        }
+
+        for (const auto& seq : pMBLayout->GetAllSequences())
+        {
+            if (seq.seqId == GAP_SEQUENCE_ID || seq.seqId >= numSequences)
+                continue;
+            size_t tBegin = (size_t)std::max(seq.tBegin, (ptrdiff_t)0);
+            size_t tEnd = std::min(seq.tEnd, pMBLayout->GetNumTimeSteps());
+            auto& vec = outputs[seq.seqId][i].m_buffer;
+            if (vec.capacity() < (tEnd - tBegin) * numRows)
+                RuntimeError("Not enough space in output buffer for output '%ls'.", node->GetName().c_str());
+            vec.resize((tEnd - tBegin) * numRows);
+            for (size_t t = tBegin; t < tEnd; t++)
+            {
+                size_t col = t * pMBLayout->GetNumParallelSequences() + seq.s;
+                memcpy(vec.data() + (t - tBegin) * numRows, &outputData[col * numRows], numRows * sizeof(ElemType));
+            }
+        }
+    }
+}
+
 template<typename ElemType>
 void CNTKEvalExtended<ElemType>::ForwardPass(const Values<ElemType>& inputs, Values<ElemType>& outputs)
 {
@@ -429,6 +592,25 @@ void CNTKEvalExtended<ElemType>::ForwardPass(const ValueRefs<ElemType>& inputs,
     ForwardPassT(inputs, outputs, resetRNN);
 }
 
+template <typename ElemType>
+IEvaluateModelExtended<ElemType>* CNTKEvalExtended<ElemType>::CreateSession()
+{
+    if (!m_started)
+        RuntimeError("CreateSession() called before StartForwardEvaluation()");
+
+    std::vector<wstring> outputNodeNames;
+    for (const auto& node : m_outputNodes)
+        outputNodeNames.push_back(node->GetName());
+
+    // The session gets its own copy of the network structure, which references the parameter matrices of ours.
+    auto net = this->m_net->CloneSharingParameters();
+    auto session = new CNTKEvalExtended<ElemType>();
+    session->m_config = this->m_config;
+    session->m_net = net;
+    session->StartForwardEvaluation(outputNodeNames);
+    return session;
+}
+
 template <typename ElemType>
 void CNTKEvalExtended<ElemType>::Destroy()
 {
@@ -107,6 +107,10 @@ public:
 
     virtual void ForwardPass(const ValueRefs<ElemType>& inputs, ValueRefs<ElemType>& output, bool resetRNN) override;
 
+    virtual void ForwardPassBatch(const std::vector<ValueRefs<ElemType>>& inputs, std::vector<ValueRefs<ElemType>>& outputs) override;
+
+    virtual IEvaluateModelExtended<ElemType>* CreateSession() override;
+
     virtual void Destroy() override;
 
     virtual void CreateNetwork(const std::string& networkDescription) override
@@ -127,6 +131,9 @@ private:
     StreamMinibatchInputs m_inputMatrices;
     bool m_started;
 
+    template<template<typename> class ValueContainer>
+    size_t GetNumSamples(size_t inputIndex, const ValueBuffer<ElemType, ValueContainer>& buffer) const;
+
     template<template<typename> class ValueContainer> 
     void ForwardPassT(const std::vector < ValueBuffer<ElemType, ValueContainer> >& inputs,
                       std::vector < ValueBuffer<ElemType, ValueContainer> >& outputs, bool resetRNN);
@@ -28,6 +28,8 @@ namespace Microsoft { namespace MSR { namespace CNTK {
 
 double logadd(double x, double y);
 
+template <class ElemType> class CPURNNExecutor;
+
 // To comply with BLAS libraries matrices are stored in ColMajor. However, by default C/C++/C# use RowMajor
 // conversion is need when passing data between CPUMatrix and C++ matrices
 template <class ElemType>
@@ -415,6 +417,11 @@ public:
     void BatchNormalizationBackward(const CPUMatrix<ElemType>& in, CPUMatrix<ElemType>& grad, const CPUMatrix<ElemType>& scale, double blendFactor, const CPUMatrix<ElemType>& saveMean, const CPUMatrix<ElemType>& saveInvStdDev,
                                     CPUMatrix<ElemType>& scaleGrad, CPUMatrix<ElemType>& biasGrad) const;
 
+    // RNN support functions
+    void RNNForward(const CPUMatrix<ElemType>& inputX, const CPUMatrix<ElemType>& paramW, size_t xDim, size_t yDim, const vector<size_t>& numSequencesForFrame, const struct RnnAttributes& rnnAttributes, CPUMatrix<ElemType>& reserve, CPUMatrix<ElemType>& workspace);
+    void RNNBackwardData(const CPUMatrix<ElemType>& outputDY, const CPUMatrix<ElemType>& paramW, CPUMatrix<ElemType>& outputDX, const struct RnnAttributes& rnnAttributes, CPUMatrix<ElemType>& reserve, CPUMatrix<ElemType>& workspace);
+    void RNNBackwardWeights(const CPUMatrix<ElemType>& inputX, const CPUMatrix<ElemType>& outputY, CPUMatrix<ElemType>& dw, const struct RnnAttributes& rnnAttributes, CPUMatrix<ElemType>& reserve, CPUMatrix<ElemType>& workspace);
+
 public:
     // This functions do not depend on <ElemType>, i.e. you can call them on any <ElemType>
     static int SetNumThreads(int numThreads);
@@ -466,6 +473,10 @@ public:
                   const std::array<size_t, 4>& offsets,
                   const SmallVector<size_t>& regularOpDims, const std::array<SmallVector<ptrdiff_t>, 4>& regularStrides,
                   const SmallVector<size_t>& reducingOpDims, const std::array<SmallVector<ptrdiff_t>, 4>& reducingStrides);
+    void FusedTensorOp(ElemType beta, const std::vector<const CPUMatrix<ElemType>*>& inputs, ElemType alpha, const ElementWiseProgram& program,
+                       const std::array<size_t, ElementWiseProgram::MaxOperands>& offsets,
+                       const SmallVector<size_t>& regularOpDims, const std::array<SmallVector<ptrdiff_t>, ElementWiseProgram::MaxOperands>& regularStrides,
+                       const SmallVector<size_t>& reducingOpDims, const std::array<SmallVector<ptrdiff_t>, ElementWiseProgram::MaxOperands>& reducingStrides);
 
     int Argmin() const;
     int Argmax() const;
@@ -494,38 +505,76 @@ public:
     CPUMatrix<ElemType>& AssignElementProductOfWithShift(const CPUMatrix<ElemType>& a, const CPUMatrix<ElemType>& b, const size_t shift);
 
 public:
-    friend File& operator>>(File& stream, CPUMatrix<ElemType>& us)
+    // Binary files written to seekable streams hold the elements in one contiguous block at a 64-byte aligned file offset ("BMAT64"),
+    // so that they are written and read in bulk, and can be used in place from a memory-mapped file. Other streams use "BMAT".
+    // With 'useMappedStorage', an aligned matrix in a memory-mapped file is not copied but keeps pointing into the mapping,
+    // which the caller must then keep alive (File::GetMapping()). Writes to it are private to the process.
+    void Read(File& stream, bool useMappedStorage)
     {
-        stream.GetMarker(fileMarkerBeginSection, std::wstring(L"BMAT"));
+        std::wstring section;
+        stream >> section;
+        const bool aligned = (section == L"BMAT64");
+        if (!aligned && section != L"BMAT")
+            RuntimeError("section name mismatch %ls != BMAT", section.c_str());
         size_t elsize;
         stream >> elsize;
         if (sizeof(ElemType) != elsize)
             RuntimeError("Template argument size doesn't match those in file");
-        std::wstring matrixName;
+        if (!aligned)
+        {
+            std::wstring matrixName; // not used anymore
+            stream >> matrixName;
+        }
         size_t numRows, numCols;
         int format;
-        stream >> matrixName >> format >> numRows >> numCols;
-        ElemType* d_array = new ElemType[numRows * numCols];
-        for (size_t i = 0; i < numRows * numCols; ++i)
-            stream >> d_array[i];
+        stream >> format >> numRows >> numCols;
+        if (aligned)
+            stream.SkipPadding();
+        const size_t numElements = numRows * numCols;
+        if (aligned && useMappedStorage && stream.IsMemoryMapped() && numElements > 0)
+            SetValue(numRows, numCols, (ElemType*) stream.GetMappedBlock(numElements * sizeof(ElemType)), matrixFlagDontOwnBuffer);
+        else
+        {
+            RequireSize(numRows, numCols);
+            if (stream.IsTextBased())
+            {
+                for (size_t i = 0; i < numElements; ++i)
+                    stream >> Data()[i];
+            }
+            else
+                stream.ReadBlock(Data(), numElements * sizeof(ElemType));
+        }
         stream.GetMarker(fileMarkerEndSection, std::wstring(L"EMAT"));
-        us.SetValue(numRows, numCols, d_array, matrixFlagNormal);
-
-        delete[] d_array;
+    }
+    friend File& operator>>(File& stream, CPUMatrix<ElemType>& us)
+    {
+        us.Read(stream, /*useMappedStorage=*/false);
         return stream;
     }
     friend File& operator<<(File& stream, const CPUMatrix<ElemType>& us)
     {
-        stream.PutMarker(fileMarkerBeginSection, std::wstring(L"BMAT"));
+        const bool aligned = !stream.IsTextBased() && stream.CanSeek();
+        stream.PutMarker(fileMarkerBeginSection, std::wstring(aligned ? L"BMAT64" : L"BMAT"));
         stream << sizeof(ElemType);
 
-        std::wstring s = std::wstring(L"unnamed");
+        if (!aligned)
+        {
+            std::wstring s = std::wstring(L"unnamed");
+            stream << s;
+        }
         int format = us.GetFormat();
-        stream << s << format;
+        stream << format;
 
         stream << us.m_numRows << us.m_numCols;
-        for (size_t i = 0; i < us.GetNumElements(); ++i)
-            stream << us.Data()[i];
+        if (aligned)
+            stream.PutPadding();
+        if (stream.IsTextBased())
+        {
+            for (size_t i = 0; i < us.GetNumElements(); ++i)
+                stream << us.Data()[i];
+        }
+        else
+            stream.WriteBlock(us.Data(), us.GetNumElements() * sizeof(ElemType));
         stream.PutMarker(fileMarkerEndSection, std::wstring(L"EMAT"));
         return stream;
     }
@@ -557,11 +606,42 @@ public:
                                      const size_t tPos // position
                                      );
 
+    // batched versions over all sequences of a minibatch, see CPUMatrixImpl.h
+    static ElemType RCRFForwardBackwardCompute(const CPUMatrix<ElemType>& lbls,
+                                               const CPUMatrix<ElemType>& pos_scores,
+                                               const CPUMatrix<ElemType>& pair_scores,
+                                               CPUMatrix<ElemType>& alpha,
+                                               CPUMatrix<ElemType>& beta,
+                                               const vector<size_t>& uttToChanInd, const vector<size_t>& uttBeginFrame, const vector<size_t>& uttFrameNum,
+                                               const size_t numParallelSequences);
+
+    static void RCRFTransGrdCompute(const CPUMatrix<ElemType>& lbls,
+                                    const CPUMatrix<ElemType>& pos_scores,
+                                    const CPUMatrix<ElemType>& alpha,
+                                    const CPUMatrix<ElemType>& beta,
+                                    const CPUMatrix<ElemType>& pair_scores,
+                                    CPUMatrix<ElemType>& grd,
+                                    const vector<size_t>& uttToChanInd, const vector<size_t>& uttBeginFrame, const vector<size_t>& uttFrameNum,
+                                    const size_t numParallelSequences);
+
+    static void RCRFViterbiDecode(const CPUMatrix<ElemType>& lbls,
+                                  const CPUMatrix<ElemType>& pos_scores,
+                                  const CPUMatrix<ElemType>& pair_scores,
+                                  CPUMatrix<ElemType>& decodedPath,
+                                  const vector<size_t>& uttToChanInd, const vector<size_t>& uttBeginFrame, const vector<size_t>& uttFrameNum,
+                                  const size_t numParallelSequences);
+
 protected:
     size_t LocateElement(const size_t i, const size_t j) const;
     size_t LocateColumn(const size_t j) const;
 
 private:
+// Have to use disable the warning to avoid issues with __declspec(dllexport) on Windows (C4251).
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    mutable std::shared_ptr<CPURNNExecutor<ElemType>> m_rnnExecutor; // for OptimizedRNNStack
+#pragma warning(pop)
+
     void Clear();
 
     void ScatterValues(ElemType* indices, ElemType* value, ElemType* data, ElemType alpha, size_t num_indices, size_t rows, size_t cols, size_t indices_step = 1);
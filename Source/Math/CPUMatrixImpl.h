@@ -11,6 +11,8 @@
 #include "File.h"
 
 #include "CPUMatrix.h"
+#include "CPUMemAllocator.h"
+#include "CPURNN.h"
 #include "TensorOps.h"
 #include <assert.h>
 #include <stdexcept>
@@ -126,6 +128,14 @@ static ElemType* NewArray(size_t n)
     return p;
 }
 
+// helper to allocate the storage of a matrix from the CPUMemAllocator (same rounding as NewArray())
+// The memory is only zeroed if 'zero'. Free it with CPUMemAllocator::Deallocate().
+template <class ElemType>
+static ElemType* AllocateStorage(size_t n, bool zero)
+{
+    return CPUMemAllocator::Allocate<ElemType>(AsMultipleOf(n, 2), zero);
+}
+
 template <class ElemType>
 CPUMatrix<ElemType>::CPUMatrix(const size_t numRows, const size_t numCols)
 {
@@ -137,7 +147,7 @@ CPUMatrix<ElemType>::CPUMatrix(const size_t numRows, const size_t numCols)
 
     if (GetNumElements() != 0)
     {
-        SetBuffer(NewArray<ElemType>(GetNumElements()), GetNumElements() * sizeof(ElemType));
+        SetBuffer(AllocateStorage<ElemType>(GetNumElements(), /*zero=*/true), GetNumElements() * sizeof(ElemType));
     }
 }
 
@@ -875,7 +885,8 @@ void CPUMatrix<ElemType>::SetValue(const size_t numRows, const size_t numCols, E
     if (matrixFlags & matrixFlagDontOwnBuffer)
     {
         // free previous array allocation if any before overwriting
-        delete[] Buffer();
+        if (OwnBuffer())
+            CPUMemAllocator::Deallocate(Buffer());
 
         m_numRows = numRows;
         m_numCols = numCols;
@@ -1523,10 +1534,10 @@ void CPUMatrix<ElemType>::Resize(const size_t numRows, const size_t numCols, boo
         ElemType* pArray = nullptr;
         if (numElements > 0)
         {
-            pArray = NewArray<ElemType>(numElements);
+            pArray = AllocateStorage<ElemType>(numElements, /*zero=*/false); // like GPUMatrix::Resize(), content is undefined
         }
         // success: update the object
-        delete[] Buffer();
+        CPUMemAllocator::Deallocate(Buffer());
 
         SetBuffer(pArray, numElements * sizeof(ElemType));
         SetSizeAllocated(numElements);
@@ -3674,8 +3685,11 @@ CPUMatrix<ElemType>& CPUMatrix<ElemType>::AddSignOf(const CPUMatrix<ElemType>& a
         LogicError("AddSignOf: Matrix a is empty.");
 
     auto& us = *this;
-    if (this != &a)
+    if (this != &a && (GetNumRows() != a.GetNumRows() || GetNumCols() != a.GetNumCols()))
+    {
         RequireSize(a.GetNumRows(), a.GetNumCols());
+        SetValue(0); // content after Resize() is undefined
+    }
 
 #pragma omp parallel for
     foreach_column (j, us)
@@ -4959,6 +4973,31 @@ void CPUMatrix<ElemType>::BatchNormalizationBackward(const CPUMatrix<ElemType>&
     RuntimeError("Batch normalization training on CPU is not yet implemented.");
 }
 
+template <class ElemType>
+void CPUMatrix<ElemType>::RNNForward(const CPUMatrix<ElemType>& inputX, const CPUMatrix<ElemType>& paramW, size_t xDim, size_t yDim, const vector<size_t>& numSequencesForFrame, const RnnAttributes& rnnAttributes, CPUMatrix<ElemType>& reserve, CPUMatrix<ElemType>& workspace)
+{
+    // this matrix may be handed to a differently configured RNN through the matrix pool; start over in that case
+    if (!m_rnnExecutor || !m_rnnExecutor->IsCompatible(xDim, yDim, rnnAttributes))
+        m_rnnExecutor = std::make_shared<CPURNNExecutor<ElemType>>(xDim, yDim, rnnAttributes);
+    m_rnnExecutor->ForwardCore(paramW, inputX, *this, numSequencesForFrame, rnnAttributes, reserve, workspace);
+}
+
+template <class ElemType>
+void CPUMatrix<ElemType>::RNNBackwardData(const CPUMatrix<ElemType>& outputDY, const CPUMatrix<ElemType>& paramW, CPUMatrix<ElemType>& outputDX, const RnnAttributes& rnnAttributes, CPUMatrix<ElemType>& reserve, CPUMatrix<ElemType>& workspace)
+{
+    if (!m_rnnExecutor)
+        LogicError("RNNBackwardData called, but RNNWrapper object is not yet initialized");
+    m_rnnExecutor->BackwardDataCore(*this, outputDY, paramW, outputDX, rnnAttributes, reserve, workspace);
+}
+
+template <class ElemType>
+void CPUMatrix<ElemType>::RNNBackwardWeights(const CPUMatrix<ElemType>& inputX, const CPUMatrix<ElemType>& outputY, CPUMatrix<ElemType>& dw, const RnnAttributes& rnnAttributes, CPUMatrix<ElemType>& reserve, CPUMatrix<ElemType>& workspace)
+{
+    if (!m_rnnExecutor)
+        LogicError("RNNBackwardWeights called, but RNNWrapper object is not yet initialized");
+    m_rnnExecutor->BackwardWeightsCore(inputX, outputY, dw, rnnAttributes, reserve, workspace);
+}
+
 
 #pragma region Static BLAS Functions
 
@@ -6720,6 +6759,260 @@ void CPUMatrix<ElemType>::_rcrfTransGrdCompute(size_t i,
         }
     }
 };
+
+// helpers for the batched RCRF functions below; sequence i occupies column (uttBeginFrame[i] + t) * numParallelSequences + uttToChanInd[i] at frame t
+
+// log(sum_j exp(x[j] + y[j]))
+template <class ElemType>
+static ElemType _rcrfLogSumExpOfSum(const ElemType* x, const ElemType* y, size_t n)
+{
+    ElemType maxVal = (ElemType) LZERO;
+    for (size_t j = 0; j < n; j++)
+        maxVal = std::max(maxVal, x[j] + y[j]);
+    if (maxVal <= (ElemType) LZERO)
+        return (ElemType) LZERO;
+    double sum = 0;
+    for (size_t j = 0; j < n; j++)
+        sum += exp(x[j] + y[j] - maxVal);
+    return maxVal + (ElemType) log(sum);
+}
+
+// index of the label of a frame (the first non-zero row), or -1
+template <class ElemType>
+static int _rcrfLabelOf(const CPUMatrix<ElemType>& lbls, size_t col)
+{
+    const ElemType* p = lbls.Data() + col * lbls.GetNumRows();
+    for (size_t k = 0; k < lbls.GetNumRows(); k++)
+        if (p[k] != 0)
+            return (int) k;
+    return -1;
+}
+
+// Forward-backward over all sequences of a minibatch, in parallel over the sequences.
+// Each sequence starts from the label of its first frame, like the single-sequence version.
+// alpha (output): log forward scores; beta (output): log posteriors of the labels, LZERO in gaps.
+// Returns the sum over the sequences of the negative log-likelihoods of their label sequences.
+template <class ElemType>
+ElemType CPUMatrix<ElemType>::RCRFForwardBackwardCompute(const CPUMatrix<ElemType>& lbls,
+                                                         const CPUMatrix<ElemType>& pos_scores,
+                                                         const CPUMatrix<ElemType>& pair_scores,
+                                                         CPUMatrix<ElemType>& alpha,
+                                                         CPUMatrix<ElemType>& beta,
+                                                         const vector<size_t>& uttToChanInd, const vector<size_t>& uttBeginFrame, const vector<size_t>& uttFrameNum,
+                                                         const size_t numParallelSequences)
+{
+    const size_t iNumLab = pos_scores.GetNumRows();
+    alpha.RequireSize(iNumLab, pos_scores.GetNumCols());
+    beta.RequireSize(iNumLab, pos_scores.GetNumCols());
+    alpha.SetValue((ElemType) LZERO);
+    beta.SetValue((ElemType) LZERO);
+
+    // row k of pair_scores as a contiguous vector, for the forward recursion
+    CPUMatrix<ElemType> pairScoresT;
+    pairScoresT.AssignTransposeOf(pair_scores);
+
+    const long numSequences = (long) uttFrameNum.size();
+    std::vector<ElemType> scores(numSequences);
+#pragma omp parallel for
+    for (long i = 0; i < numSequences; i++)
+    {
+        const size_t numFrames = uttFrameNum[i];
+        if (numFrames == 0)
+            continue;
+        auto colOf = [&](size_t t) { return (uttBeginFrame[i] + t) * numParallelSequences + uttToChanInd[i]; };
+        auto alphaOf = [&](size_t t) { return alpha.Data() + colOf(t) * iNumLab; };
+        auto betaOf = [&](size_t t) { return beta.Data() + colOf(t) * iNumLab; };
+        auto posOf = [&](size_t t) { return pos_scores.Data() + colOf(t) * iNumLab; };
+
+        const int firstLbl = _rcrfLabelOf(lbls, colOf(0));
+        std::vector<ElemType> start(iNumLab), d(iNumLab);
+        for (size_t k = 0; k < iNumLab; k++)
+            start[k] = (firstLbl < 0 || (int) k == firstLbl) ? 0 : (ElemType) LZERO;
+
+        // alpha(k, t) = log sum_j exp(alpha(j, t-1) + pair_scores(k, j)) + pos_scores(k, t)
+        for (size_t t = 0; t < numFrames; t++)
+        {
+            const ElemType* prev = (t == 0) ? start.data() : alphaOf(t - 1);
+            ElemType* a = alphaOf(t);
+            const ElemType* pos = posOf(t);
+            for (size_t k = 0; k < iNumLab; k++)
+                a[k] = _rcrfLogSumExpOfSum(prev, pairScoresT.Data() + k * iNumLab, iNumLab) + pos[k];
+        }
+        std::vector<ElemType> zeros(iNumLab, 0);
+        const ElemType logZ = _rcrfLogSumExpOfSum(alphaOf(numFrames - 1), zeros.data(), iNumLab);
+
+        // beta(k, t) = log sum_j exp(beta(j, t+1) + alpha(k, t) + pair_scores(j, k) - log sum_m exp(alpha(m, t) + pair_scores(j, m))),
+        // where the last term is alpha(j, t+1) - pos_scores(j, t+1)
+        for (size_t k = 0; k < iNumLab; k++)
+            betaOf(numFrames - 1)[k] = alphaOf(numFrames - 1)[k] - logZ;
+        for (long t = (long) numFrames - 2; t >= 0; t--)
+        {
+            const ElemType* nextAlpha = alphaOf(t + 1);
+            const ElemType* nextBeta = betaOf(t + 1);
+            const ElemType* nextPos = posOf(t + 1);
+            for (size_t j = 0; j < iNumLab; j++)
+                d[j] = nextBeta[j] - (nextAlpha[j] - nextPos[j]);
+            const ElemType* a = alphaOf(t);
+            ElemType* b = betaOf(t);
+            for (size_t k = 0; k < iNumLab; k++)
+                b[k] = a[k] + _rcrfLogSumExpOfSum(d.data(), pair_scores.Data() + k * iNumLab, iNumLab);
+        }
+
+        // score of the labeled path, including the transition from the start label
+        double pathScore = 0;
+        int prevLbl = firstLbl;
+        for (size_t t = 0; t < numFrames; t++)
+        {
+            const ElemType* lbl = lbls.Data() + colOf(t) * iNumLab;
+            const ElemType* pos = posOf(t);
+            for (size_t k = 0; k < iNumLab; k++)
+                pathScore += lbl[k] * pos[k];
+            int curLbl = _rcrfLabelOf(lbls, colOf(t));
+            if (curLbl >= 0 && prevLbl >= 0)
+                pathScore += pair_scores(curLbl, prevLbl);
+            prevLbl = curLbl;
+        }
+        scores[i] = logZ - (ElemType) pathScore;
+    }
+
+    ElemType totalScore = 0;
+    for (auto score : scores)
+        totalScore += score;
+    return totalScore;
+}
+
+// Gradient of the sum of the negative log-likelihoods w.r.t. pair_scores, added to grd.
+// In parallel over the columns of grd, which keeps the threads from writing to the same elements.
+template <class ElemType>
+void CPUMatrix<ElemType>::RCRFTransGrdCompute(const CPUMatrix<ElemType>& lbls,
+                                              const CPUMatrix<ElemType>& pos_scores,
+                                              const CPUMatrix<ElemType>& alpha,
+                                              const CPUMatrix<ElemType>& beta,
+                                              const CPUMatrix<ElemType>& pair_scores,
+                                              CPUMatrix<ElemType>& grd,
+                                              const vector<size_t>& uttToChanInd, const vector<size_t>& uttBeginFrame, const vector<size_t>& uttFrameNum,
+                                              const size_t numParallelSequences)
+{
+    const long iNumLab = (long) pos_scores.GetNumRows();
+    const size_t numSequences = uttFrameNum.size();
+    auto colOf = [&](size_t i, size_t t) { return (uttBeginFrame[i] + t) * numParallelSequences + uttToChanInd[i]; };
+
+    std::vector<int> firstLbls(numSequences, -1);
+    for (size_t i = 0; i < numSequences; i++)
+        if (uttFrameNum[i] > 0)
+            firstLbls[i] = _rcrfLabelOf(lbls, colOf(i, 0));
+
+    // expected counts: sum_t exp(alpha(i, t-1) + pair_scores(j, i) - (alpha(j, t) - pos_scores(j, t)) + beta(j, t))
+#pragma omp parallel for
+    for (long i = 0; i < iNumLab; i++)
+    {
+        ElemType* g = grd.Data() + i * grd.GetNumRows();
+        const ElemType* pair = pair_scores.Data() + i * iNumLab;
+        for (size_t s = 0; s < numSequences; s++)
+        {
+            for (size_t t = 0; t < uttFrameNum[s]; t++)
+            {
+                ElemType prev;
+                if (t == 0)
+                    prev = (firstLbls[s] < 0 || i == firstLbls[s]) ? 0 : (ElemType) LZERO;
+                else
+                    prev = alpha(i, colOf(s, t - 1));
+                if (prev <= (ElemType) LZERO)
+                    continue;
+                const size_t col = colOf(s, t);
+                const ElemType* a = alpha.Data() + col * iNumLab;
+                const ElemType* b = beta.Data() + col * iNumLab;
+                const ElemType* pos = pos_scores.Data() + col * iNumLab;
+                for (long j = 0; j < iNumLab; j++)
+                    g[j] += exp(prev + pair[j] - (a[j] - pos[j]) + b[j]);
+            }
+        }
+    }
+
+    // observed counts
+    for (size_t s = 0; s < numSequences; s++)
+    {
+        int prevLbl = firstLbls[s];
+        for (size_t t = 0; t < uttFrameNum[s]; t++)
+        {
+            int curLbl = _rcrfLabelOf(lbls, colOf(s, t));
+            if (curLbl >= 0 && prevLbl >= 0)
+                grd(curLbl, prevLbl) -= 1;
+            prevLbl = curLbl;
+        }
+    }
+}
+
+// Viterbi decoding of all sequences of a minibatch, in parallel over the sequences.
+// Like the single-sequence decoder, the best path is constrained to start and end at the labels of the first and last frame;
+// without a label there, it is not constrained. decodedPath (output): 1-hot labels of the best paths, 0 in gaps.
+template <class ElemType>
+void CPUMatrix<ElemType>::RCRFViterbiDecode(const CPUMatrix<ElemType>& lbls,
+                                            const CPUMatrix<ElemType>& pos_scores,
+                                            const CPUMatrix<ElemType>& pair_scores,
+                                            CPUMatrix<ElemType>& decodedPath,
+                                            const vector<size_t>& uttToChanInd, const vector<size_t>& uttBeginFrame, const vector<size_t>& uttFrameNum,
+                                            const size_t numParallelSequences)
+{
+    const size_t iNumLab = pos_scores.GetNumRows();
+    decodedPath.RequireSize(iNumLab, pos_scores.GetNumCols());
+    decodedPath.SetValue(0);
+
+    CPUMatrix<ElemType> pairScoresT;
+    pairScoresT.AssignTransposeOf(pair_scores);
+
+    const long numSequences = (long) uttFrameNum.size();
+#pragma omp parallel for
+    for (long i = 0; i < numSequences; i++)
+    {
+        const size_t numFrames = uttFrameNum[i];
+        if (numFrames == 0)
+            continue;
+        auto colOf = [&](size_t t) { return (uttBeginFrame[i] + t) * numParallelSequences + uttToChanInd[i]; };
+
+        const int firstLbl = _rcrfLabelOf(lbls, colOf(0));
+        const int lastLbl = _rcrfLabelOf(lbls, colOf(numFrames - 1));
+
+        std::vector<ElemType> delta(iNumLab), prevDelta(iNumLab);
+        std::vector<int> backtrace(numFrames * iNumLab);
+        const ElemType* pos = pos_scores.Data() + colOf(0) * iNumLab;
+        for (size_t k = 0; k < iNumLab; k++)
+            delta[k] = (firstLbl < 0 || (int) k == firstLbl) ? pos[k] : (ElemType) LZERO;
+
+        for (size_t t = 1; t < numFrames; t++)
+        {
+            delta.swap(prevDelta);
+            pos = pos_scores.Data() + colOf(t) * iNumLab;
+            for (size_t k = 0; k < iNumLab; k++)
+            {
+                const ElemType* pair = pairScoresT.Data() + k * iNumLab;
+                ElemType best = (ElemType) LZERO;
+                int bestJ = 0;
+                for (size_t j = 0; j < iNumLab; j++)
+                {
+                    if (prevDelta[j] + pair[j] > best)
+                    {
+                        best = prevDelta[j] + pair[j];
+                        bestJ = (int) j;
+                    }
+                }
+                delta[k] = best + pos[k];
+                backtrace[t * iNumLab + k] = bestJ;
+            }
+        }
+
+        int lbl = lastLbl;
+        if (lbl < 0)
+            lbl = (int) (std::max_element(delta.begin(), delta.end()) - delta.begin());
+        for (long t = (long) numFrames - 1; t >= 0; t--)
+        {
+            decodedPath(lbl, colOf(t)) = 1;
+            if (t > 0)
+                lbl = backtrace[t * iNumLab + lbl];
+        }
+    }
+}
+
 template <class ElemType>
 CPUMatrix<ElemType>& CPUMatrix<ElemType>::DropFrame(const CPUMatrix<ElemType>& label, const CPUMatrix<ElemType>& gamma, const ElemType& threshhold)
 {
@@ -7282,6 +7575,239 @@ void CPUMatrix<ElemType>::TensorOp(ElemType beta, const CPUMatrix<ElemType>& a,
     }
 }
 
+// -----------------------------------------------------------------------
+// fused elementwise operations
+// -----------------------------------------------------------------------
+
+// Evaluates an ElementWiseProgram over a strided run of up to ChunkSize elements.
+// The program is executed one instruction at a time over the whole run, so that each instruction is a
+// tight loop that the compiler can vectorize, while the registers of the run stay in the L1 cache.
+template <class ElemType>
+class ElementWiseProgramEvaluator
+{
+public:
+    static const size_t ChunkSize = 128;
+
+    // Input i of the run starts at ptrs[i] and advances by strides[i]. Returns a pointer to the 'len' results.
+    const ElemType* Evaluate(const ElementWiseProgram& program, const ElemType* const* ptrs, const ptrdiff_t* strides, size_t len)
+    {
+        const ElemType* regs[ElementWiseProgram::MaxRegisters];
+        for (size_t i = 0; i < program.numInputs; i++)
+        {
+            if (strides[i] == 1) // contiguous inputs are used in place
+            {
+                regs[i] = ptrs[i];
+                continue;
+            }
+            ElemType* reg = m_registers[i];
+            if (strides[i] == 0) // broadcasting
+            {
+                const ElemType value = *ptrs[i];
+                for (size_t j = 0; j < len; j++)
+                    reg[j] = value;
+            }
+            else
+            {
+                const ElemType* p = ptrs[i];
+                const ptrdiff_t stride = strides[i];
+                for (size_t j = 0; j < len; j++)
+                    reg[j] = p[j * stride];
+            }
+            regs[i] = reg;
+        }
+
+#define CaseUnaryFusedOp(oper)                 \
+    case ElementWiseOperator::op##oper:        \
+        for (size_t j = 0; j < len; j++)       \
+            out[j] = Op##oper(a[j]);           \
+        break
+#define CaseBinaryFusedOp(oper)                \
+    case ElementWiseOperator::op##oper:        \
+        for (size_t j = 0; j < len; j++)       \
+            out[j] = Op##oper(a[j], b[j]);     \
+        break
+#define CaseTernaryFusedOp(oper)               \
+    case ElementWiseOperator::op##oper:        \
+        for (size_t j = 0; j < len; j++)       \
+            out[j] = Op##oper(a[j], b[j], c[j]); \
+        break
+
+        for (size_t k = 0; k < program.instructions.size(); k++)
+        {
+            const auto& instruction = program.instructions[k];
+            ElemType* __restrict out = m_registers[program.numInputs + k];
+            const ElemType* __restrict a = regs[instruction.args[0]];
+            const ElemType* __restrict b = regs[instruction.args[1]];
+            const ElemType* __restrict c = regs[instruction.args[2]];
+            switch (instruction.op)
+            {
+                ForAllUnaryOps(CaseUnaryFusedOp);
+                ForAllBinaryOps(CaseBinaryFusedOp);
+                ForAllTernaryOps(CaseTernaryFusedOp);
+            default:
+                LogicError("FusedTensorOp: Unknown op code %d.", (int) instruction.op);
+            }
+            regs[program.numInputs + k] = out;
+        }
+#undef CaseUnaryFusedOp
+#undef CaseBinaryFusedOp
+#undef CaseTernaryFusedOp
+
+        return regs[program.ResultRegister()];
+    }
+
+private:
+    ElemType m_registers[ElementWiseProgram::MaxRegisters][ChunkSize];
+};
+
+// offset of each operand at linear position 'index' of the tensor 'dims', starting at dimension 'firstDim'
+template <class ElemType, size_t N>
+static inline void AddTensorOffsets(array<const ElemType*, N>& ptrs, size_t index, const SmallVector<size_t>& dims, size_t firstDim, const array<SmallVector<ptrdiff_t>, N>& strides)
+{
+    for (size_t k = firstDim; k < dims.size() && index > 0; k++)
+    {
+        const size_t i = index % dims[k];
+        index /= dims[k];
+        for (size_t n = 0; n < N; n++)
+            ptrs[n] += i * strides[n][k];
+    }
+}
+
+// perform the fused elementwise operation 'program' on 'inputs' giving 'this', reinterpreting the matrices as tensors as specified by the dims and strides
+// The innermost dimension is processed in runs of ElementWiseProgramEvaluator::ChunkSize elements. When reducing, the run goes along the
+// innermost regular dimension (results are accumulated per element over the reduced dimensions) unless that is too short, in which case
+// it goes along the innermost reducing dimension (results are summed up per output element).
+template <class ElemType>
+void CPUMatrix<ElemType>::FusedTensorOp(ElemType beta, const std::vector<const CPUMatrix<ElemType>*>& inputs, ElemType alpha, const ElementWiseProgram& program,
+                                        const array<size_t, ElementWiseProgram::MaxOperands>& offsets,
+                                        const SmallVector<size_t>& regularOpDims, const array<SmallVector<ptrdiff_t>, ElementWiseProgram::MaxOperands>& regularStrides,
+                                        const SmallVector<size_t>& reducingOpDims, const array<SmallVector<ptrdiff_t>, ElementWiseProgram::MaxOperands>& reducingStrides)
+{
+    const size_t N = ElementWiseProgram::MaxOperands;
+    const size_t outIndex = N - 1;
+    typedef ElementWiseProgramEvaluator<ElemType> Evaluator;
+    const size_t chunkSize = Evaluator::ChunkSize;
+
+    if (inputs.size() != program.numInputs || program.numInputs == 0 || program.numInputs > ElementWiseProgram::MaxInputs || program.instructions.empty())
+        InvalidArgument("FusedTensorOp: Number of inputs does not match the program.");
+
+    // base pointers; operands that are not used by the program alias the output, which is never read through them
+    array<const ElemType*, N> base;
+    for (size_t n = 0; n < outIndex; n++)
+        base[n] = (n < inputs.size() ? inputs[n]->Data() : Data()) + offsets[n];
+    ElemType* const out = Data() + offsets[outIndex];
+    base[outIndex] = out;
+
+    auto product = [](const SmallVector<size_t>& dims, size_t firstDim)
+    {
+        size_t n = 1;
+        for (size_t k = firstDim; k < dims.size(); k++)
+            n *= dims[k];
+        return n;
+    };
+    // write out a run of results; if beta == 0, the output is not read
+    auto store = [beta, alpha](ElemType* o, ptrdiff_t os, const ElemType* results, size_t len)
+    {
+        if (os == 1 && beta == 0 && alpha == 1)
+            memcpy(o, results, len * sizeof(ElemType));
+        else if (os == 1 && beta == 0)
+            for (size_t j = 0; j < len; j++)
+                o[j] = alpha * results[j];
+        else if (os == 1)
+            for (size_t j = 0; j < len; j++)
+                o[j] = beta * o[j] + alpha * results[j];
+        else
+            for (size_t j = 0; j < len; j++)
+                o[j * os] = beta == 0 ? alpha * results[j] : beta * o[j * os] + alpha * results[j];
+    };
+
+    const bool isReducing = !reducingOpDims.empty();
+    const size_t regularInnerDim = regularOpDims.empty() ? 1 : regularOpDims[0];
+    const bool runAlongRegularDim = !isReducing || regularInnerDim >= min(reducingOpDims[0], chunkSize);
+
+    if (runAlongRegularDim)
+    {
+        const size_t numChunks = (regularInnerDim + chunkSize - 1) / chunkSize;
+        const size_t numItems = product(regularOpDims, 1) * numChunks;
+        const size_t numReduced = isReducing ? product(reducingOpDims, 0) : 1;
+        array<ptrdiff_t, N> innerStrides;
+        for (size_t n = 0; n < N; n++)
+            innerStrides[n] = regularOpDims.empty() ? 0 : regularStrides[n][0];
+
+#pragma omp parallel if (numItems > 1)
+        {
+            Evaluator evaluator;
+            ElemType sums[Evaluator::ChunkSize];
+#pragma omp for
+            for (int item = 0; item < (int) numItems; item++)
+            {
+                const size_t j0 = (item % numChunks) * chunkSize;
+                const size_t len = min(chunkSize, regularInnerDim - j0);
+                array<const ElemType*, N> ptrs = base;
+                AddTensorOffsets(ptrs, item / numChunks, regularOpDims, 1, regularStrides);
+                for (size_t n = 0; n < N; n++)
+                    ptrs[n] += j0 * innerStrides[n];
+                ElemType* const o = const_cast<ElemType*>(ptrs[outIndex]);
+                const ptrdiff_t os = innerStrides[outIndex];
+
+                if (!isReducing)
+                {
+                    store(o, os, evaluator.Evaluate(program, ptrs.data(), innerStrides.data(), len), len);
+                    continue;
+                }
+                for (size_t j = 0; j < len; j++)
+                    sums[j] = 0;
+                for (size_t r = 0; r < numReduced; r++)
+                {
+                    array<const ElemType*, N> rptrs = ptrs;
+                    AddTensorOffsets(rptrs, r, reducingOpDims, 0, reducingStrides);
+                    const ElemType* results = evaluator.Evaluate(program, rptrs.data(), innerStrides.data(), len);
+                    for (size_t j = 0; j < len; j++)
+                        sums[j] += results[j];
+                }
+                store(o, os, sums, len);
+            }
+        }
+    }
+    else // reducing along a short regular dimension: run along the innermost reducing dimension instead
+    {
+        const size_t numItems = product(regularOpDims, 0);
+        const size_t reducingInnerDim = reducingOpDims[0];
+        const size_t numOuterReduced = product(reducingOpDims, 1);
+        array<ptrdiff_t, N> innerStrides;
+        for (size_t n = 0; n < N; n++)
+            innerStrides[n] = reducingStrides[n][0];
+
+#pragma omp parallel if (numItems > 1)
+        {
+            Evaluator evaluator;
+#pragma omp for
+            for (int item = 0; item < (int) numItems; item++)
+            {
+                array<const ElemType*, N> ptrs = base;
+                AddTensorOffsets(ptrs, item, regularOpDims, 0, regularStrides);
+                ElemType sum = 0;
+                for (size_t r = 0; r < numOuterReduced; r++)
+                {
+                    array<const ElemType*, N> rptrs = ptrs;
+                    AddTensorOffsets(rptrs, r, reducingOpDims, 1, reducingStrides);
+                    for (size_t j0 = 0; j0 < reducingInnerDim; j0 += chunkSize)
+                    {
+                        const size_t len = min(chunkSize, reducingInnerDim - j0);
+                        array<const ElemType*, N> cptrs = rptrs;
+                        for (size_t n = 0; n < N; n++)
+                            cptrs[n] += j0 * innerStrides[n];
+                        const ElemType* results = evaluator.Evaluate(program, cptrs.data(), innerStrides.data(), len);
+                        for (size_t j = 0; j < len; j++)
+                            sum += results[j];
+                    }
+                }
+                store(const_cast<ElemType*>(ptrs[outIndex]), 1, &sum, 1);
+            }
+        }
+    }
+}
+
 template <class ElemType>
 int CPUMatrix<ElemType>::Argmin() const
 {
@@ -0,0 +1,251 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+#include "stdafx.h"
+#include "CPUMemAllocator.h"
+#include "Basics.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace Microsoft { namespace MSR { namespace CNTK {
+
+static const size_t c_alignment = 64;
+static const size_t c_headerSize = 64;             // block header in front of the memory handed out, keeps that aligned
+static const size_t c_minClassSize = 128;
+static const size_t c_numSizeClasses = 4 * 64;
+static const size_t c_largeBlockSize = 256 * 1024; // blocks from this size on are mapped from the OS
+static const size_t c_hugePageSize = 2 * 1024 * 1024;
+
+struct BlockHeader
+{
+    size_t blockSize;  // including the header
+    size_t sizeClass;
+    void* base;        // as returned by the system
+    size_t mappedSize; // 0 if allocated from the heap
+};
+static_assert(sizeof(BlockHeader) <= c_headerSize, "CPUMemAllocator: block header too large");
+
+static std::atomic<bool> s_useHugePages(false);
+static std::atomic<size_t> s_maxCachedBytesPerThread(256 * 1024 * 1024);
+
+static std::atomic<size_t> s_bytesInUse(0);
+static std::atomic<size_t> s_peakBytesInUse(0);
+static std::atomic<size_t> s_bytesCached(0);
+static std::atomic<size_t> s_cacheHits(0);
+static std::atomic<size_t> s_cacheMisses(0);
+
+// round up to a size class: 128 bytes, then 4 classes per power of 2 (at most 25% waste)
+static size_t SizeClassOf(size_t size, size_t& classSize)
+{
+    if (size <= c_minClassSize)
+    {
+        classSize = c_minClassSize;
+        return 0;
+    }
+    size_t k = 0; // floor(log2(size - 1)), at least 7
+    for (size_t v = size - 1; v > 1; v >>= 1)
+        k++;
+    size_t step = (size_t) 1 << (k - 2);
+    classSize = ((size - 1) / step + 1) * step;
+    return (k - 7) * 4 + (classSize / step - 5) + 1;
+}
+
+static BlockHeader* SystemAllocate(size_t blockSize, size_t sizeClass)
+{
+    void* base = nullptr;
+    size_t mappedSize = 0;
+    char* block = nullptr;
+    if (blockSize >= c_largeBlockSize)
+    {
+#ifdef _WIN32
+        if (s_useHugePages && GetLargePageMinimum() > 0)
+        {
+            size_t largePageSize = GetLargePageMinimum();
+            mappedSize = (blockSize + largePageSize - 1) / largePageSize * largePageSize;
+            base = VirtualAlloc(nullptr, mappedSize, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE); // needs SeLockMemoryPrivilege
+        }
+        if (!base)
+        {
+            mappedSize = blockSize;
+            base = VirtualAlloc(nullptr, mappedSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        }
+        if (!base)
+            throw std::bad_alloc();
+        block = (char*) base;
+#else
+        const bool useHugePages = s_useHugePages && blockSize >= c_hugePageSize;
+        mappedSize = useHugePages ? blockSize + c_hugePageSize : blockSize; // transparent huge pages need huge page alignment
+        base = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED)
+            throw std::bad_alloc();
+        block = (char*) base;
+        if (useHugePages)
+        {
+            block = (char*) (((uintptr_t) base + c_hugePageSize - 1) & ~(uintptr_t) (c_hugePageSize - 1));
+            madvise(block, blockSize, MADV_HUGEPAGE); // a hint; failure is harmless
+        }
+#endif
+    }
+    else
+    {
+#ifdef _WIN32
+        base = _aligned_malloc(blockSize, c_alignment);
+#else
+        if (posix_memalign(&base, c_alignment, blockSize) != 0)
+            base = nullptr;
+#endif
+        if (!base)
+            throw std::bad_alloc();
+        block = (char*) base;
+    }
+
+    BlockHeader* header = (BlockHeader*) block;
+    header->blockSize = blockSize;
+    header->sizeClass = sizeClass;
+    header->base = base;
+    header->mappedSize = mappedSize;
+    return header;
+}
+
+static void SystemFree(BlockHeader* header)
+{
+    void* base = header->base;
+    size_t mappedSize = header->mappedSize;
+#ifdef _WIN32
+    if (mappedSize > 0)
+        VirtualFree(base, 0, MEM_RELEASE);
+    else
+        _aligned_free(base);
+#else
+    if (mappedSize > 0)
+        munmap(base, mappedSize);
+    else
+        free(base);
+#endif
+}
+
+// freed blocks of one thread, by size class
+struct ThreadCache
+{
+    std::vector<BlockHeader*> m_blocks[c_numSizeClasses];
+    size_t m_bytes = 0;
+
+    ~ThreadCache();
+    void Release()
+    {
+        for (auto& blocks : m_blocks)
+        {
+            for (auto header : blocks)
+                SystemFree(header);
+            blocks.clear();
+        }
+        s_bytesCached -= m_bytes;
+        m_bytes = 0;
+    }
+};
+
+static thread_local ThreadCache t_cache;
+static thread_local bool t_cacheDestroyed = false; // blocks freed during thread or process exit bypass the cache
+
+ThreadCache::~ThreadCache()
+{
+    Release();
+    t_cacheDestroyed = true;
+}
+
+/*static*/ void* CPUMemAllocator::AllocateBytes(size_t size, bool zero)
+{
+    size_t classSize;
+    size_t sizeClass = SizeClassOf(size + c_headerSize, classSize);
+
+    BlockHeader* header = nullptr;
+    if (!t_cacheDestroyed && !t_cache.m_blocks[sizeClass].empty())
+    {
+        header = t_cache.m_blocks[sizeClass].back();
+        t_cache.m_blocks[sizeClass].pop_back();
+        t_cache.m_bytes -= classSize;
+        s_bytesCached -= classSize;
+        s_cacheHits++;
+        if (zero)
+            memset((char*) header + c_headerSize, 0, size);
+    }
+    else
+    {
+        header = SystemAllocate(classSize, sizeClass);
+        s_cacheMisses++;
+        if (zero && header->mappedSize == 0) // fresh pages from the OS are zero already
+            memset((char*) header + c_headerSize, 0, size);
+    }
+
+    size_t inUse = (s_bytesInUse += classSize);
+    size_t peak = s_peakBytesInUse;
+    while (inUse > peak && !s_peakBytesInUse.compare_exchange_weak(peak, inUse))
+        ;
+    return (char*) header + c_headerSize;
+}
+
+/*static*/ void CPUMemAllocator::Deallocate(void* p)
+{
+    if (!p)
+        return;
+    BlockHeader* header = (BlockHeader*) ((char*) p - c_headerSize);
+    s_bytesInUse -= header->blockSize;
+    if (!t_cacheDestroyed && t_cache.m_bytes + header->blockSize <= s_maxCachedBytesPerThread)
+    {
+        t_cache.m_blocks[header->sizeClass].push_back(header);
+        t_cache.m_bytes += header->blockSize;
+        s_bytesCached += header->blockSize;
+    }
+    else
+        SystemFree(header);
+}
+
+void* CPUMemAllocator::Malloc(size_t size)
+{
+    return AllocateBytes(size, /*zero=*/false);
+}
+
+void CPUMemAllocator::Free(void* p)
+{
+    Deallocate(p);
+}
+
+/*static*/ void CPUMemAllocator::SetUseHugePages(bool enable)
+{
+    s_useHugePages = enable;
+}
+
+/*static*/ void CPUMemAllocator::SetMaxCachedBytesPerThread(size_t bytes)
+{
+    s_maxCachedBytesPerThread = bytes;
+    if (!t_cacheDestroyed && t_cache.m_bytes > bytes)
+        t_cache.Release();
+}
+
+/*static*/ void CPUMemAllocator::ReleaseCachedMemory()
+{
+    if (!t_cacheDestroyed)
+        t_cache.Release();
+}
+
+/*static*/ CPUMemAllocator::Statistics CPUMemAllocator::GetStatistics()
+{
+    Statistics statistics;
+    statistics.bytesInUse = s_bytesInUse;
+    statistics.peakBytesInUse = s_peakBytesInUse;
+    statistics.bytesCached = s_bytesCached;
+    statistics.cacheHits = s_cacheHits;
+    statistics.cacheMisses = s_cacheMisses;
+    return statistics;
+}
+
+} } }
@@ -0,0 +1,64 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+#pragma once
+
+#include "MemAllocator.h"
+#include <cstddef>
+
+namespace Microsoft { namespace MSR { namespace CNTK {
+
+#ifdef _WIN32
+#ifdef MATH_EXPORTS
+#define MATH_API __declspec(dllexport)
+#else
+#define MATH_API __declspec(dllimport)
+#endif
+#else // no DLLs on Linux
+#define MATH_API
+#endif
+
+// -----------------------------------------------------------------------
+// CPUMemAllocator -- allocator for the storage of CPU matrices
+//  - memory is 64-byte aligned (cache line, widest SIMD loads)
+//  - requests are rounded up to size classes (4 per power of 2), and freed blocks are kept in a cache of the freeing thread
+//    up to a byte budget, so that the resizing of matrices during training reuses memory instead of calling the system
+//  - large blocks come straight from the OS and are therefore zero already; they can be backed by (transparent) huge pages
+//  - memory is only zeroed when asked for
+// -----------------------------------------------------------------------
+
+class MATH_API CPUMemAllocator : public MemAllocator
+{
+public:
+    void* Malloc(size_t size) override;
+    void Free(void* p) override;
+
+    static void* AllocateBytes(size_t size, bool zero);
+    static void Deallocate(void* p); // accepts nullptr
+
+    template <typename AllocatedElemType>
+    static AllocatedElemType* Allocate(size_t numElements, bool zero = false)
+    {
+        return (AllocatedElemType*) AllocateBytes(numElements * sizeof(AllocatedElemType), zero);
+    }
+
+    // back large blocks by huge pages where the OS supports it (Linux: transparent huge pages; Windows: large pages, if privileged)
+    static void SetUseHugePages(bool enable);
+    // budget of the cache of each thread; 0 disables caching
+    static void SetMaxCachedBytesPerThread(size_t bytes);
+    // return the blocks cached by the calling thread to the system
+    static void ReleaseCachedMemory();
+
+    struct Statistics
+    {
+        size_t bytesInUse;     // in blocks handed out, including rounding to size classes
+        size_t peakBytesInUse;
+        size_t bytesCached;    // in the caches of all threads
+        size_t cacheHits;
+        size_t cacheMisses;
+    };
+    static Statistics GetStatistics();
+};
+
+} } }
@@ -0,0 +1,548 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+// CPURNN.cpp -- CPU implementation of the fused RNN stack used by OptimizedRNNStackNode
+//
+
+#include "stdafx.h"
+#include "Basics.h"
+#include "CPURNN.h"
+#include <math.h>
+#include <string.h>
+#include <omp.h>
+#include <algorithm>
+
+#pragma warning(disable : 4127) // conditional expression is constant; "if (sizeof(ElemType)==sizeof(float))" triggers this
+
+#ifdef USE_MKL
+// requires MKL 10.0 and above
+#include <mkl.h>
+#else
+#ifdef _MSC_VER
+// Visual Studio doesn't define standard complex types properly
+#define HAVE_LAPACK_CONFIG_H
+#define LAPACK_COMPLEX_STRUCTURE
+#endif
+#include <cblas.h>
+#endif
+
+namespace Microsoft { namespace MSR { namespace CNTK {
+
+// elementwise loops smaller than this are not worth starting an OpenMP team for
+static const long s_minParallelElements = 4096;
+
+// col-major C = alpha * op(A) * op(B) + beta * C on raw buffers, so that we can address the rows of one direction
+// inside the output of a bidirectional layer through the leading dimension
+template <class ElemType>
+static void Gemm(bool transposeA, bool transposeB, size_t m, size_t n, size_t k, ElemType alpha, const ElemType* a, size_t lda, const ElemType* b, size_t ldb, ElemType beta, ElemType* c, size_t ldc)
+{
+    if (m == 0 || n == 0)
+        return;
+    if (k == 0) // BLAS would not touch C in this case
+    {
+        for (size_t j = 0; j < n; j++)
+            for (size_t i = 0; i < m; i++)
+                c[i + j * ldc] = beta == 0 ? 0 : beta * c[i + j * ldc];
+        return;
+    }
+    CBLAS_TRANSPOSE transA = transposeA ? CblasTrans : CblasNoTrans;
+    CBLAS_TRANSPOSE transB = transposeB ? CblasTrans : CblasNoTrans;
+    if (sizeof(ElemType) == sizeof(double))
+    {
+        cblas_dgemm(CblasColMajor, transA, transB, (int) m, (int) n, (int) k, alpha, reinterpret_cast<const double*>(a), (int) lda, reinterpret_cast<const double*>(b), (int) ldb, beta, reinterpret_cast<double*>(c), (int) ldc);
+    }
+    else
+    {
+#pragma warning(suppress : 4244)
+        cblas_sgemm(CblasColMajor, transA, transB, (int) m, (int) n, (int) k, alpha, reinterpret_cast<const float*>(a), (int) lda, reinterpret_cast<const float*>(b), (int) ldb, beta, reinterpret_cast<float*>(c), (int) ldc);
+    }
+}
+
+template <class ElemType>
+static inline ElemType Sigmoid(ElemType x)
+{
+    return 1 / (1 + exp(-x));
+}
+
+template <class ElemType>
+CPURNNExecutor<ElemType>::CPURNNExecutor(size_t xDim, size_t yDim, const RnnAttributes& rnnAttributes)
+    : m_xDim(xDim), m_yDim(yDim), m_rnnAttributes(rnnAttributes),
+      m_numColumns(0), m_maxSequences(0), m_reserveSize(0), m_BackwardDataCalledYet(false)
+{
+    if      (rnnAttributes.m_recurrentOp == wstring(L"lstm"))    m_cellType = CellType::LSTM, m_numGates = 4;
+    else if (rnnAttributes.m_recurrentOp == wstring(L"gru"))     m_cellType = CellType::GRU,  m_numGates = 3;
+    else if (rnnAttributes.m_recurrentOp == wstring(L"rnnReLU")) m_cellType = CellType::ReLU, m_numGates = 1;
+    else if (rnnAttributes.m_recurrentOp == wstring(L"rnnTanh")) m_cellType = CellType::Tanh, m_numGates = 1;
+    else InvalidArgument("Unknown cell type '%ls'. Supported values are 'lstm', 'gru', 'rnnReLU', 'rnnTanh'.", rnnAttributes.m_recurrentOp.c_str());
+
+    m_numDirections = rnnAttributes.m_bidirectional ? 2 : 1;
+    m_numLayers = rnnAttributes.m_numLayers;
+    m_hiddenSize = rnnAttributes.m_hiddenSize;
+    if (m_yDim != m_numDirections * m_hiddenSize)
+        InvalidArgument("CPURNNExecutor: Output leading dimension must be twice hidden size for bidirectional networks");
+
+    // lay out the parameter blob the way cuDNN does: all weights first, then all biases
+    const size_t numPseudoLayers = m_numLayers * m_numDirections;
+    const size_t gatesDim = m_numGates * m_hiddenSize;
+    m_weightsXOffset.resize(numPseudoLayers);
+    m_weightsHOffset.resize(numPseudoLayers);
+    m_biasXOffset.resize(numPseudoLayers);
+    m_biasHOffset.resize(numPseudoLayers);
+    size_t offset = 0;
+    for (size_t layer = 0; layer < m_numLayers; layer++)
+    {
+        for (size_t direction = 0; direction < m_numDirections; direction++)
+        {
+            size_t p = PseudoLayer(layer, direction);
+            m_weightsXOffset[p] = offset;
+            offset += LayerInputDim(layer) * gatesDim;
+            m_weightsHOffset[p] = offset;
+            offset += m_hiddenSize * gatesDim;
+        }
+    }
+    for (size_t p = 0; p < numPseudoLayers; p++)
+    {
+        m_biasXOffset[p] = offset;
+        offset += gatesDim;
+        m_biasHOffset[p] = offset;
+        offset += gatesDim;
+    }
+    m_numParameters = offset;
+}
+
+template <class ElemType>
+size_t CPURNNExecutor<ElemType>::PrevFrame(size_t t, size_t direction) const
+{
+    if (direction == 0)
+        return t == 0 ? SIZE_MAX : t - 1;
+    else
+        return t + 1 == m_numSequencesForFrame.size() ? SIZE_MAX : t + 1;
+}
+
+template <class ElemType>
+size_t CPURNNExecutor<ElemType>::NextFrame(size_t t, size_t direction) const
+{
+    return PrevFrame(t, 1 - direction);
+}
+
+template <class ElemType>
+size_t CPURNNExecutor<ElemType>::NumSequencesWithStateIn(size_t t, size_t other) const
+{
+    // sequences are sorted longest first, so the sequences present in both frames are a common prefix
+    return other == SIZE_MAX ? 0 : min(m_numSequencesForFrame[t], m_numSequencesForFrame[other]);
+}
+
+template <class ElemType>
+void CPURNNExecutor<ElemType>::SetFrames(const vector<size_t>& numSequencesForFrame)
+{
+    m_numSequencesForFrame = numSequencesForFrame;
+    m_frameOffset.resize(numSequencesForFrame.size() + 1);
+    m_frameOffset[0] = 0;
+    m_maxSequences = 0;
+    for (size_t t = 0; t < numSequencesForFrame.size(); t++)
+    {
+        if (t > 0 && numSequencesForFrame[t] > numSequencesForFrame[t - 1])
+            LogicError("CPURNNExecutor: Sequences must be sorted by decreasing length.");
+        m_frameOffset[t + 1] = m_frameOffset[t] + numSequencesForFrame[t];
+        m_maxSequences = max(m_maxSequences, numSequencesForFrame[t]);
+    }
+    m_numColumns = m_frameOffset.back();
+}
+
+// one time step of one pseudo-layer for all sequences of frame t
+//  - on entry, the gates of frame t hold the input projection plus the biases (except the GRU candidate's recurrent bias)
+//  - 'recurrentProjection' holds W_h * h_prev for the sequences that have a previous state
+//  - on exit, the gates hold the gate activations, and the output of frame t is written to 'y'
+template <class ElemType>
+void CPURNNExecutor<ElemType>::ForwardStep(size_t p, size_t direction, size_t t, ElemType* y, const ElemType* recurrentProjection, const ElemType* biasH, ElemType* reserve) const
+{
+    const size_t hiddenSize = m_hiddenSize;
+    const size_t gatesDim = m_numGates * hiddenSize;
+    const size_t yDim = m_yDim;
+    const size_t tPrev = PrevFrame(t, direction);
+    const size_t numSequences = m_numSequencesForFrame[t];
+    const size_t numWithState = NumSequencesWithStateIn(t, tPrev);
+
+    ElemType* gates = reserve + m_gatesOffset[p] + m_frameOffset[t] * gatesDim;
+    ElemType* state = reserve + m_stateOffset[p] + m_frameOffset[t] * hiddenSize;
+    const ElemType* statePrev = numWithState ? reserve + m_stateOffset[p] + m_frameOffset[tPrev] * hiddenSize : nullptr;
+    ElemType* h = y + m_frameOffset[t] * yDim + direction * hiddenSize;
+    const ElemType* hPrev = numWithState ? y + m_frameOffset[tPrev] * yDim + direction * hiddenSize : nullptr;
+    const CellType cellType = m_cellType;
+
+    const long numElements = (long) (numSequences * hiddenSize);
+#pragma omp parallel for if (numElements >= s_minParallelElements)
+    for (long k = 0; k < numElements; k++)
+    {
+        const size_t s = k / hiddenSize;
+        const size_t i = k % hiddenSize;
+        const bool hasState = s < numWithState;
+        ElemType* g = gates + s * gatesDim;
+        const ElemType* r = recurrentProjection + s * gatesDim;
+        switch (cellType)
+        {
+        case CellType::LSTM:
+        {
+            ElemType in     = Sigmoid(g[i]                  + (hasState ? r[i]                  : 0));
+            ElemType forget = Sigmoid(g[i + hiddenSize]     + (hasState ? r[i + hiddenSize]     : 0));
+            ElemType cand   = tanh   (g[i + 2 * hiddenSize] + (hasState ? r[i + 2 * hiddenSize] : 0));
+            ElemType out    = Sigmoid(g[i + 3 * hiddenSize] + (hasState ? r[i + 3 * hiddenSize] : 0));
+            ElemType c = in * cand + (hasState ? forget * statePrev[s * hiddenSize + i] : 0);
+            g[i] = in;
+            g[i + hiddenSize] = forget;
+            g[i + 2 * hiddenSize] = cand;
+            g[i + 3 * hiddenSize] = out;
+            state[s * hiddenSize + i] = c;
+            h[s * yDim + i] = out * tanh(c);
+            break;
+        }
+        case CellType::GRU:
+        {
+            // cuDNN variant: the reset gate is applied after the recurrent projection, h' = tanh(W x + b_W + r .* (R h + b_R))
+            ElemType reset  = Sigmoid(g[i]              + (hasState ? r[i]              : 0));
+            ElemType update = Sigmoid(g[i + hiddenSize] + (hasState ? r[i + hiddenSize] : 0));
+            ElemType hr = biasH[i + 2 * hiddenSize] + (hasState ? r[i + 2 * hiddenSize] : 0);
+            ElemType cand = tanh(g[i + 2 * hiddenSize] + reset * hr);
+            g[i] = reset;
+            g[i + hiddenSize] = update;
+            g[i + 2 * hiddenSize] = cand;
+            state[s * hiddenSize + i] = hr;
+            h[s * yDim + i] = (1 - update) * cand + (hasState ? update * hPrev[s * yDim + i] : 0);
+            break;
+        }
+        case CellType::ReLU:
+        {
+            ElemType v = g[i] + (hasState ? r[i] : 0);
+            g[i] = v > 0 ? v : 0;
+            h[s * yDim + i] = g[i];
+            break;
+        }
+        case CellType::Tanh:
+            g[i] = tanh(g[i] + (hasState ? r[i] : 0));
+            h[s * yDim + i] = g[i];
+            break;
+        }
+    }
+}
+
+template <class ElemType>
+void CPURNNExecutor<ElemType>::ForwardCore(
+    const CPUMatrix<ElemType>& weightsW,
+    const CPUMatrix<ElemType>& inputX, CPUMatrix<ElemType>& outputY,
+    const vector<size_t>& numSequencesForFrame,
+    const RnnAttributes& rnnAttributes,
+    CPUMatrix<ElemType>& reserve, CPUMatrix<ElemType>& workspace)
+{
+    // test that the RNN shape is correct
+    if (!(m_rnnAttributes == rnnAttributes))
+        LogicError("RNN Layout has changed during processing");
+    if (weightsW.GetNumElements() != m_numParameters)
+        InvalidArgument("RNN needs %ld parameters, but %ld were allocated", (long) m_numParameters, (long) weightsW.GetNumElements());
+
+    SetFrames(numSequencesForFrame);
+    if (inputX.GetNumElements() != m_xDim * m_numColumns || outputY.GetNumElements() != m_yDim * m_numColumns)
+        InvalidArgument("CPURNNExecutor: Input and output must hold %d frames.", (int) m_numColumns);
+
+    const size_t numPseudoLayers = m_numLayers * m_numDirections;
+    const size_t gatesDim = m_numGates * m_hiddenSize;
+    const bool hasState = m_cellType == CellType::LSTM || m_cellType == CellType::GRU;
+
+    // reserve: gate activations and cell states per pseudo-layer, then the outputs of all layers but the top one
+    m_gatesOffset.resize(numPseudoLayers);
+    m_stateOffset.resize(numPseudoLayers);
+    m_layerOutputOffset.resize(m_numLayers);
+    size_t offset = 0;
+    for (size_t p = 0; p < numPseudoLayers; p++)
+    {
+        m_gatesOffset[p] = offset;
+        offset += gatesDim * m_numColumns;
+        m_stateOffset[p] = offset;
+        offset += hasState ? m_hiddenSize * m_numColumns : 0;
+    }
+    for (size_t layer = 0; layer + 1 < m_numLayers; layer++)
+    {
+        m_layerOutputOffset[layer] = offset;
+        offset += m_yDim * m_numColumns;
+    }
+    m_reserveSize = offset;
+    reserve.RequireSize(max<size_t>(m_reserveSize, 1), 1);
+    // workspace: recurrent projection of one time step
+    workspace.RequireSize(max<size_t>(gatesDim * m_maxSequences, 1), 1);
+
+    const ElemType* w = weightsW.Data();
+    ElemType* res = reserve.Data();
+    ElemType* recurrentProjection = workspace.Data();
+    for (size_t layer = 0; layer < m_numLayers; layer++)
+    {
+        const size_t inputDim = LayerInputDim(layer);
+        const ElemType* x = layer == 0 ? inputX.Data() : res + m_layerOutputOffset[layer - 1];
+        ElemType* y = layer + 1 == m_numLayers ? outputY.Data() : res + m_layerOutputOffset[layer];
+        for (size_t direction = 0; direction < m_numDirections; direction++)
+        {
+            const size_t p = PseudoLayer(layer, direction);
+            ElemType* gates = res + m_gatesOffset[p];
+
+            // input projection for all time steps at once, plus biases
+            Gemm<ElemType>(true, false, gatesDim, m_numColumns, inputDim, 1, w + m_weightsXOffset[p], inputDim, x, inputDim, 0, gates, gatesDim);
+            const ElemType* biasX = w + m_biasXOffset[p];
+            const ElemType* biasH = w + m_biasHOffset[p];
+            // the GRU candidate's recurrent bias is inside the reset gate's product, it is added in ForwardStep()
+            const size_t numBiasHRows = m_cellType == CellType::GRU ? 2 * m_hiddenSize : gatesDim;
+#pragma omp parallel for
+            for (long j = 0; j < (long) m_numColumns; j++)
+            {
+                ElemType* g = gates + j * gatesDim;
+                for (size_t i = 0; i < gatesDim; i++)
+                    g[i] += biasX[i] + (i < numBiasHRows ? biasH[i] : 0);
+            }
+
+            // recurrence
+            const size_t numFrames = m_numSequencesForFrame.size();
+            for (size_t step = 0; step < numFrames; step++)
+            {
+                const size_t t = direction == 0 ? step : numFrames - 1 - step;
+                const size_t tPrev = PrevFrame(t, direction);
+                const size_t numWithState = NumSequencesWithStateIn(t, tPrev);
+                if (numWithState > 0)
+                    Gemm<ElemType>(true, false, gatesDim, numWithState, m_hiddenSize, 1, w + m_weightsHOffset[p], m_hiddenSize,
+                                   y + m_frameOffset[tPrev] * m_yDim + direction * m_hiddenSize, m_yDim, 0, recurrentProjection, gatesDim);
+                ForwardStep(p, direction, t, y, recurrentProjection, biasH, res);
+            }
+        }
+    }
+    m_BackwardDataCalledYet = false;
+}
+
+// back-propagates one time step of one pseudo-layer for all sequences of frame t
+//  - 'dhCarry' holds the gradient w.r.t. the output of frame t from the step that consumed it (if any);
+//    on exit it holds the part of the gradient w.r.t. the previous output that does not go through W_h
+//  - 'dcCarry' does the same for the LSTM cell state
+template <class ElemType>
+void CPURNNExecutor<ElemType>::BackwardStep(size_t p, size_t direction, size_t t, const ElemType* y, const ElemType* dy, const ElemType* reserve,
+                                            ElemType* dGatesX, ElemType* dGatesH, ElemType* dhCarry, ElemType* dcCarry) const
+{
+    const size_t hiddenSize = m_hiddenSize;
+    const size_t gatesDim = m_numGates * hiddenSize;
+    const size_t yDim = m_yDim;
+    const size_t tPrev = PrevFrame(t, direction);
+    const size_t numSequences = m_numSequencesForFrame[t];
+    const size_t numWithState = NumSequencesWithStateIn(t, tPrev);
+    const size_t numWithCarry = NumSequencesWithStateIn(t, NextFrame(t, direction));
+
+    const ElemType* gates = reserve + m_gatesOffset[p] + m_frameOffset[t] * gatesDim;
+    const ElemType* state = reserve + m_stateOffset[p] + m_frameOffset[t] * hiddenSize;
+    const ElemType* statePrev = numWithState ? reserve + m_stateOffset[p] + m_frameOffset[tPrev] * hiddenSize : nullptr;
+    const ElemType* h = y + m_frameOffset[t] * yDim + direction * hiddenSize;
+    const ElemType* hPrev = numWithState ? y + m_frameOffset[tPrev] * yDim + direction * hiddenSize : nullptr;
+    const ElemType* dh = dy + m_frameOffset[t] * yDim + direction * hiddenSize;
+    ElemType* dgx = dGatesX + m_frameOffset[t] * gatesDim;
+    ElemType* dgh = dGatesH + m_frameOffset[t] * gatesDim;
+    const CellType cellType = m_cellType;
+
+    const long numElements = (long) (numSequences * hiddenSize);
+#pragma omp parallel for if (numElements >= s_minParallelElements)
+    for (long k = 0; k < numElements; k++)
+    {
+        const size_t s = k / hiddenSize;
+        const size_t i = k % hiddenSize;
+        const size_t si = s * hiddenSize + i;
+        const ElemType* g = gates + s * gatesDim;
+        ElemType* dg = dgx + s * gatesDim;
+        ElemType dOut = dh[s * yDim + i] + (s < numWithCarry ? dhCarry[si] : 0);
+        switch (cellType)
+        {
+        case CellType::LSTM:
+        {
+            ElemType in = g[i], forget = g[i + hiddenSize], cand = g[i + 2 * hiddenSize], out = g[i + 3 * hiddenSize];
+            ElemType tanhC = tanh(state[si]);
+            ElemType dc = dOut * out * (1 - tanhC * tanhC) + (s < numWithCarry ? dcCarry[si] : 0);
+            ElemType cPrev = s < numWithState ? statePrev[si] : 0;
+            dg[i]                  = dc * cand * in * (1 - in);
+            dg[i + hiddenSize]     = dc * cPrev * forget * (1 - forget);
+            dg[i + 2 * hiddenSize] = dc * in * (1 - cand * cand);
+            dg[i + 3 * hiddenSize] = dOut * tanhC * out * (1 - out);
+            dcCarry[si] = dc * forget;
+            break;
+        }
+        case CellType::GRU:
+        {
+            ElemType reset = g[i], update = g[i + hiddenSize], cand = g[i + 2 * hiddenSize];
+            ElemType hr = state[si];
+            ElemType prev = s < numWithState ? hPrev[s * yDim + i] : 0;
+            ElemType dCandPre = dOut * (1 - update) * (1 - cand * cand);
+            ElemType* dgr = dgh + s * gatesDim;
+            dg[i]                  = dCandPre * hr * reset * (1 - reset);
+            dg[i + hiddenSize]     = dOut * (prev - cand) * update * (1 - update);
+            dg[i + 2 * hiddenSize] = dCandPre;
+            dgr[i]                  = dg[i];
+            dgr[i + hiddenSize]     = dg[i + hiddenSize];
+            dgr[i + 2 * hiddenSize] = dCandPre * reset;
+            dhCarry[si] = dOut * update; // direct path through the update gate
+            break;
+        }
+        case CellType::ReLU:
+            dg[i] = h[s * yDim + i] > 0 ? dOut : 0;
+            break;
+        case CellType::Tanh:
+            dg[i] = dOut * (1 - h[s * yDim + i] * h[s * yDim + i]);
+            break;
+        }
+    }
+}
+
+template <class ElemType>
+void CPURNNExecutor<ElemType>::BackwardDataCore(
+    const CPUMatrix<ElemType>& outputY, const CPUMatrix<ElemType>& outputDY, const CPUMatrix<ElemType>& weightsW, CPUMatrix<ElemType>& dx,
+    const RnnAttributes& rnnAttributes,
+    CPUMatrix<ElemType>& reserve, CPUMatrix<ElemType>& workspace)
+{
+    // test that the RNN shape is correct
+    if (!(m_rnnAttributes == rnnAttributes))
+        LogicError("RNN Layout has changed during processing");
+    if (m_BackwardDataCalledYet)
+        return;
+    if (reserve.GetNumElements() < m_reserveSize || outputDY.GetNumElements() != m_yDim * m_numColumns || dx.GetNumElements() != m_xDim * m_numColumns)
+        LogicError("CPURNNExecutor: BackwardDataCore called with a different minibatch than ForwardCore.");
+
+    const size_t numPseudoLayers = m_numLayers * m_numDirections;
+    const size_t gatesDim = m_numGates * m_hiddenSize;
+
+    // workspace: gate gradients per pseudo-layer (kept for BackwardWeightsCore()), output gradients of two layers, carries of one time step
+    m_dGatesXOffset.resize(numPseudoLayers);
+    m_dGatesHOffset.resize(numPseudoLayers);
+    size_t offset = 0;
+    for (size_t p = 0; p < numPseudoLayers; p++)
+    {
+        m_dGatesXOffset[p] = offset;
+        offset += gatesDim * m_numColumns;
+        m_dGatesHOffset[p] = m_dGatesXOffset[p];
+        if (m_cellType == CellType::GRU)
+        {
+            m_dGatesHOffset[p] = offset;
+            offset += gatesDim * m_numColumns;
+        }
+    }
+    size_t dyOffset[2];
+    for (size_t k = 0; k < 2; k++)
+    {
+        dyOffset[k] = offset;
+        offset += m_numLayers > 1 ? m_yDim * m_numColumns : 0;
+    }
+    size_t dhCarryOffset = offset;
+    offset += m_hiddenSize * m_maxSequences;
+    size_t dcCarryOffset = offset;
+    offset += m_hiddenSize * m_maxSequences;
+    // BackwardWeightsCore() needs one more column block for the shifted recurrent inputs
+    size_t workspaceSize = max(offset, m_numColumns ? m_dGatesHOffset.back() + gatesDim * m_numColumns + m_hiddenSize * m_numColumns : 0);
+    workspace.RequireSize(max<size_t>(workspaceSize, 1), 1);
+
+    const ElemType* w = weightsW.Data();
+    const ElemType* res = reserve.Data();
+    ElemType* ws = workspace.Data();
+    ElemType* dhCarry = ws + dhCarryOffset;
+    ElemType* dcCarry = ws + dcCarryOffset;
+    for (size_t layer = m_numLayers; layer-- > 0;)
+    {
+        const size_t inputDim = LayerInputDim(layer);
+        const ElemType* y = layer + 1 == m_numLayers ? outputY.Data() : res + m_layerOutputOffset[layer];
+        const ElemType* dy = layer + 1 == m_numLayers ? outputDY.Data() : ws + dyOffset[layer % 2];
+        ElemType* dInput = layer == 0 ? dx.Data() : ws + dyOffset[(layer - 1) % 2];
+        for (size_t direction = 0; direction < m_numDirections; direction++)
+        {
+            const size_t p = PseudoLayer(layer, direction);
+            ElemType* dGatesX = ws + m_dGatesXOffset[p];
+            ElemType* dGatesH = ws + m_dGatesHOffset[p];
+
+            // recurrence, in reverse order of the forward pass
+            const size_t numFrames = m_numSequencesForFrame.size();
+            for (size_t step = numFrames; step-- > 0;)
+            {
+                const size_t t = direction == 0 ? step : numFrames - 1 - step;
+                const size_t tPrev = PrevFrame(t, direction);
+                const size_t numWithState = NumSequencesWithStateIn(t, tPrev);
+                BackwardStep(p, direction, t, y, dy, res, dGatesX, dGatesH, dhCarry, dcCarry);
+                if (numWithState > 0)
+                    Gemm<ElemType>(false, false, m_hiddenSize, numWithState, gatesDim, 1, w + m_weightsHOffset[p], m_hiddenSize,
+                                   dGatesH + m_frameOffset[t] * gatesDim, gatesDim, m_cellType == CellType::GRU ? 1 : 0, dhCarry, m_hiddenSize);
+            }
+
+            // gradient w.r.t. the layer input for all time steps at once
+            Gemm<ElemType>(false, false, inputDim, m_numColumns, gatesDim, 1, w + m_weightsXOffset[p], inputDim, dGatesX, gatesDim, direction == 0 ? 0 : 1, dInput, inputDim);
+        }
+    }
+    m_BackwardDataCalledYet = true;
+}
+
+template <class ElemType>
+void CPURNNExecutor<ElemType>::BackwardWeightsCore(const CPUMatrix<ElemType>& inputX, const CPUMatrix<ElemType>& outputY, CPUMatrix<ElemType>& dw,
+                                                   const RnnAttributes& rnnAttributes,
+                                                   CPUMatrix<ElemType>& reserve, CPUMatrix<ElemType>& workspace)
+{
+    // test that the RNN shape is correct
+    if (!(m_rnnAttributes == rnnAttributes))
+        LogicError("RNN Layout has changed during processing");
+    if (!m_BackwardDataCalledYet)
+        LogicError("CPURNNExecutor: BackwardWeightsCore must be called after BackwardDataCore.");
+    if (dw.GetNumElements() != m_numParameters)
+        InvalidArgument("RNN needs %ld parameters, but %ld were allocated", (long) m_numParameters, (long) dw.GetNumElements());
+
+    const size_t gatesDim = m_numGates * m_hiddenSize;
+    const ElemType* res = reserve.Data();
+    ElemType* ws = workspace.Data();
+    ElemType* hShifted = ws + m_dGatesHOffset.back() + gatesDim * m_numColumns;
+    ElemType* dW = dw.Data();
+    for (size_t layer = 0; layer < m_numLayers; layer++)
+    {
+        const size_t inputDim = LayerInputDim(layer);
+        const ElemType* x = layer == 0 ? inputX.Data() : res + m_layerOutputOffset[layer - 1];
+        const ElemType* y = layer + 1 == m_numLayers ? outputY.Data() : res + m_layerOutputOffset[layer];
+        for (size_t direction = 0; direction < m_numDirections; direction++)
+        {
+            const size_t p = PseudoLayer(layer, direction);
+            const ElemType* dGatesX = ws + m_dGatesXOffset[p];
+            const ElemType* dGatesH = ws + m_dGatesHOffset[p];
+
+            // like cuDNN, we accumulate into dw
+            Gemm<ElemType>(false, true, inputDim, gatesDim, m_numColumns, 1, x, inputDim, dGatesX, gatesDim, 1, dW + m_weightsXOffset[p], inputDim);
+
+            // gather the previous output of each column (zero at sequence starts), so that the recurrent weights also take a single GEMM
+#pragma omp parallel for
+            for (long t = 0; t < (long) m_numSequencesForFrame.size(); t++)
+            {
+                const size_t tPrev = PrevFrame(t, direction);
+                const size_t numWithState = NumSequencesWithStateIn(t, tPrev);
+                for (size_t s = 0; s < m_numSequencesForFrame[t]; s++)
+                {
+                    ElemType* dst = hShifted + (m_frameOffset[t] + s) * m_hiddenSize;
+                    if (s < numWithState)
+                        memcpy(dst, y + (m_frameOffset[tPrev] + s) * m_yDim + direction * m_hiddenSize, m_hiddenSize * sizeof(ElemType));
+                    else
+                        memset(dst, 0, m_hiddenSize * sizeof(ElemType));
+                }
+            }
+            Gemm<ElemType>(false, true, m_hiddenSize, gatesDim, m_numColumns, 1, hShifted, m_hiddenSize, dGatesH, gatesDim, 1, dW + m_weightsHOffset[p], m_hiddenSize);
+
+            // biases
+            ElemType* dBiasX = dW + m_biasXOffset[p];
+            ElemType* dBiasH = dW + m_biasHOffset[p];
+#pragma omp parallel for
+            for (long i = 0; i < (long) gatesDim; i++)
+            {
+                ElemType sumX = 0, sumH = 0;
+                for (size_t j = 0; j < m_numColumns; j++)
+                {
+                    sumX += dGatesX[j * gatesDim + i];
+                    sumH += dGatesH[j * gatesDim + i];
+                }
+                dBiasX[i] += sumX;
+                dBiasH[i] += sumH;
+            }
+        }
+    }
+}
+
+template class CPURNNExecutor<float>;
+template class CPURNNExecutor<double>;
+
+}}}
@@ -0,0 +1,99 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+// CPURNN.h -- CPU implementation of the fused RNN stack used by OptimizedRNNStackNode
+//
+#pragma once
+
+#include "CPUMatrix.h"
+#include "RNNCommon.h"
+#include <vector>
+
+namespace Microsoft { namespace MSR { namespace CNTK {
+
+// CPURNNExecutor is the CPU counterpart of CuDnnRNNExecutor. It is attached to a CPUMatrix object in the
+// same way, and all calls to the RNN need to go through that object.
+//
+// It computes the same stacked LSTM / GRU / ReLU-RNN / tanh-RNN (uni- or bidirectional) as cuDNN 5, on the
+// same monolithic parameter blob (CUDNN_LINEAR_INPUT layout), so a model can be trained on one device and
+// evaluated on the other:
+//  - weights: for each layer, for each direction: the input matrices of all gates, then the recurrent matrices
+//    of all gates. The matrices of one direction form one col-major [inputDim x numGates*hiddenSize] resp.
+//    [hiddenSize x numGates*hiddenSize] matrix, gate order i, f, c, o (LSTM) and r, z, h (GRU).
+//  - biases (after all weights): for each layer, for each direction: input biases, then recurrent biases.
+// Sequences are packed as for cuDNN: time step t holds numSequencesForFrame[t] columns, longest sequences first.
+//
+// The input projections of all time steps are computed with a single GEMM per layer and direction; only the
+// recurrent projection is computed step by step.
+template <class ElemType>
+class CPURNNExecutor
+{
+public:
+    CPURNNExecutor(size_t xDim, size_t yDim, const RnnAttributes& rnnAttributes);
+
+    bool IsCompatible(size_t xDim, size_t yDim, const RnnAttributes& rnnAttributes) const
+    {
+        return m_xDim == xDim && m_yDim == yDim && m_rnnAttributes == rnnAttributes;
+    }
+
+    size_t GetNumParameters() const { return m_numParameters; }
+
+    void ForwardCore(const CPUMatrix<ElemType>& weightsW, const CPUMatrix<ElemType>& inputX, CPUMatrix<ElemType>& outputY, const vector<size_t>& numSequencesForFrame, const RnnAttributes& rnnAttributes, CPUMatrix<ElemType>& reserve, CPUMatrix<ElemType>& workspace);
+    void BackwardWeightsCore(const CPUMatrix<ElemType>& inputX, const CPUMatrix<ElemType>& outputY, CPUMatrix<ElemType>& dw, const RnnAttributes& rnnAttributes, CPUMatrix<ElemType>& reserve, CPUMatrix<ElemType>& workspace);
+    void BackwardDataCore(const CPUMatrix<ElemType>& outputY, const CPUMatrix<ElemType>& outputDY, const CPUMatrix<ElemType>& w, CPUMatrix<ElemType>& dx, const RnnAttributes& rnnAttributes, CPUMatrix<ElemType>& reserve, CPUMatrix<ElemType>& workspace);
+
+private:
+    enum class CellType
+    {
+        LSTM,
+        GRU,
+        ReLU,
+        Tanh
+    };
+
+    // index of the (layer, direction) pair, which cuDNN calls a pseudo-layer
+    size_t PseudoLayer(size_t layer, size_t direction) const { return layer * m_numDirections + direction; }
+    size_t LayerInputDim(size_t layer) const { return layer == 0 ? m_xDim : m_yDim; }
+
+    // frames processed before/after frame t in the given direction (SIZE_MAX if none)
+    size_t PrevFrame(size_t t, size_t direction) const;
+    size_t NextFrame(size_t t, size_t direction) const;
+    // number of sequences in frame t that have a state in frame 'other'
+    size_t NumSequencesWithStateIn(size_t t, size_t other) const;
+
+    void SetFrames(const vector<size_t>& numSequencesForFrame);
+    void ForwardStep(size_t p, size_t direction, size_t t, ElemType* y, const ElemType* recurrentProjection, const ElemType* biasH, ElemType* reserve) const;
+    void BackwardStep(size_t p, size_t direction, size_t t, const ElemType* y, const ElemType* dy, const ElemType* reserve, ElemType* dGatesX, ElemType* dGatesH, ElemType* dhCarry, ElemType* dcCarry) const;
+
+    size_t m_xDim, m_yDim;
+    RnnAttributes m_rnnAttributes;
+    CellType m_cellType;
+    size_t m_numGates;
+    size_t m_numDirections;
+    size_t m_numLayers;
+    size_t m_hiddenSize;
+
+    // offsets into the parameter blob, per pseudo-layer
+    std::vector<size_t> m_weightsXOffset, m_weightsHOffset, m_biasXOffset, m_biasHOffset;
+    size_t m_numParameters;
+
+    // sequence packing of the current minibatch
+    std::vector<size_t> m_numSequencesForFrame;
+    std::vector<size_t> m_frameOffset; // first column of each frame
+    size_t m_numColumns;
+    size_t m_maxSequences;
+
+    // offsets into the reserve (kept from ForwardCore() until the backward calls), per pseudo-layer resp. layer:
+    // gate activations, cell states (LSTM) or recurrent candidate projections (GRU), outputs of all but the top layer
+    std::vector<size_t> m_gatesOffset, m_stateOffset, m_layerOutputOffset;
+    size_t m_reserveSize;
+
+    // offsets into the workspace (kept from BackwardDataCore() until BackwardWeightsCore()), per pseudo-layer:
+    // gradients of the gate pre-activations w.r.t. the input and the recurrent projection (the same except for GRU)
+    std::vector<size_t> m_dGatesXOffset, m_dGatesHOffset;
+
+    bool m_BackwardDataCalledYet;
+};
+
+}}}
@@ -747,10 +747,10 @@ void CPUSparseMatrix<ElemType>::Allocate(const size_t numRows, const size_t numC
     {
         if (GetFormat() == MatrixFormat::matrixFormatSparseCSC || GetFormat() == MatrixFormat::matrixFormatSparseCSR)
         {
-            // The initialization of the following buffer is done by new []().
-            auto* pArray      = new ElemType[numNZElemToReserve]();
-            auto* unCompIndex = new CPUSPARSE_INDEX_TYPE[numNZElemToReserve]();
-            auto* compIndex   = new CPUSPARSE_INDEX_TYPE[newCompIndexSize]();
+            // The following buffers are zero-initialized.
+            auto* pArray      = CPUMemAllocator::Allocate<ElemType>(numNZElemToReserve, /*zero=*/true);
+            auto* unCompIndex = CPUMemAllocator::Allocate<CPUSPARSE_INDEX_TYPE>(numNZElemToReserve, /*zero=*/true);
+            auto* compIndex   = CPUMemAllocator::Allocate<CPUSPARSE_INDEX_TYPE>(newCompIndexSize, /*zero=*/true);
 
             if (keepExistingValues && (NzCount() > numNZElemToReserve || GetCompIndexSize() > newCompIndexSize))
                 LogicError("Allocate: To keep values m_nz should <= numNZElemToReserve and m_compIndexSize <= newCompIndexSize");
@@ -764,9 +764,9 @@ void CPUSparseMatrix<ElemType>::Allocate(const size_t numRows, const size_t numC
             }
 
             // TODO: This is super ugly. The internals of the storage object should be a shared_ptr.
-            delete[] Buffer();
-            delete[] GetUnCompIndex();
-            delete[] GetCompIndex();
+            CPUMemAllocator::Deallocate(Buffer());
+            CPUMemAllocator::Deallocate(GetUnCompIndex());
+            CPUMemAllocator::Deallocate(GetCompIndex());
 
             SetBuffer(pArray, numNZElemToReserve, false);
             SetUnCompIndex(unCompIndex);
@@ -774,8 +774,8 @@ void CPUSparseMatrix<ElemType>::Allocate(const size_t numRows, const size_t numC
         }
         else if (GetFormat() == MatrixFormat::matrixFormatSparseBlockCol || GetFormat() == MatrixFormat::matrixFormatSparseBlockRow)
         {
-            ElemType* blockVal = new ElemType[numNZElemToReserve];
-            size_t* blockIds = new size_t[newCompIndexSize];
+            ElemType* blockVal = CPUMemAllocator::Allocate<ElemType>(numNZElemToReserve);
+            size_t* blockIds = CPUMemAllocator::Allocate<size_t>(newCompIndexSize);
 
             if (keepExistingValues && (NzCount() > numNZElemToReserve || GetCompIndexSize() > newCompIndexSize))
                 LogicError("Resize: To keep values m_nz should <= numNZElemToReserve and m_compIndexSize <= newCompIndexSize");
@@ -787,8 +787,8 @@ void CPUSparseMatrix<ElemType>::Allocate(const size_t numRows, const size_t numC
                 memcpy(blockIds, GetBlockIds(), sizeof(size_t) * GetCompIndexSize());
             }
 
-            delete[] Buffer();
-            delete[] GetBlockIds();
+            CPUMemAllocator::Deallocate(Buffer());
+            CPUMemAllocator::Deallocate(GetBlockIds());
 
             SetBuffer(blockVal, numNZElemToReserve, false);
             SetBlockIds(blockIds);
@@ -870,6 +870,56 @@ void CPUSparseMatrix<ElemType>::Reset()
     SetBlockIdShift(0);
 }
 
+// the columns that have a block, in block order
+template <class ElemType>
+std::vector<size_t> CPUSparseMatrix<ElemType>::GetBlockColumns() const
+{
+    if (GetFormat() != MatrixFormat::matrixFormatSparseBlockCol)
+        LogicError("GetBlockColumns: Expected sparse block col matrix.");
+
+    std::vector<size_t> columns(GetBlockSize());
+    for (size_t blockId = 0; blockId < columns.size(); blockId++)
+        columns[blockId] = GetBlockIds()[blockId] - GetBlockIdShift();
+    return columns;
+}
+
+// Rearranges the blocks according to cpuCol2BlockId: column j gets block cpuCol2BlockId[j], unless it is SparseIndex_NotAssigned.
+// The values of columns that already had a block are kept, new blocks are filled with zeros.
+// Values of columns that do not get a block are dropped.
+template <class ElemType>
+void CPUSparseMatrix<ElemType>::AdjustCol2BlockId(const GPUSPARSE_INDEX_TYPE* cpuCol2BlockId, size_t numBlocks)
+{
+    if (GetFormat() != MatrixFormat::matrixFormatSparseBlockCol)
+        LogicError("AdjustCol2BlockId: Expected sparse block col matrix.");
+    if (!OwnBuffer())
+        LogicError("Cannot modify since the buffer is managed externally.");
+
+    const size_t numRows = GetNumRows();
+    const size_t numCols = GetNumCols();
+    const std::vector<size_t> oldColumns = GetBlockColumns();
+    const std::vector<ElemType> oldValues(Data(), Data() + NzCount());
+
+    SetBlockSize(0);
+    SetBlockIdShift(0);
+    RequireSizeAndAllocate(numRows, numCols, numBlocks * numRows, true, false);
+
+    ElemType* values = Data();
+    memset(values, 0, sizeof(ElemType) * numBlocks * numRows);
+    for (size_t j = 0; j < numCols; j++)
+    {
+        if (cpuCol2BlockId[j] != SparseIndex_NotAssigned)
+            GetBlockIds()[cpuCol2BlockId[j]] = j;
+    }
+
+    for (size_t oldBlockId = 0; oldBlockId < oldColumns.size(); oldBlockId++)
+    {
+        GPUSPARSE_INDEX_TYPE blockId = cpuCol2BlockId[oldColumns[oldBlockId]];
+        if (blockId != SparseIndex_NotAssigned)
+            memcpy(values + blockId * numRows, oldValues.data() + oldBlockId * numRows, sizeof(ElemType) * numRows);
+    }
+    SetBlockSize(numBlocks);
+}
+
 // Implements product of one sparse and one dense matrix updating a third dense matrix. Input matrices are optionally transposed.
 // NOTE: The only for using a class template instead of a function template was that I couldn't make the function template compile.
 template <class ElemType, bool denseTimesSparse /* false means SparseTimesDense */, bool transposeA, bool transposeB>
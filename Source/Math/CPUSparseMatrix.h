@@ -192,6 +192,10 @@ public:
 
     void Reset();
 
+    // sparse block column only
+    std::vector<size_t> GetBlockColumns() const;
+    void AdjustCol2BlockId(const GPUSPARSE_INDEX_TYPE* cpuCol2BlockId, size_t numBlocks);
+
     const ElemType operator()(const size_t row, const size_t col) const
     {
         if (col >= m_numCols || row >= m_numRows)
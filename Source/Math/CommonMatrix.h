@@ -15,11 +15,13 @@
 
 #include "Basics.h"
 #include "basetypes.h"
+#include "CPUMemAllocator.h"
 #include <string>
 #include <stdint.h>
 #include <memory>
 #include <unordered_map>
 #include <map>
+#include <vector>
 
 #pragma warning( disable: 4251 )
 typedef unsigned char byte;
@@ -195,6 +197,63 @@ enum ElementWiseOperator
     Macro(ElementwiseProductWithPowExponentDerivative); \
     Macro(ElementwiseProductWithPowBaseDerivative);
 
+// -----------------------------------------------------------------------
+// ElementWiseProgram -- a straight-line sequence of elementwise operations
+// that is evaluated in a single pass over its input tensors.
+// This is used to execute chains of elementwise nodes that have been fused
+// into one node, without materializing the intermediate results.
+// Registers [0, numInputs) hold the inputs. Each instruction computes one
+// more register from up to three previous ones. The last register is the result.
+// -----------------------------------------------------------------------
+
+struct ElementWiseInstruction
+{
+    ElementWiseOperator op;
+    unsigned char args[3]; // source registers; only the first 1, 2, or 3 are used, depending on the arity of 'op'
+};
+
+struct ElementWiseProgram
+{
+    static const size_t MaxInputs = 7;                 // inputs plus output are passed to the tensor lib as this many + 1 operands
+    static const size_t MaxOperands = MaxInputs + 1;
+    static const size_t MaxRegisters = 32;
+
+    size_t numInputs = 0;
+    std::vector<ElementWiseInstruction> instructions;
+
+    size_t NumRegisters() const { return numInputs + instructions.size(); }
+    size_t ResultRegister() const { return NumRegisters() - 1; }
+
+    // append an instruction and return its result register
+    size_t Add(ElementWiseOperator op, size_t a, size_t b = 0, size_t c = 0)
+    {
+        if (NumRegisters() >= MaxRegisters)
+            LogicError("ElementWiseProgram: Too many instructions.");
+        if (a >= NumRegisters() || b >= NumRegisters() || c >= NumRegisters())
+            LogicError("ElementWiseProgram: Instruction argument out of range.");
+        instructions.push_back(ElementWiseInstruction{ op, { (unsigned char)a, (unsigned char)b, (unsigned char)c } });
+        return ResultRegister();
+    }
+};
+
+// number of arguments of an elementwise operation that has a tensor implementation (0 for all others)
+inline size_t GetElementWiseOperatorArity(ElementWiseOperator op)
+{
+#define CaseElementWiseOperatorArity(oper) case ElementWiseOperator::op##oper:
+    switch (op)
+    {
+    ForAllUnaryOps(CaseElementWiseOperatorArity)
+        return 1;
+    ForAllBinaryOps(CaseElementWiseOperatorArity)
+        return 2;
+    ForAllTernaryOps(CaseElementWiseOperatorArity)
+        return 3;
+    default:
+        return 0;
+    }
+#undef CaseElementWiseOperatorArity
+}
+
 // -----------------------------------------------------------------------
 // various enums to describe
 // -----------------------------------------------------------------------
@@ -273,17 +332,17 @@ public:
         {
             if (m_computeDevice < 0)
             {
-                delete[] m_pArray;
+                CPUMemAllocator::Deallocate(m_pArray);
                 m_pArray = nullptr;
                 m_nzValues = nullptr;
 
-                delete[] m_unCompIndex;
+                CPUMemAllocator::Deallocate(m_unCompIndex);
                 m_unCompIndex = nullptr;
 
-                delete[] m_compIndex;
+                CPUMemAllocator::Deallocate(m_compIndex);
                 m_compIndex = nullptr;
 
-                delete[] m_blockIds;
+                CPUMemAllocator::Deallocate(m_blockIds);
                 m_blockIds = nullptr;
             }
             else
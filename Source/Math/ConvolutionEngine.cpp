@@ -854,6 +854,605 @@ public:
     }
 };
 
+//------------------------------------------------------------------
+// Direct convolution engine implementation.
+// CPU-only engine for the 2D convolutions that dominate CNNs. None of them unroll the input:
+// 1. 3x3 kernels with stride 1 use Winograd minimal filtering F(4x4, 3x3), or F(2x2, 3x3) for small outputs
+//    (Fast Algorithms for Convolutional Neural Networks; Lavin, Gray). The input is transformed tile by tile
+//    in blocks of tiles small enough to stay in cache, so the temporary memory does not grow with the minibatch.
+// 2. 1x1 kernels are a GEMM per sample directly on the input (strided ones on a subsampled copy of it).
+// 3. Depthwise kernels (depth 1, one kernel per channel or one shared by all channels) use direct loops.
+//    The GEMM engine does not support these at all, so the reference engine was used before.
+// Winograd and 1x1 convolutions use the GEMM engine for the backward passes.
+//------------------------------------------------------------------
+
+// Winograd F(M x M, 3 x 3) transform matrices. Tiles of the input and of the transformed kernels are
+// Alpha x Alpha, Alpha = M + 2. Output Y = AT * [(G * g * G^T) .* (BT * d * BT^T)] * AT^T.
+template <class ElemType, size_t M>
+struct WinogradF3;
+
+template <class ElemType>
+struct WinogradF3<ElemType, 2>
+{
+    static const size_t Alpha = 4;
+    static constexpr ElemType BT[4][4] = {
+        { 1,  0, -1,  0 },
+        { 0,  1,  1,  0 },
+        { 0, -1,  1,  0 },
+        { 0,  1,  0, -1 } };
+    static constexpr ElemType G[4][3] = {
+        { 1,              0,              0 },
+        { (ElemType)0.5,  (ElemType)0.5,  (ElemType)0.5 },
+        { (ElemType)0.5,  (ElemType)-0.5, (ElemType)0.5 },
+        { 0,              0,              1 } };
+    static constexpr ElemType AT[2][4] = {
+        { 1, 1,  1,  0 },
+        { 0, 1, -1, -1 } };
+};
+
+template <class ElemType>
+struct WinogradF3<ElemType, 4>
+{
+    static const size_t Alpha = 6;
+    static constexpr ElemType BT[6][6] = {
+        { 4,  0, -5,  0, 1, 0 },
+        { 0, -4, -4,  1, 1, 0 },
+        { 0,  4, -4, -1, 1, 0 },
+        { 0, -2, -1,  2, 1, 0 },
+        { 0,  2, -1, -2, 1, 0 },
+        { 0,  4,  0, -5, 0, 1 } };
+    static constexpr ElemType G[6][3] = {
+        { (ElemType)(1.0 / 4),   0,                      0 },
+        { (ElemType)(-1.0 / 6),  (ElemType)(-1.0 / 6),   (ElemType)(-1.0 / 6) },
+        { (ElemType)(-1.0 / 6),  (ElemType)(1.0 / 6),    (ElemType)(-1.0 / 6) },
+        { (ElemType)(1.0 / 24),  (ElemType)(1.0 / 12),   (ElemType)(1.0 / 6) },
+        { (ElemType)(1.0 / 24),  (ElemType)(-1.0 / 12),  (ElemType)(1.0 / 6) },
+        { 0,                     0,                      1 } };
+    static constexpr ElemType AT[4][6] = {
+        { 1, 1,  1, 1,  1, 0 },
+        { 0, 1, -1, 2, -2, 0 },
+        { 0, 1,  1, 4,  4, 0 },
+        { 0, 1, -1, 8, -8, 1 } };
+};
+
+template <class ElemType> constexpr ElemType WinogradF3<ElemType, 2>::BT[4][4];
+template <class ElemType> constexpr ElemType WinogradF3<ElemType, 2>::G[4][3];
+template <class ElemType> constexpr ElemType WinogradF3<ElemType, 2>::AT[2][4];
+template <class ElemType> constexpr ElemType WinogradF3<ElemType, 4>::BT[6][6];
+template <class ElemType> constexpr ElemType WinogradF3<ElemType, 4>::G[6][3];
+template <class ElemType> constexpr ElemType WinogradF3<ElemType, 4>::AT[4][6];
+
+// res = l * x * r^T for small row-major matrices.
+template <class ElemType, size_t R, size_t K, size_t C, size_t L>
+inline void WinogradSandwich(const ElemType (&l)[R][K], const ElemType (&x)[K][L], const ElemType (&r)[C][L], ElemType (&res)[R][C])
+{
+    ElemType tmp[R][L];
+    for (size_t i = 0; i < R; i++)
+    {
+        for (size_t j = 0; j < L; j++)
+        {
+            ElemType sum = 0;
+            for (size_t k = 0; k < K; k++)
+                sum += l[i][k] * x[k][j];
+            tmp[i][j] = sum;
+        }
+    }
+    for (size_t i = 0; i < R; i++)
+    {
+        for (size_t j = 0; j < C; j++)
+        {
+            ElemType sum = 0;
+            for (size_t k = 0; k < L; k++)
+                sum += tmp[i][k] * r[j][k];
+            res[i][j] = sum;
+        }
+    }
+}
+
+template <class ElemType>
+class DirectConvolutionEngine : public GemmConvolutionEngine<ElemType>
+{
+public:
+    using Base = GemmConvolutionEngine<ElemType>;
+    using typename Base::Mat;
+
+public:
+    DirectConvolutionEngine(ConvolveGeometryPtr geometry, DEVICEID_TYPE deviceId, ImageLayoutKind imageLayout, size_t maxTempMemSizeInSamples, PoolKind poolKind, bool poolIncludePad)
+        : Base(geometry, deviceId, imageLayout, maxTempMemSizeInSamples, poolKind, poolIncludePad),
+        m_algo(GetAlgorithm(*geometry)), m_winogradTileSize(0)
+    {
+        if (m_algo == Algorithm::None)
+            return;
+        const auto& inT = geometry->InputShape();
+        const auto& outT = geometry->OutputShape();
+        m_inW = inT[0];
+        m_inH = inT[1];
+        m_inC = inT[2];
+        m_outW = outT[0];
+        m_outH = outT[1];
+        m_outC = outT[2];
+        m_kernW = geometry->KernelShape()[0];
+        m_kernH = geometry->KernelShape()[1];
+        m_strideW = (int)geometry->GetStride(0);
+        m_strideH = (int)geometry->GetStride(1);
+        m_padW = geometry->GetLowerPad(0);
+        m_padH = geometry->GetLowerPad(1);
+        m_sharedKernel = geometry->GetSharing(2);
+    }
+
+protected:
+    using Base::IsGpu;
+
+    using Base::m_geometry;
+    using Base::m_deviceId;
+    using Base::m_imageLayout;
+
+    enum class Algorithm
+    {
+        None,
+        Winograd,
+        Pointwise,
+        Depthwise
+    };
+
+    void EnsureCompatible() override
+    {
+        if (m_imageLayout != ImageLayoutKind::CHW)
+            LogicError("Direct convolution engine supports only CHW/cudnn layout.");
+        if (IsGpu(m_deviceId))
+            LogicError("Direct convolution engine supports only CPU device.");
+        if (m_algo == Algorithm::None)
+            LogicError("Direct convolution engine does not support this convolution configuration. Geometry: %s", ((string)*m_geometry).c_str());
+    }
+
+    void ForwardCore(const Mat& in, const Mat& kernel, Mat& out, Mat& workspace) override
+    {
+        if (in.GetMatrixType() != DENSE)
+            return FallbackForward(in, kernel, out, workspace);
+
+        switch (m_algo)
+        {
+        case Algorithm::Winograd:
+            // F(4x4, 3x3) needs 4 times fewer tiles but wastes more of them at the border of small outputs.
+            if (m_outW >= 4 && m_outH >= 4)
+                ForwardWinograd<4>(in, kernel, out, workspace);
+            else
+                ForwardWinograd<2>(in, kernel, out, workspace);
+            break;
+        case Algorithm::Pointwise:
+            ForwardPointwise(in, kernel, out, workspace);
+            break;
+        case Algorithm::Depthwise:
+            ForwardDepthwise(in, kernel, out);
+            break;
+        default:
+            FallbackForward(in, kernel, out, workspace);
+        }
+    }
+
+    void BackwardDataCore(const Mat& srcGrad, const Mat& kernel, Mat& grad, bool accumulateGradient, Mat& workspace) override
+    {
+        if (m_algo == Algorithm::Depthwise)
+            BackwardDataDepthwise(srcGrad, kernel, grad);
+        else
+            Base::BackwardDataCore(srcGrad, kernel, grad, accumulateGradient, workspace);
+    }
+
+    void BackwardKernelCore(const Mat& srcGrad, const Mat& in, Mat& kernelGrad, bool accumulateGradient, bool allowReuse, Mat& workspace) override
+    {
+        if (m_algo != Algorithm::Depthwise)
+            Base::BackwardKernelCore(srcGrad, in, kernelGrad, accumulateGradient, allowReuse, workspace);
+        else if (in.GetMatrixType() != DENSE)
+            ReferenceConvolutionEngine<ElemType>::BackwardKernelCore(srcGrad, in, kernelGrad, accumulateGradient, allowReuse, workspace);
+        else
+            BackwardKernelDepthwise(srcGrad, in, kernelGrad, workspace);
+    }
+
+private:
+    void FallbackForward(const Mat& in, const Mat& kernel, Mat& out, Mat& workspace)
+    {
+        // Depthwise convolutions have no sharing along channels, which only the reference engine supports.
+        if (m_algo == Algorithm::Depthwise)
+            ReferenceConvolutionEngine<ElemType>::ForwardCore(in, kernel, out, workspace);
+        else
+            Base::ForwardCore(in, kernel, out, workspace);
+    }
+
+    // Range [begin, end) of the output coordinates o for which the input coordinate o * stride - pad + tap
+    // lies inside [0, inSize).
+    static void GetValidRange(int inSize, int outSize, int stride, int pad, int tap, int& begin, int& end)
+    {
+        int offset = tap - pad;
+        begin = offset >= 0 ? 0 : (-offset + stride - 1) / stride;
+        end = offset >= inSize ? 0 : min(outSize, (inSize - 1 - offset) / stride + 1);
+        if (end < begin)
+            end = begin;
+    }
+
+    // Transforms the kernels to Alpha^2 matrices U of [K x C]. The kernel of map k is row k of the kernel matrix,
+    // in cudnn (row-major) layout. Kernels do not change during inference, so the transform is only redone when
+    // they differ from the ones transformed last time.
+    template <size_t M>
+    void TransformWinogradKernel(const Mat& kernel)
+    {
+        using Transform = WinogradF3<ElemType, M>;
+        const size_t alpha = Transform::Alpha;
+        size_t mapCount = m_outC;
+        const ElemType* kernData = kernel.Data();
+        size_t kernSize = mapCount * m_inC * 9;
+        if (m_winogradKernel != nullptr && m_winogradTileSize == M &&
+            std::equal(m_winogradKernelSource.begin(), m_winogradKernelSource.end(), kernData))
+            return;
+
+        m_winogradKernelSource.assign(kernData, kernData + kernSize);
+        m_winogradTileSize = M;
+        if (m_winogradKernel == nullptr)
+            m_winogradKernel = std::make_unique<Mat>(m_deviceId);
+        m_winogradKernel->Resize(1, alpha * alpha * mapCount * m_inC);
+        ElemType* u = m_winogradKernel->Data();
+        #pragma omp parallel for
+        for (long kc = 0; kc < (long)(mapCount * m_inC); kc++)
+        {
+            size_t k = kc % mapCount;
+            size_t c = kc / mapCount;
+            const ElemType* src = kernData + (k * m_inC + c) * 9;
+            ElemType g[3][3];
+            for (size_t y = 0; y < 3; y++)
+                for (size_t x = 0; x < 3; x++)
+                    g[y][x] = src[y * 3 + x];
+            ElemType res[alpha][alpha];
+            WinogradSandwich(Transform::G, g, Transform::G, res);
+            for (size_t i = 0; i < alpha; i++)
+                for (size_t j = 0; j < alpha; j++)
+                    u[(i * alpha + j) * mapCount * m_inC + kc] = res[i][j];
+        }
+    }
+
+    // Winograd F(M x M, 3 x 3) forward pass:
+    // 1. Transform kernels: [3x3 x C x K] -> Alpha^2 matrices U of [K x C] (see TransformWinogradKernel()).
+    // 2. Transform input tiles: for a block of P tiles (of all samples), [Alpha x Alpha x C x P] -> Alpha^2 matrices V of [C x P].
+    // 3. Alpha^2 GEMMs M = U * V, [K x P] each.
+    // 4. Transform M to the M x M output tiles of the block.
+    // Input tiles of neighboring outputs overlap by 2, with zeros outside of the input (that is, the padding).
+    template <size_t M>
+    void ForwardWinograd(const Mat& in, const Mat& kernel, Mat& out, Mat& workspace)
+    {
+        using Transform = WinogradF3<ElemType, M>;
+        const size_t alpha = Transform::Alpha;
+        const size_t tileCount = alpha * alpha;
+
+        size_t batchSize = in.GetNumCols();
+        size_t tilesW = (m_outW + M - 1) / M;
+        size_t tilesH = (m_outH + M - 1) / M;
+        size_t tilesPerSample = tilesW * tilesH;
+        size_t numTiles = tilesPerSample * batchSize;
+        size_t mapCount = m_outC;
+        // Transformed inputs and outputs of a block should stay in the cache.
+        size_t blockSize = c_winogradBlockBytes / (tileCount * (m_inC + mapCount) * sizeof(ElemType));
+        blockSize = min(numTiles, max(blockSize, c_minWinogradBlockTiles));
+
+        size_t inputOffset = 0;
+        size_t outputOffset = tileCount * m_inC * blockSize;
+        workspace.Resize(1, outputOffset + tileCount * mapCount * blockSize);
+        ElemType* wsData = workspace.Data();
+
+        TransformWinogradKernel<M>(kernel);
+
+        const ElemType* inData = in.Data();
+        ElemType* outData = out.Data();
+        size_t inSampleSize = in.GetNumRows();
+        size_t outSampleSize = out.GetNumRows();
+        for (size_t first = 0; first < numTiles; first += blockSize)
+        {
+            size_t count = min(blockSize, numTiles - first);
+
+            // 2. Input transform.
+            ElemType* v = wsData + inputOffset;
+            #pragma omp parallel for
+            for (long p = 0; p < (long)count; p++)
+            {
+                size_t sample = (first + p) / tilesPerSample;
+                size_t tile = (first + p) % tilesPerSample;
+                int h0 = (int)(tile / tilesW * M) - m_padH;
+                int w0 = (int)(tile % tilesW * M) - m_padW;
+                bool interior = h0 >= 0 && w0 >= 0 && h0 + (int)alpha <= (int)m_inH && w0 + (int)alpha <= (int)m_inW;
+                const ElemType* src = inData + sample * inSampleSize;
+                ElemType d[alpha][alpha];
+                ElemType res[alpha][alpha];
+                for (size_t c = 0; c < m_inC; c++)
+                {
+                    const ElemType* plane = src + c * m_inW * m_inH;
+                    for (size_t y = 0; y < alpha; y++)
+                    {
+                        int h = h0 + (int)y;
+                        for (size_t x = 0; x < alpha; x++)
+                        {
+                            int w = w0 + (int)x;
+                            d[y][x] = interior || (0 <= h && h < (int)m_inH && 0 <= w && w < (int)m_inW) ? plane[h * m_inW + w] : 0;
+                        }
+                    }
+                    WinogradSandwich(Transform::BT, d, Transform::BT, res);
+                    for (size_t i = 0; i < alpha; i++)
+                        for (size_t j = 0; j < alpha; j++)
+                            v[(i * alpha + j) * m_inC * count + p * m_inC + c] = res[i][j];
+                }
+            }
+
+            // 3. Element-wise products of the transformed tiles, summed over the channels.
+            for (size_t t = 0; t < tileCount; t++)
+            {
+                auto uSlice = m_winogradKernel->ColumnSlice(t * mapCount * m_inC, mapCount * m_inC);
+                uSlice.Reshape(mapCount, m_inC);
+                auto vSlice = workspace.ColumnSlice(inputOffset + t * m_inC * count, m_inC * count);
+                vSlice.Reshape(m_inC, count);
+                auto mSlice = workspace.ColumnSlice(outputOffset + t * mapCount * count, mapCount * count);
+                mSlice.Reshape(mapCount, count);
+                Mat::Multiply(uSlice, false, vSlice, false, mSlice);
+            }
+
+            // 4. Output transform.
+            const ElemType* prod = wsData + outputOffset;
+            #pragma omp parallel for
+            for (long p = 0; p < (long)count; p++)
+            {
+                size_t sample = (first + p) / tilesPerSample;
+                size_t tile = (first + p) % tilesPerSample;
+                size_t h0 = tile / tilesW * M;
+                size_t w0 = tile % tilesW * M;
+                size_t rows = min(M, m_outH - h0);
+                size_t cols = min(M, m_outW - w0);
+                ElemType* dst = outData + sample * outSampleSize;
+                ElemType m[alpha][alpha];
+                ElemType res[M][M];
+                for (size_t k = 0; k < mapCount; k++)
+                {
+                    for (size_t i = 0; i < alpha; i++)
+                        for (size_t j = 0; j < alpha; j++)
+                            m[i][j] = prod[(i * alpha + j) * mapCount * count + p * mapCount + k];
+                    WinogradSandwich(Transform::AT, m, Transform::AT, res);
+                    ElemType* plane = dst + k * m_outW * m_outH;
+                    for (size_t y = 0; y < rows; y++)
+                        for (size_t x = 0; x < cols; x++)
+                            plane[(h0 + y) * m_outW + w0 + x] = res[y][x];
+                }
+            }
+        }
+    }
+
+    // 1x1 convolution of a sample is [W'H' x C] * [C x K] -> [W'H' x K], with the kernel matrix in
+    // cudnn (row-major) layout being [C x K] already. Unless stride and padding are trivial the input
+    // is subsampled to [W'H' x C] first.
+    void ForwardPointwise(const Mat& in, const Mat& kernel, Mat& out, Mat& workspace)
+    {
+        size_t batchSize = in.GetNumCols();
+        size_t outSize = m_outW * m_outH;
+        auto kern = kernel.ColumnSlice(0, kernel.GetNumCols());
+        kern.Reshape(m_inC, m_outC);
+
+        bool subsample = m_outW != m_inW || m_outH != m_inH || m_padW != 0 || m_padH != 0;
+        if (subsample)
+            workspace.Resize(outSize, m_inC);
+
+        for (size_t sample = 0; sample < batchSize; sample++)
+        {
+            auto outSlice = out.ColumnSlice(sample, 1);
+            outSlice.Reshape(outSize, m_outC);
+            if (!subsample)
+            {
+                auto inSlice = in.ColumnSlice(sample, 1);
+                inSlice.Reshape(outSize, m_inC);
+                Mat::Multiply(inSlice, false, kern, false, outSlice);
+                continue;
+            }
+
+            const ElemType* src = in.Data() + sample * in.GetNumRows();
+            ElemType* dst = workspace.Data();
+            #pragma omp parallel for
+            for (long c = 0; c < (long)m_inC; c++)
+            {
+                const ElemType* plane = src + c * m_inW * m_inH;
+                ElemType* sub = dst + c * outSize;
+                for (int y = 0; y < (int)m_outH; y++)
+                {
+                    int h = y * m_strideH - m_padH;
+                    for (int x = 0; x < (int)m_outW; x++)
+                    {
+                        int w = x * m_strideW - m_padW;
+                        sub[y * m_outW + x] = 0 <= h && h < (int)m_inH && 0 <= w && w < (int)m_inW ? plane[h * m_inW + w] : 0;
+                    }
+                }
+            }
+            Mat::Multiply(workspace, false, kern, false, outSlice);
+        }
+    }
+
+    // Calls fn(outRow, inRow, weight, begin, end, tap offset) for all kernel taps and output rows of a plane,
+    // restricted to the output range for which the tap is inside the input.
+    template <class Fn>
+    void ForEachDepthwiseTap(Fn fn) const
+    {
+        for (int y = 0; y < (int)m_outH; y++)
+        {
+            for (int ky = 0; ky < (int)m_kernH; ky++)
+            {
+                int h = y * m_strideH - m_padH + ky;
+                if (h < 0 || h >= (int)m_inH)
+                    continue;
+                for (int kx = 0; kx < (int)m_kernW; kx++)
+                {
+                    int begin, end;
+                    GetValidRange((int)m_inW, (int)m_outW, m_strideW, m_padW, kx, begin, end);
+                    fn(y, h, ky * (int)m_kernW + kx, begin, end, kx - m_padW);
+                }
+            }
+        }
+    }
+
+    const ElemType* DepthwiseKernel(const ElemType* kernData, size_t c) const
+    {
+        return m_sharedKernel ? kernData : kernData + c * m_kernW * m_kernH;
+    }
+
+    void ForwardDepthwise(const Mat& in, const Mat& kernel, Mat& out)
+    {
+        size_t batchSize = in.GetNumCols();
+        const ElemType* inData = in.Data();
+        const ElemType* kernData = kernel.Data();
+        ElemType* outData = out.Data();
+        size_t inSampleSize = in.GetNumRows();
+        size_t outSampleSize = out.GetNumRows();
+        int strideW = m_strideW;
+        #pragma omp parallel for
+        for (long nc = 0; nc < (long)(batchSize * m_inC); nc++)
+        {
+            size_t sample = nc / m_inC;
+            size_t c = nc % m_inC;
+            const ElemType* src = inData + sample * inSampleSize + c * m_inW * m_inH;
+            ElemType* dst = outData + sample * outSampleSize + c * m_outW * m_outH;
+            const ElemType* weights = DepthwiseKernel(kernData, c);
+            std::fill(dst, dst + m_outW * m_outH, (ElemType)0);
+            ForEachDepthwiseTap([&](int y, int h, int tap, int begin, int end, int offset)
+            {
+                ElemType* outRow = dst + y * m_outW;
+                const ElemType* inRow = src + h * m_inW;
+                ElemType weight = weights[tap];
+                for (int x = begin; x < end; x++)
+                    outRow[x] += weight * inRow[x * strideW + offset];
+            });
+        }
+    }
+
+    void BackwardDataDepthwise(const Mat& srcGrad, const Mat& kernel, Mat& grad)
+    {
+        size_t batchSize = srcGrad.GetNumCols();
+        const ElemType* srcGradData = srcGrad.Data();
+        const ElemType* kernData = kernel.Data();
+        ElemType* gradData = grad.Data();
+        size_t srcGradSampleSize = srcGrad.GetNumRows();
+        size_t gradSampleSize = grad.GetNumRows();
+        int strideW = m_strideW;
+        #pragma omp parallel for
+        for (long nc = 0; nc < (long)(batchSize * m_inC); nc++)
+        {
+            size_t sample = nc / m_inC;
+            size_t c = nc % m_inC;
+            const ElemType* src = srcGradData + sample * srcGradSampleSize + c * m_outW * m_outH;
+            ElemType* dst = gradData + sample * gradSampleSize + c * m_inW * m_inH;
+            const ElemType* weights = DepthwiseKernel(kernData, c);
+            ForEachDepthwiseTap([&](int y, int h, int tap, int begin, int end, int offset)
+            {
+                const ElemType* srcRow = src + y * m_outW;
+                ElemType* gradRow = dst + h * m_inW;
+                ElemType weight = weights[tap];
+                for (int x = begin; x < end; x++)
+                    gradRow[x * strideW + offset] += weight * srcRow[x];
+            });
+        }
+    }
+
+    // Gradients are computed per channel in the workspace, and summed over the channels if they share the kernel.
+    void BackwardKernelDepthwise(const Mat& srcGrad, const Mat& in, Mat& kernelGrad, Mat& workspace)
+    {
+        size_t batchSize = srcGrad.GetNumCols();
+        size_t kernelSize = m_kernW * m_kernH;
+        workspace.Resize(kernelSize, m_inC);
+        workspace.SetValue(0);
+        const ElemType* srcGradData = srcGrad.Data();
+        const ElemType* inData = in.Data();
+        ElemType* wsData = workspace.Data();
+        size_t srcGradSampleSize = srcGrad.GetNumRows();
+        size_t inSampleSize = in.GetNumRows();
+        int strideW = m_strideW;
+        #pragma omp parallel for
+        for (long c = 0; c < (long)m_inC; c++)
+        {
+            ElemType* weightGrads = wsData + c * kernelSize;
+            for (size_t sample = 0; sample < batchSize; sample++)
+            {
+                const ElemType* src = srcGradData + sample * srcGradSampleSize + c * m_outW * m_outH;
+                const ElemType* inPlane = inData + sample * inSampleSize + c * m_inW * m_inH;
+                ForEachDepthwiseTap([&](int y, int h, int tap, int begin, int end, int offset)
+                {
+                    const ElemType* srcRow = src + y * m_outW;
+                    const ElemType* inRow = inPlane + h * m_inW;
+                    ElemType sum = 0;
+                    for (int x = begin; x < end; x++)
+                        sum += srcRow[x] * inRow[x * strideW + offset];
+                    weightGrads[tap] += sum;
+                });
+            }
+        }
+
+        ElemType* kernGradData = kernelGrad.Data();
+        for (size_t c = 0; c < m_inC; c++)
+        {
+            ElemType* dst = m_sharedKernel ? kernGradData : kernGradData + c * kernelSize;
+            for (size_t i = 0; i < kernelSize; i++)
+                dst[i] += wsData[c * kernelSize + i];
+        }
+    }
+
+    static Algorithm GetAlgorithm(const ConvolveGeometry& geometry)
+    {
+        const auto& inT = geometry.InputShape();
+        const auto& kernT = geometry.KernelShape();
+        const auto& outT = geometry.OutputShape();
+        if (inT.GetRank() != 3)
+            return Algorithm::None;
+        for (size_t i = 0; i < 3; i++)
+        {
+            if (geometry.GetDilation(i) != 1)
+                return Algorithm::None;
+        }
+        if (!geometry.GetSharing(0) || !geometry.GetSharing(1) || geometry.GetMapCount(0) != 1 || geometry.GetMapCount(1) != 1)
+            return Algorithm::None;
+
+        // Kernels spanning all channels, one output position along channels.
+        if (kernT[2] == inT[2] && geometry.GetSharing(2) && outT[2] == geometry.GetMapCount(2))
+        {
+            if (kernT[0] == 1 && kernT[1] == 1)
+                return Algorithm::Pointwise;
+            if (kernT[0] == 3 && kernT[1] == 3 && geometry.GetStride(0) == 1 && geometry.GetStride(1) == 1)
+                return Algorithm::Winograd;
+        }
+        // Kernels of depth 1, applied to each channel separately.
+        else if (kernT[2] == 1 && geometry.GetMapCount(2) == 1 && geometry.GetStride(2) == 1 && outT[2] == inT[2])
+        {
+            return Algorithm::Depthwise;
+        }
+        return Algorithm::None;
+    }
+
+public:
+    static bool IsSupported(DEVICEID_TYPE deviceId, ConvolveGeometryPtr geometry)
+    {
+        return deviceId < 0 && GetAlgorithm(*geometry) != Algorithm::None;
+    }
+
+private:
+    static const size_t c_winogradBlockBytes = 1 << 20;
+    static const size_t c_minWinogradBlockTiles = 16;
+
+    Algorithm m_algo;
+    size_t m_inW, m_inH, m_inC;
+    size_t m_outW, m_outH, m_outC;
+    size_t m_kernW, m_kernH;
+    int m_strideW, m_strideH;
+    int m_padW, m_padH;
+    bool m_sharedKernel;
+
+    // Transformed Winograd kernels and the kernels they were computed from.
+    std::unique_ptr<Mat> m_winogradKernel;
+    std::vector<ElemType> m_winogradKernelSource;
+    size_t m_winogradTileSize;
+};
+
+// Static members are taken by reference (std::max), so they need a definition.
+template <class ElemType>
+const size_t DirectConvolutionEngine<ElemType>::c_winogradBlockBytes;
+template <class ElemType>
+const size_t DirectConvolutionEngine<ElemType>::c_minWinogradBlockTiles;
+
 template <class ElemType>
 std::unique_ptr<ConvolutionEngine<ElemType>> ConvolutionEngine<ElemType>::Create(ConvolveGeometryPtr geometry, DEVICEID_TYPE deviceId,
                                                                                  ImageLayoutKind imageLayout, size_t maxTempMemSizeInSamples, PoolKind poolKind,
@@ -892,6 +1491,14 @@ std::unique_ptr<ConvolutionEngine<ElemType>> ConvolutionEngine<ElemType>::Create
                                                                forceDeterministicAlgorithms, poolIncludePad, inputHasFreeDimension);
     }
 
+    if (isEnabled(ConvolutionEngineKind::Direct) && DirectConvolutionEngine<ElemType>::IsSupported(deviceId, geometry))
+    {
+        if (GetMathLibTraceLevel() > 0)
+            fprintf(stderr, "%lsusing direct convolution engine for geometry: %s.\n", logPrefix.c_str(), engStr.c_str());
+
+        return std::make_unique<DirectConvolutionEngine<ElemType>>(geometry, deviceId, imageLayout, maxTempMemSizeInSamples, poolKind, poolIncludePad);
+    }
+
     if (isEnabled(ConvolutionEngineKind::Gemm) && GemmConvolutionEngine<ElemType>::IsSupported(deviceId, geometry))
     {
         if (GetMathLibTraceLevel() > 0)
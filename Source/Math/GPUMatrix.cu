@@ -2897,8 +2897,11 @@ GPUMatrix<ElemType>& GPUMatrix<ElemType>::AddSignOf(const GPUMatrix<ElemType>& a
     if (a.IsEmpty())
         LogicError("AddSignOf: Matrix a is empty.");
 
-    if (this != &a)
+    if (this != &a && (GetNumRows() != a.GetNumRows() || GetNumCols() != a.GetNumCols()))
+    {
         RequireSize(a.GetNumRows(), a.GetNumCols());
+        SetValue(0); // content after Resize() is undefined
+    }
 
     PrepareDevice();
     int blocksPerGrid = (int) ceil(1.0 * GetNumElements() / GridDim::maxThreadsPerBlock);
@@ -620,40 +620,73 @@ public:
                                     const int shift);
 
 public:
+    // file format: see CPUMatrix::Read()
     friend File& operator>>(File& stream, GPUMatrix<ElemType>& us)
     {
-        stream.GetMarker(fileMarkerBeginSection, std::wstring(L"BMAT"));
+        std::wstring section;
+        stream >> section;
+        const bool aligned = (section == L"BMAT64");
+        if (!aligned && section != L"BMAT")
+            RuntimeError("section name mismatch %ls != BMAT", section.c_str());
         size_t elsize;
         stream >> elsize;
         if (sizeof(ElemType) != elsize)
             LogicError("Template argument size doesn't match those in file");
-        std::wstring matrixNameDummy; // Note this is not used anymore, just a dummy for compatability.
+        if (!aligned)
+        {
+            std::wstring matrixNameDummy; // Note this is not used anymore, just a dummy for compatability.
+            stream >> matrixNameDummy;
+        }
         size_t numRows, numCols;
         int format;
-        stream >> matrixNameDummy >> format >> numRows >> numCols;
-        ElemType* d_array = new ElemType[numRows * numCols];
-        for (size_t i = 0; i < numRows * numCols; ++i)
-            stream >> d_array[i];
+        stream >> format >> numRows >> numCols;
+        if (aligned)
+            stream.SkipPadding();
+        const size_t numElements = numRows * numCols;
+        if (stream.IsMemoryMapped() && numElements > 0) // copy to the device straight from the mapping
+            us.SetValue(numRows, numCols, us.GetComputeDeviceId(), (ElemType*) stream.GetMappedBlock(numElements * sizeof(ElemType)), matrixFlagNormal | format);
+        else
+        {
+            std::vector<ElemType> d_array(numElements);
+            if (stream.IsTextBased())
+            {
+                for (size_t i = 0; i < numElements; ++i)
+                    stream >> d_array[i];
+            }
+            else
+                stream.ReadBlock(d_array.data(), numElements * sizeof(ElemType));
+            us.SetValue(numRows, numCols, us.GetComputeDeviceId(), d_array.data(), matrixFlagNormal | format);
+        }
         stream.GetMarker(fileMarkerEndSection, std::wstring(L"EMAT"));
-        us.SetValue(numRows, numCols, us.GetComputeDeviceId(), d_array, matrixFlagNormal | format);
-        delete[] d_array;
         return stream;
     }
     friend File& operator<<(File& stream, const GPUMatrix<ElemType>& us)
     {
-        stream.PutMarker(fileMarkerBeginSection, std::wstring(L"BMAT"));
+        const bool aligned = !stream.IsTextBased() && stream.CanSeek();
+        stream.PutMarker(fileMarkerBeginSection, std::wstring(aligned ? L"BMAT64" : L"BMAT"));
         stream << sizeof(ElemType);
 
-        // TODO: This is now ignored on input, so we can should change to an empty string. This might break parsing, and must be tested first
-        std::wstring s = std::wstring(L"unnamed");
+        if (!aligned)
+        {
+            // TODO: This is now ignored on input, so we can should change to an empty string. This might break parsing, and must be tested first
+            std::wstring s = std::wstring(L"unnamed");
+            stream << s;
+        }
         int format = us.GetFormat();
-        stream << s << format;
+        stream << format;
 
         stream << us.m_numRows << us.m_numCols;
+        if (aligned)
+            stream.PutPadding();
         ElemType* pArray = us.CopyToArray();
-        for (size_t i = 0; i < us.GetNumElements(); ++i)
-            stream << pArray[i];
-        
+        if (stream.IsTextBased())
+        {
+            for (size_t i = 0; i < us.GetNumElements(); ++i)
+                stream << pArray[i];
+        }
+        else
+            stream.WriteBlock(pArray, us.GetNumElements() * sizeof(ElemType));
+
         delete[] pArray;
 
         stream.PutMarker(fileMarkerEndSection, std::wstring(L"EMAT"));
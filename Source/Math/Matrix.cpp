@@ -598,7 +598,7 @@ void Matrix<ElemType>::SetDevice(DEVICEID_TYPE deviceId)
 }
 
 template <class ElemType>
-void Matrix<ElemType>::Read(File& stream)
+void Matrix<ElemType>::Read(File& stream, bool useMappedStorage)
 {
     Matrix<ElemType>& M = *this;
     char type;
@@ -609,7 +609,7 @@ void Matrix<ElemType>::Read(File& stream)
         {
             if (!M.m_CPUMatrix)
                 M.m_CPUMatrix = make_shared<CPUMatrix<ElemType>>();
-            stream >> (*M.m_CPUMatrix);
+            M.m_CPUMatrix->Read(stream, useMappedStorage);
             M.SetDataLocation(CPU, DENSE);
         }
         else
@@ -1433,10 +1433,24 @@ void Matrix<ElemType>::AdjustSparseBlockColumn(const GPUSPARSE_INDEX_TYPE* cpuCo
         this,
         NOT_IMPLEMENTED,
         NOT_IMPLEMENTED,
-        NOT_IMPLEMENTED,
+        m_CPUSparseMatrix->AdjustCol2BlockId(cpuCol2BlockId, numBlocks),
         m_GPUSparseMatrix->AdjustCol2BlockId(cpuCol2BlockId, numBlocks, useBlockId2Col));
 }
 
+///
+/// returns the columns of a sparse block column matrix that have a block, in block order
+///
+template <class ElemType>
+std::vector<size_t> Matrix<ElemType>::GetSparseBlockColumns() const
+{
+    DISPATCH_MATRIX_ON_FLAG(this,
+        nullptr,
+        NOT_IMPLEMENTED,
+        NOT_IMPLEMENTED,
+        return m_CPUSparseMatrix->GetBlockColumns(),
+        NOT_IMPLEMENTED);
+}
+
 template <class ElemType>
 void Matrix<ElemType>::SetDiagonalValue(const ElemType v)
 {
@@ -4880,7 +4894,7 @@ void Matrix<ElemType>::RNNForward(const Matrix<ElemType> &inputX, const Matrix<E
 
     DISPATCH_MATRIX_ON_FLAG(this,
                             this,
-                            NOT_IMPLEMENTED,
+                            m_CPUMatrix->RNNForward(*(inputX.m_CPUMatrix), *(paramW.m_CPUMatrix), xDim, yDim, numSequencesForFrame, rnnAttributes, *(reserve.m_CPUMatrix), *(workspace.m_CPUMatrix)),
                             m_GPUMatrix->RNNForward(*(inputX.m_GPUMatrix), *(paramW.m_GPUMatrix), xDim, yDim, numSequencesForFrame, rnnAttributes, *(reserve.m_GPUMatrix), *(workspace.m_GPUMatrix)),
                             NOT_IMPLEMENTED,
                             NOT_IMPLEMENTED);
@@ -4895,7 +4909,7 @@ void Matrix<ElemType>::RNNBackwardData(const Matrix<ElemType>& outputDY, const M
     workspace._transferToDevice(GetDeviceId());
     DISPATCH_MATRIX_ON_FLAG(this,
                             this,
-                            NOT_IMPLEMENTED,
+                            m_CPUMatrix->RNNBackwardData(*(outputDY.m_CPUMatrix), *(paramW.m_CPUMatrix), *(outputDX.m_CPUMatrix), rnnAttributes, *(reserve.m_CPUMatrix), *(workspace.m_CPUMatrix)),
                             m_GPUMatrix->RNNBackwardData(*(outputDY.m_GPUMatrix), *(paramW.m_GPUMatrix), *(outputDX.m_GPUMatrix), rnnAttributes, *(reserve.m_GPUMatrix), *(workspace.m_GPUMatrix)),
                             NOT_IMPLEMENTED,
                             NOT_IMPLEMENTED);
@@ -4910,7 +4924,7 @@ void Matrix<ElemType>::RNNBackwardWeights(const Matrix<ElemType>& inputX, const
     workspace._transferToDevice(GetDeviceId());
     DISPATCH_MATRIX_ON_FLAG(this,
                             this,
-                            NOT_IMPLEMENTED,
+                            m_CPUMatrix->RNNBackwardWeights(*(inputX.m_CPUMatrix), *(outputY.m_CPUMatrix), *(dw.m_CPUMatrix), rnnAttributes, *(reserve.m_CPUMatrix), *(workspace.m_CPUMatrix)),
                             m_GPUMatrix->RNNBackwardWeights(*(inputX.m_GPUMatrix), *(outputY.m_GPUMatrix), *(dw.m_GPUMatrix), rnnAttributes, *(reserve.m_GPUMatrix), *(workspace.m_GPUMatrix)),
                             NOT_IMPLEMENTED,
                             NOT_IMPLEMENTED);
@@ -5967,6 +5981,77 @@ void Matrix<ElemType>::RCRFTransGrdCompute(const Matrix<ElemType>& lbls,
                             NOT_IMPLEMENTED);
 }
 
+// The batched RCRF functions only exist on the CPU. Inputs on a GPU are copied over and stay valid there (BOTH state),
+// outputs are moved to the CPU for the computation and back to their device afterwards.
+template <class ElemType>
+ElemType Matrix<ElemType>::RCRFForwardBackwardCompute(const Matrix<ElemType>& lbls, const Matrix<ElemType>& pos_scores, const Matrix<ElemType>& pair_scores,
+                                                      Matrix<ElemType>& alpha, Matrix<ElemType>& beta,
+                                                      const std::vector<size_t>& uttToChanInd, const std::vector<size_t>& uttBeginFrame, const std::vector<size_t>& uttFrameNum,
+                                                      const size_t numParallelSequences)
+{
+    if (lbls.GetMatrixType() != DENSE || pos_scores.GetMatrixType() != DENSE || pair_scores.GetMatrixType() != DENSE)
+        NOT_IMPLEMENTED;
+
+    for (auto input : { &lbls, &pos_scores, &pair_scores })
+        input->TransferToDeviceIfNotThere(CPUDEVICE, /*isBeingMoved=*/false, /*emptyTransfer=*/false, /*updatePreferredDevice=*/false);
+    DEVICEID_TYPE alphaDeviceId = alpha.GetDeviceId(), betaDeviceId = beta.GetDeviceId();
+    alpha.TransferToDeviceIfNotThere(CPUDEVICE, /*isBeingMoved=*/true, /*emptyTransfer=*/true, /*updatePreferredDevice=*/false);
+    beta.TransferToDeviceIfNotThere(CPUDEVICE, /*isBeingMoved=*/true, /*emptyTransfer=*/true, /*updatePreferredDevice=*/false);
+    alpha.SwitchToMatrixType(DENSE, matrixFormatDense, false);
+    beta.SwitchToMatrixType(DENSE, matrixFormatDense, false);
+
+    ElemType totalScore = CPUMatrix<ElemType>::RCRFForwardBackwardCompute(*lbls.m_CPUMatrix, *pos_scores.m_CPUMatrix, *pair_scores.m_CPUMatrix,
+                                                                          *alpha.m_CPUMatrix, *beta.m_CPUMatrix,
+                                                                          uttToChanInd, uttBeginFrame, uttFrameNum, numParallelSequences);
+
+    alpha.TransferToDeviceIfNotThere(alphaDeviceId, /*isBeingMoved=*/true, /*emptyTransfer=*/false, /*updatePreferredDevice=*/false);
+    beta.TransferToDeviceIfNotThere(betaDeviceId, /*isBeingMoved=*/true, /*emptyTransfer=*/false, /*updatePreferredDevice=*/false);
+    return totalScore;
+}
+
+template <class ElemType>
+void Matrix<ElemType>::RCRFTransGrdCompute(const Matrix<ElemType>& lbls, const Matrix<ElemType>& pos_scores,
+                                           const Matrix<ElemType>& alpha, const Matrix<ElemType>& beta, const Matrix<ElemType>& pair_scores,
+                                           Matrix<ElemType>& grd,
+                                           const std::vector<size_t>& uttToChanInd, const std::vector<size_t>& uttBeginFrame, const std::vector<size_t>& uttFrameNum,
+                                           const size_t numParallelSequences)
+{
+    if (lbls.GetMatrixType() != DENSE || pos_scores.GetMatrixType() != DENSE || pair_scores.GetMatrixType() != DENSE || grd.GetMatrixType() != DENSE)
+        NOT_IMPLEMENTED;
+
+    for (auto input : { &lbls, &pos_scores, &alpha, &beta, &pair_scores })
+        input->TransferToDeviceIfNotThere(CPUDEVICE, /*isBeingMoved=*/false, /*emptyTransfer=*/false, /*updatePreferredDevice=*/false);
+    DEVICEID_TYPE grdDeviceId = grd.GetDeviceId();
+    grd.TransferToDeviceIfNotThere(CPUDEVICE, /*isBeingMoved=*/true, /*emptyTransfer=*/false, /*updatePreferredDevice=*/false);
+
+    CPUMatrix<ElemType>::RCRFTransGrdCompute(*lbls.m_CPUMatrix, *pos_scores.m_CPUMatrix, *alpha.m_CPUMatrix, *beta.m_CPUMatrix, *pair_scores.m_CPUMatrix,
+                                             *grd.m_CPUMatrix,
+                                             uttToChanInd, uttBeginFrame, uttFrameNum, numParallelSequences);
+
+    grd.TransferToDeviceIfNotThere(grdDeviceId, /*isBeingMoved=*/true, /*emptyTransfer=*/false, /*updatePreferredDevice=*/false);
+}
+
+template <class ElemType>
+void Matrix<ElemType>::RCRFViterbiDecode(const Matrix<ElemType>& lbls, const Matrix<ElemType>& pos_scores, const Matrix<ElemType>& pair_scores,
+                                         Matrix<ElemType>& decodedPath,
+                                         const std::vector<size_t>& uttToChanInd, const std::vector<size_t>& uttBeginFrame, const std::vector<size_t>& uttFrameNum,
+                                         const size_t numParallelSequences)
+{
+    if (lbls.GetMatrixType() != DENSE || pos_scores.GetMatrixType() != DENSE || pair_scores.GetMatrixType() != DENSE)
+        NOT_IMPLEMENTED;
+
+    for (auto input : { &lbls, &pos_scores, &pair_scores })
+        input->TransferToDeviceIfNotThere(CPUDEVICE, /*isBeingMoved=*/false, /*emptyTransfer=*/false, /*updatePreferredDevice=*/false);
+    DEVICEID_TYPE deviceId = decodedPath.GetDeviceId();
+    decodedPath.TransferToDeviceIfNotThere(CPUDEVICE, /*isBeingMoved=*/true, /*emptyTransfer=*/true, /*updatePreferredDevice=*/false);
+    decodedPath.SwitchToMatrixType(DENSE, matrixFormatDense, false);
+
+    CPUMatrix<ElemType>::RCRFViterbiDecode(*lbls.m_CPUMatrix, *pos_scores.m_CPUMatrix, *pair_scores.m_CPUMatrix, *decodedPath.m_CPUMatrix,
+                                           uttToChanInd, uttBeginFrame, uttFrameNum, numParallelSequences);
+
+    decodedPath.TransferToDeviceIfNotThere(deviceId, /*isBeingMoved=*/true, /*emptyTransfer=*/false, /*updatePreferredDevice=*/false);
+}
+
 template <class ElemType>
 Matrix<ElemType>& Matrix<ElemType>::DropFrame(const Matrix<ElemType>& label, const Matrix<ElemType>& gamma, const ElemType& threshhold)
 {
@@ -6121,6 +6206,34 @@ void Matrix<ElemType>::TensorOp(ElemType beta, const Matrix<ElemType>& a, const
                             NOT_IMPLEMENTED,
                             NOT_IMPLEMENTED);
 }
+
+// Inputs are passed as a list since their number depends on the program. There is no GPU kernel for fused operations;
+// TensorView::DoFusedOpOf() executes the program one operation at a time in that case.
+template <class ElemType>
+void Matrix<ElemType>::FusedTensorOp(ElemType beta, const std::vector<const Matrix<ElemType>*>& inputs, ElemType alpha, const ElementWiseProgram& program,
+                                     const std::array<size_t, ElementWiseProgram::MaxOperands>& offsets,
+                                     const SmallVector<size_t>& regularOpDims, const std::array<SmallVector<ptrdiff_t>, ElementWiseProgram::MaxOperands>& regularStrides,
+                                     const SmallVector<size_t>& reducingOpDims, const std::array<SmallVector<ptrdiff_t>, ElementWiseProgram::MaxOperands>& reducingStrides)
+{
+    VerifyIsDense(*this);
+    for (const auto* input : inputs)
+    {
+        VerifyIsDense(*input);
+        DecideAndMoveToRightDevice(*this, *input);
+    }
+
+    std::vector<const CPUMatrix<ElemType>*> cpuInputs;
+    for (const auto* input : inputs)
+        cpuInputs.push_back(input->m_CPUMatrix.get());
+
+    DISPATCH_MATRIX_ON_FLAG(this,
+                            this,
+                            m_CPUMatrix->FusedTensorOp(beta, cpuInputs, alpha, program, offsets, regularOpDims, regularStrides, reducingOpDims, reducingStrides),
+                            NOT_IMPLEMENTED,
+                            NOT_IMPLEMENTED,
+                            NOT_IMPLEMENTED);
+}
+
 template <class ElemType>
 void Matrix<ElemType>::TensorArgOp(const Matrix<ElemType>& a, ElementWiseOperator reductionOp,
                                    const array<size_t, 2>& offsets,
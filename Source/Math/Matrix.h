@@ -290,6 +290,7 @@ public:
     void SetColumn(const Matrix<ElemType>& valMat, size_t colInd);
 
     void AdjustSparseBlockColumn(const GPUSPARSE_INDEX_TYPE* cpuCol2BlockId, size_t numBlocks, bool useBlockId2Col);
+    std::vector<size_t> GetSparseBlockColumns() const; // CPU only
 
     void SetDiagonalValue(const ElemType v);
     void SetDiagonalValue(const Matrix<ElemType>& vector);
@@ -626,6 +627,11 @@ public:
                   const std::array<size_t, 4>& offsets,
                   const SmallVector<size_t>& regularOpDims, const std::array<SmallVector<ptrdiff_t>, 4>& regularStrides,
                   const SmallVector<size_t>& reducingOpDims, const std::array<SmallVector<ptrdiff_t>, 4>& reducingStrides);
+    // operands are the program's inputs, padded to MaxInputs, followed by 'this'
+    void FusedTensorOp(ElemType beta, const std::vector<const Matrix<ElemType>*>& inputs, ElemType alpha, const ElementWiseProgram& program,
+                       const std::array<size_t, ElementWiseProgram::MaxOperands>& offsets,
+                       const SmallVector<size_t>& regularOpDims, const std::array<SmallVector<ptrdiff_t>, ElementWiseProgram::MaxOperands>& regularStrides,
+                       const SmallVector<size_t>& reducingOpDims, const std::array<SmallVector<ptrdiff_t>, ElementWiseProgram::MaxOperands>& reducingStrides);
 
     void TensorArgOp(const Matrix<ElemType>& a, ElementWiseOperator reductionOp,
                      const std::array<size_t, 2>& offsets,
@@ -633,7 +639,8 @@ public:
                      const SmallVector<size_t>& reducingOpDims, const std::array<SmallVector<ptrdiff_t>, 2>& reducingStrides);
 
 public:
-    void Read(File& stream);
+    // useMappedStorage: a dense CPU matrix may keep pointing into a memory-mapped file (see CPUMatrix::Read())
+    void Read(File& stream, bool useMappedStorage = false);
     void Write(File& stream) const;
 
     Matrix<ElemType>& Shift(const Matrix<ElemType>& a, int shift);
@@ -658,6 +665,23 @@ public:
                                     const int startLbl, // the time 0 start symbol in the output layer
                                     const int shift);
 
+    // batched over all sequences of a minibatch, which are given like for AssignCTCScore(); CPU only, data on a GPU is copied over
+    static ElemType RCRFForwardBackwardCompute(const Matrix<ElemType>& lbls, const Matrix<ElemType>& pos_scores, const Matrix<ElemType>& pair_scores,
+                                               Matrix<ElemType>& alpha, Matrix<ElemType>& beta,
+                                               const std::vector<size_t>& uttToChanInd, const std::vector<size_t>& uttBeginFrame, const std::vector<size_t>& uttFrameNum,
+                                               const size_t numParallelSequences);
+
+    static void RCRFTransGrdCompute(const Matrix<ElemType>& lbls, const Matrix<ElemType>& pos_scores,
+                                    const Matrix<ElemType>& alpha, const Matrix<ElemType>& beta, const Matrix<ElemType>& pair_scores,
+                                    Matrix<ElemType>& grd,
+                                    const std::vector<size_t>& uttToChanInd, const std::vector<size_t>& uttBeginFrame, const std::vector<size_t>& uttFrameNum,
+                                    const size_t numParallelSequences);
+
+    static void RCRFViterbiDecode(const Matrix<ElemType>& lbls, const Matrix<ElemType>& pos_scores, const Matrix<ElemType>& pair_scores,
+                                  Matrix<ElemType>& decodedPath,
+                                  const std::vector<size_t>& uttToChanInd, const std::vector<size_t>& uttBeginFrame, const std::vector<size_t>& uttFrameNum,
+                                  const size_t numParallelSequences);
+
     template <typename T>
     friend class MatrixQuantizer;
 
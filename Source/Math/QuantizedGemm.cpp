@@ -0,0 +1,384 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+// QuantizedGemm.cpp -- blocked integer GEMM for 16-bit quantized operands
+//
+// The product is computed on micro-tiles of PanelRows x BlockCols outputs, each accumulated over the full
+// inner dimension in registers. Columns of B are processed in cache-sized chunks so that a chunk of packed B
+// stays in L2 while all panels of A stream past it; panels are distributed across OpenMP threads.
+// Kernels are selected at runtime, so the library itself can be built for the baseline instruction set:
+//  - AVX512VNNI: vpdpwssd, 16 rows x 2 k per instruction
+//  - AVX2:       vpmaddwd + vpaddd, 8 rows x 2 k per instruction
+//  - SSE2:       pmaddwd + paddd, 4 rows x 2 k per instruction
+//  - Scalar:     portable fallback
+// All kernels compute exactly the same integer result.
+//
+
+#include "stdafx.h"
+#include "Basics.h"
+#include "QuantizedGemm.h"
+#include <algorithm>
+#include <atomic>
+#include <string.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define QGEMM_X86
+#include <emmintrin.h>
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define QGEMM_TARGET(features)
+#if _MSC_VER >= 1920
+#define QGEMM_HAS_VNNI
+#endif
+#else
+#include <cpuid.h>
+#define QGEMM_TARGET(features) __attribute__((target(features)))
+#if __GNUC__ >= 8 || defined(__clang__)
+#define QGEMM_HAS_VNNI
+#endif
+#endif
+#endif
+
+namespace Microsoft { namespace MSR { namespace CNTK {
+
+static const int MR = Int16Gemm::PanelRows;
+static const int NR = Int16Gemm::BlockCols;
+
+static inline int KPairs(int k)
+{
+    return (k + 1) / 2;
+}
+
+// -----------------------------------------------------------------------
+// packing
+// -----------------------------------------------------------------------
+
+/*static*/ void Int16Gemm::PackA(int m, int k, const short* A, Int16PackedA& packed)
+{
+    const int numPanels = (m + MR - 1) / MR;
+    const int kPairs = KPairs(k);
+    packed.m = m;
+    packed.k = k;
+    packed.data.assign((size_t)numPanels * kPairs * MR * 2, 0);
+
+#pragma omp parallel for
+    for (int p = 0; p < numPanels; p++)
+    {
+        short* panel = packed.data.data() + (size_t)p * kPairs * MR * 2;
+        const int rowEnd = std::min(m, (p + 1) * MR);
+        for (int l = 0; l < k; l++)
+        {
+            short* dst = panel + (size_t)(l / 2) * MR * 2 + (l % 2);
+            const short* src = A + (size_t)l * m; // column l of A
+            for (int r = p * MR; r < rowEnd; r++)
+                dst[(r - p * MR) * 2] = src[r];
+        }
+    }
+}
+
+/*static*/ void Int16Gemm::PackB(int k, int n, const short* B, Int16PackedB& packed)
+{
+    const int numBlocks = (n + NR - 1) / NR;
+    const int kPairs = KPairs(k);
+    packed.k = k;
+    packed.n = n;
+    packed.data.assign((size_t)numBlocks * kPairs * NR * 2, 0);
+
+#pragma omp parallel for
+    for (int j = 0; j < n; j++)
+    {
+        short* dst = packed.data.data() + (size_t)(j / NR) * kPairs * NR * 2 + (j % NR) * 2;
+        const short* src = B + (size_t)j * k; // column j of B
+        for (int l = 0; l < k; l++)
+            dst[(size_t)(l / 2) * NR * 2 + (l % 2)] = src[l];
+    }
+}
+
+// -----------------------------------------------------------------------
+// micro-kernels
+// Each computes tile[j * MR + r] = sum over the panel/block pair for a full MR x NR tile.
+// -----------------------------------------------------------------------
+
+static void MicroKernelScalar(int kPairs, const short* a, const short* b, int* tile)
+{
+    int acc[NR][MR] = {};
+    for (int q = 0; q < kPairs; q++, a += MR * 2, b += NR * 2)
+    {
+        for (int j = 0; j < NR; j++)
+        {
+            const int b0 = b[j * 2];
+            const int b1 = b[j * 2 + 1];
+            for (int r = 0; r < MR; r++)
+                acc[j][r] += a[r * 2] * b0 + a[r * 2 + 1] * b1;
+        }
+    }
+    memcpy(tile, acc, sizeof(acc));
+}
+
+#ifdef QGEMM_X86
+
+static inline int LoadPair(const short* p)
+{
+    int v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static void MicroKernelSSE2(int kPairs, const short* a, const short* b, int* tile)
+{
+    __m128i acc[NR][MR / 4];
+    for (int j = 0; j < NR; j++)
+        for (int i = 0; i < MR / 4; i++)
+            acc[j][i] = _mm_setzero_si128();
+
+    for (int q = 0; q < kPairs; q++, a += MR * 2, b += NR * 2)
+    {
+        __m128i av[MR / 4];
+        for (int i = 0; i < MR / 4; i++)
+            av[i] = _mm_loadu_si128((const __m128i*)(a + i * 8));
+        for (int j = 0; j < NR; j++)
+        {
+            const __m128i bv = _mm_set1_epi32(LoadPair(b + j * 2));
+            for (int i = 0; i < MR / 4; i++)
+                acc[j][i] = _mm_add_epi32(acc[j][i], _mm_madd_epi16(av[i], bv));
+        }
+    }
+
+    for (int j = 0; j < NR; j++)
+        for (int i = 0; i < MR / 4; i++)
+            _mm_storeu_si128((__m128i*)(tile + j * MR + i * 4), acc[j][i]);
+}
+
+QGEMM_TARGET("avx2")
+static void MicroKernelAVX2(int kPairs, const short* a, const short* b, int* tile)
+{
+    __m256i c00 = _mm256_setzero_si256(), c01 = _mm256_setzero_si256();
+    __m256i c10 = _mm256_setzero_si256(), c11 = _mm256_setzero_si256();
+    __m256i c20 = _mm256_setzero_si256(), c21 = _mm256_setzero_si256();
+    __m256i c30 = _mm256_setzero_si256(), c31 = _mm256_setzero_si256();
+
+    for (int q = 0; q < kPairs; q++, a += MR * 2, b += NR * 2)
+    {
+        const __m256i a0 = _mm256_loadu_si256((const __m256i*)(a));
+        const __m256i a1 = _mm256_loadu_si256((const __m256i*)(a + 16));
+        __m256i bv;
+        bv = _mm256_set1_epi32(LoadPair(b + 0));
+        c00 = _mm256_add_epi32(c00, _mm256_madd_epi16(a0, bv));
+        c01 = _mm256_add_epi32(c01, _mm256_madd_epi16(a1, bv));
+        bv = _mm256_set1_epi32(LoadPair(b + 2));
+        c10 = _mm256_add_epi32(c10, _mm256_madd_epi16(a0, bv));
+        c11 = _mm256_add_epi32(c11, _mm256_madd_epi16(a1, bv));
+        bv = _mm256_set1_epi32(LoadPair(b + 4));
+        c20 = _mm256_add_epi32(c20, _mm256_madd_epi16(a0, bv));
+        c21 = _mm256_add_epi32(c21, _mm256_madd_epi16(a1, bv));
+        bv = _mm256_set1_epi32(LoadPair(b + 6));
+        c30 = _mm256_add_epi32(c30, _mm256_madd_epi16(a0, bv));
+        c31 = _mm256_add_epi32(c31, _mm256_madd_epi16(a1, bv));
+    }
+
+    _mm256_storeu_si256((__m256i*)(tile + 0 * MR), c00);
+    _mm256_storeu_si256((__m256i*)(tile + 0 * MR + 8), c01);
+    _mm256_storeu_si256((__m256i*)(tile + 1 * MR), c10);
+    _mm256_storeu_si256((__m256i*)(tile + 1 * MR + 8), c11);
+    _mm256_storeu_si256((__m256i*)(tile + 2 * MR), c20);
+    _mm256_storeu_si256((__m256i*)(tile + 2 * MR + 8), c21);
+    _mm256_storeu_si256((__m256i*)(tile + 3 * MR), c30);
+    _mm256_storeu_si256((__m256i*)(tile + 3 * MR + 8), c31);
+}
+
+#ifdef QGEMM_HAS_VNNI
+QGEMM_TARGET("avx512f,avx512bw,avx512vnni")
+static void MicroKernelAVX512VNNI(int kPairs, const short* a, const short* b, int* tile)
+{
+    __m512i c0 = _mm512_setzero_si512(), c1 = _mm512_setzero_si512();
+    __m512i c2 = _mm512_setzero_si512(), c3 = _mm512_setzero_si512();
+
+    for (int q = 0; q < kPairs; q++, a += MR * 2, b += NR * 2)
+    {
+        const __m512i av = _mm512_loadu_si512((const void*)a);
+        c0 = _mm512_dpwssd_epi32(c0, av, _mm512_set1_epi32(LoadPair(b + 0)));
+        c1 = _mm512_dpwssd_epi32(c1, av, _mm512_set1_epi32(LoadPair(b + 2)));
+        c2 = _mm512_dpwssd_epi32(c2, av, _mm512_set1_epi32(LoadPair(b + 4)));
+        c3 = _mm512_dpwssd_epi32(c3, av, _mm512_set1_epi32(LoadPair(b + 6)));
+    }
+
+    _mm512_storeu_si512((void*)(tile + 0 * MR), c0);
+    _mm512_storeu_si512((void*)(tile + 1 * MR), c1);
+    _mm512_storeu_si512((void*)(tile + 2 * MR), c2);
+    _mm512_storeu_si512((void*)(tile + 3 * MR), c3);
+}
+#endif
+
+// -----------------------------------------------------------------------
+// CPU feature detection
+// -----------------------------------------------------------------------
+
+static void CpuId(int leaf, int subLeaf, unsigned int regs[4])
+{
+#ifdef _MSC_VER
+    int r[4];
+    __cpuidex(r, leaf, subLeaf);
+    for (int i = 0; i < 4; i++)
+        regs[i] = (unsigned int)r[i];
+#else
+    if (!__get_cpuid_count((unsigned int)leaf, (unsigned int)subLeaf, &regs[0], &regs[1], &regs[2], &regs[3]))
+        regs[0] = regs[1] = regs[2] = regs[3] = 0;
+#endif
+}
+
+// register state enabled by the OS (XCR0)
+static unsigned long long GetXCR0()
+{
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    unsigned int eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+
+static bool CpuSupports(Int16Gemm::Kernel kernel)
+{
+    if (kernel == Int16Gemm::Kernel::Scalar || kernel == Int16Gemm::Kernel::SSE2) // SSE2 is part of x64
+        return true;
+
+    unsigned int leaf1[4], leaf7[4];
+    CpuId(1, 0, leaf1);
+    const bool osxsave = (leaf1[2] & (1u << 27)) != 0;
+    if (!osxsave)
+        return false;
+    CpuId(0, 0, leaf7);
+    if (leaf7[0] < 7)
+        return false;
+    CpuId(7, 0, leaf7);
+    const unsigned long long xcr0 = GetXCR0();
+    const bool avxState = (xcr0 & 0x6) == 0x6;
+    const bool avx512State = (xcr0 & 0xE6) == 0xE6;
+
+    if (kernel == Int16Gemm::Kernel::AVX2)
+        return avxState && (leaf7[1] & (1u << 5)) != 0;
+#ifdef QGEMM_HAS_VNNI
+    if (kernel == Int16Gemm::Kernel::AVX512VNNI)
+        return avx512State && (leaf7[1] & (1u << 16)) != 0 /*AVX512F*/ && (leaf7[1] & (1u << 30)) != 0 /*AVX512BW*/ && (leaf7[2] & (1u << 11)) != 0 /*VNNI*/;
+#else
+    (void)avx512State;
+#endif
+    return false;
+}
+
+#else // !QGEMM_X86
+
+static bool CpuSupports(Int16Gemm::Kernel kernel)
+{
+    return kernel == Int16Gemm::Kernel::Scalar;
+}
+
+#endif
+
+typedef void (*MicroKernel)(int kPairs, const short* a, const short* b, int* tile);
+
+static MicroKernel GetMicroKernel(Int16Gemm::Kernel kernel)
+{
+    switch (kernel)
+    {
+#ifdef QGEMM_X86
+#ifdef QGEMM_HAS_VNNI
+    case Int16Gemm::Kernel::AVX512VNNI: return MicroKernelAVX512VNNI;
+#endif
+    case Int16Gemm::Kernel::AVX2:       return MicroKernelAVX2;
+    case Int16Gemm::Kernel::SSE2:       return MicroKernelSSE2;
+#endif
+    default:                            return MicroKernelScalar;
+    }
+}
+
+static Int16Gemm::Kernel DetectKernel()
+{
+    for (auto kernel : { Int16Gemm::Kernel::AVX512VNNI, Int16Gemm::Kernel::AVX2, Int16Gemm::Kernel::SSE2 })
+    {
+        if (CpuSupports(kernel))
+            return kernel;
+    }
+    return Int16Gemm::Kernel::Scalar;
+}
+
+static std::atomic<int>& CurrentKernel()
+{
+    static std::atomic<int> kernel((int)DetectKernel());
+    return kernel;
+}
+
+/*static*/ Int16Gemm::Kernel Int16Gemm::GetKernel()
+{
+    return (Kernel)CurrentKernel().load();
+}
+
+/*static*/ void Int16Gemm::SetKernel(Kernel kernel)
+{
+    if (!IsKernelSupported(kernel))
+        InvalidArgument("Int16Gemm: The %s kernel is not supported on this CPU.", KernelName(kernel));
+    CurrentKernel() = (int)kernel;
+}
+
+/*static*/ bool Int16Gemm::IsKernelSupported(Kernel kernel)
+{
+    return CpuSupports(kernel);
+}
+
+/*static*/ const char* Int16Gemm::KernelName(Kernel kernel)
+{
+    switch (kernel)
+    {
+    case Kernel::Scalar:     return "scalar";
+    case Kernel::SSE2:       return "SSE2";
+    case Kernel::AVX2:       return "AVX2";
+    case Kernel::AVX512VNNI: return "AVX512-VNNI";
+    default:                 return "unknown";
+    }
+}
+
+// -----------------------------------------------------------------------
+// driver
+// -----------------------------------------------------------------------
+
+/*static*/ void Int16Gemm::Multiply(const Int16PackedA& A, const Int16PackedB& B, int* C)
+{
+    if (A.k != B.k)
+        InvalidArgument("Int16Gemm::Multiply: The inner dimensions of a and b must match.");
+
+    const int m = A.m, n = B.n, kPairs = KPairs(A.k);
+    const int numPanels = (m + MR - 1) / MR;
+    const int numBlocks = (n + NR - 1) / NR;
+    const size_t panelSize = (size_t)kPairs * MR * 2;
+    const size_t blockSize = (size_t)kPairs * NR * 2;
+    const MicroKernel microKernel = GetMicroKernel(GetKernel());
+
+    // number of B blocks processed per chunk, such that a chunk occupies about 256 KB (a typical L2 share)
+    const int blocksPerChunk = std::max(1, (int)((256 * 1024) / (blockSize * sizeof(short))));
+
+    for (int chunkBegin = 0; chunkBegin < numBlocks; chunkBegin += blocksPerChunk)
+    {
+        const int chunkEnd = std::min(numBlocks, chunkBegin + blocksPerChunk);
+#pragma omp parallel for
+        for (int p = 0; p < numPanels; p++)
+        {
+            int tile[NR * MR];
+            const short* a = A.data.data() + p * panelSize;
+            const int rowBegin = p * MR;
+            const int rows = std::min(MR, m - rowBegin);
+            for (int jb = chunkBegin; jb < chunkEnd; jb++)
+            {
+                microKernel(kPairs, a, B.data.data() + jb * blockSize, tile);
+                const int colBegin = jb * NR;
+                const int cols = std::min(NR, n - colBegin);
+                for (int j = 0; j < cols; j++)
+                    memcpy(C + (size_t)(colBegin + j) * m + rowBegin, tile + j * MR, rows * sizeof(int));
+            }
+        }
+    }
+}
+
+}}}
@@ -0,0 +1,71 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+// QuantizedGemm.h -- blocked integer GEMM for 16-bit quantized operands, used by QuantizedMultiplier
+//
+#pragma once
+
+#include <vector>
+
+#ifdef _WIN32
+#ifdef MATH_EXPORTS
+#define MATH_API __declspec(dllexport)
+#else
+#define MATH_API __declspec(dllimport)
+#endif
+#else // no DLLs on Linux
+#define MATH_API
+#endif
+
+namespace Microsoft { namespace MSR { namespace CNTK {
+
+// Operands are packed once into a kernel-friendly layout; packed constant operands can be reused across calls.
+// Both layouts interleave the inner dimension in pairs, matching the pairwise 16-bit multiply-add
+// instructions (pmaddwd, vpdpwssd). Odd 'k' and partial panels are padded with zeros.
+
+// left operand A[m,k]: panels of Int16Gemm::PanelRows rows; per k-pair the panel holds (A[r,l], A[r,l+1]) for each row r
+struct Int16PackedA
+{
+    int m = 0;
+    int k = 0;
+    std::vector<short> data;
+};
+
+// right operand B[k,n]: blocks of Int16Gemm::BlockCols columns; per k-pair the block holds (B[l,j], B[l+1,j]) for each column j
+struct Int16PackedB
+{
+    int k = 0;
+    int n = 0;
+    std::vector<short> data;
+};
+
+class MATH_API Int16Gemm
+{
+public:
+    static const int PanelRows = 16; // micro-tile height (rows of A per panel)
+    static const int BlockCols = 4;  // micro-tile width (columns of B per block)
+
+    enum class Kernel
+    {
+        Scalar,
+        SSE2,
+        AVX2,
+        AVX512VNNI
+    };
+
+    // pack column-major matrices
+    static void PackA(int m, int k, const short* A, Int16PackedA& packed);
+    static void PackB(int k, int n, const short* B, Int16PackedB& packed);
+
+    // C[m,n] = A[m,k] * B[k,n], C is column-major with leading dimension m
+    static void Multiply(const Int16PackedA& A, const Int16PackedB& B, int* C);
+
+    // the kernel is chosen once from the CPU features; it can be overridden (e.g. by tests and benchmarks)
+    static Kernel GetKernel();
+    static void SetKernel(Kernel kernel); // fails if the CPU does not support it
+    static bool IsKernelSupported(Kernel kernel);
+    static const char* KernelName(Kernel kernel);
+};
+
+}}}
@@ -4,6 +4,7 @@
 //
 #pragma once
 #include "Quantizers.h"
+#include "QuantizedGemm.h"
 
 namespace Microsoft { namespace MSR { namespace CNTK {
 
@@ -21,6 +22,14 @@ class QuantizedMultiplier
     // Placeholders for quantized matrices A and B
     vector<short> m_pMatA, m_pMatB;
 
+    // Quantized matrices in the layout of the integer GEMM kernel. For constant matrices these are computed
+    // once and reused by all subsequent calls.
+    Int16PackedA m_packedA;
+    Int16PackedB m_packedB;
+
+    // integer product before de-quantization
+    vector<int> m_matC;
+
     // Whether matrices A and B are constant (i.e. weights)
     // If the matrix is constant, the size of the underlying container for quatized values will be preserved for
     // the lifespan of the object
@@ -44,12 +53,15 @@ public:
     // A[m,k]*B[k,n] = C[m,n]
     void Multiply(int m, int n, int k, ElemType* A, ElemType* B, ElemType* C)
     {
-        // Quantize
+        // Quantize and pack. The quantized copy of a constant matrix is kept, since its quantizer state (scale) must be preserved.
         if (!m_isAConstant || m_firstPass)
         {
             m_pMatA.resize(m*k);
             ArrayRef<short> refMatA(m_pMatA.data(), m_pMatA.size());
             m_pQuantizerA->Quantize(ArrayRef<ElemType>(A, m_pMatA.size()), refMatA);
+            Int16Gemm::PackA(m, k, m_pMatA.data(), m_packedA);
+            if (m_isAConstant)
+                m_pMatA = vector<short>(); // only the packed copy is needed from now on
         }
         
         if (!m_isBConstant || m_firstPass)
@@ -57,27 +69,26 @@ public:
             m_pMatB.resize(n*k);
             ArrayRef<short> refMatB(m_pMatB.data(), m_pMatB.size());
             m_pQuantizerB->Quantize(ArrayRef<ElemType>(B, m_pMatB.size()), refMatB);
+            Int16Gemm::PackB(k, n, m_pMatB.data(), m_packedB);
+            if (m_isBConstant)
+                m_pMatB = vector<short>();
         }
 
         m_firstPass = false;
 
+        if (m_packedA.m != m || m_packedA.k != k || m_packedB.n != n || m_packedB.k != k)
+            LogicError("QuantizedMultiplier: Dimensions of a constant matrix changed between calls.");
+
         // Do multiply
-        // Naive inefficient product, just for demonstation
-        // TODO: replace with an efficient version, e.g. IPG, block multiplier, Eigen, gemmlowp, etc.
-        for (size_t i = 0; i < m; i++)
-            for (size_t j = 0; j < n; j++)
-            {
-                int dotProduct=0;
-                for (size_t l = 0; l < k; l++)
-                {
-                    // CNTK is using column-major storage
-                    dotProduct += m_pMatA[i + l*m] * m_pMatB[l + k*j];
-                }
-                C[i + j*m] = (ElemType)dotProduct;
-            }
+        // Blocked SIMD integer product with 32-bit accumulation, see QuantizedGemm.cpp.
+        int mn = m*n;
+        m_matC.resize(mn);
+        Int16Gemm::Multiply(m_packedA, m_packedB, m_matC.data());
 
         // De-quantize
-        int mn = m*n;
+#pragma omp parallel for
+        for (int i = 0; i < mn; i++)
+            C[i] = (ElemType)m_matC[i];
         m_pQuantizerB->Dequantize(C, C, mn);
         m_pQuantizerA->Dequantize(C, C, mn);
     }
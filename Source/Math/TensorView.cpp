@@ -285,6 +285,76 @@ void TensorView<ElemType>::DoTernaryOpOf(ElemType beta, const TensorView& a, con
     GetSOB().TensorOp(beta, a.GetSOB(), b.GetSOB(), c.GetSOB(), alpha, op, reductionOp, offsets, regularOpDims, regularStrides, reducingOpDims, reducingStrides);
 }
 
+template <class ElemType>
+void TensorView<ElemType>::DoFusedOpOf(ElemType beta, const vector<TensorView>& inputs, ElemType alpha, const ElementWiseProgram& program)
+{
+    const size_t N = ElementWiseProgram::MaxOperands;
+    if (inputs.size() != program.numInputs || inputs.empty() || inputs.size() > ElementWiseProgram::MaxInputs || program.instructions.empty())
+        InvalidArgument("DoFusedOpOf: Number of inputs does not match the program.");
+
+    bool isOnCPU = GetSOB().GetDeviceId() == CPUDEVICE;
+    for (const auto& input : inputs)
+        isOnCPU &= input.GetSOB().GetDeviceId() == CPUDEVICE;
+    if (!isOnCPU)
+        return DoFusedOpOfByOperation(beta, inputs, alpha, program);
+
+    // unused operands are padded with the output shape; the program never accesses them
+    array<TensorShape, N> shapes;
+    for (size_t i = 0; i < N; i++)
+        shapes[i] = i < inputs.size() ? inputs[i].GetShape() : GetShape();
+
+    array<size_t, N> offsets;
+    array<SmallVector<ptrdiff_t>, N> regularStrides, reducingStrides;
+    SmallVector<size_t> regularOpDims, reducingOpDims;
+    PrepareTensorOperands<ElemType, N>(shapes, offsets, regularOpDims, regularStrides, reducingOpDims, reducingStrides);
+
+    // output cannot be input when reducing
+    if (reducingOpDims.size() > 0)
+        for (const auto& input : inputs)
+            CheckDifferentObject(input, *this);
+
+    vector<const Matrix<ElemType>*> sobs;
+    for (const auto& input : inputs)
+        sobs.push_back(&input.GetSOB());
+    GetSOB().FusedTensorOp(beta, sobs, alpha, program, offsets, regularOpDims, regularStrides, reducingOpDims, reducingStrides);
+}
+
+// execute an ElementWiseProgram one operation at a time, with intermediate results of the full operation shape
+template <class ElemType>
+void TensorView<ElemType>::DoFusedOpOfByOperation(ElemType beta, const vector<TensorView>& inputs, ElemType alpha, const ElementWiseProgram& program)
+{
+    // operation shape = max over all input dimensions
+    size_t rank = 0;
+    for (const auto& input : inputs)
+        rank = max(rank, input.GetShape().GetRank());
+    SmallVector<size_t> opDims(rank, 1);
+    for (const auto& input : inputs)
+        for (size_t k = 0; k < input.GetShape().GetRank(); k++)
+            opDims[k] = max(opDims[k], input.GetShape()[k]);
+    const TensorShape opShape(opDims);
+
+    vector<TensorView> registers(inputs);
+    for (size_t k = 0; k < program.instructions.size(); k++)
+    {
+        const auto& instruction = program.instructions[k];
+        const bool isLast = k + 1 == program.instructions.size();
+        TensorView result = isLast ? *this : TensorView(make_shared<Matrix<ElemType>>(opShape.GetNumElements(), 1, GetSOB().GetDeviceId()), opShape);
+        const ElemType resultBeta = isLast ? beta : 0;
+        const ElemType resultAlpha = isLast ? alpha : 1;
+        const auto& a = registers[instruction.args[0]];
+        const auto& b = registers[instruction.args[1]];
+        const auto& c = registers[instruction.args[2]];
+        switch (GetElementWiseOperatorArity(instruction.op))
+        {
+        case 1: result.DoUnaryOpOf  (resultBeta, a,       resultAlpha, instruction.op, ElementWiseOperator::opSum); break;
+        case 2: result.DoBinaryOpOf (resultBeta, a, b,    resultAlpha, instruction.op, ElementWiseOperator::opSum); break;
+        case 3: result.DoTernaryOpOf(resultBeta, a, b, c, resultAlpha, instruction.op, ElementWiseOperator::opSum); break;
+        default: LogicError("DoFusedOpOf: Unknown op code %d.", (int) instruction.op);
+        }
+        registers.push_back(result);
+    }
+}
+
 template <class ElemType>
 void TensorView<ElemType>::DoArgReductionOpOf(const TensorView& a, ElementWiseOperator reductionOp)
 {
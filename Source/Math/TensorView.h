@@ -134,6 +134,16 @@ public:
     void DoBinaryOpOf (ElemType beta, const TensorView& a, const TensorView& b,                      ElemType alpha, ElementWiseOperator op, ElementWiseOperator reductionOp);
     void DoTernaryOpOf(ElemType beta, const TensorView& a, const TensorView& b, const TensorView& c, ElemType alpha, ElementWiseOperator op, ElementWiseOperator reductionOp);
 
+    // -------------------------------------------------------------------
+    // fused elementwise operations
+    // c.DoFusedOpOf(beta, inputs, alpha, program) means c := beta * c + alpha * program(inputs),
+    // with the same broadcasting, inverse-broadcasting, and in-place rules as above.
+    // On the CPU, the program is evaluated in a single pass without intermediate tensors;
+    // otherwise it is executed one operation at a time.
+    // -------------------------------------------------------------------
+
+    void DoFusedOpOf(ElemType beta, const std::vector<TensorView>& inputs, ElemType alpha, const ElementWiseProgram& program);
+
     // -------------------------------------------------------------------
     // arg based operations
     // -------------------------------------------------------------------
@@ -166,6 +176,8 @@ public:
     friend Test::TensorTest<ElemType>;
 
 private:
+    void DoFusedOpOfByOperation(ElemType beta, const std::vector<TensorView>& inputs, ElemType alpha, const ElementWiseProgram& program);
+
     // -------------------------------------------------------------------
     // sob members
     // -------------------------------------------------------------------
@@ -10,7 +10,14 @@
 #include "BinaryDataChunk.h"
 #include "CBFUtils.h"
 #include "FileWrapper.h"
+#include <climits>
 #include <vector>
+#ifdef USE_LZ4
+#include <lz4.h>
+#endif
+#ifdef USE_ZSTD
+#include <zstd.h>
+#endif
 
 namespace CNTK {
 
@@ -20,9 +27,49 @@ enum class MatrixEncodingType : unsigned char
 {
     dense = 0,
     sparse_csc = 1,
-    // TODO: compressed_sparse_csc = 2, // indices are encoded as var-ints
+    compressed_sparse_csc = 2, // counts and delta encoded indices are var-ints (version 2 and up)
 };
 
+// Starting with version 2, the data of each chunk (everything after the sequence lengths) is preceded by
+// the codec it is compressed with and its uncompressed size. Chunks that do not compress well are stored as is.
+enum class ChunkCompressionType : unsigned char
+{
+    none = 0,
+    lz4 = 1,
+    zstd = 2,
+};
+
+static const size_t s_chunkDataHeaderSize = sizeof(ChunkCompressionType) + sizeof(uint64_t);
+
+static void DecompressChunkData(ChunkCompressionType compression, const byte* source, size_t sourceSize, byte* target, size_t targetSize, const wstring& filename)
+{
+    switch (compression)
+    {
+    case ChunkCompressionType::lz4:
+#ifdef USE_LZ4
+        if (sourceSize > INT_MAX || targetSize > INT_MAX ||
+            LZ4_decompress_safe((const char*)source, (char*)target, (int)sourceSize, (int)targetSize) != (int)targetSize)
+            RuntimeError("Failed to decompress an lz4 compressed chunk of '%ls'.", filename.c_str());
+        break;
+#else
+        RuntimeError("'%ls' contains lz4 compressed chunks, but the reader was built without lz4 support.", filename.c_str());
+#endif
+    case ChunkCompressionType::zstd:
+#ifdef USE_ZSTD
+    {
+        size_t result = ZSTD_decompress(target, targetSize, source, sourceSize);
+        if (ZSTD_isError(result) || result != targetSize)
+            RuntimeError("Failed to decompress a zstd compressed chunk of '%ls'.", filename.c_str());
+        break;
+    }
+#else
+        RuntimeError("'%ls' contains zstd compressed chunks, but the reader was built without zstd support.", filename.c_str());
+#endif
+    default:
+        RuntimeError("Unknown chunk compression type %u in '%ls'.", (unsigned int)compression, filename.c_str());
+    }
+}
+
 
 void BinaryChunkDeserializer::ReadChunkTable()
 {
@@ -37,9 +84,8 @@ void BinaryChunkDeserializer::ReadChunkTable()
     // Read in all of the offsets for the chunks
     m_file.ReadOrDie(chunks, sizeof(BinaryChunkInfo), m_numChunks);
 
-    // We fill the final entry with the current position of the file
-    auto position = m_file.TellOrDie();
-    chunks[m_numChunks].offset = position;
+    // We fill the final entry with the start of the header, which is where the data of the last chunk ends
+    chunks[m_numChunks].offset = m_headerOffset;
     chunks[m_numChunks].numSamples = 0;
     chunks[m_numChunks].numSequences = 0;
 
@@ -52,6 +98,14 @@ BinaryChunkDeserializer::BinaryChunkDeserializer(const BinaryConfigHelper& helpe
     SetTraceLevel(helper.GetTraceLevel());
 
     Initialize(helper.GetRename(), helper.GetElementType());
+
+    if (helper.UseMemoryMapping())
+    {
+        m_mappedFile = make_shared<MemoryMappedFile>(helper.GetFilePath());
+        if (m_traceLevel > 1)
+            fprintf(stderr, "BinaryChunkDeserializer: memory mapped '%ls' (%" PRIu64 " bytes).\n",
+                helper.GetFilePath().c_str(), (uint64_t)m_mappedFile->Size());
+    }
 }
 
 
@@ -60,7 +114,8 @@ BinaryChunkDeserializer::BinaryChunkDeserializer(const std::wstring& filename) :
     m_file(FileWrapper::OpenOrDie(filename, L"rb")),
     m_headerOffset(0),
     m_chunkTableOffset(0),
-    m_traceLevel(0)
+    m_traceLevel(0),
+    m_version(0)
 {
 }
 
@@ -71,11 +126,11 @@ void BinaryChunkDeserializer::Initialize(const std::map<std::wstring, std::wstri
     // First, verify the magic number.
     CBFUtils::FindMagicOrDie(m_file);
     
-    // Second, read the version number of the data file, and (for now) make sure the reader version is the same.
-    uint32_t versionNumber = CBFUtils::GetVersionNumber(m_file);
-    if (versionNumber != s_currentVersion)
+    // Second, read the version number of the data file, and make sure the reader can read it.
+    m_version = CBFUtils::GetVersionNumber(m_file);
+    if (m_version == 0 || m_version > s_currentVersion)
         LogicError("The reader version is %" PRIu32 ", but the data file was created for version %" PRIu32 ".",
-            s_currentVersion, versionNumber);
+            s_currentVersion, m_version);
 
     // Now, find where the header is.
     m_headerOffset = CBFUtils::GetHeaderOffset(m_file);
@@ -102,6 +157,8 @@ void BinaryChunkDeserializer::Initialize(const std::map<std::wstring, std::wstri
             m_deserializers[i] = make_shared<DenseBinaryDataDeserializer>(m_file, precision);
         else if (type == MatrixEncodingType::sparse_csc)
             m_deserializers[i] = make_shared<SparseBinaryDataDeserializer>(m_file, precision);
+        else if (type == MatrixEncodingType::compressed_sparse_csc && m_version >= 2)
+            m_deserializers[i] = make_shared<CompressedSparseBinaryDataDeserializer>(m_file, precision);
         else
             RuntimeError("Unknown encoding type %u requested.", (unsigned int)type);
 
@@ -169,18 +226,17 @@ void BinaryChunkDeserializer::SequenceInfosForChunk(ChunkIdType chunkId, std::ve
     }
 }
 
-unique_ptr<byte[]> BinaryChunkDeserializer::ReadChunk(ChunkIdType chunkId)
+unique_ptr<byte[]> BinaryChunkDeserializer::ReadChunk(uint64_t offset, size_t chunkSize)
 {
-    // Seek to the start of the data portion in the chunk
-    m_file.SeekOrDie(m_chunkTable->GetDataStartOffset(chunkId), SEEK_SET);
-
-    // Determine how big the chunk is.
-    size_t chunkSize = m_chunkTable->GetChunkSize(chunkId);
-    
     // Create buffer
     // TODO: use a pool of buffers instead of allocating a new one, each time a chunk is read.
     unique_ptr<byte[]> buffer(new byte[chunkSize]);
 
+    std::lock_guard<std::mutex> lock(m_fileMutex);
+
+    // Seek to the start of the data portion in the chunk
+    m_file.SeekOrDie(offset, SEEK_SET);
+
     // Read the chunk from disk
     m_file.ReadOrDie(buffer.get(), sizeof(byte), chunkSize);
 
@@ -188,12 +244,67 @@ unique_ptr<byte[]> BinaryChunkDeserializer::ReadChunk(ChunkIdType chunkId)
 }
 
 
+unique_ptr<byte[]> BinaryChunkDeserializer::DecompressChunk(ChunkCompressionType compression, uint64_t offset, size_t chunkSize, size_t uncompressedSize)
+{
+    unique_ptr<byte[]> buffer(new byte[uncompressedSize]);
+    if (m_mappedFile)
+    {
+        DecompressChunkData(compression, (const byte*)m_mappedFile->GetView(offset, chunkSize), chunkSize, buffer.get(), uncompressedSize, m_file.Filename());
+        // Only the decompressed copy is used from now on.
+        m_mappedFile->DontNeed(offset, chunkSize);
+    }
+    else
+    {
+        unique_ptr<byte[]> compressed = ReadChunk(offset, chunkSize);
+        DecompressChunkData(compression, compressed.get(), chunkSize, buffer.get(), uncompressedSize, m_file.Filename());
+    }
+    return buffer;
+}
+
 ChunkPtr BinaryChunkDeserializer::GetChunk(ChunkIdType chunkId)
 {
-    // Read the chunk into memory
-    unique_ptr<byte[]> buffer = ReadChunk(chunkId);
+    auto numSequences = m_chunkTable->GetNumSequences(chunkId);
+    uint64_t offset = m_chunkTable->GetDataStartOffset(chunkId);
+    size_t chunkSize = m_chunkTable->GetChunkSize(chunkId);
+
+    shared_ptr<BinaryDataChunk> chunk;
+    if (m_version >= 2)
+    {
+        if (chunkSize < s_chunkDataHeaderSize)
+            RuntimeError("Chunk %u of '%ls' is truncated.", (unsigned int)chunkId, m_file.Filename().c_str());
+
+        ChunkCompressionType compression;
+        uint64_t uncompressedSize;
+        if (m_mappedFile)
+        {
+            const char* header = m_mappedFile->GetView(offset, s_chunkDataHeaderSize);
+            memcpy(&compression, header, sizeof(compression));
+            memcpy(&uncompressedSize, header + sizeof(compression), sizeof(uncompressedSize));
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(m_fileMutex);
+            m_file.SeekOrDie(offset, SEEK_SET);
+            m_file.ReadOrDie(compression);
+            m_file.ReadOrDie(uncompressedSize);
+        }
+        offset += s_chunkDataHeaderSize;
+        chunkSize -= s_chunkDataHeaderSize;
+
+        if (compression != ChunkCompressionType::none)
+            chunk = make_shared<BinaryDataChunk>(chunkId, numSequences, DecompressChunk(compression, offset, chunkSize, uncompressedSize), uncompressedSize, m_deserializers);
+    }
+
+    // With memory mapping, the chunk is a view into the file, so no data is read or copied here.
+    if (!chunk && m_mappedFile)
+        chunk = make_shared<BinaryDataChunk>(chunkId, numSequences, m_mappedFile, offset, chunkSize, m_deserializers);
+    else if (!chunk)
+        chunk = make_shared<BinaryDataChunk>(chunkId, numSequences, ReadChunk(offset, chunkSize), chunkSize, m_deserializers);
 
-    return make_shared<BinaryDataChunk>(chunkId, m_chunkTable->GetNumSequences(chunkId), std::move(buffer), m_deserializers);
+    // Parse the chunk here rather than on first access, so that decoding (fp16 values, var-int indices)
+    // runs on the thread that loads the chunk, which is the prefetch thread of the randomizer.
+    chunk->ParseChunk();
+    return chunk;
 }
 
 void BinaryChunkDeserializer::SetTraceLevel(unsigned int traceLevel)
@@ -5,10 +5,12 @@
 
 #pragma once
 
+#include <mutex>
 #include "DataDeserializerBase.h"
 #include "BinaryConfigHelper.h"
 #include "BinaryDataChunk.h"
 #include "BinaryDataDeserializer.h"
+#include "MemoryMappedFile.h"
 
 namespace CNTK {
 
@@ -83,6 +85,8 @@ typedef std::shared_ptr<CorpusDescriptor> CorpusDescriptorPtr;
 
 class FileWrapper;
 
+enum class ChunkCompressionType : unsigned char;
+
 // TODO: more details when tracing warnings 
 class BinaryChunkDeserializer : public DataDeserializerBase {
 public:
@@ -101,6 +105,9 @@ public:
     // Get information about particular chunk.
     void SequenceInfosForChunk(ChunkIdType chunkId, std::vector<SequenceInfo>& result) override;
 
+    // Only the reads from the input file are serialized; decompression and parsing run concurrently.
+    bool SupportsConcurrentChunkLoading() const override { return true; }
+
 private:
     // Builds an index of the input data.
     void Initialize(const std::map<std::wstring, std::wstring>& rename, DataType precision);
@@ -109,7 +116,10 @@ private:
     void ReadChunkTable();
 
     // Reads a chunk from disk into buffer
-    unique_ptr<byte[]> ReadChunk(ChunkIdType chunkId);
+    unique_ptr<byte[]> ReadChunk(uint64_t offset, size_t chunkSize);
+
+    // Reads a compressed chunk and returns its decompressed data
+    unique_ptr<byte[]> DecompressChunk(ChunkCompressionType compression, uint64_t offset, size_t chunkSize, size_t uncompressedSize);
 
     BinaryChunkDeserializer(const wstring& filename);
 
@@ -117,6 +127,11 @@ private:
 
 private:
     FileWrapper m_file;
+    // Guards the position of m_file when chunks are loaded concurrently.
+    std::mutex m_fileMutex;
+
+    // Set if chunks are views into the memory mapped input file instead of being read into buffers.
+    MemoryMappedFilePtr m_mappedFile;
 
     int64_t m_headerOffset, m_chunkTableOffset;
 
@@ -130,7 +145,10 @@ private:
     
     unsigned int m_traceLevel;
 
-    static const uint32_t s_currentVersion = 1;
+    // Version of the input file.
+    uint32_t m_version;
+
+    static const uint32_t s_currentVersion = 2;
 
     friend class CNTKBinaryReaderTestRunner;
 
@@ -9,6 +9,7 @@
 #include "BinaryConfigHelper.h"
 #include "BinaryChunkDeserializer.h"
 #include "BinaryDataDeserializer.h"
+#include "MemoryMappedFile.h"
 
 namespace CNTK {
 
@@ -18,19 +19,51 @@ public:
     explicit BinaryDataChunk(ChunkIdType chunkId,
         size_t numSequences, 
         unique_ptr<byte[]> buffer, 
+        size_t size,
         std::vector<BinaryDataDeserializerPtr> deserializer)
         : m_chunkId(chunkId),
         m_numSequences(numSequences), 
         m_buffer(std::move(buffer)), 
+        m_viewOffset(0),
+        m_viewSize(0),
+        m_dataBegin(m_buffer.get()),
+        m_dataSize(size),
         m_deserializers(deserializer)
     { }
 
+    // Chunk that is a view into a memory mapped file; sequences point directly into the mapping.
+    explicit BinaryDataChunk(ChunkIdType chunkId,
+        size_t numSequences,
+        MemoryMappedFilePtr file,
+        uint64_t offset,
+        size_t size,
+        std::vector<BinaryDataDeserializerPtr> deserializer)
+        : m_chunkId(chunkId),
+        m_numSequences(numSequences),
+        m_file(file),
+        m_viewOffset(offset),
+        m_viewSize(size),
+        // the deserializers only read from the buffer
+        m_dataBegin((byte*)file->GetView(offset, size)),
+        m_dataSize(size),
+        m_deserializers(deserializer)
+    {
+        // start reading the chunk in, so it is resident by the time the randomizer gets to it
+        m_file->WillNeed(offset, size);
+    }
+
+    ~BinaryDataChunk()
+    {
+        // the chunk has left the randomization window, its pages can go
+        if (m_file)
+            m_file->DontNeed(m_viewOffset, m_viewSize);
+    }
+
     // Gets a sequence using its index inside the chunk.
     void GetSequence(size_t sequenceIdx, std::vector<SequenceDataPtr>& result) override
     {
         // Check if we've already parsed the chunk. If not, parse it.
-        if (m_data.size() == 0)
-            ParseChunk();
+        ParseChunk();
 
         assert(m_data.size() != 0);
 
@@ -49,18 +82,22 @@ public:
         return numSamples;
     }
 
-protected:
+    // Creates the sequence data of all streams; called by the deserializer when the chunk is loaded.
     void ParseChunk()
     {
+        if (m_data.size() != 0)
+            return;
+
         m_data.resize(m_deserializers.size());
 
         // the number of bytes of buffer that have been processed by the deserializer so far
         size_t bytesProcessed = 0;
         // Now call all of the deserializers on the chunk, in order
         for (size_t i = 0; i < m_deserializers.size(); i++)
-            bytesProcessed += m_deserializers[i]->GetSequenceDataForChunk(m_numSequences, m_buffer.get() + bytesProcessed, m_data[i]);
+            bytesProcessed += m_deserializers[i]->GetSequenceDataForChunk(m_numSequences, m_dataBegin + bytesProcessed, m_dataSize - bytesProcessed, m_data[i]);
     }
 
+protected:
     // chunk id (copied from the descriptor)
     ChunkIdType m_chunkId;
 
@@ -71,6 +108,15 @@ protected:
     // This is the actual chunk read from disk. We will call back to the deserializer for it to be deserialized
     unique_ptr<byte[]> m_buffer;
 
+    // Alternatively, the chunk is a view into the memory mapped input file.
+    MemoryMappedFilePtr m_file;
+    uint64_t m_viewOffset;
+    size_t m_viewSize;
+
+    // Start and size of the chunk data, in either of the above.
+    byte* m_dataBegin;
+    size_t m_dataSize;
+
     // This is the deserializer who knows how to interpret the m_data chunk that we read in
     std::vector<BinaryDataDeserializerPtr> m_deserializers;
     
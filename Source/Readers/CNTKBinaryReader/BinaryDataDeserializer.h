@@ -10,6 +10,8 @@
 #include "BinaryDataChunk.h"
 #include "FileWrapper.h"
 #include "Reader.h"
+#include <inttypes.h>
+#include <limits>
 
 namespace CNTK {
 
@@ -27,6 +29,7 @@ public:
         if (precision != DataType::Float && precision != DataType::Double)
             LogicError("Unsupported precision type %u.", (unsigned int)precision);
 
+        // Half precision values are expanded to either precision; float and double have to match.
         if ((m_dataType == ReaderDataType::tfloat && precision != DataType::Float) ||
             (m_dataType == ReaderDataType::tdouble && precision != DataType::Double))
             LogicError("Unsupported combination of the input data type %u and precision %u. "
@@ -35,7 +38,9 @@ public:
         m_precision = precision;
     }
 
-    virtual size_t GetSequenceDataForChunk(size_t numSequences, void* data, std::vector<SequenceDataPtr>& result) = 0;
+    // Parses the sequences of this input from the chunk data at 'data', of which 'size' bytes are left.
+    // Returns the number of bytes consumed.
+    virtual size_t GetSequenceDataForChunk(size_t numSequences, void* data, size_t size, std::vector<SequenceDataPtr>& result) = 0;
 
     virtual StorageFormat GetStorageFormat() = 0;
 
@@ -60,19 +65,28 @@ public:
             return sizeof(float);
         if (m_dataType == ReaderDataType::tdouble)
             return sizeof(double);
+        if (m_dataType == ReaderDataType::tfloat16)
+            return sizeof(uint16_t);
         
         LogicError("Unsupported input data type %u.", (unsigned int)m_dataType);
     }
 
+    // True if the stored values are not in the reader precision and have to be converted when the chunk is parsed.
+    bool NeedsConversion()
+    {
+        return m_dataType == ReaderDataType::tfloat16;
+    }
+
 protected:
 
     enum class ReaderDataType : unsigned char
     {
         tfloat = 0,
         tdouble = 1,
+        tfloat16 = 2, // IEEE half precision (version 2 and up)
         // TODO: 
-        // tbool = 2, 1 bit per value (one-hot data)
-        // tbyte = 3, 1 byte per value
+        // tbool = 3, 1 bit per value (one-hot data)
+        // tbyte = 4, 1 byte per value
     };
 
     virtual ~BinaryDataDeserializer() = default;
@@ -90,15 +104,69 @@ protected:
     void ReadDataType(FileWrapper& file)
     {
         file.ReadOrDie(m_dataType);
-        if (m_dataType> ReaderDataType::tdouble)
+        if (m_dataType > ReaderDataType::tfloat16)
             RuntimeError("Unsupported input data type %u.", (unsigned int)m_dataType);
     }
 
+    // Converts 'count' stored half precision values into 'target', which is resized to hold them in the reader precision.
+    void ConvertValues(const void* source, size_t count, std::vector<char>& target)
+    {
+        const uint16_t* values = (const uint16_t*)source;
+        if (m_precision == DataType::Float)
+        {
+            target.resize(count * sizeof(float));
+            float* result = (float*)target.data();
+            for (size_t i = 0; i < count; i++)
+                result[i] = HalfToFloat(values[i]);
+        }
+        else
+        {
+            target.resize(count * sizeof(double));
+            double* result = (double*)target.data();
+            for (size_t i = 0; i < count; i++)
+                result[i] = HalfToFloat(values[i]);
+        }
+    }
+
+    static float HalfToFloat(uint16_t value)
+    {
+        uint32_t sign = uint32_t(value & 0x8000) << 16;
+        uint32_t exponent = (value >> 10) & 0x1f;
+        uint32_t mantissa = value & 0x3ff;
+        uint32_t bits;
+        if (exponent == 0x1f) // infinity or NaN
+            bits = sign | 0x7f800000 | (mantissa << 13);
+        else if (exponent != 0) // normalized, rebias the exponent
+            bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+        else if (mantissa == 0) // signed zero
+            bits = sign;
+        else // denormalized in half, but normalized in single precision
+        {
+            exponent = 127 - 14;
+            while ((mantissa & 0x400) == 0)
+            {
+                mantissa <<= 1;
+                exponent--;
+            }
+            bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+        }
+        float result;
+        memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
     void ReadSampleSize(FileWrapper& file)
     {
         file.ReadOrDie(m_sampleDimension);
     }
 
+    // Fails unless 'count' bytes follow 'offset' in chunk data of 'size' bytes.
+    void CheckChunkDataSize(size_t offset, uint64_t count, size_t size) const
+    {
+        if (offset > size || count > size - offset)
+            RuntimeError("The chunk data of the input '%ls' is truncated or corrupt.", m_name.c_str());
+    }
+
     struct DenseInputStreamBuffer : DenseSequenceData
     {
         const void* GetDataBuffer() override
@@ -114,6 +182,7 @@ protected:
         void* m_data;
         DataType m_dataType;
         NDShape m_sampleShape;
+        std::vector<char> m_decodedData; // owns m_data, if the values had to be converted
     };
 
     struct SparseInputStreamBuffer : SparseSequenceData
@@ -135,6 +204,8 @@ protected:
 
         void* m_data;
         NDShape m_sampleShape;
+        std::vector<char> m_decodedData; // owns m_data, if the values had to be converted
+        std::vector<SparseIndexType> m_decodedIndices; // owns m_indices, if the indices were var-int encoded
     };
 
     DataType m_precision;
@@ -152,7 +223,7 @@ public:
 
     virtual  StorageFormat GetStorageFormat() override { return StorageFormat::Dense; }
 
-    size_t GetSequenceDataForChunk(size_t numSequences, void* data, std::vector<SequenceDataPtr>& result)
+    size_t GetSequenceDataForChunk(size_t numSequences, void* data, size_t size, std::vector<SequenceDataPtr>& result)
     {
         size_t valueSize = SizeOfDataType();
         result.resize(numSequences);
@@ -160,9 +231,16 @@ public:
         for (size_t i = 0; i < numSequences; i++)
         {
             shared_ptr<DenseInputStreamBuffer> sequenceDataPtr = make_shared<DenseInputStreamBuffer>();
+            CheckChunkDataSize(offset, sizeof(uint32_t), size);
             sequenceDataPtr->m_numberOfSamples = *(uint32_t*)((char*)data + offset);
             offset += sizeof(uint32_t);
+            CheckChunkDataSize(offset, (uint64_t)m_sampleDimension * valueSize * sequenceDataPtr->m_numberOfSamples, size);
             sequenceDataPtr->m_data = (char*)data + offset;
+            if (NeedsConversion())
+            {
+                ConvertValues(sequenceDataPtr->m_data, m_sampleDimension * sequenceDataPtr->m_numberOfSamples, sequenceDataPtr->m_decodedData);
+                sequenceDataPtr->m_data = sequenceDataPtr->m_decodedData.data();
+            }
             sequenceDataPtr->m_sampleShape = GetSampleShape();
             sequenceDataPtr->m_elementType = m_precision;
             result[i]  = sequenceDataPtr;
@@ -194,14 +272,14 @@ public:
     //   ElemType[nnz]: the values for the sparse sequences
     //   int32_t[nnz]: the row offsets for the sparse sequences
     //   int32_t[numSamples]: sizes (nnz counts) for each sample in the sequence
-    size_t GetSequenceDataForChunk(size_t numSequences, void* data, std::vector<SequenceDataPtr>& result)
+    size_t GetSequenceDataForChunk(size_t numSequences, void* data, size_t size, std::vector<SequenceDataPtr>& result)
     {
         size_t offset = 0;
         result.resize(numSequences);
         for (size_t i = 0; i < numSequences; i++)
         {
             shared_ptr<SparseInputStreamBuffer> sequenceDataPtr = make_shared<SparseInputStreamBuffer>();
-            offset += GetSequenceData((char*)data + offset, sequenceDataPtr);
+            offset += GetSequenceData((char*)data + offset, size - offset, sequenceDataPtr);
             sequenceDataPtr->m_sampleShape = GetSampleShape();
             sequenceDataPtr->m_elementType = m_precision;
             result[i] = sequenceDataPtr;
@@ -210,12 +288,13 @@ public:
         return offset;
     }
 
-    size_t GetSequenceData(void* data, shared_ptr<SparseInputStreamBuffer>& sequence)
+    size_t GetSequenceData(void* data, size_t size, shared_ptr<SparseInputStreamBuffer>& sequence)
     {
         size_t valueSize = SizeOfDataType();
         size_t offset = 0;
 
         // The very first value in the buffer is the number of samples in this sequence.
+        CheckChunkDataSize(offset, 2 * sizeof(uint32_t), size);
         sequence->m_numberOfSamples = *(uint32_t*)data;
         offset += sizeof(uint32_t);
 
@@ -227,12 +306,18 @@ public:
         }
         sequence->m_totalNnzCount = nnz;
         offset += sizeof(uint32_t);
+        CheckChunkDataSize(offset, (valueSize + sizeof(int32_t)) * (uint64_t)nnz + sizeof(int32_t) * (uint64_t)sequence->m_numberOfSamples, size);
 
         // the rest of this sequence
         // Since we're not templating on ElemType, we use void for the values. Note that this is the only place
         // this deserializer uses ElemType, the rest are int32_t for this deserializer.
         // The data is already properly packed, so just use it.
         sequence->m_data = (char*)data + offset;
+        if (NeedsConversion())
+        {
+            ConvertValues(sequence->m_data, sequence->m_totalNnzCount, sequence->m_decodedData);
+            sequence->m_data = sequence->m_decodedData.data();
+        }
         offset += valueSize * sequence->m_totalNnzCount;
 
         // The indices are supposed to be correctly packed (i.e., in increasing order)
@@ -251,4 +336,98 @@ public:
 };
 
     
+// Same as the sparse CSC encoding, except that all counts and the row indices are stored as var-ints
+// (LEB128: 7 bits per byte, least significant group first, high bit set on all but the last byte),
+// and the row indices of each sample are delta encoded, which keeps most of them in a single byte.
+class CompressedSparseBinaryDataDeserializer : public SparseBinaryDataDeserializer
+{
+public:
+    using SparseBinaryDataDeserializer::SparseBinaryDataDeserializer;
+
+    // The format of data is:
+    // sequence[numSequences], where each sequence consists of:
+    //   varint: numSamples
+    //   varint: nnz for the sequence
+    //   ElemType[nnz]: the values for the sparse sequences
+    //   for each sample in the sequence:
+    //     varint: nnz count for the sample
+    //     varint[nnz count]: the first row offset of the sample, then the differences to the previous one
+    // Every var-int takes at least one byte, so the counts are checked against the rest of the chunk before they are used.
+    size_t GetSequenceDataForChunk(size_t numSequences, void* data, size_t size, std::vector<SequenceDataPtr>& result)
+    {
+        size_t valueSize = SizeOfDataType();
+        const unsigned char* position = (const unsigned char*)data;
+        const unsigned char* end = position + size;
+        result.resize(numSequences);
+        for (size_t i = 0; i < numSequences; i++)
+        {
+            shared_ptr<SparseInputStreamBuffer> sequence = make_shared<SparseInputStreamBuffer>();
+            uint64_t numberOfSamples = ReadVarInt(position, end);
+            uint64_t nnz = ReadVarInt(position, end);
+            if (numberOfSamples > std::numeric_limits<uint32_t>::max())
+                RuntimeError("Sample count %" PRIu64 " in the input '%ls' is too large.", numberOfSamples, m_name.c_str());
+            if (nnz > (uint64_t)std::numeric_limits<SparseIndexType>::max())
+                RuntimeError("NNZ count is too large for an IndexType value.");
+            sequence->m_numberOfSamples = (uint32_t)numberOfSamples;
+            sequence->m_totalNnzCount = (SparseIndexType)nnz;
+
+            // the values, then at least one byte per sample and per row index
+            CheckChunkDataSize(position - (const unsigned char*)data, (valueSize + 1) * nnz + numberOfSamples, size);
+            sequence->m_data = (void*)position;
+            if (NeedsConversion())
+            {
+                ConvertValues(sequence->m_data, sequence->m_totalNnzCount, sequence->m_decodedData);
+                sequence->m_data = sequence->m_decodedData.data();
+            }
+            position += valueSize * sequence->m_totalNnzCount;
+
+            sequence->m_decodedIndices.resize(sequence->m_totalNnzCount);
+            sequence->m_nnzCounts.resize(sequence->m_numberOfSamples);
+            size_t k = 0;
+            for (uint32_t j = 0; j < sequence->m_numberOfSamples; j++)
+            {
+                uint64_t count = ReadVarInt(position, end);
+                if (count > sequence->m_decodedIndices.size() - k)
+                    RuntimeError("The nnz counts of a sequence in the input '%ls' exceed its total nnz count.", m_name.c_str());
+                sequence->m_nnzCounts[j] = (SparseIndexType)count;
+
+                uint64_t index = 0;
+                for (uint64_t l = 0; l < count; l++)
+                {
+                    index += ReadVarInt(position, end);
+                    if (index >= m_sampleDimension)
+                        RuntimeError("Row index %" PRIu64 " in the input '%ls' exceeds the sample dimension %" PRIu32 ".",
+                            index, m_name.c_str(), m_sampleDimension);
+                    sequence->m_decodedIndices[k++] = (SparseIndexType)index;
+                }
+            }
+            if (k != sequence->m_decodedIndices.size())
+                RuntimeError("The nnz counts of a sequence in the input '%ls' do not add up to its total nnz count.", m_name.c_str());
+            sequence->m_indices = sequence->m_decodedIndices.data();
+
+            sequence->m_sampleShape = GetSampleShape();
+            sequence->m_elementType = m_precision;
+            result[i] = sequence;
+        }
+
+        return position - (const unsigned char*)data;
+    }
+
+private:
+    uint64_t ReadVarInt(const unsigned char*& position, const unsigned char* end) const
+    {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            if (position == end)
+                RuntimeError("The chunk data of the input '%ls' is truncated or corrupt.", m_name.c_str());
+            unsigned char current = *position++;
+            value |= uint64_t(current & 0x7f) << shift;
+            if ((current & 0x80) == 0)
+                return value;
+        }
+        RuntimeError("Malformed var-int in a compressed sparse input.");
+    }
+};
+
 }
@@ -33,7 +33,7 @@ CNTKBinaryReader::CNTKBinaryReader(const ConfigParameters& config)
 
         if (configHelper.ShouldKeepDataInMemory())
         {
-            m_deserializer = shared_ptr<DataDeserializer>(new ChunkCache(m_deserializer));
+            m_deserializer = shared_ptr<DataDeserializer>(new ChunkCache(m_deserializer, ChunkCacheConfiguration(config)));
             log << " | keeping data in memory";
         }
 
@@ -45,7 +45,7 @@ CNTKBinaryReader::CNTKBinaryReader(const ConfigParameters& config)
                 << window 
                 << configHelper.UseSampleBasedRandomizationWindow() ? " samples" : " chunks";
             int verbosity = config(L"verbosity", 0);
-            m_sequenceEnumerator = make_shared<BlockRandomizer>(
+            auto randomizer = make_shared<BlockRandomizer>(
                 verbosity, /* verbosity */
                 window,  /* randomizationRangeInSamples */
                 m_deserializer, /* deserializer */
@@ -54,6 +54,8 @@ CNTKBinaryReader::CNTKBinaryReader(const ConfigParameters& config)
                  0, /*maxNumberOfInvalidSequences */
                 configHelper.UseSampleBasedRandomizationWindow() /*sampleBasedRandomizationWindow */,
                 GetRandomSeed(config) /*seedOffset*/);
+            randomizer->SetPrefetchConfiguration(ChunkPrefetchConfiguration(config));
+            m_sequenceEnumerator = randomizer;
         }
         else
         {
@@ -35,19 +35,21 @@ CNTKTextFormatReader::CNTKTextFormatReader(const ConfigParameters& config)
             m_deserializer = make_shared<TextParser<double>>(corpus, configHelper, true);
 
         if (configHelper.ShouldKeepDataInMemory())
-            m_deserializer = make_shared<ChunkCache>(m_deserializer);
+            m_deserializer = make_shared<ChunkCache>(m_deserializer, ChunkCacheConfiguration(config));
 
         size_t window = configHelper.GetRandomizationWindow();
         if (window > 0)
         {
             // TODO: drop "verbosity", use config.traceLevel() instead. 
             int verbosity = config(L"verbosity", 0); 
-            m_sequenceEnumerator = make_shared<BlockRandomizer>(verbosity, window, m_deserializer,
-                                                                /*shouldPrefetch =*/ true,
-                                                                /*multithreadedGetNextSequences =*/ false,
-                                                                /*maxNumberOfInvalidSequences =*/ 0,
-                                                                /*sampleBasedRandomizationWindow =*/ configHelper.UseSampleBasedRandomizationWindow(),
-                                                                /*seedOffset =*/ GetRandomSeed(config));
+            auto randomizer = make_shared<BlockRandomizer>(verbosity, window, m_deserializer,
+                                                           /*shouldPrefetch =*/ true,
+                                                           /*multithreadedGetNextSequences =*/ false,
+                                                           /*maxNumberOfInvalidSequences =*/ 0,
+                                                           /*sampleBasedRandomizationWindow =*/ configHelper.UseSampleBasedRandomizationWindow(),
+                                                           /*seedOffset =*/ GetRandomSeed(config));
+            randomizer->SetPrefetchConfiguration(ChunkPrefetchConfiguration(config));
+            m_sequenceEnumerator = randomizer;
         }
         else
         {
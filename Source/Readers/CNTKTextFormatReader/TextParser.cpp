@@ -7,7 +7,9 @@
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
 #include <cfloat>
+#include <string.h>
 #include "BufferedFileReader.h"
+#include "ExceptionCapture.h"
 #include "IndexBuilder.h"
 #include "TextParser.h"
 #include "TextReaderConstants.h"
@@ -37,6 +39,126 @@ enum State
     Exponent
 };
 
+// Reads a non-empty run of decimal digits starting at pos, advancing pos past it.
+// Produces exactly the value of the 'number = number * 10 + digit' accumulation in
+// TryReadRealNumber: the first 15 digits are accumulated in an integer (below 2^53,
+// so both are exact), any further ones in a double, as in the state machine.
+static inline double ParseDigits(const char*& pos, const char* end, size_t& numDigits)
+{
+    const char* start = pos;
+    const char* limit = (end - pos > 15) ? pos + 15 : end;
+    uint64_t integer = 0;
+    for (; pos < limit && IsDigit(*pos); ++pos)
+        integer = integer * 10 + (*pos - '0');
+
+    double number = static_cast<double>(integer);
+    for (; pos < end && IsDigit(*pos); ++pos)
+        number = number * 10 + (*pos - '0');
+
+    numDigits = pos - start;
+    return number;
+}
+
+// 10^n, computed as the repeated 'divider *= 10' of TryReadRealNumber
+// (the table entries are exact, so only longer fractions need the loop).
+static inline double DecimalDivider(size_t n)
+{
+    static const double powersOf10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const size_t tableSize = sizeof(powersOf10) / sizeof(powersOf10[0]);
+    if (n < tableSize)
+        return powersOf10[n];
+
+    double divider = powersOf10[tableSize - 1];
+    for (size_t i = tableSize - 1; i < n; ++i)
+        divider *= 10;
+    return divider;
+}
+
+// Fast path counterpart of TextParser::TryReadRealNumber: accepts the same grammar, stops at the
+// same character and yields bit-identical values, but works on a memory range and does not
+// produce any diagnostics. The range end is treated like the row delimiter it is followed by.
+template <class ElemType>
+static bool TryParseRealNumber(const char*& pos, const char* end, ElemType& value)
+{
+    const char* p = pos;
+    bool negative = false;
+    if (p < end && isSign(*p))
+    {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    if (p == end || !IsDigit(*p))
+        return false;
+
+    size_t numDigits;
+    double number = ParseDigits(p, end, numDigits);
+    double coefficient;
+
+    if (p < end && *p == '.')
+    {
+        ++p;
+        if (p == end || !IsDigit(*p))
+        {
+            value = static_cast<ElemType>((negative) ? -number : number);
+            pos = p;
+            return true;
+        }
+
+        coefficient = number;
+        number = ParseDigits(p, end, numDigits);
+        coefficient += (number / DecimalDivider(numDigits));
+
+        if (p == end || !isE(*p))
+        {
+            value = static_cast<ElemType>((negative) ? -coefficient : coefficient);
+            pos = p;
+            return true;
+        }
+
+        if (negative)
+            coefficient = -coefficient;
+    }
+    else if (p < end && isE(*p))
+    {
+        coefficient = (negative) ? -number : number;
+    }
+    else
+    {
+        value = static_cast<ElemType>((negative) ? -number : number);
+        pos = p;
+        return true;
+    }
+
+    // exponent: the letter E, followed with optional minus or plus sign and nonempty sequence of decimal digits
+    ++p;
+    negative = false;
+    if (p < end && isSign(*p))
+    {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    if (p == end || !IsDigit(*p))
+        return false;
+
+    number = ParseDigits(p, end, numDigits);
+    double exponent = (negative) ? -number : number;
+    value = static_cast<ElemType>(coefficient * pow(10.0, exponent));
+    pos = p;
+    return true;
+}
+
+// Returns the position of the first name prefix in [pos, end), or end if there is none.
+static inline const char* FindNamePrefix(const char* pos, const char* end)
+{
+    const char* found = static_cast<const char*>(memchr(pos, NAME_PREFIX, end - pos));
+    return found ? found : end;
+}
+
 template <class ElemType>
 class TextParser<ElemType>::TextDataChunk : public Chunk, public std::enable_shared_from_this<Chunk>
 {
@@ -93,7 +215,8 @@ TextParser<ElemType>::TextParser(CorpusDescriptorPtr corpus, const std::wstring&
     m_numRetries(5),
     m_corpus(corpus),
     m_useMaximumAsSequenceLength(true),
-    m_cacheIndex(false)
+    m_cacheIndex(false),
+    m_fastParsing(true)
 {
     assert(streams.size() > 0);
 
@@ -266,10 +389,13 @@ ChunkPtr TextParser<ElemType>::GetChunk(ChunkIdType chunkId)
 
     attempt(m_numRetries, [this, &textChunk, &chunkDescriptor]()
     {
-        if (m_file->CheckError())
         {
-            m_file.reset(new FileWrapper(m_filename, L"rbS"));
-            m_file->CheckIsOpenOrDie();
+            std::lock_guard<std::mutex> lock(m_fileMutex);
+            if (m_file->CheckError())
+            {
+                m_file.reset(new FileWrapper(m_filename, L"rbS"));
+                m_file->CheckIsOpenOrDie();
+            }
         }
 
         LoadChunk(textChunk, chunkDescriptor);
@@ -281,9 +407,51 @@ ChunkPtr TextParser<ElemType>::GetChunk(ChunkIdType chunkId)
 template <class ElemType>
 void TextParser<ElemType>::LoadChunk(TextChunkPtr& chunk, const ChunkDescriptor& descriptor)
 {
-    chunk->m_sequenceMap.resize(descriptor.NumberOfSequences());
-    for (size_t sequenceIndex = 0; sequenceIndex < descriptor.NumberOfSequences(); ++sequenceIndex)
+    const size_t numberOfSequences = descriptor.NumberOfSequences();
+    chunk->m_sequenceMap.resize(numberOfSequences);
+
+    // Sequences that were successfully parsed by the fast path (char instead of bool,
+    // since the entries are written from different threads).
+    std::vector<char> parsed(numberOfSequences, 0);
+
+    // At the 'Info' trace level every sequence is traced, which needs the character-by-character parser.
+    if (m_fastParsing && m_traceLevel < Info && descriptor.SizeInBytes() > 0)
+    {
+        // Read the whole chunk through a separate file handle, so that neither the shared
+        // file reader nor its position are touched, then parse the sequences in parallel.
+        std::vector<char> buffer(descriptor.SizeInBytes());
+        auto file = FileWrapper::OpenOrDie(m_filename, L"rbS");
+        file.SeekOrDie(descriptor.StartOffset(), SEEK_SET);
+        file.ReadOrDie(buffer.data(), buffer.size(), 1);
+
+        auto parseSequence = [this, &chunk, &descriptor, &buffer, &parsed](int sequenceIndex)
+        {
+            const auto& sequenceDescriptor = descriptor.Sequences()[sequenceIndex];
+            size_t offset = sequenceDescriptor.OffsetInChunk(), size = sequenceDescriptor.SizeInBytes();
+            if (offset + size > buffer.size())
+                return;
+
+            parsed[sequenceIndex] = TryParseSequence(buffer.data() + offset, size, sequenceDescriptor, chunk->m_sequenceMap[sequenceIndex]);
+        };
+
+        ExceptionCapture capture;
+#pragma omp parallel for schedule(dynamic)
+        for (int sequenceIndex = 0; sequenceIndex < (int)numberOfSequences; ++sequenceIndex)
+            capture.SafeRun(parseSequence, sequenceIndex);
+        capture.RethrowIfHappened();
+    }
+
+    // Everything the fast path could not handle is re-read sequentially (in the order of the
+    // sequences in the file, so that warnings and error accounting are the same as without it).
+    if (std::find(parsed.begin(), parsed.end(), 0) == parsed.end())
+        return;
+
+    std::lock_guard<std::mutex> lock(m_fileMutex);
+    for (size_t sequenceIndex = 0; sequenceIndex < numberOfSequences; ++sequenceIndex)
     {
+        if (parsed[sequenceIndex])
+            continue;
+
         const auto& sequenceDescriptor = descriptor.Sequences()[sequenceIndex];
         chunk->m_sequenceMap[sequenceIndex] = LoadSequence(sequenceDescriptor, descriptor.StartOffset());
     }
@@ -311,21 +479,7 @@ typename TextParser<ElemType>::SequenceBuffer TextParser<ElemType>::LoadSequence
 
     size_t bytesToRead = sequenceDsc.SizeInBytes();
 
-    SequenceBuffer sequence;
-
-    // TODO: reuse loaded sequences instead of creating new ones!
-    for (auto const & stream : m_streamInfos)
-    {
-        if (stream.m_type == StorageFormat::Dense)
-        {
-            sequence.push_back(make_unique<DenseInputStreamBuffer>(
-                stream.m_sampleShape.Dimensions()[0] * sequenceDsc.m_numberOfSamples, stream.m_sampleShape));
-        }
-        else
-        {
-            sequence.push_back(make_unique<SparseInputStreamBuffer>(stream.m_sampleShape));
-        }
-    }
+    SequenceBuffer sequence = CreateSequenceBuffer(sequenceDsc.m_numberOfSamples);
 
     size_t numRowsRead = 0, expectedRowCount = sequenceDsc.m_numberOfSamples;
     size_t rowNumber = 1;
@@ -433,8 +587,213 @@ typename TextParser<ElemType>::SequenceBuffer TextParser<ElemType>::LoadSequence
     return sequence;
 }
 
+template <class ElemType>
+typename TextParser<ElemType>::SequenceBuffer TextParser<ElemType>::CreateSequenceBuffer(size_t numberOfSamples) const
+{
+    SequenceBuffer sequence;
+
+    // TODO: reuse loaded sequences instead of creating new ones!
+    for (auto const & stream : m_streamInfos)
+    {
+        if (stream.m_type == StorageFormat::Dense)
+        {
+            sequence.push_back(make_unique<DenseInputStreamBuffer>(
+                stream.m_sampleShape.Dimensions()[0] * numberOfSamples, stream.m_sampleShape));
+        }
+        else
+        {
+            sequence.push_back(make_unique<SparseInputStreamBuffer>(stream.m_sampleShape));
+        }
+    }
+    return sequence;
+}
+
+// The checks below mirror the ones in LoadSequence(), TryReadRow() and TryReadSample(),
+// with every warning or error turned into a bail-out.
+template <class ElemType>
+bool TextParser<ElemType>::TryParseSequence(const char* data, size_t size, const SequenceDescriptor& sequenceDsc, SequenceBuffer& sequence) const
+{
+    sequence = CreateSequenceBuffer(sequenceDsc.m_numberOfSamples);
+
+    const char* pos = data;
+    const char* end = data + size;
+    size_t numRowsRead = 0;
+    while (pos < end)
+    {
+        // memchr is vectorized by the C runtime, which makes finding the rows almost free.
+        const char* rowEnd = static_cast<const char*>(memchr(pos, ROW_DELIMITER, end - pos));
+        if (!rowEnd)
+            return false; // a missing trailing newline produces a warning
+
+        if (!TryParseRow(pos, rowEnd, sequence))
+            return false;
+
+        ++numRowsRead;
+        pos = rowEnd + 1;
+    }
+
+    size_t expectedRowCount = sequenceDsc.m_numberOfSamples;
+    if (numRowsRead < expectedRowCount)
+        return false;
+
+    uint32_t overallSequenceLength = 0;
+    for (size_t i = 0; i < sequence.size(); ++i)
+    {
+        if (sequence[i]->m_numberOfSamples == 0)
+            return false;
+
+        if (!m_useMaximumAsSequenceLength && !m_streamDescriptors[i].m_definesMbSize)
+            continue;
+
+        if (sequence[i]->m_numberOfSamples > expectedRowCount)
+            return false;
+
+        overallSequenceLength = max(sequence[i]->m_numberOfSamples, overallSequenceLength);
+    }
+
+    if (overallSequenceLength < expectedRowCount)
+        return false;
+
+    FillSequenceMetadata(sequence, { sequenceDsc.m_key, 0 });
+    return true;
+}
+
+template <class ElemType>
+bool TextParser<ElemType>::TryParseRow(const char* pos, const char* rowEnd, SequenceBuffer& sequence) const
+{
+    // skip sequence ids
+    while (pos < rowEnd && IsDigit(*pos))
+        ++pos;
+
+    size_t numSampleRead = 0;
+    ElemType value;
+
+    while (pos < rowEnd)
+    {
+        if (isColumnDelimiter(*pos))
+        {
+            ++pos;
+            continue;
+        }
+
+        if (*pos != NAME_PREFIX)
+            return false;
+        ++pos;
+
+        if (pos < rowEnd && *pos == ESCAPE_SYMBOL)
+        {
+            // a comment, ignored until the next vertical bar or the end of row.
+            pos = FindNamePrefix(pos + 1, rowEnd);
+            continue;
+        }
+
+        const char* name = pos;
+        while (pos < rowEnd && !isValueDelimiter(*pos) && *pos != NAME_PREFIX && !isNonPrintable(*pos))
+            ++pos;
+
+        size_t nameLength = pos - name;
+        if (nameLength == 0)
+            return false;
+
+        size_t id = 0;
+        while (id < m_streamDescriptors.size() &&
+               (m_streamDescriptors[id].m_alias.length() != nameLength || memcmp(m_streamDescriptors[id].m_alias.data(), name, nameLength) != 0))
+            ++id;
+
+        if (id == m_streamDescriptors.size())
+        {
+            // inputs that are not specified in the config are skipped (silently below the 'Info' trace level).
+            pos = FindNamePrefix(pos, rowEnd);
+            continue;
+        }
+
+        const StreamInfo& stream = m_streamInfos[id];
+        size_t sampleSize = stream.m_sampleShape.Dimensions()[0];
+
+        if (stream.m_type == StorageFormat::Dense)
+        {
+            DenseInputStreamBuffer* data = reinterpret_cast<DenseInputStreamBuffer*>(sequence[id].get());
+            vector<ElemType>& values = data->m_buffer;
+            size_t counter = 0;
+            while (pos < rowEnd)
+            {
+                if (isValueDelimiter(*pos))
+                {
+                    ++pos;
+                    continue;
+                }
+
+                if (isNonPrintable(*pos) || *pos == NAME_PREFIX)
+                    break;
+
+                if (!TryParseRealNumber(pos, rowEnd, value))
+                    return false;
+
+                values.push_back(value);
+                ++counter;
+            }
+
+            // both a sparse suffix and an excess of values produce a warning
+            if (counter != sampleSize)
+                return false;
+
+            ++data->m_numberOfSamples;
+        }
+        else
+        {
+            SparseInputStreamBuffer* data = reinterpret_cast<SparseInputStreamBuffer*>(sequence[id].get());
+            vector<ElemType>& values = data->m_buffer;
+            vector<SparseIndexType>& indices = data->m_indicesBuffer;
+            size_t size = values.size();
+            while (pos < rowEnd)
+            {
+                if (isValueDelimiter(*pos))
+                {
+                    ++pos;
+                    continue;
+                }
+
+                if (isNonPrintable(*pos) || *pos == NAME_PREFIX)
+                    break;
+
+                if (!IsDigit(*pos))
+                    return false;
+
+                size_t index = 0;
+                for (; pos < rowEnd && IsDigit(*pos); ++pos)
+                {
+                    size_t temp = index;
+                    index = index * 10 + (*pos - '0');
+                    if (temp > index)
+                        return false;
+                }
+
+                if (index >= sampleSize || pos == rowEnd || *pos != INDEX_DELIMITER)
+                    return false;
+                ++pos;
+
+                if (!TryParseRealNumber(pos, rowEnd, value))
+                    return false;
+
+                values.push_back(value);
+                indices.push_back(static_cast<SparseIndexType>(index));
+            }
+
+            ++data->m_numberOfSamples;
+            SparseIndexType count = static_cast<SparseIndexType>(values.size() - size);
+            data->m_nnzCounts.push_back(count);
+            data->m_totalNnzCount += count;
+        }
+
+        ++numSampleRead;
+    }
+
+    // empty rows and rows with more samples than inputs produce a warning
+    return numSampleRead > 0 && numSampleRead <= m_streams.size();
+}
+
 template<class ElemType>
-void TextParser<ElemType>::FillSequenceMetadata(SequenceBuffer& sequenceData, const SequenceKey& sequenceKey)
+void TextParser<ElemType>::FillSequenceMetadata(SequenceBuffer& sequenceData, const SequenceKey& sequenceKey) const
 {
     for (size_t j = 0; j < m_streamInfos.size(); ++j)
     {
@@ -1232,6 +1591,12 @@ void TextParser<ElemType>::SetCacheIndex(bool value)
     m_cacheIndex = value;
 }
 
+template <class ElemType>
+void TextParser<ElemType>::SetFastParsing(bool value)
+{
+    m_fastParsing = value;
+}
+
 template<class ElemType>
 inline bool TextParser<ElemType>::CanRead()
 {
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <mutex>
 #include "DataDeserializerBase.h"
 #include "Descriptors.h"
 #include "TextConfigHelper.h"
@@ -38,6 +39,13 @@ public:
 
     bool GetSequenceInfoByKey(const SequenceKey&, SequenceInfo&) override;
 
+    // Chunks are parsed from an in-memory copy, only the fallback to the
+    // character-by-character parser goes through the shared file reader (under a lock).
+    bool SupportsConcurrentChunkLoading() const override
+    {
+        return true;
+    }
+
 private:
     TextParser(CorpusDescriptorPtr corpus, const std::wstring& filename, const vector<StreamDescriptor>& streams, bool primary = true);
 
@@ -110,6 +118,10 @@ private:
     std::shared_ptr<FileWrapper> m_file;
     std::shared_ptr<BufferedFileReader> m_fileReader;
 
+    // Guards the file, the file reader and the error/warning state used by
+    // the character-by-character parser.
+    std::mutex m_fileMutex;
+
     // An internal structure to assist with copying from input stream buffers into
     // into sequence data in a proper format.
     struct StreamInfo;
@@ -133,6 +145,7 @@ private:
     unsigned int m_numAllowedErrors;
     bool m_skipSequenceIds;
     bool m_cacheIndex;
+    bool m_fastParsing; // parse well-formed sequences from memory, in parallel (default: true)
     unsigned int m_numRetries; // specifies the number of times an unsuccessful
                                // file operation should be repeated (default value is 5).
 
@@ -185,11 +198,23 @@ private:
     // retrieves the data for the corresponding sequence from the file.
     SequenceBuffer LoadSequence(const SequenceDescriptor& descriptor, size_t chunkOffset);
 
+    // Creates empty input stream buffers for a sequence with the given number of samples.
+    SequenceBuffer CreateSequenceBuffer(size_t numberOfSamples) const;
+
+    // Fast path: parses a sequence from its in-memory copy [data, data + size).
+    // Returns false if the sequence is not well-formed or would produce a warning, in which
+    // case it has to be re-read with LoadSequence() to get the diagnostics and error accounting.
+    // Does not touch any shared state, so it can be called from several threads.
+    bool TryParseSequence(const char* data, size_t size, const SequenceDescriptor& descriptor, SequenceBuffer& sequence) const;
+
+    // Parses one row [pos, rowEnd) of samples into the sequence, fast path counterpart of TryReadRow().
+    bool TryParseRow(const char* pos, const char* rowEnd, SequenceBuffer& sequence) const;
+
     // Given a descriptor, retrieves the data for the corresponding chunk from the file.
     void LoadChunk(TextChunkPtr& chunk, const ChunkDescriptor& descriptor);
 
     // Fills some metadata members to be conformant to the exposed SequenceData interface.
-    void FillSequenceMetadata(SequenceBuffer& sequenceBuffer, const SequenceKey& sequenceKey);
+    void FillSequenceMetadata(SequenceBuffer& sequenceBuffer, const SequenceKey& sequenceKey) const;
 
     void SetTraceLevel(unsigned int traceLevel);
 
@@ -203,6 +228,8 @@ private:
 
     void SetCacheIndex(bool value);
 
+    void SetFastParsing(bool value);
+
     friend class CNTKTextFormatReaderTestRunner<ElemType>;
 
     DISABLE_COPY_AND_MOVE(TextParser);
@@ -164,8 +164,10 @@ CompositeDataReader::CompositeDataReader(const ConfigParameters& config) :
             }
 
             bool shouldPrefetch = true;
-            m_sequenceEnumerator = std::make_shared<BlockRandomizer>(verbosity, randomizationWindow, deserializer, shouldPrefetch,
+            auto randomizer = std::make_shared<BlockRandomizer>(verbosity, randomizationWindow, deserializer, shouldPrefetch,
                 multiThreadedDeserialization, maxErrors, sampleBasedRandomizationWindow, GetRandomSeed(config));
+            randomizer->SetPrefetchConfiguration(ChunkPrefetchConfiguration(config));
+            m_sequenceEnumerator = randomizer;
         }
         else
             m_sequenceEnumerator = std::make_shared<NoRandomizer>(deserializer, multiThreadedDeserialization, maxErrors);
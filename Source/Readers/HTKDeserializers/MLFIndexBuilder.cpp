@@ -49,30 +49,84 @@ namespace CNTK {
     // Each utterance starts with an utterance key (State::UtteranceKey -> State::UtteranceFrames).
     // End of utterance is indicated by a single dot on a line (State::UtteranceFrames -> State::UtteranceKey)
 
+    // Utterances are indexed in parallel, in ranges of the file that start right after the end of an utterance.
     /*virtual*/ void MLFIndexBuilder::Populate(shared_ptr<Index>& index) /*override*/
     {
         m_input.CheckIsOpenOrDie();
 
-        index->Reserve(filesize(m_input.File()));
+        size_t fileSize = filesize(m_input.File());
+        index->Reserve(fileSize);
 
-        BufferedFileReader reader(m_bufferSize, m_input);
-
-        if (reader.Empty())
+        if (fileSize == 0)
             RuntimeError("Input file is empty");
    
         if (!m_corpus)
             RuntimeError("MLFIndexBuilder: corpus descriptor was not specified.");
 
+        auto boundaries = SplitIntoRanges(0, fileSize, [this](BufferedFileReader& reader, size_t limit) { return FindNextUtteranceStart(reader, limit); });
+
+        vector<vector<Utterance>> utterances(boundaries.size() - 1);
+        IndexRanges(boundaries,
+            [this, &utterances](size_t r, BufferedFileReader& reader, size_t end)
+            {
+                PopulateRange(reader, end, r == 0 ? State::Header : State::UtteranceKey, utterances[r]);
+            },
+            [this, &index, &utterances](size_t r)
+            {
+                IndexedSequence sequence;
+                for (const auto& utterance : utterances[r])
+                {
+                    size_t id = 0;
+                    bool isValid = TryParseSequenceKey(utterance.keyLine, id, m_corpus->KeyToId) && utterance.hasFrames;
+                    if (!utterance.isComplete)
+                        continue;
+
+                    if (isValid)
+                    {
+                        sequence.SetKey(id)
+                            .SetNumberOfSamples(utterance.numberOfSamples)
+                            .SetOffset(utterance.offset)
+                            .SetSize(utterance.size);
+                        index->AddSequence(sequence);
+                    }
+                    else
+                        fprintf(stderr, "WARNING: Cannot parse the utterance '%s' at offset (%" PRIu64 ")\n", m_corpus->IdToKey(id).c_str(), utterance.offset);
+                }
+                vector<Utterance>().swap(utterances[r]);
+            });
+    }
+
+    // Looks for the first line that follows the end of an utterance. A single dot on a line only ends an utterance
+    // if it is not itself the key of the next one, which it could be after another dot or after the header.
+    size_t MLFIndexBuilder::FindNextUtteranceStart(BufferedFileReader& reader, size_t limit) const
+    {
+        string line, previousLine;
+        bool hasPreviousLine = false;
+        while (reader.GetFileOffset() < limit && reader.TryReadLine(line))
+        {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            if (line.empty())
+                continue;
+
+            if (line == "." && hasPreviousLine && previousLine != "." && previousLine != "#!MLF!#")
+                return reader.GetFileOffset();
+
+            previousLine = line;
+            hasPreviousLine = true;
+        }
+        return SIZE_MAX;
+    }
 
-        size_t id = 0;
-        State currentState = State::Header;
+    void MLFIndexBuilder::PopulateRange(BufferedFileReader& reader, size_t end, State initialState, vector<Utterance>& utterances) const
+    {
+        State currentState = initialState;
         vector<boost::iterator_range<char*>> tokens;
-        bool isValid = true; // Flag indicating whether the current sequence is valid.
-        size_t sequenceStartOffset = 0; // Offset in file where current sequence starts.
         string lastNonEmptyLine; // Needed to parse information about last frame
-        IndexedSequence sequence;
         string line;
-        while (true)
+        Utterance utterance{};
+        while (reader.GetFileOffset() < end)
         {
             auto offset = reader.GetFileOffset();
 
@@ -103,8 +157,9 @@ namespace CNTK {
 
                 lastNonEmptyLine.clear();
 
-                sequenceStartOffset = offset;
-                isValid = TryParseSequenceKey(line, id, m_corpus->KeyToId);
+                utterance = Utterance{};
+                utterance.keyLine = line;
+                utterance.offset = offset;
                 currentState = State::UtteranceFrames;
             }
             break;
@@ -121,10 +176,8 @@ namespace CNTK {
                 // Ok, a single . on a line means we found the end of the utterance.
                 auto sequenceEndOffset = reader.GetFileOffset();
 
-                uint32_t numberOfSamples = 0;
-                if (lastNonEmptyLine.empty())
-                    isValid = false;
-                else
+                utterance.hasFrames = !lastNonEmptyLine.empty();
+                if (utterance.hasFrames)
                 {
                     tokens.clear();
                     
@@ -132,19 +185,12 @@ namespace CNTK {
                     Split(&lastNonEmptyLine[0], &lastNonEmptyLine[0] + lastNonEmptyLine.size(), delim, tokens);
 
                     auto range = MLFFrameRange::ParseFrameRange(tokens, sequenceEndOffset);
-                    numberOfSamples = static_cast<uint32_t>(range.second);
+                    utterance.numberOfSamples = static_cast<uint32_t>(range.second);
                 }
 
-                if (isValid)
-                {
-                    sequence.SetKey(id)
-                        .SetNumberOfSamples(numberOfSamples)
-                        .SetOffset(sequenceStartOffset)
-                        .SetSize(sequenceEndOffset - sequenceStartOffset);
-                    index->AddSequence(sequence);
-                }
-                else
-                    fprintf(stderr, "WARNING: Cannot parse the utterance '%s' at offset (%" PRIu64 ")\n", m_corpus->IdToKey(id).c_str(), sequenceStartOffset);
+                utterance.isComplete = true;
+                utterance.size = sequenceEndOffset - utterance.offset;
+                utterances.push_back(move(utterance));
                 currentState = State::UtteranceKey; // Let's try the next one.
             }
             break;
@@ -152,8 +198,11 @@ namespace CNTK {
                 LogicError("Unexpected MLF state.");
             }  
         }
-    }
 
+        // The key of an unterminated utterance at the end of the file is still registered with the corpus.
+        if (currentState == State::UtteranceFrames)
+            utterances.push_back(move(utterance));
+    }
 
     // Tries to parse sequence key
     // In MLF a sequence key should be in quotes. During parsing the extension should be removed.
@@ -28,6 +28,22 @@ namespace CNTK {
             UtteranceFrames
         };
 
+        // An utterance found in a range of the file. Its key is only mapped to an id when the ranges are merged,
+        // so that the ids are assigned in the order of the file.
+        struct Utterance
+        {
+            std::string keyLine;
+            bool hasFrames;
+            bool isComplete; // false if the file ends before the terminating "."
+            uint32_t numberOfSamples;
+            size_t offset;
+            size_t size;
+        };
+
+        void PopulateRange(BufferedFileReader& reader, size_t end, State initialState, std::vector<Utterance>& utterances) const;
+
+        size_t FindNextUtteranceStart(BufferedFileReader& reader, size_t limit) const;
+
         inline bool TryParseSequenceKey(const std::string& line, size_t& id, std::function<size_t(const std::string&)> keyToId);
     };
 
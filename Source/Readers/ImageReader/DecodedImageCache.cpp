@@ -0,0 +1,239 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+
+#include "stdafx.h"
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+#include <algorithm>
+#include <cmath>
+#include <opencv2/opencv.hpp>
+#include "DecodedImageCache.h"
+#include "FileWrapper.h"
+#include "fileutil.h"
+#include "Platform.h"
+#include "TimerUtility.h"
+
+namespace CNTK {
+
+using namespace Microsoft::MSR::CNTK;
+
+namespace {
+
+const uint64_t c_magic = 0x3145484341434d49; // "IMCACHE1"
+const uint32_t c_version = 1;
+
+// Number of images decoded in parallel before they are written to the file.
+const size_t c_imagesPerBatch = 256;
+
+struct Header
+{
+    uint64_t m_magic;
+    uint32_t m_version;
+    uint32_t m_grayscale;
+    uint64_t m_shorterSide;
+    uint64_t m_numberOfImages;
+    uint64_t m_tableOffset;
+};
+
+struct TableEntry
+{
+    uint64_t m_offset;
+    uint32_t m_rows;
+    uint32_t m_cols;
+    uint32_t m_channels;
+    uint32_t m_pathLength;
+};
+
+size_t Aligned(size_t size)
+{
+    return (size + 7) & ~(size_t)7;
+}
+
+void WritePadding(FileWrapper& file, size_t size)
+{
+    static const char zeros[8] = {};
+    if (Aligned(size) != size)
+        file.WriteOrDie(zeros, 1, Aligned(size) - size);
+}
+
+}
+
+DecodedImageCache::DecodedImageCache(const std::wstring& filename, size_t shorterSide, bool grayscale,
+                                     const std::vector<std::string>& paths, const Decoder& decode, int verbosity)
+    : m_filename(filename), m_shorterSide(shorterSide), m_grayscale(grayscale), m_verbosity(verbosity)
+{
+    if (TryOpen())
+        return;
+
+    Build(paths, decode);
+    if (!TryOpen())
+        RuntimeError("Decoded image cache '%ls' could not be opened after it has been built.", m_filename.c_str());
+}
+
+cv::Mat DecodedImageCache::Get(const std::string& path) const
+{
+    auto image = m_images.find(path);
+    if (image == m_images.end())
+        return cv::Mat();
+
+    const Image& i = image->second;
+    size_t size = (size_t)i.m_rows * i.m_cols * i.m_channels;
+    auto data = m_file->GetView(i.m_offset, size);
+    return cv::Mat(i.m_rows, i.m_cols, CV_8UC(i.m_channels), const_cast<char*>(data));
+}
+
+bool DecodedImageCache::TryOpen()
+{
+    m_images.clear();
+    m_file.reset();
+
+    if (!fexists(m_filename.c_str()))
+        return false;
+
+    m_file = std::make_shared<MemoryMappedFile>(m_filename);
+    if (m_file->Size() < sizeof(Header))
+    {
+        fprintf(stderr, "WARNING: Decoded image cache '%ls' is truncated, it will be rebuilt.\n", m_filename.c_str());
+        m_file.reset();
+        return false;
+    }
+
+    const Header& header = *reinterpret_cast<const Header*>(m_file->Data());
+    if (header.m_magic != c_magic || header.m_version != c_version)
+    {
+        fprintf(stderr, "WARNING: '%ls' is not a decoded image cache of the current version, it will be rebuilt.\n", m_filename.c_str());
+        m_file.reset();
+        return false;
+    }
+
+    if ((header.m_grayscale != 0) != m_grayscale || header.m_shorterSide != m_shorterSide)
+    {
+        fprintf(stderr, "WARNING: Decoded image cache '%ls' was built with grayscale = %d and shorter side %" PRIu64 ", "
+                "expected grayscale = %d and shorter side %" PRIu64 ", it will be rebuilt.\n",
+                m_filename.c_str(), (int)header.m_grayscale, header.m_shorterSide, (int)m_grayscale, (uint64_t)m_shorterSide);
+        m_file.reset();
+        return false;
+    }
+
+    uint64_t offset = header.m_tableOffset;
+    m_images.reserve((size_t)header.m_numberOfImages);
+    for (uint64_t i = 0; i < header.m_numberOfImages; ++i)
+    {
+        const auto& entry = *reinterpret_cast<const TableEntry*>(m_file->GetView(offset, sizeof(TableEntry)));
+        offset += sizeof(TableEntry);
+        const char* path = m_file->GetView(offset, entry.m_pathLength);
+        offset += Aligned(entry.m_pathLength);
+
+        // Checks that the pixels are inside of the file, so that Get() does not fail later.
+        m_file->GetView(entry.m_offset, (size_t)entry.m_rows * entry.m_cols * entry.m_channels);
+        m_images[std::string(path, entry.m_pathLength)] = Image{ entry.m_offset, (int)entry.m_rows, (int)entry.m_cols, (int)entry.m_channels };
+    }
+
+    if (m_verbosity > 0)
+        fprintf(stderr, "DecodedImageCache: Using %d decoded images from '%ls'.\n", (int)m_images.size(), m_filename.c_str());
+    return true;
+}
+
+void DecodedImageCache::Build(const std::vector<std::string>& paths, const Decoder& decode)
+{
+    Timer timer;
+    timer.Start();
+
+    // Several workers of a distributed job can build the same cache at the same time,
+    // so each writes its own temporary file and replaces the cache when it is complete.
+    std::wstring tempFilename = m_filename + L".tmp" + std::to_wstring(GetCurrentProcessId());
+    std::vector<TableEntry> entries;
+    std::vector<size_t> pathIndices;
+    size_t numberOfFailures = 0;
+    {
+        auto file = FileWrapper::OpenOrDie(tempFilename, L"wb");
+
+        Header header = {};
+        file.WriteOrDie(&header, sizeof(header), 1);
+        uint64_t offset = sizeof(Header);
+
+        std::vector<cv::Mat> images;
+        for (size_t begin = 0; begin < paths.size(); begin += c_imagesPerBatch)
+        {
+            size_t end = std::min(begin + c_imagesPerBatch, paths.size());
+            images.assign(end - begin, cv::Mat());
+
+#pragma omp parallel for schedule(dynamic)
+            for (int i = 0; i < (int)images.size(); ++i)
+            {
+                cv::Mat image;
+                try
+                {
+                    image = decode(begin + i);
+                }
+                catch (const std::exception&)
+                {
+                    // Not cached, the deserializer reports the error when the image is read.
+                    continue;
+                }
+
+                if (!image.data || image.depth() != CV_8U)
+                    continue;
+
+                int side = std::min(image.rows, image.cols);
+                if (m_shorterSide > 0 && (size_t)side > m_shorterSide)
+                {
+                    double scale = (double)m_shorterSide / side;
+                    cv::Size size((int)std::round(image.cols * scale), (int)std::round(image.rows * scale));
+                    cv::resize(image, image, size, 0, 0, cv::INTER_AREA);
+                }
+
+                images[i] = image.isContinuous() ? image : image.clone();
+            }
+
+            for (size_t i = 0; i < images.size(); ++i)
+            {
+                const cv::Mat& image = images[i];
+                if (!image.data)
+                {
+                    numberOfFailures++;
+                    continue;
+                }
+
+                size_t size = image.total() * image.elemSize();
+                file.WriteOrDie(image.data, 1, size);
+                WritePadding(file, size);
+
+                entries.push_back(TableEntry{ offset, (uint32_t)image.rows, (uint32_t)image.cols, (uint32_t)image.channels(), (uint32_t)paths[begin + i].size() });
+                pathIndices.push_back(begin + i);
+                offset += Aligned(size);
+            }
+        }
+
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            file.WriteOrDie(&entries[i], sizeof(TableEntry), 1);
+            const auto& path = paths[pathIndices[i]];
+            file.WriteOrDie(path.data(), 1, path.size());
+            WritePadding(file, path.size());
+        }
+
+        header.m_magic = c_magic;
+        header.m_version = c_version;
+        header.m_grayscale = m_grayscale ? 1 : 0;
+        header.m_shorterSide = m_shorterSide;
+        header.m_numberOfImages = entries.size();
+        header.m_tableOffset = offset;
+        file.SeekOrDie(0, SEEK_SET);
+        file.WriteOrDie(&header, sizeof(header), 1);
+        file.FlushOrDie();
+    }
+
+    renameOrDie(tempFilename, m_filename);
+
+    timer.Stop();
+    if (m_verbosity > 0 || numberOfFailures > 0)
+    {
+        fprintf(stderr, "DecodedImageCache: Decoded %d images into '%ls' in %.6g seconds, %d images could not be decoded.\n",
+                (int)entries.size(), m_filename.c_str(), timer.ElapsedSeconds(), (int)numberOfFailures);
+    }
+}
+
+}
@@ -0,0 +1,73 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <opencv2/core/mat.hpp>
+#include "MemoryMappedFile.h"
+
+namespace CNTK {
+
+// A file with already decoded (and optionally downscaled) images, so that images do not have to be decoded
+// again every time they are read. The file is built on first use from all images of the map file and is
+// memory mapped afterwards; it can be shared between epochs, runs and the workers of a distributed job.
+//
+// Layout of the file, all parts are 8 byte aligned:
+//     header: magic, version, grayscale flag, shorter side the images were resized to (0 - original size),
+//             number of images, offset of the image table
+//     pixels of all images, as continuous 8 bit HWC (BGR) data
+//     image table: offset of the pixels, rows, columns, channels, path length, path - for every image
+// A file that was built for a different grayscale or shorter side setting is rebuilt.
+class DecodedImageCache
+{
+public:
+    // Decodes the image with the given index; returns an empty matrix if the image cannot be decoded.
+    typedef std::function<cv::Mat(size_t index)> Decoder;
+
+    // Opens the cache file, or builds it from the given images if it does not exist or does not match
+    // the configuration. Images with a shorter side longer than 'shorterSide' are downscaled to it (0 - keep the
+    // original size); smaller images are not upscaled.
+    DecodedImageCache(const std::wstring& filename, size_t shorterSide, bool grayscale,
+                      const std::vector<std::string>& paths, const Decoder& decode, int verbosity);
+
+    // Returns the image, or an empty matrix if it is not in the cache.
+    // The matrix refers to the read-only mapping of the file, so it has to be copied before it is modified.
+    cv::Mat Get(const std::string& path) const;
+
+    size_t NumberOfImages() const
+    {
+        return m_images.size();
+    }
+
+private:
+    struct Image
+    {
+        uint64_t m_offset;
+        int m_rows;
+        int m_cols;
+        int m_channels;
+    };
+
+    // Maps the file and reads its image table; returns false if the file does not exist or does not match.
+    bool TryOpen();
+
+    void Build(const std::vector<std::string>& paths, const Decoder& decode);
+
+    std::wstring m_filename;
+    size_t m_shorterSide;
+    bool m_grayscale;
+    int m_verbosity;
+
+    MemoryMappedFilePtr m_file;
+    std::unordered_map<std::string, Image> m_images;
+
+    DISABLE_COPY_AND_MOVE(DecodedImageCache);
+};
+
+}
@@ -73,6 +73,8 @@ extern "C" DATAREADER_API bool CreateTransformer(Transformer** transformer, cons
         *transformer = new TransposeTransformer(config);
     else if (type == L"Cast")
         *transformer = new CastTransformer(config);
+    else if (type == L"CropScaleMeanTranspose")
+        *transformer = new CropScaleMeanTransposeTransformer(config);
     else
         // Unknown type.
         return false;
@@ -64,6 +64,7 @@ private:
 ImageDataDeserializer::ImageDataDeserializer(CorpusDescriptorPtr corpus, const ConfigParameters& config, bool primary) : ImageDeserializerBase(corpus, config, primary)
 {
     CreateSequenceDescriptions(corpus, config(L"file"), m_labelGenerator->LabelDimension(), m_multiViewCrop);
+    CreateDecodedImageCache(config);
 }
 
 // TODO: Should be removed at some point.
@@ -110,6 +111,7 @@ ImageDataDeserializer::ImageDataDeserializer(const ConfigParameters& config)
     }
 
     CreateSequenceDescriptions(std::make_shared<CorpusDescriptor>(false), configHelper.GetMapPath(), labelDimension, configHelper.IsMultiViewCrop());
+    CreateDecodedImageCache(config);
 }
 
 // Descriptions of chunks exposed by the image reader.
@@ -232,6 +234,34 @@ void ImageDataDeserializer::CreateSequenceDescriptions(CorpusDescriptorPtr corpu
     }
 }
 
+void ImageDataDeserializer::CreateDecodedImageCache(const ConfigParameters& config)
+{
+    std::wstring filename = config(L"decodedImageCacheFile", L"");
+    if (filename.empty())
+        return;
+
+    // Each image is decoded once, also when it is used by several sequences or copies.
+    std::vector<std::string> paths;
+    std::vector<size_t> sequenceIds;
+    std::unordered_map<std::string, size_t> knownPaths;
+    for (const auto& s : m_imageSequences)
+    {
+        if (knownPaths.emplace(s.m_path, paths.size()).second)
+        {
+            paths.push_back(s.m_path);
+            sequenceIds.push_back(s.m_key.m_sequence);
+        }
+    }
+
+    size_t shorterSide = config(L"decodedImageCacheShorterSide", (size_t)0);
+    auto decode = [this, &paths, &sequenceIds](size_t index)
+    {
+        return ReadImage(sequenceIds[index], paths[index], m_grayscale);
+    };
+
+    m_decodedImageCache = std::make_unique<DecodedImageCache>(filename, shorterSide, m_grayscale, paths, decode, m_verbosity);
+}
+
 ChunkPtr ImageDataDeserializer::GetChunk(ChunkIdType chunkId)
 {
     auto sequenceDescription = m_imageSequences[chunkId];
@@ -284,6 +314,14 @@ cv::Mat ImageDataDeserializer::ReadImage(size_t seqId, const std::string& path,
 {
     assert(!path.empty());
 
+    if (m_decodedImageCache && grayscale == m_grayscale)
+    {
+        auto image = m_decodedImageCache->Get(path);
+        // The image is copied out of the read-only mapping, because transforms modify images in place.
+        if (image.data)
+            return image.clone();
+    }
+
     ImageDataDeserializer::SeqReaderMap::const_iterator r;
     if (m_readers.empty() || (r = m_readers.find(seqId)) == m_readers.end())
         return m_defaultReader->Read(seqId, path, grayscale);
@@ -10,6 +10,7 @@
 #include "ByteReader.h"
 #include <unordered_map>
 #include "CorpusDescriptor.h"
+#include "DecodedImageCache.h"
 
 namespace CNTK {
 
@@ -44,6 +45,9 @@ private:
     // Creates a set of sequence descriptions.
     void CreateSequenceDescriptions(CorpusDescriptorPtr corpus, std::string mapPath, size_t labelDimension, bool isMultiCrop);
 
+    // Opens (or builds) the decoded image cache if 'decodedImageCacheFile' is specified in the config.
+    void CreateDecodedImageCache(const ConfigParameters& config);
+
     // Image sequence descriptions. Currently, a sequence contains a single sample only.
     struct ImageSequenceDescription : public SequenceInfo
     {
@@ -68,6 +72,9 @@ private:
     SeqReaderMap m_readers;
 
     std::unique_ptr<FileByteReader> m_defaultReader;
+
+    // Already decoded images; null if the cache is not used.
+    std::unique_ptr<DecodedImageCache> m_decodedImageCache;
 };
 
 }
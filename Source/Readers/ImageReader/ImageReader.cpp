@@ -63,16 +63,32 @@ ImageReader::ImageReader(const ConfigParameters& config)
     std::wstring featureName = m_streams[configHelper.GetFeatureStreamId()].m_name;
     ConfigParameters featureStream = config(featureName);
 
-    std::vector<Transformation> transformations;
-    transformations.push_back(Transformation{ std::make_shared<CropTransformer>(featureStream), featureName });
-    transformations.push_back(Transformation{ std::make_shared<ScaleTransformer>(featureStream), featureName });
-    transformations.push_back(Transformation{ std::make_shared<ColorTransformer>(featureStream), featureName });
-    transformations.push_back(Transformation{ std::make_shared<IntensityTransformer>(featureStream), featureName });
-    transformations.push_back(Transformation{ std::make_shared<MeanTransformer>(featureStream), featureName });
+    // Color and intensity jittering are no-ops unless they are configured.
+    double brightnessRadius = featureStream(L"brightnessRadius", "0.0");
+    double contrastRadius = featureStream(L"contrastRadius", "0.0");
+    double saturationRadius = featureStream(L"saturationRadius", "0.0");
+    double intensityStdDev = featureStream(L"intensityStdDev", "0.0");
+    std::wstring intensityFile = featureStream(L"intensityFile", L"");
+    bool jitter = brightnessRadius != 0.0 || contrastRadius != 0.0 || saturationRadius != 0.0 || (intensityStdDev != 0.0 && !intensityFile.empty());
 
-    if (configHelper.GetDataFormat() == CHW)
+    std::vector<Transformation> transformations;
+    if (configHelper.GetDataFormat() == CHW && !jitter)
+    {
+        // Same result as the separate transforms below, in a single pass over the scaled image.
+        transformations.push_back(Transformation{ std::make_shared<CropScaleMeanTransposeTransformer>(featureStream), featureName });
+    }
+    else
     {
-        transformations.push_back(Transformation{ std::make_shared<TransposeTransformer>(featureStream), featureName });
+        transformations.push_back(Transformation{ std::make_shared<CropTransformer>(featureStream), featureName });
+        transformations.push_back(Transformation{ std::make_shared<ScaleTransformer>(featureStream), featureName });
+        transformations.push_back(Transformation{ std::make_shared<ColorTransformer>(featureStream), featureName });
+        transformations.push_back(Transformation{ std::make_shared<IntensityTransformer>(featureStream), featureName });
+        transformations.push_back(Transformation{ std::make_shared<MeanTransformer>(featureStream), featureName });
+
+        if (configHelper.GetDataFormat() == CHW)
+        {
+            transformations.push_back(Transformation{ std::make_shared<TransposeTransformer>(featureStream), featureName });
+        }
     }
 
     // We should always have cast at the end. 
@@ -423,18 +423,18 @@ void ScaleTransformer::Apply(uint8_t, cv::Mat &mat)
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-MeanTransformer::MeanTransformer(const ConfigParameters& config) : ImageTransformerBase(config)
+// Reads the mean image from the 'meanFile', returns an empty image if no mean file is specified.
+static cv::Mat ReadMeanImage(const ConfigParameters& config)
 {
+    cv::Mat meanImg;
     std::wstring meanFile = config(L"meanFile", L"");
-    if (meanFile.empty())
-        m_meanImg.release();
-    else
+    if (!meanFile.empty())
     {
         cv::FileStorage fs;
         fs.open(msra::strfun::utf8(meanFile).c_str(), cv::FileStorage::READ);
         if (!fs.isOpened())
             RuntimeError("Could not open file: %ls", meanFile.c_str());
-        fs["MeanImg"] >> m_meanImg;
+        fs["MeanImg"] >> meanImg;
         int cchan;
         fs["Channel"] >> cchan;
         int crow;
@@ -442,11 +442,17 @@ MeanTransformer::MeanTransformer(const ConfigParameters& config) : ImageTransfor
         int ccol;
         fs["Col"] >> ccol;
         if (cchan * crow * ccol !=
-            m_meanImg.channels() * m_meanImg.rows * m_meanImg.cols)
+            meanImg.channels() * meanImg.rows * meanImg.cols)
             RuntimeError("Invalid data in file: %ls", meanFile.c_str());
         fs.release();
-        m_meanImg = m_meanImg.reshape(cchan, crow);
+        meanImg = meanImg.reshape(cchan, crow);
     }
+    return meanImg;
+}
+
+MeanTransformer::MeanTransformer(const ConfigParameters& config) : ImageTransformerBase(config)
+{
+    m_meanImg = ReadMeanImage(config);
 }
 
 void MeanTransformer::Apply(uint8_t, cv::Mat &mat)
@@ -595,6 +601,116 @@ SequenceDataPtr TransposeTransformer::TypedTranspose<TElementTo>::Apply(ImageSeq
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+CropScaleMeanTransposeTransformer::CropScaleMeanTransposeTransformer(const ConfigParameters& config) : TransformBase(config),
+    m_crop(std::make_shared<CropTransformer>(config)), m_scale(std::make_shared<ScaleTransformer>(config)),
+    m_floatTransform(this), m_doubleTransform(this)
+{
+    cv::Mat meanImg = ReadMeanImage(config);
+    if (!meanImg.empty())
+        meanImg.convertTo(m_meanImg, CV_32F);
+}
+
+void CropScaleMeanTransposeTransformer::StartEpoch(const EpochConfiguration& config)
+{
+    m_crop->StartEpoch(config);
+    m_scale->StartEpoch(config);
+}
+
+// The output is the CHW image of the size requested by the Scale transform, in the required precision.
+StreamInformation CropScaleMeanTransposeTransformer::Transform(const StreamInformation& inputStream)
+{
+    TransformBase::Transform(inputStream);
+    auto scaled = m_scale->Transform(m_crop->Transform(inputStream));
+
+    ImageDimensions dimensions(TensorShape(scaled.m_sampleLayout.Dimensions()), HWC);
+    if (!m_meanImg.empty() &&
+        (m_meanImg.cols != (int)dimensions.m_width || m_meanImg.rows != (int)dimensions.m_height || m_meanImg.channels() != (int)dimensions.m_numChannels))
+    {
+        fprintf(stderr, "WARNING: Mean file does not match the size of the input image, will be ignored.\n"
+            "Please remove mean transformation from the config.\n");
+        m_meanImg.release();
+    }
+
+    auto dims = dimensions.AsTensorShape(CHW).GetDims();
+    m_outputStream.m_sampleLayout = NDShape(std::vector<size_t>(dims.begin(), dims.end()));
+    m_outputStream.m_elementType = m_precision;
+    return m_outputStream;
+}
+
+SequenceDataPtr CropScaleMeanTransposeTransformer::Transform(SequenceDataPtr sequence)
+{
+    auto scaled = m_scale->Transform(m_crop->Transform(sequence));
+    auto inputSequence = static_cast<ImageSequenceData*>(scaled.get());
+
+    if (m_precision == DataType::Float)
+        return Apply(m_floatTransform, *inputSequence);
+    return Apply(m_doubleTransform, *inputSequence);
+}
+
+template <class TElementTo>
+SequenceDataPtr CropScaleMeanTransposeTransformer::Apply(TypedTransform<TElementTo>& transform, const ImageSequenceData& inputSequence)
+{
+    switch (inputSequence.m_image.depth())
+    {
+    case CV_8U:
+        return transform.template Apply<unsigned char>(inputSequence);
+    case CV_32F:
+        return transform.template Apply<float>(inputSequence);
+    case CV_64F:
+        return transform.template Apply<double>(inputSequence);
+    default:
+        RuntimeError("Unsupported image type %d in stream '%ls'.", inputSequence.m_image.depth(), m_inputStream.m_name.c_str());
+    }
+    return nullptr; // Make compiler happy
+}
+
+template <class TElementTo>
+template <class TElementFrom>
+SequenceDataPtr CropScaleMeanTransposeTransformer::TypedTransform<TElementTo>::Apply(const ImageSequenceData& inputSequence)
+{
+    assert(inputSequence.m_numberOfSamples == 1);
+
+    const cv::Mat& image = inputSequence.m_image;
+    size_t rows = image.rows;
+    size_t cols = image.cols;
+    size_t channels = image.channels();
+    size_t planeSize = rows * cols;
+
+    auto dims = ImageDimensions(cols, rows, channels).AsTensorShape(CHW).GetDims();
+    NDShape resultShape(std::vector<size_t>(dims.begin(), dims.end()));
+    auto result = std::make_shared<DenseSequenceWithBuffer<TElementTo>>(m_memBuffers, planeSize * channels, resultShape);
+    result->m_key = inputSequence.m_key;
+    result->m_numberOfSamples = inputSequence.m_numberOfSamples;
+
+    // Row by row, so that a row of the image stays in cache while it is written to all channel planes.
+    // The inner loops have no dependencies between iterations and are vectorized by the compiler.
+    const cv::Mat& mean = m_parent->m_meanImg;
+    TElementTo* dst = result->GetBuffer();
+    for (size_t i = 0; i < rows; ++i)
+    {
+        const TElementFrom* x = image.ptr<TElementFrom>((int)i);
+        const float* m = mean.empty() ? nullptr : mean.ptr<float>((int)i);
+        for (size_t c = 0; c < channels; ++c)
+        {
+            TElementTo* y = dst + c * planeSize + i * cols;
+            if (m)
+            {
+                for (size_t j = 0; j < cols; ++j)
+                    y[j] = static_cast<TElementTo>(x[j * channels + c]) - static_cast<TElementTo>(m[j * channels + c]);
+            }
+            else
+            {
+                for (size_t j = 0; j < cols; ++j)
+                    y[j] = static_cast<TElementTo>(x[j * channels + c]);
+            }
+        }
+    }
+
+    return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 IntensityTransformer::IntensityTransformer(const ConfigParameters &config) : ImageTransformerBase(config)
 {
     m_stdDev = config(L"intensityStdDev", "0.0");
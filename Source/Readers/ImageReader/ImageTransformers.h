@@ -205,6 +205,51 @@ private:
     TypedTranspose<double> m_doubleTransform;
 };
 
+// Crop, scale, mean subtraction, transposition from HWC to CHW and cast to the output precision as a single transform.
+// Crop and scale are done by the Crop and Scale transforms on the decoded (usually 8 bit) image. The remaining steps are
+// a single pass over the scaled image that writes the pooled output buffer, instead of converting the image to
+// floating point, subtracting the mean image and transposing it as separate passes with temporary images.
+// The result is the same as of the sequence of Crop, Scale, Mean, Transpose and Cast transforms with the same config.
+class CropScaleMeanTransposeTransformer : public TransformBase
+{
+public:
+    explicit CropScaleMeanTransposeTransformer(const Microsoft::MSR::CNTK::ConfigParameters& config);
+
+    void StartEpoch(const EpochConfiguration& config) override;
+
+    // Transformation of the stream.
+    StreamInformation Transform(const StreamInformation& inputStream) override;
+
+    // Transformation of the sequence.
+    SequenceDataPtr Transform(SequenceDataPtr sequence) override;
+
+private:
+    // A helper class writes images to a set of typed memory buffers.
+    template <class TElementTo>
+    struct TypedTransform
+    {
+        CropScaleMeanTransposeTransformer* m_parent;
+
+        TypedTransform(CropScaleMeanTransposeTransformer* parent) : m_parent(parent) {}
+
+        template <class TElementFrom>
+        SequenceDataPtr Apply(const ImageSequenceData& inputSequence);
+        Microsoft::MSR::CNTK::conc_stack<std::vector<TElementTo>> m_memBuffers;
+    };
+
+    template <class TElementTo>
+    SequenceDataPtr Apply(TypedTransform<TElementTo>& transform, const ImageSequenceData& inputSequence);
+
+    TransformerPtr m_crop;
+    TransformerPtr m_scale;
+
+    // Single precision mean image, empty if there is no mean file.
+    cv::Mat m_meanImg;
+
+    TypedTransform<float> m_floatTransform;
+    TypedTransform<double> m_doubleTransform;
+};
+
 // Intensity jittering based on PCA transform as described in original AlexNet paper
 // (http://papers.nips.cc/paper/4824-imagenet-classification-with-deep-convolutional-neural-networks.pdf)
 // Currently uses precomputed values from 
@@ -9,13 +9,22 @@
 #include <inttypes.h>
 #include "BlockRandomizer.h"
 #include <algorithm>
+#include <chrono>
 #include <utility>
 
 #include "DataReader.h"
+#include "DataDeserializerBase.h"
 #include "ExceptionCapture.h"
 
 namespace CNTK {
 
+ChunkPrefetchConfiguration::ChunkPrefetchConfiguration(const ConfigParameters& config)
+{
+    m_depth = config(L"prefetchDepth", (size_t)1);
+    m_numThreads = config(L"prefetchThreads", (size_t)0);
+    m_memoryBudget = (size_t)config(L"prefetchMemoryBudgetInMB", (size_t)0) * 1024 * 1024;
+}
+
 BlockRandomizer::BlockRandomizer(
     int verbosity,
     size_t randomizationRange,
@@ -34,9 +43,9 @@ BlockRandomizer::BlockRandomizer(
       m_sweepSizeInSamples(0),
       m_chunkRandomizer(std::make_shared<ChunkRandomizer>(deserializer, randomizationRange, sampleBasedRandomizationWindow)),
       m_multithreadedGetNextSequences(multithreadedGetNextSequence),
-      m_prefetchedChunk(ChunkIdMax),
       m_cleaner(maxNumberOfInvalidSequences),
-      m_seedOffset(seedOffset)
+      m_seedOffset(seedOffset),
+      m_bytesPerSample(0)
 {
     assert(deserializer != nullptr);
 
@@ -45,6 +54,19 @@ BlockRandomizer::BlockRandomizer(
     m_streams = m_deserializer->StreamInfos();
     m_sequenceRandomizer = std::make_shared<SequenceRandomizer>(verbosity, m_deserializer, m_chunkRandomizer);
 
+    auto deserializerBase = std::dynamic_pointer_cast<DataDeserializerBase>(m_deserializer);
+    m_concurrentChunkLoading = deserializerBase && deserializerBase->SupportsConcurrentChunkLoading();
+
+    // Estimate the memory of a sample for the prefetch budget. Sparse streams are counted with one non-zero value per sample.
+    for (const auto& stream : m_streams)
+    {
+        size_t elementSize = stream.m_elementType == DataType::Double ? sizeof(double) : sizeof(float);
+        if (stream.m_storageFormat == StorageFormat::Dense && !stream.m_sampleLayout.IsUnknown() && !stream.m_sampleLayout.HasUnboundDimension())
+            m_bytesPerSample += stream.m_sampleLayout.TotalSize() * elementSize;
+        else
+            m_bytesPerSample += elementSize + sizeof(int32_t);
+    }
+
     // Calculate total number of samples.
     m_sweepSizeInSamples = 0;
     for (auto const & chunk : m_deserializer->ChunkInfos())
@@ -61,6 +83,10 @@ std::map<std::wstring, size_t> BlockRandomizer::GetState()
 // Start a new epoch.
 void BlockRandomizer::StartEpoch(const EpochConfiguration& config)
 {
+    if (m_verbosity >= Notification)
+        PrintPrefetchStatistics();
+    m_prefetchStatistics = ChunkPrefetchStatistics();
+
     m_currentWindowRange = ClosedOpenChunkInterval{};
 
     m_config = config;
@@ -234,8 +260,7 @@ std::pair<size_t, size_t> BlockRandomizer::LoadSequenceData(size_t globalSampleC
     }
 
     // Now it is safe to start the new chunk prefetch.
-    ChunkIdType chunkToPrefetchNext = GetChunkToPrefetch(windowRange);
-    Prefetch(chunkToPrefetchNext);
+    Prefetch(GetChunksToPrefetch(windowRange));
 
     return { numGlobalSamples, numLocalSamples };
 }
@@ -395,31 +420,14 @@ void BlockRandomizer::LoadDataChunks(const ClosedOpenChunkInterval& windowRange)
         }
 
         auto const& chunk = m_chunkRandomizer->GetRandomizedChunks()[i];
-        if (chunk.m_original->m_id == m_prefetchedChunk && m_prefetch.valid())
-        {
-            // Taking prefetched chunk.
-            m_chunks[chunk.m_original->m_id] = m_prefetch.get();
-            if (m_verbosity >= Information)
-                fprintf(stderr, "BlockRandomizer::RetrieveDataChunks: paged in prefetched chunk %u (original chunk: %u), now %" PRIu64 " chunks in memory\n",
-                chunk.m_chunkId,
-                chunk.m_original->m_id,
-                ++numLoadedChunks);
-        }
-        else
-        {
-            // Make sure we have no outstanding prefetches.
-            if (m_prefetch.valid())
-            {
-                m_prefetch.wait();
-            }
-
-            m_chunks[chunk.m_original->m_id] = m_deserializer->GetChunk(chunk.m_original->m_id);
-            if (m_verbosity >= Information)
-                fprintf(stderr, "BlockRandomizer::RetrieveDataChunks: paged in randomized chunk %u (original chunk: %u), now %" PRIu64 " chunks in memory\n",
-                chunk.m_chunkId,
-                chunk.m_original->m_id,
-                ++numLoadedChunks);
-        }
+        bool prefetched;
+        m_chunks[chunk.m_original->m_id] = GetChunk(chunk.m_original->m_id, prefetched);
+        if (m_verbosity >= Information)
+            fprintf(stderr, "BlockRandomizer::RetrieveDataChunks: paged in %s chunk %u (original chunk: %u), now %" PRIu64 " chunks in memory\n",
+            prefetched ? "prefetched" : "randomized",
+            chunk.m_chunkId,
+            chunk.m_original->m_id,
+            ++numLoadedChunks);
     }
 
     if (m_verbosity >= Notification)
@@ -429,45 +437,216 @@ void BlockRandomizer::LoadDataChunks(const ClosedOpenChunkInterval& windowRange)
                 m_chunkRandomizer->GetRandomizedChunks()[windowRange.m_end - 1].m_chunkId);
 }
 
-// Identifies chunk id that should be prefetched.
-ChunkIdType BlockRandomizer::GetChunkToPrefetch(const ClosedOpenChunkInterval& windowRange)
+// Identifies chunks that should be prefetched, in the order in which they will be needed.
+std::vector<const ChunkInfo*> BlockRandomizer::GetChunksToPrefetch(const ClosedOpenChunkInterval& windowRange)
 {
-    ChunkIdType toBePrefetched = ChunkIdMax;
-    auto current = windowRange.m_end;
-    while (current < m_chunkRandomizer->GetRandomizedChunks().size())
+    std::vector<const ChunkInfo*> toBePrefetched;
+    size_t estimatedSize = 0;
+    const auto& chunks = m_chunkRandomizer->GetRandomizedChunks();
+    for (auto current = windowRange.m_end; current < chunks.size() && toBePrefetched.size() < m_prefetchConfig.m_depth; ++current)
     {
-        const auto& chunk = m_chunkRandomizer->GetRandomizedChunks()[current];
-        if (chunk.m_chunkId % m_config.m_numberOfWorkers == m_config.m_workerRank &&
-            m_chunks.find(chunk.m_original->m_id) == m_chunks.end())
+        const auto& chunk = chunks[current];
+        if (chunk.m_chunkId % m_config.m_numberOfWorkers != m_config.m_workerRank ||
+            m_chunks.find(chunk.m_original->m_id) != m_chunks.end())
         {
-            toBePrefetched = chunk.m_original->m_id;
-            break;
+            continue;
         }
-        ++current;
+
+        size_t chunkSize = EstimateChunkSize(*chunk.m_original);
+        if (!toBePrefetched.empty() && m_prefetchConfig.m_memoryBudget != 0 && estimatedSize + chunkSize > m_prefetchConfig.m_memoryBudget)
+            break;
+
+        estimatedSize += chunkSize;
+        toBePrefetched.push_back(chunk.m_original);
     }
     return toBePrefetched;
 }
 
-// Performs io prefetch of the specified chunk if needed.
-void BlockRandomizer::Prefetch(ChunkIdType chunkId)
+// Performs io prefetch of the specified chunks if needed.
+void BlockRandomizer::Prefetch(const std::vector<const ChunkInfo*>& chunks)
 {
-    // Start new prefetch if necessary.
-    if (m_prefetchedChunk != chunkId && chunkId != ChunkIdMax)
+    // Keep the prefetches that are still needed, in the new order.
+    std::deque<PrefetchedChunk> prefetch;
+    for (auto chunk : chunks)
     {
-        // Wait to make sure there is no outstanding prefetches.
-        if (m_prefetch.valid())
+        auto it = std::find_if(m_prefetch.begin(), m_prefetch.end(), [chunk](const PrefetchedChunk& p) { return p.m_chunkId == chunk->m_id; });
+        if (it != m_prefetch.end())
         {
-            m_prefetch.wait();
+            prefetch.push_back(std::move(*it));
+            m_prefetch.erase(it);
         }
+    }
+
+    // The rest is not needed anymore (e.g. a new sweep has started).
+    // Loads that are already running have to finish, since they use the deserializer.
+    for (auto& p : m_prefetch)
+    {
+        if (!TakePendingLoad(p.m_chunkId) && m_launchType == launch::async)
+            p.m_chunk.wait();
+    }
+    m_prefetch.swap(prefetch);
 
-        m_prefetchedChunk = chunkId;
-        m_prefetch = std::async(m_launchType, [this, chunkId]() { return m_deserializer->GetChunk(chunkId); });
+    // Start new prefetches.
+    for (auto chunk : chunks)
+    {
+        ChunkIdType chunkId = chunk->m_id;
+        auto it = std::find_if(m_prefetch.begin(), m_prefetch.end(), [chunkId](const PrefetchedChunk& p) { return p.m_chunkId == chunkId; });
+        if (it != m_prefetch.end())
+            continue;
+
+        PrefetchedChunk p;
+        p.m_chunkId = chunkId;
+        p.m_estimatedSize = EstimateChunkSize(*chunk);
+        if (m_prefetchThreads)
+        {
+            auto result = std::make_shared<std::promise<ChunkPtr>>();
+            p.m_chunk = result->get_future();
+            {
+                std::lock_guard<std::mutex> lock(m_pendingLoadsMutex);
+                m_pendingLoads.push_back(PendingLoad{ chunkId, result });
+            }
+            m_prefetchThreads->Submit([this]() { RunNextPendingLoad(); });
+        }
+        else
+        {
+            p.m_chunk = std::async(m_launchType, [this, chunkId]() { return LoadChunk(chunkId); });
+        }
+        m_prefetch.push_back(std::move(p));
 
         if (m_verbosity >= Debug)
             fprintf(stderr, "BlockRandomizer::Prefetch: prefetching original chunk: %u\n", chunkId);
     }
 }
 
+void BlockRandomizer::RunNextPendingLoad()
+{
+    PendingLoad load;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingLoadsMutex);
+        if (m_pendingLoads.empty())
+            return; // taken by the consumer or cancelled
+        load = m_pendingLoads.front();
+        m_pendingLoads.pop_front();
+    }
+
+    try
+    {
+        load.m_result->set_value(LoadChunk(load.m_chunkId));
+    }
+    catch (...)
+    {
+        load.m_result->set_exception(std::current_exception());
+    }
+}
+
+bool BlockRandomizer::TakePendingLoad(ChunkIdType chunkId)
+{
+    std::lock_guard<std::mutex> lock(m_pendingLoadsMutex);
+    auto it = std::find_if(m_pendingLoads.begin(), m_pendingLoads.end(), [chunkId](const PendingLoad& l) { return l.m_chunkId == chunkId; });
+    if (it == m_pendingLoads.end())
+        return false;
+    m_pendingLoads.erase(it);
+    return true;
+}
+
+ChunkPtr BlockRandomizer::LoadChunk(ChunkIdType chunkId)
+{
+    if (m_concurrentChunkLoading)
+        return m_deserializer->GetChunk(chunkId);
+
+    std::lock_guard<std::mutex> lock(m_loadChunkMutex);
+    return m_deserializer->GetChunk(chunkId);
+}
+
+ChunkPtr BlockRandomizer::GetChunk(ChunkIdType chunkId, bool& prefetched)
+{
+    auto start = std::chrono::steady_clock::now();
+    auto it = std::find_if(m_prefetch.begin(), m_prefetch.end(), [chunkId](const PrefetchedChunk& p) { return p.m_chunkId == chunkId; });
+
+    ChunkPtr chunk;
+    bool stalled;
+    // A prefetch that has not started yet is faster done here than waited for.
+    prefetched = it != m_prefetch.end() && !TakePendingLoad(chunkId);
+    if (prefetched)
+    {
+        // a deferred prefetch (no io prefetch) is only executed here
+        stalled = it->m_chunk.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+        chunk = it->m_chunk.get();
+        m_prefetchStatistics.m_numPrefetchedChunks++;
+    }
+    else
+    {
+        stalled = true;
+        chunk = LoadChunk(chunkId);
+        m_prefetchStatistics.m_numSynchronousChunks++;
+    }
+
+    if (it != m_prefetch.end())
+        m_prefetch.erase(it);
+
+    if (stalled)
+    {
+        m_prefetchStatistics.m_numStalls++;
+        m_prefetchStatistics.m_stallTimeInSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    return chunk;
+}
+
+void BlockRandomizer::CancelPrefetch()
+{
+    for (auto& p : m_prefetch)
+    {
+        if (!TakePendingLoad(p.m_chunkId) && m_launchType == launch::async)
+            p.m_chunk.wait();
+    }
+    m_prefetch.clear();
+}
+
+size_t BlockRandomizer::EstimateChunkSize(const ChunkInfo& chunk) const
+{
+    return chunk.m_numberOfSamples * m_bytesPerSample;
+}
+
+void BlockRandomizer::PrintPrefetchStatistics() const
+{
+    const auto& stats = m_prefetchStatistics;
+    if (stats.m_numPrefetchedChunks + stats.m_numSynchronousChunks == 0)
+        return;
+
+    fprintf(stderr, "BlockRandomizer: %" PRIu64 " chunks prefetched, %" PRIu64 " loaded on demand; waited for %" PRIu64 " chunks for %.3f seconds\n",
+            stats.m_numPrefetchedChunks,
+            stats.m_numSynchronousChunks,
+            stats.m_numStalls,
+            stats.m_stallTimeInSeconds);
+}
+
+void BlockRandomizer::SetPrefetchConfiguration(const ChunkPrefetchConfiguration& config)
+{
+    CancelPrefetch();
+    m_prefetchThreads.reset();
+
+    m_prefetchConfig = config;
+    m_prefetchConfig.m_depth = std::max<size_t>(m_prefetchConfig.m_depth, 1);
+    // Without io prefetch, chunks are loaded when they are needed.
+    if (m_launchType != launch::async)
+        m_prefetchConfig.m_depth = 1;
+
+    if (m_prefetchConfig.m_depth > 1)
+    {
+        size_t numThreads = m_prefetchConfig.m_numThreads != 0 ? m_prefetchConfig.m_numThreads : m_prefetchConfig.m_depth;
+        // Loads are serialized if the deserializer does not support concurrent loading, so one thread does.
+        if (!m_concurrentChunkLoading)
+            numThreads = 1;
+        m_prefetchThreads.reset(new Microsoft::MSR::CNTK::WorkStealingThreadPool(std::min(numThreads, m_prefetchConfig.m_depth)));
+    }
+
+    if (m_verbosity >= Notification && m_prefetchConfig.m_depth > 1)
+        fprintf(stderr, "BlockRandomizer: prefetching up to %" PRIu64 " chunks on %" PRIu64 " threads%s\n",
+                m_prefetchConfig.m_depth,
+                m_prefetchThreads->NumThreads(),
+                m_concurrentChunkLoading ? "" : " (chunks are loaded one at a time)");
+}
+
 void BlockRandomizer::SetState(const std::map<std::wstring, size_t>& state)
 {
     auto it = state.find(g_minibatchSourcePosition);
@@ -12,10 +12,40 @@
 #include "ChunkRandomizer.h"
 #include "SequenceRandomizer.h"
 #include "ReaderUtil.h"
+#include "WorkStealingThreadPool.h"
+#include <deque>
 #include <future>
+#include <mutex>
 
 namespace CNTK {
 
+// Configuration of the chunk prefetch of the BlockRandomizer.
+struct ChunkPrefetchConfiguration
+{
+    ChunkPrefetchConfiguration() = default;
+
+    // Reads 'prefetchDepth', 'prefetchThreads' and 'prefetchMemoryBudgetInMB'.
+    explicit ChunkPrefetchConfiguration(const ConfigParameters& config);
+
+    // Number of chunks following the randomization window that are loaded ahead of time.
+    size_t m_depth = 1;
+    // Number of threads loading chunks; 0 means one per chunk of m_depth.
+    // Chunks are only loaded concurrently if the deserializer supports it (see DataDeserializerBase).
+    size_t m_numThreads = 0;
+    // Limit for the estimated size of chunks that are prefetched but not yet used, in bytes; 0 means no limit.
+    // At least one chunk is always prefetched.
+    size_t m_memoryBudget = 0;
+};
+
+// Time spent by the consumer waiting for chunks, i.e. the time that was not hidden by the prefetch.
+struct ChunkPrefetchStatistics
+{
+    size_t m_numPrefetchedChunks = 0;    // chunks taken from the prefetch
+    size_t m_numSynchronousChunks = 0;   // chunks that had to be loaded on demand
+    size_t m_numStalls = 0;              // chunks the consumer had to wait for
+    double m_stallTimeInSeconds = 0;
+};
+
 // A randomizer that firstly randomizes chunks and then sequences inside a rolling window of chunks.
 // Uses ChunkRandomizer to randomize chunk descriptions and SequenceRandomizer to randomize sequence descriptions inside a window of chunks.
 // It requires only a window of sequence descriptions and corresponding chunk data.
@@ -65,16 +95,20 @@ public:
 
     ~BlockRandomizer()
     {
-        if (m_prefetch.valid())
-        {
-            m_prefetch.wait();
-        }
+        CancelPrefetch();
     }
 
     void SetState(const std::map<std::wstring, size_t>& state) override;
 
     void SetConfiguration(const ReaderConfiguration& config) override;
 
+    // Sets up an N-deep chunk prefetch. Must be called before the first epoch is started.
+    // Has no effect if the randomizer was created without prefetch.
+    void SetPrefetchConfiguration(const ChunkPrefetchConfiguration& config);
+
+    // Statistics accumulated since the start of the current epoch.
+    const ChunkPrefetchStatistics& GetPrefetchStatistics() const { return m_prefetchStatistics; }
+
 private:
     // Load data for chunks if needed.
     void LoadDataChunks(const ClosedOpenChunkInterval& windowRange);
@@ -97,11 +131,32 @@ private:
     // Prepares a new sweep if needed.
     void PrepareNewSweepIfNeeded(size_t samplePosition);
 
-    // Performs io prefetch of the specified chunk if needed.
-    void Prefetch(ChunkIdType chunkId);
+    // Performs io prefetch of the specified chunks if needed, in the given order.
+    void Prefetch(const std::vector<const ChunkInfo*>& chunks);
+
+    // Returns the next candidates for the prefetch after the given range, not exceeding the prefetch depth and memory budget.
+    std::vector<const ChunkInfo*> GetChunksToPrefetch(const ClosedOpenChunkInterval& windowRange);
+
+    // Loads the chunk from the deserializer, serializing the calls if the deserializer requires it.
+    ChunkPtr LoadChunk(ChunkIdType chunkId);
+
+    // Takes the given chunk from the prefetch or loads it, accounting for the time spent waiting.
+    ChunkPtr GetChunk(ChunkIdType chunkId, bool& prefetched);
 
-    // Returns next candidate for the prefetch in the given range.
-    ChunkIdType GetChunkToPrefetch(const ClosedOpenChunkInterval& windowRange);
+    // Waits for all outstanding prefetches and drops them.
+    void CancelPrefetch();
+
+    // Executed by the prefetch threads: loads the first chunk of m_pendingLoads.
+    // Taking the first one keeps the order of loads independent of the scheduling of the thread pool.
+    void RunNextPendingLoad();
+
+    // Removes the chunk from m_pendingLoads if its load has not started yet.
+    bool TakePendingLoad(ChunkIdType chunkId);
+
+    // Estimated size of a chunk in memory.
+    size_t EstimateChunkSize(const ChunkInfo& chunk) const;
+
+    void PrintPrefetchStatistics() const;
 
     // Global sample position on the timeline.
     size_t m_globalSamplePosition;
@@ -153,12 +208,33 @@ private:
 
     int m_verbosity;
 
-    // Prefetch future.
-    std::future<ChunkPtr> m_prefetch;
+    // A chunk that is loaded ahead of time.
+    struct PrefetchedChunk
+    {
+        ChunkIdType m_chunkId; // original chunk id
+        size_t m_estimatedSize;
+        std::future<ChunkPtr> m_chunk;
+    };
+
+    // Outstanding prefetches, in the order in which the chunks will be needed.
+    std::deque<PrefetchedChunk> m_prefetch;
     // Whether to have async or deferred prefetch.
     launch m_launchType;
-    // Prefetched original chunk id.
-    ChunkIdType m_prefetchedChunk;
+    ChunkPrefetchConfiguration m_prefetchConfig;
+    ChunkPrefetchStatistics m_prefetchStatistics;
+    // Whether the deserializer can load several chunks concurrently; otherwise GetChunk() calls are serialized.
+    bool m_concurrentChunkLoading;
+    std::mutex m_loadChunkMutex;
+    // Prefetches on m_prefetchThreads that have not started yet.
+    struct PendingLoad
+    {
+        ChunkIdType m_chunkId;
+        std::shared_ptr<std::promise<ChunkPtr>> m_result;
+    };
+    std::deque<PendingLoad> m_pendingLoads;
+    std::mutex m_pendingLoadsMutex;
+    // Estimated size of one sample in memory, summed over all streams.
+    size_t m_bytesPerSample;
 
     // Current loaded chunks.
     ClosedOpenChunkInterval m_currentWindowRange;
@@ -168,6 +244,9 @@ private:
 
     // Helper class for removing invalid sequences.
     SequenceCleaner m_cleaner;
+
+    // Threads for deep prefetch (m_prefetchConfig.m_depth > 1). Declared last, so that it is destroyed first.
+    std::unique_ptr<Microsoft::MSR::CNTK::WorkStealingThreadPool> m_prefetchThreads;
 };
 
 }
@@ -7,6 +7,7 @@
 #include "Bundler.h"
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
+#include <map>
 #include <set>
 
 namespace CNTK {
@@ -260,11 +261,12 @@ public:
             m_innerChunks[currentIndex] = drivingChunk;
         }
 
-        // Creating sequence mapping and requiring underlying chunks.
+        // Creating sequence mapping and collecting the underlying chunks.
+        std::vector<std::map<ChunkIdType, ChunkPtr>> secondaryChunks(deserializers.size());
+        std::vector<ChunkIdType> secondaryChunkIds(m_innerChunks.size());
         SequenceInfo s;
         for (size_t deserializerIndex = 1; deserializerIndex < deserializers.size(); ++deserializerIndex)
         {
-            auto& chunkTable = m_parent->m_weakChunkTable[deserializerIndex];
             for (size_t sequenceIndex = 0; sequenceIndex < sequences.size(); ++sequenceIndex)
             {
                 if (chunk.m_invalid.find(sequenceIndex) != chunk.m_invalid.end())
@@ -275,15 +277,54 @@ public:
                 size_t currentIndex = sequenceIndex * deserializers.size() + deserializerIndex;
                 deserializers[deserializerIndex]->GetSequenceInfo(sequences[sequenceIndex], s);
                 m_sequenceToSequence[currentIndex] = s.m_indexInChunk;
+                secondaryChunkIds[currentIndex] = s.m_chunkId;
+                secondaryChunks[deserializerIndex][s.m_chunkId] = nullptr;
+            }
+        }
+
+        // Requiring underlying chunks.
+        // Secondary chunks are shared between bundling chunks that are loaded concurrently. The table of loaded chunks
+        // is only locked to look them up and to publish them, so that loads of different chunks can overlap.
+        {
+            std::lock_guard<std::mutex> lock(m_parent->m_weakChunkTableMutex);
+            for (size_t deserializerIndex = 1; deserializerIndex < deserializers.size(); ++deserializerIndex)
+                for (auto& secondaryChunk : secondaryChunks[deserializerIndex])
+                    secondaryChunk.second = m_parent->m_weakChunkTable[deserializerIndex][secondaryChunk.first].lock();
+        }
+
+        for (size_t deserializerIndex = 1; deserializerIndex < deserializers.size(); ++deserializerIndex)
+            for (auto& secondaryChunk : secondaryChunks[deserializerIndex])
+                if (!secondaryChunk.second)
+                    secondaryChunk.second = deserializers[deserializerIndex]->GetChunk(secondaryChunk.first);
+
+        {
+            // If another bundling chunk has published the same chunk in the meantime, that one is used instead.
+            std::lock_guard<std::mutex> lock(m_parent->m_weakChunkTableMutex);
+            for (size_t deserializerIndex = 1; deserializerIndex < deserializers.size(); ++deserializerIndex)
+            {
+                auto& chunkTable = m_parent->m_weakChunkTable[deserializerIndex];
+                for (auto& secondaryChunk : secondaryChunks[deserializerIndex])
+                {
+                    ChunkPtr published = chunkTable[secondaryChunk.first].lock();
+                    if (published)
+                        secondaryChunk.second = published;
+                    else
+                        chunkTable[secondaryChunk.first] = secondaryChunk.second;
+                }
+            }
+        }
 
-                ChunkPtr secondaryChunk = chunkTable[s.m_chunkId].lock();
-                if (!secondaryChunk)
+        for (size_t deserializerIndex = 1; deserializerIndex < deserializers.size(); ++deserializerIndex)
+        {
+            for (size_t sequenceIndex = 0; sequenceIndex < sequences.size(); ++sequenceIndex)
+            {
+                if (chunk.m_invalid.find(sequenceIndex) != chunk.m_invalid.end())
                 {
-                    secondaryChunk = deserializers[deserializerIndex]->GetChunk(s.m_chunkId);
-                    chunkTable[s.m_chunkId] = secondaryChunk;
+                    continue;
                 }
 
-                m_innerChunks[currentIndex] = secondaryChunk;
+                size_t currentIndex = sequenceIndex * deserializers.size() + deserializerIndex;
+                m_innerChunks[currentIndex] = secondaryChunks[deserializerIndex][secondaryChunkIds[currentIndex]];
             }
         }
     }
@@ -307,4 +348,15 @@ ChunkPtr Bundler::GetChunk(ChunkIdType chunkId)
     return std::make_shared<BundlingChunk>(m_streams.size(), this, chunkId);
 }
 
+bool Bundler::SupportsConcurrentChunkLoading() const
+{
+    for (const auto& d : m_deserializers)
+    {
+        auto deserializer = std::dynamic_pointer_cast<DataDeserializerBase>(d);
+        if (!deserializer || !deserializer->SupportsConcurrentChunkLoading())
+            return false;
+    }
+    return true;
+}
+
 }
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <set>
 #include "DataDeserializerBase.h"
 #include "Config.h"
@@ -28,6 +29,9 @@ public:
     // Gets a chunk with data.
     virtual ChunkPtr GetChunk(ChunkIdType chunkId) override;
 
+    // Chunks can be loaded concurrently if all underlying deserializers allow it.
+    virtual bool SupportsConcurrentChunkLoading() const override;
+
 private:
     DISABLE_COPY_AND_MOVE(Bundler);
 
@@ -69,6 +73,7 @@ private:
     // A table of loaded chunks to make sure we do not load same chunk twice.
     // Inner vector is the table of chunk id into weak pointer, the outer vector has an element per deserializer.
     std::vector<std::vector<std::weak_ptr<Chunk>>> m_weakChunkTable;
+    std::mutex m_weakChunkTableMutex;
 
     // General configuration
     int m_verbosity;
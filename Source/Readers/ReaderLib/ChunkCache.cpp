@@ -5,22 +5,440 @@
 
 #define _CRT_SECURE_NO_WARNINGS
 
+#include <cstring>
 #include "ChunkCache.h"
+#include "FileWrapper.h"
+#include "Platform.h"
 
 namespace CNTK {
 
+using namespace std;
+
+ChunkCacheConfiguration::ChunkCacheConfiguration(const ConfigParameters& config)
+{
+    m_maxSizeInBytes = (size_t)config(L"chunkCacheSizeInMB", (size_t)0) * 1024 * 1024;
+    m_spillDirectory = (wstring)config(L"chunkCacheSpillDirectory", L"");
+}
+
+// A copy of all sequences of a chunk in a single buffer. The buffer is also the format
+// of the spill file:
+//     header: magic, number of sequences, number of streams, index in chunk of every sequence
+//     a record for every sequence and stream: RecordHeader, sample shape dimensions,
+//         [nnz counts, indices (sparse only)], data.
+// All parts are 8 byte aligned.
+class ChunkCache::CachedChunk : public Chunk, public enable_shared_from_this<ChunkCache::CachedChunk>
+{
+public:
+    // Copies the sequences of the chunk.
+    CachedChunk(Chunk& chunk, const vector<SequenceInfo>& sequences, const vector<StreamInformation>& streams)
+        : m_sequences(sequences), m_numberOfStreams(streams.size())
+    {
+        Append(s_magic);
+        Append((uint64_t)sequences.size());
+        Append((uint64_t)m_numberOfStreams);
+        for (const auto& s : sequences)
+            Append((uint64_t)s.m_indexInChunk);
+
+        vector<SequenceDataPtr> data;
+        for (const auto& s : sequences)
+        {
+            data.clear();
+            chunk.GetSequence(s.m_indexInChunk, data);
+            if (data.size() != m_numberOfStreams)
+                LogicError("Chunk returned %zu streams for a sequence, %zu were expected.", data.size(), m_numberOfStreams);
+
+            for (size_t i = 0; i < m_numberOfStreams; ++i)
+                AppendRecord(*data[i], streams[i]);
+        }
+
+        m_buffer.shrink_to_fit();
+        Parse();
+    }
+
+    // Takes a buffer previously produced by the other constructor.
+    CachedChunk(vector<char>&& buffer, const vector<SequenceInfo>& sequences)
+        : m_sequences(sequences), m_buffer(move(buffer))
+    {
+        if (m_buffer.size() < 3 * sizeof(uint64_t) || *reinterpret_cast<uint64_t*>(m_buffer.data()) != s_magic)
+            RuntimeError("Spilled chunk has an unexpected format.");
+        m_numberOfStreams = (size_t)reinterpret_cast<uint64_t*>(m_buffer.data())[2];
+        Parse();
+    }
+
+    virtual void GetSequence(size_t sequenceIndex, vector<SequenceDataPtr>& result) override
+    {
+        if (sequenceIndex >= m_positions.size() || m_positions[sequenceIndex] == SIZE_MAX)
+            LogicError("Sequence %zu is not part of the cached chunk.", sequenceIndex);
+
+        auto self = shared_from_this();
+        const size_t* offsets = &m_records[m_positions[sequenceIndex] * m_numberOfStreams];
+        for (size_t i = 0; i < m_numberOfStreams; ++i)
+            result.push_back(CreateSequenceData(offsets[i], self));
+    }
+
+    virtual void SequenceInfos(vector<SequenceInfo>& result) override
+    {
+        result.insert(result.end(), m_sequences.begin(), m_sequences.end());
+    }
+
+    const vector<char>& Buffer() const { return m_buffer; }
+
+    size_t SizeInBytes() const
+    {
+        return m_buffer.size() + m_records.size() * sizeof(size_t) + m_positions.size() * sizeof(size_t) +
+            m_sequences.size() * sizeof(SequenceInfo);
+    }
+
+private:
+    static const uint64_t s_magic = 0x31454843434b4e43; // "CNKCCHE1"
+
+    struct RecordHeader
+    {
+        uint64_t m_keySequence;
+        uint32_t m_keySample;
+        uint32_t m_numberOfSamples;
+        uint32_t m_isValid;
+        uint32_t m_elementType;
+        uint32_t m_isSparse;
+        uint32_t m_rank;
+        uint64_t m_totalNnzCount;
+        uint64_t m_dataSize;
+    };
+
+    struct CachedDenseSequenceData : DenseSequenceData
+    {
+        const NDShape& GetSampleShape() override { return m_sampleShape; }
+        const void* GetDataBuffer() override { return m_data; }
+
+        NDShape m_sampleShape;
+        const void* m_data;
+        shared_ptr<CachedChunk> m_chunk; // keeps the data alive
+    };
+
+    struct CachedSparseSequenceData : SparseSequenceData
+    {
+        const NDShape& GetSampleShape() override { return m_sampleShape; }
+        const void* GetDataBuffer() override { return m_data; }
+
+        NDShape m_sampleShape;
+        const void* m_data;
+        shared_ptr<CachedChunk> m_chunk; // keeps the data alive
+    };
+
+    static size_t Aligned(size_t size) { return (size + 7) & ~(size_t)7; }
+
+    template <class T>
+    void Append(const T& value)
+    {
+        Append(&value, sizeof(T));
+    }
+
+    void Append(const void* data, size_t size)
+    {
+        size_t offset = m_buffer.size();
+        m_buffer.resize(offset + Aligned(size));
+        if (size > 0)
+            memcpy(m_buffer.data() + offset, data, size);
+    }
+
+    void AppendRecord(SequenceDataBase& sequence, const StreamInformation& stream)
+    {
+        RecordHeader header = {};
+        header.m_keySequence = sequence.m_key.m_sequence;
+        header.m_keySample = sequence.m_key.m_sample;
+        header.m_numberOfSamples = sequence.m_numberOfSamples;
+        header.m_isValid = sequence.m_isValid;
+        header.m_elementType = (uint32_t)(sequence.m_elementType != DataType::Unknown ? sequence.m_elementType : stream.m_elementType);
+        header.m_isSparse = stream.m_storageFormat != StorageFormat::Dense;
+
+        const auto& dimensions = sequence.GetSampleShape().Dimensions();
+        header.m_rank = (uint32_t)dimensions.size();
+
+        auto sparse = header.m_isSparse ? static_cast<SparseSequenceData*>(&sequence) : nullptr;
+        if (sequence.m_isValid)
+        {
+            size_t elementSize = DataTypeSize((DataType)header.m_elementType);
+            if (sparse)
+            {
+                header.m_totalNnzCount = sparse->m_totalNnzCount;
+                header.m_dataSize = header.m_totalNnzCount * elementSize;
+            }
+            else
+                header.m_dataSize = sequence.m_numberOfSamples * sequence.GetSampleShape().TotalSize() * elementSize;
+        }
+
+        Append(header);
+        for (auto d : dimensions)
+            Append((uint64_t)d);
+
+        if (!sequence.m_isValid)
+            return;
+
+        if (sparse)
+        {
+            if (sparse->m_nnzCounts.size() != sequence.m_numberOfSamples)
+                LogicError("Sparse sequence has %zu nnz counts for %u samples.", sparse->m_nnzCounts.size(), sequence.m_numberOfSamples);
+            Append(sparse->m_nnzCounts.data(), sparse->m_nnzCounts.size() * sizeof(SparseIndexType));
+            Append(sparse->m_indices, header.m_totalNnzCount * sizeof(SparseIndexType));
+        }
+        Append(sequence.GetDataBuffer(), header.m_dataSize);
+    }
+
+    // Finds the records in the buffer.
+    void Parse()
+    {
+        const uint64_t* header = reinterpret_cast<const uint64_t*>(m_buffer.data());
+        size_t numberOfSequences = (size_t)header[1];
+        if (numberOfSequences != m_sequences.size())
+            RuntimeError("Cached chunk has %zu sequences, %zu were expected.", numberOfSequences, m_sequences.size());
+
+        const uint64_t* indices = header + 3;
+        size_t offset = (3 + numberOfSequences) * sizeof(uint64_t);
+        m_records.resize(numberOfSequences * m_numberOfStreams);
+        for (size_t i = 0; i < numberOfSequences; ++i)
+        {
+            if (indices[i] >= m_positions.size())
+                m_positions.resize(indices[i] + 1, SIZE_MAX);
+            m_positions[indices[i]] = i;
+
+            for (size_t j = 0; j < m_numberOfStreams; ++j)
+            {
+                if (offset + sizeof(RecordHeader) > m_buffer.size())
+                    RuntimeError("Cached chunk is truncated.");
+
+                m_records[i * m_numberOfStreams + j] = offset;
+                const auto& record = *reinterpret_cast<const RecordHeader*>(m_buffer.data() + offset);
+                offset += sizeof(RecordHeader) + record.m_rank * sizeof(uint64_t);
+                if (record.m_isValid && record.m_isSparse)
+                    offset += Aligned(record.m_numberOfSamples * sizeof(SparseIndexType)) + Aligned(record.m_totalNnzCount * sizeof(SparseIndexType));
+                if (record.m_isValid)
+                    offset += Aligned(record.m_dataSize);
+            }
+        }
+
+        if (offset != m_buffer.size())
+            RuntimeError("Cached chunk has an unexpected size.");
+    }
+
+    SequenceDataPtr CreateSequenceData(size_t offset, const shared_ptr<CachedChunk>& self)
+    {
+        char* p = m_buffer.data() + offset;
+        const auto& record = *reinterpret_cast<const RecordHeader*>(p);
+        p += sizeof(RecordHeader);
+
+        const uint64_t* d = reinterpret_cast<const uint64_t*>(p);
+        NDShape shape(vector<size_t>(d, d + record.m_rank));
+        p += record.m_rank * sizeof(uint64_t);
+
+        SequenceDataPtr result;
+        if (record.m_isSparse)
+        {
+            auto sparse = make_shared<CachedSparseSequenceData>();
+            sparse->m_sampleShape = shape;
+            sparse->m_data = nullptr;
+            if (record.m_isValid)
+            {
+                auto nnzCounts = reinterpret_cast<const SparseIndexType*>(p);
+                sparse->m_nnzCounts.assign(nnzCounts, nnzCounts + record.m_numberOfSamples);
+                p += Aligned(record.m_numberOfSamples * sizeof(SparseIndexType));
+                sparse->m_indices = reinterpret_cast<SparseIndexType*>(p);
+                sparse->m_totalNnzCount = (SparseIndexType)record.m_totalNnzCount;
+                p += Aligned(record.m_totalNnzCount * sizeof(SparseIndexType));
+                sparse->m_data = p;
+            }
+            sparse->m_chunk = self;
+            result = sparse;
+        }
+        else
+        {
+            auto dense = make_shared<CachedDenseSequenceData>();
+            dense->m_sampleShape = shape;
+            dense->m_data = record.m_isValid ? p : nullptr;
+            dense->m_chunk = self;
+            result = dense;
+        }
+
+        result->m_numberOfSamples = record.m_numberOfSamples;
+        result->m_isValid = record.m_isValid != 0;
+        result->m_elementType = (DataType)record.m_elementType;
+        result->m_key = SequenceKey((size_t)record.m_keySequence, record.m_keySample);
+        return result;
+    }
+
+    vector<SequenceInfo> m_sequences;
+    size_t m_numberOfStreams;
+    vector<char> m_buffer;
+    vector<size_t> m_records;   // offset of every record, by position of the sequence and stream
+    vector<size_t> m_positions; // position of the sequence by its index in chunk
+
+    DISABLE_COPY_AND_MOVE(CachedChunk);
+};
+
+// Append() takes the magic by reference, so it needs a definition.
+const uint64_t ChunkCache::CachedChunk::s_magic;
+
+ChunkCache::ChunkCache(DataDeserializerPtr deserializer, const ChunkCacheConfiguration& configuration)
+    : m_deserializer(deserializer), m_configuration(configuration)
+{
+    if (!m_configuration.m_spillDirectory.empty() && m_configuration.m_maxSizeInBytes == 0)
+        InvalidArgument("Chunk cache spill directory '%ls' requires a cache size limit (chunkCacheSizeInMB).",
+                        m_configuration.m_spillDirectory.c_str());
+}
+
+ChunkCache::~ChunkCache()
+{
+    for (const auto& entry : m_entries)
+    {
+        if (!entry.second.m_spillFile.empty())
+            _wunlink(entry.second.m_spillFile.c_str());
+    }
+}
+
 ChunkPtr ChunkCache::GetChunk(ChunkIdType chunkId)
 {
+    if (m_configuration.m_maxSizeInBytes > 0)
+        return GetBoundedChunk(chunkId);
+
     auto it = m_chunkMap.find(chunkId);
     if (it != m_chunkMap.end())
     {
         return it->second;
     }
- 
+
     ChunkPtr chunk = m_deserializer->GetChunk(chunkId);
     m_chunkMap[chunkId] = chunk;
- 
+
     return chunk;
 }
 
+ChunkCache::Statistics ChunkCache::GetStatistics() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_statistics;
+}
+
+// The lock only protects the cache state: loading the chunk and the spill file I/O happen outside of it,
+// so that concurrent requests for other chunks are not blocked.
+ChunkPtr ChunkCache::GetBoundedChunk(ChunkIdType chunkId)
+{
+    wstring spillFile;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto& entry = m_entries[chunkId];
+        if (entry.m_chunk)
+        {
+            m_statistics.m_numHits++;
+            m_lru.splice(m_lru.begin(), m_lru, entry.m_lru);
+            return entry.m_chunk;
+        }
+
+        if (entry.m_spilling)
+        {
+            // Evicted, but still being written to the spill directory.
+            m_statistics.m_numHits++;
+            return Insert(chunkId, entry, entry.m_spilling);
+        }
+
+        spillFile = entry.m_spillFile;
+    }
+
+    vector<SequenceInfo> sequences;
+    m_deserializer->SequenceInfosForChunk(chunkId, sequences);
+
+    CachedChunkPtr chunk;
+    if (!spillFile.empty())
+    {
+        auto file = FileWrapper::OpenOrDie(spillFile, L"rb");
+        vector<char> buffer(file.Filesize());
+        file.ReadOrDie(buffer.data(), 1, buffer.size());
+        chunk = make_shared<CachedChunk>(move(buffer), sequences);
+    }
+    else
+    {
+        auto original = m_deserializer->GetChunk(chunkId);
+        chunk = make_shared<CachedChunk>(*original, sequences, m_deserializer->StreamInfos());
+    }
+
+    vector<pair<ChunkIdType, CachedChunkPtr>> toSpill;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto& entry = m_entries[chunkId];
+        if (entry.m_chunk)
+        {
+            // Another thread has loaded the same chunk in the meantime.
+            m_statistics.m_numHits++;
+            m_lru.splice(m_lru.begin(), m_lru, entry.m_lru);
+            return entry.m_chunk;
+        }
+
+        if (!spillFile.empty())
+            m_statistics.m_numSpillReads++;
+        else
+            m_statistics.m_numMisses++;
+
+        Insert(chunkId, entry, chunk);
+        Evict(toSpill);
+    }
+
+    for (const auto& evicted : toSpill)
+        Spill(evicted.first, *evicted.second);
+    return chunk;
+}
+
+ChunkCache::CachedChunkPtr ChunkCache::Insert(ChunkIdType chunkId, Entry& entry, CachedChunkPtr chunk)
+{
+    entry.m_chunk = chunk;
+    m_lru.push_front(chunkId);
+    entry.m_lru = m_lru.begin();
+    m_statistics.m_sizeInBytes += chunk->SizeInBytes();
+    return chunk;
+}
+
+void ChunkCache::Evict(vector<pair<ChunkIdType, CachedChunkPtr>>& toSpill)
+{
+    while (m_statistics.m_sizeInBytes > m_configuration.m_maxSizeInBytes && m_lru.size() > 1)
+    {
+        auto chunkId = m_lru.back();
+        auto& entry = m_entries[chunkId];
+
+        // Chunks do not change, so a chunk is only written once.
+        if (!m_configuration.m_spillDirectory.empty() && entry.m_spillFile.empty() && !entry.m_spilling)
+        {
+            entry.m_spilling = entry.m_chunk;
+            toSpill.push_back(make_pair(chunkId, entry.m_chunk));
+        }
+
+        m_statistics.m_sizeInBytes -= entry.m_chunk->SizeInBytes();
+        m_statistics.m_numEvictions++;
+        entry.m_chunk.reset();
+        m_lru.pop_back();
+    }
+}
+
+void ChunkCache::Spill(ChunkIdType chunkId, const CachedChunk& chunk)
+{
+    auto filename = GetSpillFilename(chunkId);
+    const auto& buffer = chunk.Buffer();
+    {
+        auto file = FileWrapper::OpenOrDie(filename, L"wb");
+        file.WriteOrDie(buffer.data(), 1, buffer.size());
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+    auto& entry = m_entries[chunkId];
+    entry.m_spillFile = filename;
+    entry.m_spilling.reset();
+    m_statistics.m_spilledSizeInBytes += buffer.size();
+}
+
+wstring ChunkCache::GetSpillFilename(ChunkIdType chunkId) const
+{
+    // Several readers (or processes) can share the spill directory.
+    wstring directory = m_configuration.m_spillDirectory;
+    if (directory.back() != L'/' && directory.back() != L'\\')
+        directory += L'/';
+    return directory + L"cntk_chunk_" + to_wstring(GetCurrentProcessId()) + L"_" +
+        to_wstring(reinterpret_cast<uintptr_t>(this)) + L"_" + to_wstring(chunkId) + L".bin";
+}
+
 }
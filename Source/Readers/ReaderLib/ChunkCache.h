@@ -6,21 +6,44 @@
 #pragma once
 
 #include <map>
+#include <list>
+#include <mutex>
 #include "DataDeserializer.h"
 
 namespace CNTK {
 
+struct ChunkCacheConfiguration
+{
+    ChunkCacheConfiguration() = default;
+
+    // Reads 'chunkCacheSizeInMB' and 'chunkCacheSpillDirectory'.
+    explicit ChunkCacheConfiguration(const ConfigParameters& config);
+
+    // Limit for the size of the chunks kept in memory, in bytes; 0 means no limit.
+    size_t m_maxSizeInBytes = 0;
+    // Existing directory where chunks evicted from memory are written to, so that they can be
+    // read back without parsing them again. Empty means evicted chunks are dropped.
+    std::wstring m_spillDirectory;
+};
+
 // A cache to store the complete dataset (all chunks) in memory. The caching can
-// be switched on/off by a boolean flag in the reader config section, independent 
-// of the randomization and chunking parameters. The caching should only be enabled 
-// when the whole dataset fits in memory.
+// be switched on/off by a boolean flag in the reader config section, independent
+// of the randomization and chunking parameters.
 // Implemented as a wrapping proxy around a deserializer that stores pointers to
 // all chunks it sees in an internal map.
+//
+// Without a size limit the caching should only be enabled when the whole dataset fits in memory.
+// With a limit, the chunks are copied into a compact binary form of their sequences, and the least
+// recently used chunks are evicted when the limit is exceeded. Evicted chunks are either spilled to
+// the spill directory (and read back from there when they are needed again) or dropped, in which
+// case they are loaded from the deserializer again.
 class ChunkCache : public DataDeserializer
 {
 public:
 
-    ChunkCache(DataDeserializerPtr deserializer) : m_deserializer(deserializer) { }
+    ChunkCache(DataDeserializerPtr deserializer, const ChunkCacheConfiguration& configuration = ChunkCacheConfiguration());
+
+    ~ChunkCache();
 
     virtual std::vector<StreamInformation> StreamInfos() override
     {
@@ -45,11 +68,54 @@ public:
     // Gets chunk data given its id.
     virtual ChunkPtr GetChunk(ChunkIdType chunkId);
 
+    struct Statistics
+    {
+        size_t m_numHits = 0;           // chunks found in memory
+        size_t m_numSpillReads = 0;     // chunks read back from the spill directory
+        size_t m_numMisses = 0;         // chunks loaded from the deserializer
+        size_t m_numEvictions = 0;      // chunks removed from memory
+        size_t m_sizeInBytes = 0;       // size of the chunks currently in memory
+        size_t m_spilledSizeInBytes = 0;// size of the chunks in the spill directory
+    };
+
+    Statistics GetStatistics() const;
+
 private:
+    class CachedChunk;
+    typedef std::shared_ptr<CachedChunk> CachedChunkPtr;
+
+    struct Entry
+    {
+        CachedChunkPtr m_chunk;                  // null if the chunk is not in memory
+        std::list<ChunkIdType>::iterator m_lru;  // position in m_lru if the chunk is in memory
+        std::wstring m_spillFile;                // non-empty if the chunk has been spilled
+        CachedChunkPtr m_spilling;               // non-null while the evicted chunk is being written to the spill file
+    };
+
+    ChunkPtr GetBoundedChunk(ChunkIdType chunkId);
+
+    CachedChunkPtr Insert(ChunkIdType chunkId, Entry& entry, CachedChunkPtr chunk);
+
+    // Evicts the least recently used chunks, except the most recent one, until the cache fits into its limit.
+    // Collects the evicted chunks that have to be written to the spill directory, which the caller does
+    // without holding the lock.
+    void Evict(std::vector<std::pair<ChunkIdType, CachedChunkPtr>>& toSpill);
+
+    // Writes an evicted chunk to its spill file.
+    void Spill(ChunkIdType chunkId, const CachedChunk& chunk);
+
+    std::wstring GetSpillFilename(ChunkIdType chunkId) const;
+
     // A map of currently loaded chunks
     std::map<size_t, ChunkPtr> m_chunkMap;
     DataDeserializerPtr m_deserializer;
 
+    ChunkCacheConfiguration m_configuration;
+    std::map<ChunkIdType, Entry> m_entries;
+    std::list<ChunkIdType> m_lru; // chunks in memory, most recently used first
+    Statistics m_statistics;
+    mutable std::mutex m_mutex;
+
     DISABLE_COPY_AND_MOVE(ChunkCache);
 };
 
@@ -29,6 +29,13 @@ public:
         return m_streams;
     }
 
+    // Whether GetChunk() can be called from several threads at the same time, which lets the randomizer
+    // load chunks in parallel. Deserializers that parse through shared state (e.g. a file position) must not claim this.
+    virtual bool SupportsConcurrentChunkLoading() const
+    {
+        return false;
+    }
+
 protected:
     virtual bool GetSequenceInfoByKey(const SequenceKey&, SequenceInfo&)
     {
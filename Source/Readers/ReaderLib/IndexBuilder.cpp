@@ -23,6 +23,7 @@ IndexBuilder::IndexBuilder(const FileWrapper& input)
     m_isCacheEnabled(false),
     m_chunkSize(g_32MB),
     m_bufferSize(g_2MB),
+    m_rangeSize(g_64MB),
     m_primary(true)
 {}
 
@@ -121,6 +122,83 @@ void IndexBuilder::WriteIndexCacheAsync(shared_ptr<Index>& index)
     }).detach();
 }
 
+unique_ptr<BufferedFileReader> IndexBuilder::CreateReader(size_t offset) const
+{
+    auto file = FileWrapper::OpenOrDie(m_input.Filename(), L"rbS");
+    file.SeekOrDie(offset, SEEK_SET);
+    return make_unique<BufferedFileReader>(m_bufferSize, file);
+}
+
+vector<size_t> IndexBuilder::SplitIntoRanges(size_t begin, size_t end, const function<size_t(BufferedFileReader&, size_t)>& findSequenceStart) const
+{
+    vector<size_t> boundaries{ begin };
+    size_t numRanges = (m_rangeSize == 0 || end <= begin) ? 1 : (end - begin + m_rangeSize - 1) / m_rangeSize;
+    if (numRanges > 1)
+    {
+        // Each inner boundary is searched from a multiple of the range size up to the next one. If none is found
+        // there (a sequence longer than a range), the range is merged with the next one.
+        vector<size_t> found(numRanges, SIZE_MAX);
+#pragma omp parallel for schedule(dynamic)
+        for (int k = 1; k < (int)numRanges; k++)
+        {
+            size_t candidate = begin + k * m_rangeSize;
+            size_t limit = min(candidate + m_rangeSize, end);
+            try
+            {
+                // start at the line that contains the previous character, so that we do not miss a line starting at the candidate
+                auto reader = CreateReader(candidate - 1);
+                if (reader->TryMoveToNextLine() && reader->GetFileOffset() < limit)
+                    found[k] = findSequenceStart(*reader, limit);
+            }
+            catch (...)
+            {
+                // Leave it to the indexing of the range to report the error, at the position a sequential build would.
+            }
+        }
+
+        for (size_t k = 1; k < numRanges; k++)
+        {
+            if (found[k] < end && found[k] > boundaries.back())
+                boundaries.push_back(found[k]);
+        }
+    }
+    boundaries.push_back(end);
+    return boundaries;
+}
+
+void IndexBuilder::IndexRanges(const vector<size_t>& boundaries,
+                               const function<void(size_t, BufferedFileReader&, size_t)>& indexRange,
+                               const function<void(size_t)>& mergeRange) const
+{
+    size_t numRanges = boundaries.size() - 1;
+    size_t batchSize = 2 * max<size_t>(thread::hardware_concurrency(), 1);
+    vector<exception_ptr> errors(numRanges);
+    for (size_t batchBegin = 0; batchBegin < numRanges; batchBegin += batchSize)
+    {
+        size_t batchEnd = min(batchBegin + batchSize, numRanges);
+#pragma omp parallel for schedule(dynamic)
+        for (int r = (int)batchBegin; r < (int)batchEnd; r++)
+        {
+            try
+            {
+                auto reader = CreateReader(boundaries[r]);
+                indexRange(r, *reader, boundaries[r + 1]);
+            }
+            catch (...)
+            {
+                errors[r] = current_exception();
+            }
+        }
+
+        for (size_t r = batchBegin; r < batchEnd; r++)
+        {
+            mergeRange(r);
+            if (errors[r])
+                rethrow_exception(errors[r]);
+        }
+    }
+}
+
 const static size_t s_sequenceSize = sizeof(IndexedSequence);
 const static size_t s_numSequencesToBuffer = (g_1MB >> 1) / s_sequenceSize;
 
@@ -218,28 +296,28 @@ static const char s_BOM[3] = { '\xEF', '\xBB', '\xBF' };
     if (m_fileSize == 0)
         RuntimeError("Input file is empty");
 
-    m_reader.reset(new BufferedFileReader(m_bufferSize, m_input));
+    BufferedFileReader reader(m_bufferSize, m_input);
 
     index->Reserve(m_fileSize);
 
     // skip BOM prefix at the very beginning of the input file if it's there.
     for (char ch : s_BOM) 
     {
-        if (!m_reader->Empty() && m_reader->Peek() == ch)
-            m_reader->Pop();
+        if (!reader.Empty() && reader.Peek() == ch)
+            reader.Pop();
         else break;
     }
 
     if (!isspace(m_streamPrefix))
     {
         // as long as the stream prefix is not a white space, it's safe to skip all leading spaces.
-        while (isspace(m_reader->Peek()) && m_reader->Pop()); 
+        while (isspace(reader.Peek()) && reader.Pop()); 
     }
 
-    if (m_reader->Empty())
+    if (reader.Empty())
         RuntimeError("Input file is empty");
 
-    if (m_skipSequenceIds || (!m_reader->Empty() && m_reader->Peek() == m_streamPrefix))
+    if (m_skipSequenceIds || (!reader.Empty() && reader.Peek() == m_streamPrefix))
     {
         // Skip sequence id parsing, treat lines as individual sequences
         // In this case the sequences do not have ids, they are assigned corresponding line numbers
@@ -248,72 +326,140 @@ static const char s_BOM[3] = { '\xEF', '\xBB', '\xBF' };
             RuntimeError("Corpus expects non-numeric sequence keys present but the input file does not have them."
                 "Please use the configuration to enable numeric keys instead.");
 
-        PopulateFromLines(index);
+        PopulateFromLines(index, reader.GetFileOffset(), reader.CurrentLineNumber());
     }
     else 
     {
-        PopulateImpl(index);
+        PopulateImpl(index, reader.GetFileOffset());
     }
 }
 
-void TextInputIndexBuilder::PopulateFromLines(shared_ptr<Index>& index)
+void TextInputIndexBuilder::PopulateFromLines(shared_ptr<Index>& index, size_t firstOffset, size_t firstLineNumber)
+{
+    // every line is a sequence, so ranges can start at any line
+    auto boundaries = SplitIntoRanges(firstOffset, m_fileSize, [](BufferedFileReader& reader, size_t) { return reader.GetFileOffset(); });
+
+    vector<vector<IndexedSequence>> sequences(boundaries.size() - 1);
+    vector<size_t> numberOfLines(boundaries.size() - 1);
+    size_t lineNumber = firstLineNumber;
+    IndexRanges(boundaries,
+        [this, &sequences, &numberOfLines](size_t r, BufferedFileReader& reader, size_t end)
+        {
+            numberOfLines[r] = PopulateRangeFromLines(reader, end, sequences[r]);
+        },
+        [&index, &sequences, &numberOfLines, &lineNumber](size_t r)
+        {
+            for (auto& sequence : sequences[r])
+                index->AddSequence(sequence.SetKey(lineNumber + sequence.Key()));
+            lineNumber += numberOfLines[r];
+            vector<IndexedSequence>().swap(sequences[r]);
+        });
+}
+
+size_t TextInputIndexBuilder::PopulateRangeFromLines(BufferedFileReader& reader, size_t end, vector<IndexedSequence>& sequences) const
 {
     IndexedSequence sequence;
-    while (!m_reader->Empty())
+    while (!reader.Empty() && reader.GetFileOffset() < end)
     {
-        size_t offset = m_reader->GetFileOffset();
+        size_t offset = reader.GetFileOffset();
 
-        if (!FindMainStream())
+        if (!FindMainStream(reader))
         { 
             // skip lines that do not contain main stream name.
-            m_reader->TryMoveToNextLine();
+            reader.TryMoveToNextLine();
             continue;
         }
 
-        sequence.SetNumberOfSamples(1).SetOffset(offset).SetKey(m_reader->CurrentLineNumber());
+        sequence.SetNumberOfSamples(1).SetOffset(offset).SetKey(reader.CurrentLineNumber());
 
-        if (m_reader->TryMoveToNextLine())
+        if (reader.TryMoveToNextLine())
         {
-            sequence.SetSize(m_reader->GetFileOffset() - offset);
-            index->AddSequence(sequence);
+            sequence.SetSize(reader.GetFileOffset() - offset);
+            sequences.push_back(sequence);
         } 
         else  if (offset < m_fileSize)
         {
             // There's a number of characters, not terminated by a newline,
             // add a sequence to the index, parser will have to deal with it.
             sequence.SetSize(m_fileSize - offset);
-            index->AddSequence(sequence);
+            sequences.push_back(sequence);
             break;
         }
     }
+    return reader.CurrentLineNumber();
 }
 
-void TextInputIndexBuilder::PopulateImpl(shared_ptr<Index>& index)
+void TextInputIndexBuilder::PopulateImpl(shared_ptr<Index>& index, size_t firstOffset)
+{
+    // Symbolic keys are numbered in the order in which they are first seen, unless they are hashed,
+    // so they can only be read in file order.
+    bool canSplit = !m_corpus || m_corpus->IsNumericSequenceKeys() || m_corpus->IsHashingEnabled();
+    auto boundaries = canSplit ?
+        SplitIntoRanges(firstOffset, m_fileSize, [this](BufferedFileReader& reader, size_t limit) { return FindNextSequenceStart(reader, limit); }) :
+        vector<size_t>{ firstOffset, m_fileSize };
+
+    vector<vector<IndexedSequence>> sequences(boundaries.size() - 1);
+    IndexRanges(boundaries,
+        [this, &sequences](size_t r, BufferedFileReader& reader, size_t end)
+        {
+            PopulateRange(reader, end, sequences[r]);
+        },
+        [&index, &sequences](size_t r)
+        {
+            for (const auto& sequence : sequences[r])
+                index->AddSequence(sequence);
+            vector<IndexedSequence>().swap(sequences[r]);
+        });
+}
+
+size_t TextInputIndexBuilder::FindNextSequenceStart(BufferedFileReader& reader, size_t limit) const
+{
+    // Lines without an id continue the current sequence, so the first id we see is not necessarily a new one.
+    bool foundId = false;
+    size_t currentId = 0, id = 0;
+    while (!reader.Empty() && reader.GetFileOffset() < limit)
+    {
+        auto offset = reader.GetFileOffset();
+        if (TryGetSequenceId(reader, id))
+        {
+            if (foundId && id != currentId)
+                return offset;
+            foundId = true;
+            currentId = id;
+        }
+        reader.TryMoveToNextLine();
+    }
+    return SIZE_MAX;
+}
+
+void TextInputIndexBuilder::PopulateRange(BufferedFileReader& reader, size_t end, vector<IndexedSequence>& sequences) const
 {
     IndexedSequence sequence;
     uint32_t numberOfSamples = 0;
     bool foundMainStream = false;
-    size_t prevId = 0, nextId = 0, prevOffset = m_reader->GetFileOffset();
+    size_t prevId = 0, nextId = 0, prevOffset = reader.GetFileOffset();
 
     // Go ahead and read the id of the very first sequence.
-    if (!TryGetSequenceId(prevId))
+    if (!TryGetSequenceId(reader, prevId))
     {
         RuntimeError("Expected a sequence id at the offset %zu, none was found.", prevOffset);
     }
 
-    while (!m_reader->Empty())
+    while (!reader.Empty())
     {
-        if (FindMainStream())
+        if (FindMainStream(reader))
         {
             numberOfSamples++;
             foundMainStream = true;
         }
 
-        m_reader->TryMoveToNextLine(); // ignore whatever is left on this line.
+        reader.TryMoveToNextLine(); // ignore whatever is left on this line.
 
-        auto offset = m_reader->GetFileOffset(); // a new line starts at this offset;
+        auto offset = reader.GetFileOffset(); // a new line starts at this offset;
+        if (offset >= end)
+            break; // the next range starts with a new sequence
         
-        if (TryGetSequenceId(nextId) && nextId != prevId)
+        if (TryGetSequenceId(reader, nextId) && nextId != prevId)
         {
             // found a new sequence, which starts at the [offset] bytes into the file
             // adding the previous one to the index.
@@ -327,26 +473,27 @@ void TextInputIndexBuilder::PopulateImpl(shared_ptr<Index>& index)
             numberOfSamples = 0;
             
             if (foundMainStream)
-                index->AddSequence(sequence);
+                sequences.push_back(sequence);
             foundMainStream = false;
         }
     }
 
-    if (prevOffset < m_fileSize)
+    end = min(end, m_fileSize);
+    if (prevOffset < end)
     {
         sequence.SetKey(prevId)
             .SetNumberOfSamples(numberOfSamples)
             .SetOffset(prevOffset)
-            .SetSize(m_fileSize - prevOffset);
+            .SetSize(end - prevOffset);
         
         if (foundMainStream)
-            index->AddSequence(sequence);
+            sequences.push_back(sequence);
     }
 }
 
-inline bool TextInputIndexBuilder::FindMainStream()
+inline bool TextInputIndexBuilder::FindMainStream(BufferedFileReader& reader) const
 {
-    if (m_reader->Empty())
+    if (reader.Empty())
         return false;
     
     if (m_mainStream.empty())
@@ -357,7 +504,7 @@ inline bool TextInputIndexBuilder::FindMainStream()
     int i = 0;
     do  
     {
-        char c = m_reader->Peek();
+        char c = reader.Peek();
         if (i == length)
         {
             // we found a match, check to see if it's followed by either a space, 
@@ -375,30 +522,30 @@ inline bool TextInputIndexBuilder::FindMainStream()
 
         if (c == g_eol)
             break;
-    } while (m_reader->Pop());
+    } while (reader.Pop());
 
     // we hit either the EOL or the EOF, see if we have a match
     return (i == length);
 }
 
-inline bool TextInputIndexBuilder::TryGetSequenceId(size_t& id)
+inline bool TextInputIndexBuilder::TryGetSequenceId(BufferedFileReader& reader, size_t& id) const
 {
     if (m_corpus && !m_corpus->IsNumericSequenceKeys())
-        return TryGetSymbolicSequenceId(id, m_corpus->KeyToId);
+        return TryGetSymbolicSequenceId(reader, id, m_corpus->KeyToId);
 
-    return TryGetNumericSequenceId(id);
+    return TryGetNumericSequenceId(reader, id);
 }
 
-inline bool TextInputIndexBuilder::TryGetNumericSequenceId(size_t& id)
+inline bool TextInputIndexBuilder::TryGetNumericSequenceId(BufferedFileReader& reader, size_t& id) const
 {
-    if (m_reader->Empty())
+    if (reader.Empty())
         return false;
 
     bool found = false;
     id = 0;
     do
     {
-        char c = m_reader->Peek();
+        char c = reader.Peek();
         if (!isdigit(c))
             // Stop as soon as there's a non-digit character
             return found;
@@ -409,16 +556,16 @@ inline bool TextInputIndexBuilder::TryGetNumericSequenceId(size_t& id)
             RuntimeError("Overflow while reading a numeric sequence id (%zu-bit value).", sizeof(id));
         
         found = true;
-    } while (m_reader->Pop());
+    } while (reader.Pop());
 
     // reached EOF without hitting the pipe character,
     // ignore it for now, parser will have to deal with it.
     return false;
 }
 
-inline bool TextInputIndexBuilder::TryGetSymbolicSequenceId(size_t& id, function<size_t(const string&)> keyToId)
+inline bool TextInputIndexBuilder::TryGetSymbolicSequenceId(BufferedFileReader& reader, size_t& id, function<size_t(const string&)> keyToId) const
 {
-    if (m_reader->Empty())
+    if (reader.Empty())
         return false;
 
     bool found = false;
@@ -427,7 +574,7 @@ inline bool TextInputIndexBuilder::TryGetSymbolicSequenceId(size_t& id, function
     key.reserve(256);
     do
     {
-        char c = m_reader->Peek();
+        char c = reader.Peek();
         if (isspace(c))
         {
             if (found)
@@ -437,7 +584,7 @@ inline bool TextInputIndexBuilder::TryGetSymbolicSequenceId(size_t& id, function
 
         key += c;
         found = true;
-    } while (m_reader->Pop());
+    } while (reader.Pop());
 
     // reached EOF without hitting the pipe character,
     // ignore it for now, parser will have to deal with it.
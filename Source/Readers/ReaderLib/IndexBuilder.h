@@ -7,6 +7,8 @@
 
 #include <stdint.h>
 #include <vector>
+#include <functional>
+#include <exception>
 #include <boost/noncopyable.hpp>
 #include "Index.h"
 #include "CorpusDescriptor.h"
@@ -27,6 +29,8 @@ class IndexedSequence
     friend class ChunkDescriptor;
     
 public:
+    size_t Key() const { return key; }
+
     IndexedSequence& SetKey(size_t value) { key = value; return *this;  }
     
     IndexedSequence& SetNumberOfSamples(uint32_t value) { numberOfSamples = value; return *this; }
@@ -76,6 +80,9 @@ public:
 
     IndexBuilder& SetCachingEnabled(bool value) { m_isCacheEnabled = value; return *this; }
 
+    // Size of the byte ranges of the input that are indexed in parallel (0 indexes the whole input on one thread).
+    IndexBuilder& SetRangeSize(size_t size) { m_rangeSize = size; return *this; }
+
     virtual std::wstring GetCacheFilename() = 0;
 
 protected:
@@ -85,9 +92,27 @@ protected:
 
     virtual void Populate(std::shared_ptr<Index>&) = 0;
 
+    // Returns a reader of the input that starts at the given offset and is independent of any other reader.
+    std::unique_ptr<BufferedFileReader> CreateReader(size_t offset) const;
+
+    // Splits [begin, end) of the input into ranges of about m_rangeSize bytes that can be indexed independently.
+    // findSequenceStart() is called with a reader at the start of a line and an offset limit. It returns the start
+    // offset of a sequence at or after the reader position and before the limit, or SIZE_MAX if it found none.
+    // Returns the range boundaries, starting with 'begin' and ending with 'end'.
+    std::vector<size_t> SplitIntoRanges(size_t begin, size_t end, const std::function<size_t(BufferedFileReader&, size_t)>& findSequenceStart) const;
+
+    // Calls indexRange(r, reader, end) for the ranges [boundaries[r], boundaries[r + 1]) in parallel, each with its
+    // own reader starting at the range begin, and mergeRange(r) for the ranges in file order. Ranges are processed in
+    // batches, so only a few ranges' results are waiting to be merged at any time. An exception thrown while indexing
+    // a range is rethrown after that range is merged, so errors surface in the same order as in a sequential build.
+    void IndexRanges(const std::vector<size_t>& boundaries,
+                     const std::function<void(size_t, BufferedFileReader&, size_t)>& indexRange,
+                     const std::function<void(size_t)>& mergeRange) const;
+
     FileWrapper m_input;
     CorpusDescriptorPtr m_corpus;
     size_t m_bufferSize;
+    size_t m_rangeSize;
     bool m_primary;
     size_t m_chunkSize;
 
@@ -142,31 +167,42 @@ private:
     std::string m_mainStream;
     std::unique_ptr<KMP> m_nfa; 
 
-    std::unique_ptr<BufferedFileReader> m_reader;
+    // All of the following read through the given reader, so that ranges of the input can be indexed in parallel.
 
     // Returns true if main stream name if found on the current line.
-    bool FindMainStream();
+    bool FindMainStream(BufferedFileReader& reader) const;
 
     // Invokes either TryGetNumericSequenceId or TryGetSymbolicSequenceId depending
     // on the specified corpus settings.
-    bool TryGetSequenceId(size_t& id);
+    bool TryGetSequenceId(BufferedFileReader& reader, size_t& id) const;
 
     // Tries to get numeric sequence id.
     // Throws an exception if a non-numerical is read until the pipe character or 
     // EOF is reached without hitting the pipe character.
     // Returns false if no numerical characters are found preceding the pipe.
     // Otherwise, writes sequence id value to the provided reference, returns true.
-    bool TryGetNumericSequenceId(size_t& id);
+    bool TryGetNumericSequenceId(BufferedFileReader& reader, size_t& id) const;
 
     // Same as above but for symbolic ids.
     // It reads a symbolic key and converts it to numeric id using provided keyToId function.
-    bool TryGetSymbolicSequenceId(size_t& id, std::function<size_t(const std::string&)> keyToId);
+    bool TryGetSymbolicSequenceId(BufferedFileReader& reader, size_t& id, std::function<size_t(const std::string&)> keyToId) const;
+
+    // Returns the start of the first line after the reader position (and before the limit) whose sequence id
+    // differs from the id of the line before it, or SIZE_MAX.
+    size_t FindNextSequenceStart(BufferedFileReader& reader, size_t limit) const;
 
-    void PopulateImpl(std::shared_ptr<Index>& index);
+    void PopulateImpl(std::shared_ptr<Index>& index, size_t firstOffset);
+
+    // Indexes the sequences that start in [reader position, end).
+    void PopulateRange(BufferedFileReader& reader, size_t end, std::vector<IndexedSequence>& sequences) const;
 
     // Parses input line by line, treating each line as an individual sequence.
     // Ignores sequence id information, using the line number instead as the id.
-    void PopulateFromLines(std::shared_ptr<Index>& index);
+    void PopulateFromLines(std::shared_ptr<Index>& index, size_t firstOffset, size_t firstLineNumber);
+
+    // Indexes the lines in [reader position, end), using the line numbers relative to the range begin as keys.
+    // Returns the number of lines in the range.
+    size_t PopulateRangeFromLines(BufferedFileReader& reader, size_t end, std::vector<IndexedSequence>& sequences) const;
 };
 
 }
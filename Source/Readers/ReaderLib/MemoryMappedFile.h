@@ -0,0 +1,179 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <inttypes.h>
+#include <errno.h>
+#include <string.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include "Basics.h"
+
+namespace CNTK {
+
+// Read-only memory mapping of a whole file.
+//
+// Besides giving access to the file contents without copying them into the process, it lets readers
+// tell the OS which parts of the file are about to be used (WillNeed(), which starts asynchronous
+// readahead) and which are no longer needed (DontNeed(), which drops the pages from the process;
+// they stay in the page cache).
+class MemoryMappedFile
+{
+public:
+    explicit MemoryMappedFile(const std::wstring& filename)
+        : m_filename(filename), m_data(nullptr), m_size(0)
+    {
+#ifdef _WIN32
+        m_file = CreateFileW(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (m_file == INVALID_HANDLE_VALUE)
+            RuntimeError("Unable to open file '%ls' for memory mapping, error 0x%x.", filename.c_str(), (unsigned int)GetLastError());
+        LARGE_INTEGER size;
+        GetFileSizeEx(m_file, &size);
+        m_size = (size_t)size.QuadPart;
+        m_mapping = m_size ? CreateFileMappingW(m_file, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+        if (m_size && m_mapping == NULL)
+        {
+            CloseHandle(m_file);
+            RuntimeError("Unable to memory map file '%ls', error 0x%x.", filename.c_str(), (unsigned int)GetLastError());
+        }
+        m_data = m_size ? (char*)MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (m_size && m_data == nullptr)
+        {
+            CloseHandle(m_mapping);
+            CloseHandle(m_file);
+            RuntimeError("Unable to memory map file '%ls', error 0x%x.", filename.c_str(), (unsigned int)GetLastError());
+        }
+        SYSTEM_INFO systemInfo;
+        GetSystemInfo(&systemInfo);
+        m_pageSize = systemInfo.dwPageSize;
+#else
+        m_file = open(msra::strfun::utf8(filename).c_str(), O_RDONLY);
+        if (m_file == -1)
+            RuntimeError("Unable to open file '%ls' for memory mapping: %s.", filename.c_str(), strerror(errno));
+        struct stat sb;
+        if (fstat(m_file, &sb) == -1)
+        {
+            close(m_file);
+            RuntimeError("Unable to retrieve the size of file '%ls': %s.", filename.c_str(), strerror(errno));
+        }
+        m_size = (size_t)sb.st_size;
+        if (m_size)
+        {
+            void* data = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, m_file, 0);
+            if (data == MAP_FAILED)
+            {
+                close(m_file);
+                RuntimeError("Unable to memory map file '%ls': %s.", filename.c_str(), strerror(errno));
+            }
+            m_data = (char*)data;
+        }
+        m_pageSize = (size_t)sysconf(_SC_PAGESIZE);
+#endif
+    }
+
+    ~MemoryMappedFile()
+    {
+#ifdef _WIN32
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mapping != NULL)
+            CloseHandle(m_mapping);
+        CloseHandle(m_file);
+#else
+        if (m_data)
+            munmap(m_data, m_size);
+        close(m_file);
+#endif
+    }
+
+    const char* Data() const { return m_data; }
+    size_t Size() const { return m_size; }
+
+    // Returns a pointer to [offset, offset + size) of the file.
+    const char* GetView(uint64_t offset, size_t size) const
+    {
+        if (offset > m_size || size > m_size - offset)
+            RuntimeError("Range [%" PRIu64 ", %" PRIu64 ") is outside of the memory mapped file '%ls' (%" PRIu64 " bytes).",
+                         offset, offset + size, m_filename.c_str(), (uint64_t)m_size);
+        return m_data + offset;
+    }
+
+    // Hints that the range will be accessed soon; the OS starts reading it in the background.
+    void WillNeed(uint64_t offset, size_t size) const
+    {
+        char* begin;
+        size_t length;
+        if (!PageRange(offset, size, /*inner=*/false, begin, length))
+            return;
+#ifdef _WIN32
+#if _WIN32_WINNT >= 0x0602 // PrefetchVirtualMemory() needs Windows 8
+        WIN32_MEMORY_RANGE_ENTRY range = { begin, length };
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#endif
+#else
+        madvise(begin, length, MADV_WILLNEED);
+#endif
+    }
+
+    // Hints that the range is no longer needed. Only pages entirely inside of the range are released,
+    // so neighboring data that shares a page is not affected.
+    void DontNeed(uint64_t offset, size_t size) const
+    {
+        char* begin;
+        size_t length;
+        if (!PageRange(offset, size, /*inner=*/true, begin, length))
+            return;
+#ifdef _WIN32
+        // unlocking pages that are not locked removes them from the working set
+        VirtualUnlock(begin, length);
+#else
+        madvise(begin, length, MADV_DONTNEED);
+#endif
+    }
+
+private:
+    // page-aligned range covering [offset, offset + size) (or contained in it, if 'inner')
+    bool PageRange(uint64_t offset, size_t size, bool inner, char*& begin, size_t& length) const
+    {
+        if (size == 0 || offset >= m_size)
+            return false;
+        uint64_t end = std::min<uint64_t>(offset + size, m_size);
+        uint64_t alignedBegin = inner ? (offset + m_pageSize - 1) / m_pageSize * m_pageSize : offset / m_pageSize * m_pageSize;
+        uint64_t alignedEnd = inner ? end / m_pageSize * m_pageSize : end;
+        if (alignedEnd <= alignedBegin)
+            return false;
+        begin = m_data + alignedBegin;
+        length = (size_t)(alignedEnd - alignedBegin);
+        return true;
+    }
+
+    std::wstring m_filename;
+    char* m_data;
+    size_t m_size;
+    size_t m_pageSize;
+#ifdef _WIN32
+    HANDLE m_file;
+    HANDLE m_mapping;
+#else
+    int m_file;
+#endif
+
+    DISABLE_COPY_AND_MOVE(MemoryMappedFile);
+};
+
+typedef std::shared_ptr<MemoryMappedFile> MemoryMappedFilePtr;
+
+}
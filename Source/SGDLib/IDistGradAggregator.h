@@ -19,6 +19,18 @@ public:
     // Returns a boolean indicating if any samples were processed
     virtual bool AggregateGradients(const std::vector<Matrix<ElemType>*>& gradients, DistGradHeader* headerCPU, bool resetState) = 0;
 
+    // Aggregators that overlap communication with backprop want to be told when a gradient is final
+    // (see ComputationNetwork::Backprop()). AggregateGradients() must still be called for all gradients
+    // once backprop is done. Gradients are expected in the order in which backprop finalizes them.
+    virtual bool OverlapsWithBackprop() const
+    {
+        return false;
+    }
+
+    // May be called concurrently; matrices that are not aggregated are ignored.
+    virtual void OnGradientReady(const Matrix<ElemType>* /*gradient*/)
+    {}
+
     size_t NumProc()
     {
         return m_mpi->NumNodesInUse();
@@ -1067,6 +1067,11 @@ size_t SGD<ElemType>::TrainOneEpoch(ComputationNetworkPtr net,
     if (numSubminibatchesNeeded > 1)
         smbDispatcher.Init(net, learnableNodes, criterionNodes, evaluationNodes);
 
+    // Gradients are only communicated during backprop if backprop produces the final gradients. With sub-minibatching,
+    // they are accumulated over the sub-minibatches and restored by DoneWithCurrentMinibatch(), which must not race with
+    // the communication, so the aggregator then reduces all buckets after the minibatch.
+    bool overlapGradientAggregation = useGradientAggregation && m_distGradAgg->OverlapsWithBackprop() && numSubminibatchesNeeded <= 1;
+
     // The following is a special feature only supported by the Kaldi2Reader for more efficient sequence training.
     // This attempts to compute the error signal for the whole utterance, which will
     // be fed to the neural network as features. Currently it is a workaround
@@ -1086,6 +1091,10 @@ size_t SGD<ElemType>::TrainOneEpoch(ComputationNetworkPtr net,
 
             if (m_bufferedAsyncGradientAggregation)
                 fprintf(stderr, ", BufferedAsyncGradientAggregation is ENABLED");
+            if (overlapGradientAggregation)
+                fprintf(stderr, ", gradient aggregation overlaps with backprop (bucket size %d KB)", (int) (m_gradientBucketSizeInBytes / 1024));
+            else if (m_distGradAgg->OverlapsWithBackprop())
+                fprintf(stderr, ", gradient aggregation in buckets of %d KB after backprop (sub-minibatching)", (int) (m_gradientBucketSizeInBytes / 1024));
         }
 
         if (useAsyncGradientAggregation)
@@ -1254,7 +1263,20 @@ size_t SGD<ElemType>::TrainOneEpoch(ComputationNetworkPtr net,
                 // ===========================================================
 
                 if (learnRatePerSample > 0.01 * m_minLearnRate) // only compute gradient when learning rate is large enough
-                    net->Backprop(criterionNodes[0]);
+                {
+                    // With bucketed aggregation, gradients are communicated as soon as they are final.
+                    ComputationNetwork::GradientReadyCallback onGradientReady;
+                    if (overlapGradientAggregation)
+                    {
+                        onGradientReady = [this](const ComputationNodeBasePtr& nodeBase)
+                        {
+                            auto node = dynamic_pointer_cast<ComputationNode<ElemType>>(nodeBase);
+                            if (node && node->GradientPtrRef())
+                                m_distGradAgg->OnGradientReady(node->GradientPtrRef().get());
+                        };
+                    }
+                    net->Backprop(criterionNodes[0], onGradientReady);
+                }
 
                 // house-keeping for sub-minibatching
                 if (actualNumSubminibatches > 1)
@@ -1303,8 +1325,19 @@ size_t SGD<ElemType>::TrainOneEpoch(ComputationNetworkPtr net,
             if (learnParamsGradients.size() == 0)
             {
                 // lazily form the list of smoothedGradients to exchange
-                learnParamsGradients.reserve(learnableNodes.size());
-                for (auto nodeIter = learnableNodes.begin(); nodeIter != learnableNodes.end(); nodeIter++)
+                // When overlapping with backprop, list them in the order in which backprop finalizes them.
+                std::list<ComputationNodeBasePtr> aggregatedNodes;
+                if (m_distGradAgg->OverlapsWithBackprop())
+                {
+                    std::set<ComputationNodeBasePtr> learnableNodeSet(learnableNodes.begin(), learnableNodes.end());
+                    const auto& evalOrder = net->GetEvalOrder(criterionNodes[0]);
+                    std::copy_if(evalOrder.rbegin(), evalOrder.rend(), std::back_inserter(aggregatedNodes),
+                                 [&learnableNodeSet](const ComputationNodeBasePtr& node) { return learnableNodeSet.find(node) != learnableNodeSet.end(); });
+                }
+                else
+                    aggregatedNodes = learnableNodes;
+                learnParamsGradients.reserve(aggregatedNodes.size());
+                for (auto nodeIter = aggregatedNodes.begin(); nodeIter != aggregatedNodes.end(); nodeIter++)
                 {
                     ComputationNodePtr node = dynamic_pointer_cast<ComputationNode<ElemType>>(*nodeIter);
                     if (node->IsParameterUpdateRequired())
@@ -2289,9 +2322,10 @@ void SGD<ElemType>::InitDistGradAgg(int numEvalNodes, int numGradientBits, int d
         if (traceLevel > 0)
             fprintf(stderr, "Initializing dataParallelSGD with FP%d aggregation.\n", numGradientBits);
         if (Globals::UseV2Aggregator()) // Currently used to check V2 against baselines.
-            m_distGradAgg = std::make_shared<V2SimpleDistGradAggregator<ElemType>>(m_mpi, m_bufferedAsyncGradientAggregation, deviceId, m_syncStatsTrace, ::CNTK::MPICommunicator(m_packThresholdSizeInBytes));
+            m_distGradAgg = std::make_shared<V2SimpleDistGradAggregator<ElemType>>(m_mpi, m_bufferedAsyncGradientAggregation, deviceId, m_syncStatsTrace, ::CNTK::MPICommunicator(m_packThresholdSizeInBytes, m_useHierarchicalAllReduce));
         else
-            m_distGradAgg = std::make_shared<SimpleDistGradAggregator<ElemType>>(m_mpi, m_bufferedAsyncGradientAggregation, deviceId, m_syncStatsTrace, m_packThresholdSizeInBytes);
+            m_distGradAgg = std::make_shared<SimpleDistGradAggregator<ElemType>>(m_mpi, m_bufferedAsyncGradientAggregation, deviceId, m_syncStatsTrace, m_packThresholdSizeInBytes, m_gradientBucketSizeInBytes, m_sparseGradientDensityThreshold,
+                                                                                 m_useHierarchicalAllReduce, m_useBuiltinAllReduce);
     }
 
     m_gradHeader.reset(DistGradHeader::Create(numEvalNodes), [](DistGradHeader* ptr) { DistGradHeader::Destroy(ptr); });
@@ -3128,6 +3162,10 @@ SGDParams::SGDParams(const ConfigRecordType& configSGD, size_t sizeofElemType)
     m_numGradientBits = vector<int>{8 * (int)sizeofElemType}; // means no quantization
     m_zeroThresholdFor1Bit = true;
     m_bufferedAsyncGradientAggregation = false;
+    m_gradientBucketSizeInBytes = 0;
+    m_sparseGradientDensityThreshold = 0.5;
+    m_useHierarchicalAllReduce = false;
+    m_useBuiltinAllReduce = false;
     m_enableDistributedMBReading = false;
     m_parallelizationStartEpochNum = 0;
     m_modelAggregationBlockSize = 0; 
@@ -3161,6 +3199,10 @@ SGDParams::SGDParams(const ConfigRecordType& configSGD, size_t sizeofElemType)
             m_numGradientBits = configDataParallelSGD(L"gradientBits", ConfigRecordType::Array(intargvector(vector<int>{defaultGradientBits})));
             m_zeroThresholdFor1Bit = configDataParallelSGD(L"useZeroThresholdFor1BitQuantization", true);
             m_bufferedAsyncGradientAggregation = configDataParallelSGD(L"useBufferedAsyncGradientAggregation", false);
+            m_gradientBucketSizeInBytes = configDataParallelSGD(L"gradientBucketSizeInKB", (size_t) 0) * 1024;
+            m_sparseGradientDensityThreshold = configDataParallelSGD(L"sparseGradientDensityThreshold", 0.5);
+            m_useHierarchicalAllReduce = configDataParallelSGD(L"useHierarchicalAllReduce", false);
+            m_useBuiltinAllReduce = configDataParallelSGD(L"useBuiltinAllReduce", false);
             for (size_t i = 0; i < m_numGradientBits.size(); i++)
             {
                 if (m_numGradientBits[i] < 1 || m_numGradientBits[i] > defaultGradientBits)
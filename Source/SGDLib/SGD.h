@@ -293,6 +293,10 @@ protected:
     intargvector m_numGradientBits;
     bool m_bufferedAsyncGradientAggregation;
     bool m_zeroThresholdFor1Bit;
+    size_t m_gradientBucketSizeInBytes; // > 0: all-reduce gradients in buckets of this size while backprop is running
+    double m_sparseGradientDensityThreshold; // sparse gradients whose touched columns may exceed this fraction are all-reduced in full
+    bool m_useHierarchicalAllReduce; // reduce within each host through shared memory, and across hosts by one rank per host
+    bool m_useBuiltinAllReduce; // reduce with AllReduceEngine (ring / recursive halving-doubling) instead of MPI_Allreduce
 
     // Parallel training related with MA / BM
     size_t m_modelAggregationBlockSize;
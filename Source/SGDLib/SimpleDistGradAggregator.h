@@ -10,10 +10,16 @@
 #include "IDistGradAggregator.h"
 #include "CUDAPageLockedMemAllocator.h"
 #include "NcclComm.h"
+#include "AllReduceEngine.h"
 #include <future>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 #include "GPUDataTransferer.h"
 #include "TimerUtility.h"
 #include "MatrixQuantizerImpl.h"
+#include <numeric>
 
 namespace Microsoft { namespace MSR { namespace CNTK {
 
@@ -23,13 +29,36 @@ class SimpleDistGradAggregator : public IDistGradAggregator<ElemType>
     UsingIDistGradAggregatorMembers;
 
 public:
-    SimpleDistGradAggregator(const MPIWrapperPtr& mpi, bool useAsyncAggregation, int deviceId, int syncStatsTrace, size_t packThresholdSizeInBytes = DEFAULT_PACK_THRESHOLD_SIZE_IN_BYTES)
+    // If bucketSizeInBytes > 0, gradients are all-reduced in buckets of about that size while backprop is still running
+    // (CPU only, not combined with async aggregation).
+    // Sparse block column gradients on the CPU are aggregated sparsely, unless more than sparseGradientDensityThreshold
+    // of their columns may have been touched.
+    // If useHierarchicalAllReduce, gradients on the CPU are reduced with MPIWrapper::HierarchicalAllReduce(), so that only
+    // one copy per host goes over the network. Otherwise, if useBuiltinAllReduce, they are reduced with AllReduceEngine instead
+    // of MPI_Allreduce. Both are blocking, so they replace the overlap of Iallreduce with the header exchange.
+    SimpleDistGradAggregator(const MPIWrapperPtr& mpi, bool useAsyncAggregation, int deviceId, int syncStatsTrace, size_t packThresholdSizeInBytes = DEFAULT_PACK_THRESHOLD_SIZE_IN_BYTES,
+                             size_t bucketSizeInBytes = 0, double sparseGradientDensityThreshold = 0.5, bool useHierarchicalAllReduce = false, bool useBuiltinAllReduce = false)
         : IDistGradAggregator<ElemType>(mpi), m_useAsyncAggregation(useAsyncAggregation), m_initialized(false), m_bufferedGradHeader(nullptr), m_syncStatsTrace(syncStatsTrace),
-        m_iterationCount(0), m_nccl(deviceId, mpi), m_packThresholdSizeInBytes(packThresholdSizeInBytes)
-    {}
+        m_iterationCount(0), m_nccl(deviceId, mpi), m_packThresholdSizeInBytes(packThresholdSizeInBytes),
+        m_sparseGradientDensityThreshold(sparseGradientDensityThreshold), m_useHierarchicalAllReduce(useHierarchicalAllReduce),
+        m_bucketSizeInBytes(bucketSizeInBytes), m_useBuckets(false), m_numBucketsLaunched(0), m_numBucketsCompleted(0), m_stopCommunicationThread(false)
+    {
+        if (useBuiltinAllReduce)
+            m_allReduceEngine.reset(new AllReduceEngine<ElemType>(mpi));
+    }
 
     ~SimpleDistGradAggregator()
     {
+        if (m_communicationThread.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_bucketMutex);
+                m_stopCommunicationThread = true;
+            }
+            m_bucketsChanged.notify_all();
+            m_communicationThread.join();
+        }
+
         for (size_t i = 0; i < m_recvHeaders.size(); ++i)
             DistGradHeader::Destroy(m_recvHeaders[i]);
 
@@ -125,6 +154,42 @@ public:
         }
     }
 
+    bool OverlapsWithBackprop() const override
+    {
+        return m_bucketSizeInBytes > 0 && !m_useAsyncAggregation;
+    }
+
+    // Groups gradients, given by their number of elements in the order in which backprop finalizes them, into buckets
+    // of consecutive gradients of at most bucketSizeInBytes. A gradient larger than that gets a bucket of its own.
+    static std::vector<std::vector<size_t>> PartitionIntoBuckets(const std::vector<size_t>& numElements, size_t bucketSizeInBytes)
+    {
+        std::vector<std::vector<size_t>> buckets;
+        size_t bucketNumElements = 0;
+        for (size_t i = 0; i < numElements.size(); i++)
+        {
+            if (buckets.empty() || (bucketNumElements > 0 && sizeof(ElemType) * (bucketNumElements + numElements[i]) > bucketSizeInBytes))
+            {
+                buckets.push_back(std::vector<size_t>());
+                bucketNumElements = 0;
+            }
+            buckets.back().push_back(i);
+            bucketNumElements += numElements[i];
+        }
+        return buckets;
+    }
+
+    void OnGradientReady(const Matrix<ElemType>* gradient) override
+    {
+        if (!m_useBuckets)
+            return;
+        auto iter = m_bucketedGradientIndex.find(gradient);
+        if (iter == m_bucketedGradientIndex.end())
+            return;
+
+        std::lock_guard<std::mutex> lock(m_bucketMutex);
+        MarkGradientReady(iter->second);
+    }
+
 private:
     std::shared_ptr<ElemType> AllocateIntermediateBuffer(int deviceID, size_t numElements)
     {
@@ -138,6 +203,29 @@ private:
                                          });
     }
 
+    // hierarchical reduction only pays off if ranks share a host; all ranks must decide alike, even those alone on theirs
+    bool UseHierarchicalAllReduce() const
+    {
+        return m_useHierarchicalAllReduce && m_mpi->MaxNumLocalRanks() > 1;
+    }
+
+    // whether CPU buffers are reduced by AllReduceOnCPU() instead of Iallreduce
+    bool UseBlockingAllReduceOnCPU() const
+    {
+        return UseHierarchicalAllReduce() || m_allReduceEngine;
+    }
+
+    // blocking allreduce of a CPU buffer
+    void AllReduceOnCPU(ElemType* data, size_t numElements)
+    {
+        if (UseHierarchicalAllReduce())
+            m_mpi->HierarchicalAllReduce(data, numElements);
+        else if (m_allReduceEngine)
+            m_allReduceEngine->AllReduce(data, numElements);
+        else
+            m_mpi->AllReduce(data, numElements);
+    }
+
     bool ShouldCopyDataToCPU(int deviceId)
     {
         // Do not copy if data is on CPU
@@ -165,10 +253,36 @@ private:
                 m_allocator.reset(new CUDAPageLockedMemAllocator(deviceId));
             }
 
+            if (OverlapsWithBackprop())
+            {
+                m_useBuckets = (deviceId == CPUDEVICE) && !m_nccl.IsSupported() && (m_mpi->UseGpuGdr() == 0);
+                if (!m_useBuckets)
+                    fprintf(stderr, "WARNING: Bucketed gradient aggregation is only supported for CPU gradients; aggregating after backprop.\n");
+            }
+
+            // Sparse gradients are aggregated separately. A worker that did not backprop through a sparse
+            // gradient yet still has it dense, so all workers agree on the sparse ones first.
+            std::vector<int> isSparse(gradients.size());
+            for (size_t i = 0; i < gradients.size(); i++)
+                isSparse[i] = (gradients[i]->GetMatrixType() != DENSE) ? 1 : 0;
+            m_mpi->AllReduce(isSparse);
+
+            std::vector<Matrix<ElemType>*> denseGradients;
             size_t packedGradientsSizeInElements = 0;
             for (size_t i = 0; i < gradients.size(); i++)
             {
-                if (!m_useAsyncAggregation && sizeof(ElemType) * gradients[i]->GetNumElements() <= m_packThresholdSizeInBytes)
+                if (isSparse[i] > 0)
+                {
+                    if (deviceId != CPUDEVICE || m_useAsyncAggregation ||
+                        (gradients[i]->GetMatrixType() != DENSE && gradients[i]->GetFormat() != matrixFormatSparseBlockCol))
+                        RuntimeError("Gradient aggregation for sparse gradient matrices is only supported for sparse block column gradients on the CPU, without buffered async aggregation!");
+
+                    m_sparseGradientIndex.push_back(i);
+                    continue;
+                }
+                denseGradients.push_back(gradients[i]);
+
+                if (!m_useAsyncAggregation && !m_useBuckets && sizeof(ElemType) * gradients[i]->GetNumElements() <= m_packThresholdSizeInBytes)
                 {
                     packedGradientsSizeInElements += gradients[i]->GetNumElements();
                     m_packedGradientsIndex.push_back(i);
@@ -178,10 +292,6 @@ private:
                     m_gradientIndexToAggregate.push_back(i);
                 }
 
-                // Make sure none of the gradient matrixes are sparse - we currently do not support aggregation of sparse gradient matrices
-                if (gradients[i]->GetMatrixType() != DENSE)
-                    RuntimeError("Gradient aggregation for sparse gradient matrices is currently unsupported!");
-
                 if (m_useAsyncAggregation)
                     m_bufferedGradients[gradients[i]].reset(new Matrix<ElemType>(gradients[i]->GetNumRows(), gradients[i]->GetNumCols(), deviceId));
             }
@@ -201,7 +311,8 @@ private:
                 // Reuse "@param m_gradientIndexToAggregate" for following code, if no continous buffer allocated
                 for (size_t i = 0; i < gradients.size(); i++)
                 {
-                    m_gradientIndexToAggregate.push_back(i);
+                    if (isSparse[i] == 0)
+                        m_gradientIndexToAggregate.push_back(i);
                 }
             }
             else
@@ -210,6 +321,13 @@ private:
                 m_gradientIndexToAggregate.insert(m_gradientIndexToAggregate.begin(), 1, (size_t)-1);
             }
 
+            // With buckets, all gradients are aggregated by the communication thread instead
+            if (m_useBuckets)
+            {
+                m_gradientIndexToAggregate.clear();
+                InitializeBuckets(denseGradients);
+            }
+
             if (ShouldCopyDataToCPU(deviceId))
             {
                 for (size_t i : m_gradientIndexToAggregate)
@@ -280,6 +398,11 @@ private:
             }
         }
 
+        // Wait for the buckets that were launched during backprop, and launch the remaining ones.
+        // This must complete before the header exchange below, since MPI is only used by one thread at a time.
+        if (m_useBuckets)
+            FinishBucketedAggregation(showSyncPerfStats);
+
         // Copy all gradient data into a single contiguous buffer, if additional continous buffer allocated
         size_t offset = 0;
         for (size_t i : m_packedGradientsIndex)
@@ -364,7 +487,7 @@ private:
                     
                     // Allreduce
                     reductionBuffer = m_intermediateCPUBuffers[allReduceIndex].get();
-                    m_mpi->AllReduce(reductionBuffer, (currentGradientIndex == -1) ? m_aggregationBuffer->GetNumElements() : gradients[currentGradientIndex]->GetNumElements());
+                    AllReduceOnCPU(reductionBuffer, (currentGradientIndex == -1) ? m_aggregationBuffer->GetNumElements() : gradients[currentGradientIndex]->GetNumElements());
 
                     // Create async H-to-G copy
                     cpuToGpuIndex = allReduceIndex;
@@ -384,8 +507,13 @@ private:
                 {
                     allReduceRequests.push_back(MPI_Request());
                     reductionBuffer = (i == -1)? m_aggregationBuffer->Data() : gradients[i]->Data();
+                    // CPU, hierarchical or built-in
+                    if ((m_mpi->UseGpuGdr() == 0) && UseBlockingAllReduceOnCPU())
+                    {
+                        AllReduceOnCPU(reductionBuffer, (i == -1) ? m_aggregationBuffer->GetNumElements() : gradients[i]->GetNumElements());
+                    }
                     // CPU
-                    if (m_mpi->UseGpuGdr() == 0)
+                    else if (m_mpi->UseGpuGdr() == 0)
                     {
                         m_mpi->Iallreduce(MPI_IN_PLACE, reductionBuffer, (i == -1) ? m_aggregationBuffer->GetNumElements() : gradients[i]->GetNumElements(),
                             MPIWrapper::GetDataType(reductionBuffer), MPI_SUM, &allReduceRequests.back()) || MpiFail("MPI_Iallreduce");
@@ -409,6 +537,9 @@ private:
             }
         }
 
+        if (!m_sparseGradientIndex.empty())
+            AggregateSparseGradients(gradients, showSyncPerfStats);
+
         // On the main node wait for the headers to arrive and aggregate
         if (m_mpi->IsMainNode())
         {
@@ -474,6 +605,260 @@ private:
         }
     }
 
+    // -----------------------------------------------------------------------
+    // sparse aggregation
+    // Sparse block column gradients (e.g. of embeddings) are not densified. The workers exchange the columns
+    // they touched, then each worker lays out its blocks for the union of these columns in ascending column order,
+    // and only the values of these blocks are all-reduced. If the touched columns of all workers add up to more than
+    // m_sparseGradientDensityThreshold of all columns, the index exchange is skipped and all columns are reduced.
+    // -----------------------------------------------------------------------
+
+    void AggregateSparseGradients(const std::vector<Matrix<ElemType>*>& gradients, bool showSyncPerfStats)
+    {
+        size_t numReducedElements = 0;
+        size_t numDenseElements = 0;
+        for (size_t i : m_sparseGradientIndex)
+        {
+            auto& gradient = *gradients[i];
+
+            // not touched by backprop on this worker yet, hence zero
+            if (gradient.GetMatrixType() == DENSE)
+            {
+                gradient.SwitchToMatrixType(SPARSE, matrixFormatSparseBlockCol, /*keepValues=*/false);
+                gradient.Reset();
+            }
+
+            const size_t numRows = gradient.GetNumRows();
+            const size_t numCols = gradient.GetNumCols();
+            const std::vector<size_t> columns = gradient.GetSparseBlockColumns();
+
+            // the sum of the counts bounds the size of the union, and is the same on all workers
+            int numColumns = (int) columns.size();
+            std::vector<int> numColumnsPerWorker(NumProc());
+            m_mpi->AllGather(&numColumns, 1, numColumnsPerWorker.data(), 1);
+            size_t totalNumColumns = std::accumulate(numColumnsPerWorker.begin(), numColumnsPerWorker.end(), (size_t) 0);
+
+            std::vector<GPUSPARSE_INDEX_TYPE> col2BlockId(numCols, SparseIndex_NotAssigned);
+            size_t numBlocks = 0;
+            if (totalNumColumns > m_sparseGradientDensityThreshold * numCols)
+            {
+                for (size_t j = 0; j < numCols; j++)
+                    col2BlockId[j] = (GPUSPARSE_INDEX_TYPE) numBlocks++;
+            }
+            else
+            {
+                std::vector<int> offsets(NumProc(), 0);
+                for (size_t k = 1; k < offsets.size(); k++)
+                    offsets[k] = offsets[k - 1] + numColumnsPerWorker[k - 1];
+
+                std::vector<int> localColumns(columns.begin(), columns.end());
+                std::vector<int> allColumns(std::max(totalNumColumns, (size_t) 1));
+                m_mpi->AllGatherv(localColumns.data(), localColumns.size(), allColumns.data(), numColumnsPerWorker.data(), offsets.data());
+
+                for (size_t k = 0; k < totalNumColumns; k++)
+                    col2BlockId[allColumns[k]] = 0;
+                for (size_t j = 0; j < numCols; j++)
+                {
+                    if (col2BlockId[j] != SparseIndex_NotAssigned)
+                        col2BlockId[j] = (GPUSPARSE_INDEX_TYPE) numBlocks++;
+                }
+            }
+
+            gradient.AdjustSparseBlockColumn(col2BlockId.data(), numBlocks, /*useBlockId2Col=*/false);
+            if (numBlocks > 0)
+                AllReduceOnCPU(gradient.Data(), numBlocks * numRows);
+
+            numReducedElements += numBlocks * numRows;
+            numDenseElements += numCols * numRows;
+        }
+
+        if (showSyncPerfStats)
+            fprintf(stderr, "Sparse gradient aggregation: %d gradients, %.6g MB reduced instead of %.6g MB\n", (int) m_sparseGradientIndex.size(),
+                    sizeof(ElemType) * numReducedElements / 1e6, sizeof(ElemType) * numDenseElements / 1e6);
+    }
+
+    // -----------------------------------------------------------------------
+    // bucketed aggregation
+    // Gradients are grouped into buckets in the order in which backprop finalizes them. As soon as all gradients
+    // of a bucket are final, a communication thread starts an Iallreduce for it, while backprop continues.
+    // Buckets are launched strictly in bucket order, which is the same on all workers, as required for the
+    // collective operations. Small gradients are packed into a per-bucket buffer, large ones are reduced in place.
+    // -----------------------------------------------------------------------
+
+    struct GradientBucket
+    {
+        std::vector<size_t> gradientIndices; // into m_bucketedGradients
+        size_t numElements = 0;
+        std::vector<ElemType> buffer;        // packed gradients; empty if the bucket holds a single gradient, which is reduced in place
+        size_t numPending = 0;               // number of gradients not yet final in the current minibatch
+        MPI_Request request;
+    };
+
+    void InitializeBuckets(const std::vector<Matrix<ElemType>*>& gradients)
+    {
+        m_buckets.clear();
+        m_bucketedGradients = gradients;
+        m_bucketedGradientIndex.clear();
+        m_bucketOfGradient.resize(gradients.size());
+        m_isGradientReady.assign(gradients.size(), false);
+        std::vector<size_t> numElements(gradients.size());
+        for (size_t i = 0; i < gradients.size(); i++)
+        {
+            numElements[i] = gradients[i]->GetNumElements();
+            m_bucketedGradientIndex[gradients[i]] = i;
+        }
+        for (const auto& gradientIndices : PartitionIntoBuckets(numElements, m_bucketSizeInBytes))
+        {
+            m_buckets.push_back(GradientBucket());
+            auto& bucket = m_buckets.back();
+            bucket.gradientIndices = gradientIndices;
+            for (size_t i : gradientIndices)
+            {
+                bucket.numElements += numElements[i];
+                m_bucketOfGradient[i] = m_buckets.size() - 1;
+            }
+            if (bucket.gradientIndices.size() > 1)
+                bucket.buffer.resize(bucket.numElements);
+            bucket.numPending = bucket.gradientIndices.size();
+        }
+
+        fprintf(stderr, "Bucketed gradient aggregation: %d gradients in %d buckets of up to %d KB.\n",
+                (int) gradients.size(), (int) m_buckets.size(), (int) (m_bucketSizeInBytes / 1024));
+        m_communicationThread = std::thread([this]() { CommunicationThreadProc(); });
+    }
+
+    // (m_bucketMutex must be held)
+    void MarkGradientReady(size_t i)
+    {
+        if (m_isGradientReady[i])
+            return;
+        m_isGradientReady[i] = true;
+        if (--m_buckets[m_bucketOfGradient[i]].numPending == 0)
+            m_bucketsChanged.notify_all();
+    }
+
+    void LaunchBucket(GradientBucket& bucket)
+    {
+        ElemType* data;
+        if (bucket.buffer.empty())
+            data = m_bucketedGradients[bucket.gradientIndices.front()]->Data();
+        else
+        {
+            data = bucket.buffer.data();
+            size_t offset = 0;
+            for (size_t i : bucket.gradientIndices)
+            {
+                const auto& gradient = *m_bucketedGradients[i];
+                memcpy(data + offset, gradient.Data(), sizeof(ElemType) * gradient.GetNumElements());
+                offset += gradient.GetNumElements();
+            }
+        }
+        // a blocking allreduce completes here, on the communication thread
+        if (UseBlockingAllReduceOnCPU())
+            AllReduceOnCPU(data, bucket.numElements);
+        else
+            m_mpi->Iallreduce(MPI_IN_PLACE, data, (int) bucket.numElements, MPIWrapper::GetDataType(data), MPI_SUM, &bucket.request) || MpiFail("MPI_Iallreduce");
+    }
+
+    void UnpackBucket(const GradientBucket& bucket)
+    {
+        size_t offset = 0;
+        for (size_t i : bucket.gradientIndices)
+        {
+            auto& gradient = *m_bucketedGradients[i];
+            memcpy(gradient.Data(), bucket.buffer.data() + offset, sizeof(ElemType) * gradient.GetNumElements());
+            offset += gradient.GetNumElements();
+        }
+    }
+
+    void CommunicationThreadProc()
+    {
+        std::unique_lock<std::mutex> lock(m_bucketMutex);
+        while (!m_stopCommunicationThread)
+        {
+            try
+            {
+                // launch the next bucket once all its gradients are final
+                if (m_numBucketsLaunched < m_buckets.size() && m_buckets[m_numBucketsLaunched].numPending == 0)
+                {
+                    if (m_numBucketsLaunched == 0)
+                        m_firstLaunchTime = std::chrono::steady_clock::now();
+                    auto& bucket = m_buckets[m_numBucketsLaunched];
+                    lock.unlock();
+                    LaunchBucket(bucket);
+                    lock.lock();
+                    m_numBucketsLaunched++;
+                    continue;
+                }
+
+                // drive the oldest in-flight reduction; the reductions complete in launch order
+                if (m_numBucketsCompleted < m_numBucketsLaunched)
+                {
+                    auto& bucket = m_buckets[m_numBucketsCompleted];
+                    int completed = 0;
+                    lock.unlock();
+                    if (UseBlockingAllReduceOnCPU())
+                        completed = 1; // already reduced by LaunchBucket()
+                    else
+                        m_mpi->Test(&bucket.request, &completed, MPI_STATUS_IGNORE) || MpiFail("MPI_Test");
+                    if (completed && !bucket.buffer.empty())
+                        UnpackBucket(bucket);
+                    lock.lock();
+                    if (completed)
+                    {
+                        if (++m_numBucketsCompleted == m_buckets.size())
+                        {
+                            m_lastCompletionTime = std::chrono::steady_clock::now();
+                            m_bucketsChanged.notify_all();
+                        }
+                    }
+                    else
+                        m_bucketsChanged.wait_for(lock, std::chrono::microseconds(50));
+                    continue;
+                }
+            }
+            catch (...)
+            {
+                if (!lock.owns_lock())
+                    lock.lock();
+                m_communicationError = std::current_exception();
+                m_bucketsChanged.notify_all();
+                return;
+            }
+            m_bucketsChanged.wait(lock);
+        }
+    }
+
+    void FinishBucketedAggregation(bool showSyncPerfStats)
+    {
+        auto backpropEndTime = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> lock(m_bucketMutex);
+
+        // hand over the gradients that were not reported during backprop, e.g. when this worker had no samples
+        for (size_t i = 0; i < m_bucketedGradients.size(); i++)
+            MarkGradientReady(i);
+        m_bucketsChanged.notify_all();
+        m_bucketsChanged.wait(lock, [this]() { return m_numBucketsCompleted == m_buckets.size() || m_communicationError; });
+        if (m_communicationError)
+            std::rethrow_exception(m_communicationError);
+
+        if (showSyncPerfStats)
+        {
+            typedef std::chrono::duration<double> Seconds;
+            double communicationTime = Seconds(m_lastCompletionTime - m_firstLaunchTime).count();
+            double overlappedTime = std::max(0.0, Seconds(std::min(backpropEndTime, m_lastCompletionTime) - m_firstLaunchTime).count());
+            fprintf(stderr, "Bucketed gradient aggregation: %d buckets, communication time: %.6g, overlapped with backprop: %.6g (%.1f%%)\n",
+                    (int) m_buckets.size(), communicationTime, overlappedTime, communicationTime > 0 ? 100.0 * overlappedTime / communicationTime : 0.0);
+        }
+
+        // prepare for the next minibatch
+        m_isGradientReady.assign(m_isGradientReady.size(), false);
+        for (auto& bucket : m_buckets)
+            bucket.numPending = bucket.gradientIndices.size();
+        m_numBucketsLaunched = 0;
+        m_numBucketsCompleted = 0;
+    }
+
 private:
     std::unique_ptr<CUDAPageLockedMemAllocator> m_allocator;
 
@@ -499,6 +884,13 @@ private:
     std::vector<size_t> m_packedGradientsIndex;
     std::vector<size_t> m_gradientIndexToAggregate;
 
+    // Sparse block column gradients, aggregated by AggregateSparseGradients()
+    std::vector<size_t> m_sparseGradientIndex;
+    const double m_sparseGradientDensityThreshold;
+
+    const bool m_useHierarchicalAllReduce;
+    std::unique_ptr<AllReduceEngine<ElemType>> m_allReduceEngine;
+
     int m_syncStatsTrace;
 
     // Only used for controlling frequency of measuring/showing gradient aggregation perf stats
@@ -507,5 +899,24 @@ private:
     bool m_initialized;
 
     NcclComm m_nccl;
+
+    const size_t m_bucketSizeInBytes;
+    bool m_useBuckets;
+    std::vector<Matrix<ElemType>*> m_bucketedGradients;
+    std::unordered_map<const Matrix<ElemType>*, size_t> m_bucketedGradientIndex;
+    std::vector<size_t> m_bucketOfGradient;
+    std::vector<GradientBucket> m_buckets;
+
+    // state shared with the communication thread, guarded by m_bucketMutex
+    std::mutex m_bucketMutex;
+    std::condition_variable m_bucketsChanged;
+    std::vector<bool> m_isGradientReady;
+    size_t m_numBucketsLaunched;
+    size_t m_numBucketsCompleted;
+    bool m_stopCommunicationThread;
+    std::exception_ptr m_communicationError;
+    std::chrono::steady_clock::time_point m_firstLaunchTime;
+    std::chrono::steady_clock::time_point m_lastCompletionTime;
+    std::thread m_communicationThread;
 };
 } } }
@@ -112,6 +112,7 @@ void TestFrameMode()
     // Create a set of trainers.
     std::map<std::wstring, std::function<DistributedLearnerPtr(LearnerPtr)>> learners;
     learners[L"simple"] = [](LearnerPtr l) { return CreateDataParallelDistributedLearner(MPICommunicator(), l, 0); };
+    learners[L"compressed"] = [](LearnerPtr l) { return CreateDataParallelDistributedLearner(CompressedMPICommunicator(2), l, 0); };
 
     if (Is1bitSGDAvailable())
     {
@@ -235,3 +236,81 @@ void TestDistributedCheckpointing()
 
     sync->Barrier();
 }
+
+void TestCompressedAggregation()
+{
+    auto sync = MPICommunicator();
+    auto numWorkers = sync->Workers().size();
+    auto workerRank = sync->CurrentWorker().m_globalRank;
+
+    // One column more than a multiple of the number of workers, so that the stripes differ in size.
+    const size_t numRows = 5;
+    const size_t numCols = 2 * numWorkers + 1;
+    const size_t numAggregations = 30;
+    const size_t numQuantizationBits = 8;
+
+    // The same values are aggregated on every call, so that a quantization error that is not carried over
+    // to the next call adds up over the calls.
+    auto valueOf = [](size_t rank, size_t row, size_t col) { return (float)sin(1.0 + 7.0 * rank + 3.0 * row + col); };
+    std::vector<float> exactSum(numRows * numCols, 0);
+    for (size_t rank = 0; rank < numWorkers; ++rank)
+        for (size_t col = 0; col < numCols; ++col)
+            for (size_t row = 0; row < numRows; ++row)
+                exactSum[col * numRows + row] += valueOf(rank, row, col);
+
+    // Values are quantized column-wise between 4 standard deviations around the mean, which is wider than the
+    // values of a column, so the quantization error is at most one step of 8 stddevs / (2^bits - 1). The stddev is
+    // at most the largest magnitude of value plus residual, 1 + step for a worker and numWorkers times that for
+    // the sum of a stripe.
+    const double levels = (double)((1 << numQuantizationBits) - 1);
+    const double workerStep = 8 / (levels - 8);
+    const double stripeStep = numWorkers * workerStep;
+
+    // Each aggregate differs from the exact sum by the change of the residuals of all workers and of the stripe
+    // owner; summed over the calls only the final residuals remain. Both bounds get a headroom of 2.
+    const double maxError = 2 * 2 * (numWorkers * workerStep + stripeStep);
+    const double maxAccumulatedError = 2 * (numWorkers * workerStep + stripeStep);
+
+    auto communicator = CompressedMPICommunicator(numQuantizationBits);
+    auto value = MakeSharedObject<NDArrayView>(DataType::Float, NDShape({ numRows, numCols }), DeviceDescriptor::CPUDevice());
+    auto checkValue = MakeSharedObject<NDArrayView>(DataType::Double, NDShape({ numRows, numCols }), DeviceDescriptor::CPUDevice());
+    std::vector<double> accumulatedError(numRows * numCols, 0);
+    for (size_t k = 0; k < numAggregations; ++k)
+    {
+        auto data = value->WritableDataBuffer<float>();
+        for (size_t col = 0; col < numCols; ++col)
+            for (size_t row = 0; row < numRows; ++row)
+                data[col * numRows + row] = valueOf(workerRank, row, col);
+
+        communicator->AggregateInPlace({ value }, sync->Workers());
+
+        for (size_t i = 0; i < exactSum.size(); ++i)
+        {
+            double error = (double)data[i] - exactSum[i];
+            if (std::abs(error) > maxError)
+                ReportFailure("Compressed aggregate %zu differs from the exact sum by %g at %zu (allowed %g).", k, error, i, maxError);
+            accumulatedError[i] += error;
+        }
+
+        // All workers must end up with the same values: the sum over the workers in full precision
+        // is then exactly numWorkers times the own value.
+        auto check = checkValue->WritableDataBuffer<double>();
+        for (size_t i = 0; i < exactSum.size(); ++i)
+            check[i] = data[i];
+        sync->AggregateInPlace({ checkValue }, sync->Workers());
+        for (size_t i = 0; i < exactSum.size(); ++i)
+        {
+            if (check[i] != numWorkers * (double)data[i])
+                ReportFailure("Compressed aggregate %zu differs between the workers at %zu.", k, i);
+        }
+    }
+
+    // The residuals are carried over between the calls.
+    for (size_t i = 0; i < accumulatedError.size(); ++i)
+    {
+        if (std::abs(accumulatedError[i]) > maxAccumulatedError)
+            ReportFailure("Accumulated error %g of the compressed aggregates at %zu exceeds the final residuals (%g).", accumulatedError[i], i, maxAccumulatedError);
+    }
+
+    sync->Barrier();
+}
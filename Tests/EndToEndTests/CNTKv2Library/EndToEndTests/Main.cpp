@@ -22,6 +22,7 @@ void TrainSequenceToSequenceTranslator();
 void TrainTruncatedLSTMAcousticModelClassifier();
 void TestFrameMode();
 void TestDistributedCheckpointing();
+void TestCompressedAggregation();
 
 int main(int argc, char *argv[])
 {
@@ -61,6 +62,8 @@ int main(int argc, char *argv[])
 
             TestDistributedCheckpointing();
 
+            TestCompressedAggregation();
+
             std::string testsPassedMsg = "\nCNTKv2Library-Distribution tests: Passed\n";
 
             printf("%s", testsPassedMsg.c_str());
@@ -0,0 +1,113 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+// AllReducePerformanceTests.cpp : sweeps the message size of a sum allreduce over the MPI processes, comparing
+// MPI_Allreduce with the ring and recursive halving-doubling algorithms of AllReduceEngine and with
+// MPIWrapper::HierarchicalAllReduce(), which sums over the ranks of a host in shared memory first.
+//
+// Usage: mpiexec -n <numProcesses> allreduceperftests [maxSizeInMB [numRepetitions]]
+//
+#include "Basics.h"
+#include "MPIWrapper.h"
+#include "AllReduceEngine.h"
+#include "V2Dependencies.h"
+#include <chrono>
+#include <functional>
+#include <vector>
+
+using namespace Microsoft::MSR::CNTK;
+using namespace std;
+
+// Returns the time of one allreduce in seconds, averaged over repetitions and ranks.
+// Checks that the result is the sum over the ranks.
+static double TimeAllReduce(const MPIWrapperPtr& mpi, const function<void(float*, size_t)>& allReduce, size_t numElements, size_t numRepetitions)
+{
+    const size_t numRanks = mpi->NumNodesInUse();
+    const size_t rank = mpi->CurrentNodeRank();
+    vector<float> data(numElements);
+    double seconds = 0;
+    for (size_t r = 0; r <= numRepetitions; r++) // the first run is a warm-up
+    {
+        for (size_t i = 0; i < numElements; i++)
+            data[i] = (float) (rank + i % 16);
+        mpi->WaitAll();
+
+        auto start = chrono::steady_clock::now();
+        allReduce(data.data(), numElements);
+        if (r > 0)
+            seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        for (size_t i = 0; i < numElements; i++)
+        {
+            if (data[i] != (float) (numRanks * (numRanks - 1) / 2 + numRanks * (i % 16)))
+                RuntimeError("allreduce returned a wrong sum at element %d of %d", (int) i, (int) numElements);
+        }
+    }
+
+    vector<double> totalSeconds(1, seconds);
+    mpi->AllReduce(totalSeconds);
+    return totalSeconds[0] / numRanks / numRepetitions;
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        size_t maxSizeInBytes = ((argc > 1) ? (size_t) atoi(argv[1]) : 64) * 1024 * 1024;
+        size_t numRepetitions = (argc > 2) ? (size_t) atoi(argv[2]) : 10;
+
+        auto mpi = MPIWrapper::GetInstance(true /*create*/);
+        const size_t numRanks = mpi->NumNodesInUse();
+        AllReduceEngine<float> engine(mpi);
+        vector<float> calibrationData(1);
+        engine.AllReduce(calibrationData.data(), calibrationData.size()); // determines the ring threshold
+
+        vector<pair<const char*, function<void(float*, size_t)>>> algorithms =
+        {
+            { "MPI", [&](float* data, size_t numElements) { mpi->AllReduce(data, numElements); } },
+            { "ring", [&](float* data, size_t numElements) { engine.RingAllReduce(data, numElements); } },
+            { "halving", [&](float* data, size_t numElements) { engine.RecursiveHalvingDoublingAllReduce(data, numElements); } },
+            { "auto", [&](float* data, size_t numElements) { engine.AllReduce(data, numElements); } },
+            { "hierarchical", [&](float* data, size_t numElements) { mpi->HierarchicalAllReduce(data, numElements); } },
+        };
+
+        // bus bandwidth: the bandwidth of each link, as the bandwidth optimal algorithm moves 2 (p-1)/p of the data per rank
+        if (mpi->IsMainNode())
+        {
+            fprintf(stderr, "%d processes, %d repetitions; time in microseconds (bus bandwidth in GB/s)\n", (int) numRanks, (int) numRepetitions);
+            fprintf(stderr, "%12s", "bytes");
+            for (const auto& algorithm : algorithms)
+                fprintf(stderr, " %20s", algorithm.first);
+            fprintf(stderr, "\n");
+        }
+
+        for (size_t sizeInBytes = sizeof(float); sizeInBytes <= maxSizeInBytes; sizeInBytes *= 4)
+        {
+            vector<double> seconds;
+            for (const auto& algorithm : algorithms)
+                seconds.push_back(TimeAllReduce(mpi, algorithm.second, sizeInBytes / sizeof(float), numRepetitions));
+
+            if (mpi->IsMainNode())
+            {
+                fprintf(stderr, "%12d", (int) sizeInBytes);
+                for (double s : seconds)
+                    fprintf(stderr, " %11.1f (%6.2f)", s * 1e6, 2.0 * (numRanks - 1) / numRanks * sizeInBytes / s / 1e9);
+                fprintf(stderr, "\n");
+            }
+        }
+
+        if (mpi->IsMainNode() && engine.RingThresholdInBytes() != SIZE_MAX)
+            fprintf(stderr, "auto switches to the ring at %d KB\n", (int) (engine.RingThresholdInBytes() / 1024));
+
+        mpi->WaitAll();
+        mpi->Finalize();
+        MPIWrapper::DeleteInstance();
+    }
+    catch (const exception& e)
+    {
+        fprintf(stderr, "EXCEPTION occurred: %s\n", e.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
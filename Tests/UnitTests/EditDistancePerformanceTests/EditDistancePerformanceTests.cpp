@@ -0,0 +1,130 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+// EditDistancePerformanceTests.cpp : sweeps the sequence length of the edit distance computation of the EditDistanceError node,
+// comparing the DP with the bit-parallel algorithm, each on one thread and with the sequences of a minibatch in parallel.
+//
+// Usage: editdistanceperftests [maxSequenceLength [numSequences [numRepetitions]]]
+//
+#include "EditDistance.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace Microsoft::MSR::CNTK;
+using namespace std;
+
+typedef vector<vector<int>> Minibatch;
+
+// reference and hypothesis sequences as from a recognizer: the hypotheses are the references with about 20% errors
+static void MakeMinibatch(size_t sequenceLength, size_t numSequences, Minibatch& references, Minibatch& hypotheses)
+{
+    const int numLabels = 40;
+    mt19937 rng(0);
+    references.assign(numSequences, vector<int>());
+    hypotheses.assign(numSequences, vector<int>());
+    for (size_t k = 0; k < numSequences; k++)
+    {
+        for (size_t i = 0; i < sequenceLength; i++)
+        {
+            int label = (int) (rng() % numLabels);
+            references[k].push_back(label);
+            switch (rng() % 15)
+            {
+                case 0: break;                                                     // deletion
+                case 1: hypotheses[k].push_back((int) (rng() % numLabels)); break; // substitution
+                case 2: hypotheses[k].push_back((int) (rng() % numLabels));        // insertion, followed by the label
+                default: hypotheses[k].push_back(label);
+            }
+        }
+    }
+}
+
+// Returns the time for a minibatch in seconds, averaged over repetitions, and the total number of edit operations.
+static double TimeMinibatch(const function<float(const vector<int>&, const vector<int>&)>& editDistance, bool parallel,
+                            const Minibatch& references, const Minibatch& hypotheses, size_t numRepetitions, double& numErrors)
+{
+    vector<float> errorNums(references.size());
+    double seconds = 0;
+    for (size_t r = 0; r <= numRepetitions; r++) // the first run is a warm-up
+    {
+        auto start = chrono::steady_clock::now();
+        if (parallel)
+        {
+#pragma omp parallel for schedule(dynamic)
+            for (long k = 0; k < (long) references.size(); k++)
+                errorNums[k] = editDistance(references[k], hypotheses[k]);
+        }
+        else
+        {
+            for (size_t k = 0; k < references.size(); k++)
+                errorNums[k] = editDistance(references[k], hypotheses[k]);
+        }
+        if (r > 0)
+            seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    }
+
+    numErrors = 0;
+    for (float errorNum : errorNums)
+        numErrors += errorNum;
+    return seconds / numRepetitions;
+}
+
+int main(int argc, char* argv[])
+{
+    size_t maxSequenceLength = (argc > 1) ? (size_t) atoi(argv[1]) : 8192;
+    size_t numSequences = (argc > 2) ? (size_t) atoi(argv[2]) : 32;
+    size_t numRepetitions = (argc > 3) ? (size_t) atoi(argv[3]) : 3;
+
+    vector<pair<const char*, function<float(const vector<int>&, const vector<int>&)>>> algorithms =
+    {
+        { "DP", [](const vector<int>& a, const vector<int>& b) { return EditOperationCount(a.data(), a.size(), b.data(), b.size(), 1, 1, 1); } },
+        { "bit-parallel", [](const vector<int>& a, const vector<int>& b) { return (float) LevenshteinDistance(a.data(), a.size(), b.data(), b.size()); } },
+    };
+
+    fprintf(stderr, "%d sequences per minibatch, %d repetitions; time per minibatch in milliseconds (grid cells per nanosecond)\n", (int) numSequences, (int) numRepetitions);
+    fprintf(stderr, "%8s", "length");
+    for (const auto& algorithm : algorithms)
+        fprintf(stderr, " %21s %21s", algorithm.first, "(parallel)");
+    fprintf(stderr, "\n");
+
+    // powers of 2 from 16, and the maximum length itself
+    vector<size_t> sequenceLengths;
+    for (size_t sequenceLength = 16; sequenceLength < maxSequenceLength; sequenceLength *= 2)
+        sequenceLengths.push_back(sequenceLength);
+    sequenceLengths.push_back(maxSequenceLength);
+
+    for (size_t sequenceLength : sequenceLengths)
+    {
+        Minibatch references, hypotheses;
+        MakeMinibatch(sequenceLength, numSequences, references, hypotheses);
+        double numCells = 0;
+        for (size_t k = 0; k < numSequences; k++)
+            numCells += (double) references[k].size() * hypotheses[k].size();
+
+        fprintf(stderr, "%8d", (int) sequenceLength);
+        double expectedNumErrors = -1;
+        for (const auto& algorithm : algorithms)
+        {
+            for (bool parallel : { false, true })
+            {
+                double numErrors;
+                double seconds = TimeMinibatch(algorithm.second, parallel, references, hypotheses, numRepetitions, numErrors);
+                if (expectedNumErrors < 0)
+                    expectedNumErrors = numErrors;
+                else if (numErrors != expectedNumErrors)
+                {
+                    fprintf(stderr, "\n%s returned %.0f edit operations instead of %.0f\n", algorithm.first, numErrors, expectedNumErrors);
+                    return EXIT_FAILURE;
+                }
+                fprintf(stderr, " %11.3f (%7.2f)", seconds * 1e3, numCells / seconds / 1e9);
+            }
+        }
+        fprintf(stderr, "\n");
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,157 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+// EvalBatcherPerformanceTests.cpp : load generator for EvalBatcher. Concurrent clients send single-sample requests back
+// to back to a small feed-forward network. For each maximum batch size and maximum latency of the batcher, and each
+// number of clients, reports the throughput against the p50 and p99 request latencies, and checks every output against
+// unbatched evaluation.
+//
+// Usage: evalbatcherperftests [maxClients [numRequestsPerClient]]
+//
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Eval.h"
+#include "EvalBatcher.h"
+
+using namespace Microsoft::MSR::CNTK;
+using namespace std;
+
+struct LoadResult
+{
+    double requestsPerSecond;
+    double p50Milliseconds;
+    double p99Milliseconds;
+    size_t numErrors;
+};
+
+// Runs numClients threads, each sending numRequestsPerClient requests one after the other through the batcher.
+// Returns the throughput, the latency percentiles over all requests, and the number of wrong output elements.
+static LoadResult GenerateLoad(EvalBatcher<float>& batcher, size_t numClients, size_t numRequestsPerClient,
+                               const vector<float>& input, const vector<float>& expected)
+{
+    vector<vector<double>> latencies(numClients);
+    vector<size_t> numErrors(numClients, 0);
+    vector<thread> clients;
+    auto start = chrono::steady_clock::now();
+    for (size_t c = 0; c < numClients; c++)
+    {
+        clients.push_back(thread([&, c]()
+        {
+            vector<float> clientInput = input;
+            ValueRefs<float> inputRefs(1);
+            inputRefs[0].m_buffer.InitFrom(clientInput);
+            vector<float> output(expected.size());
+            ValueRefs<float> outputRefs(1);
+            for (size_t r = 0; r < numRequestsPerClient; r++)
+            {
+                outputRefs[0].m_buffer.InitFrom(output.data(), output.size(), 0);
+                auto requestStart = chrono::steady_clock::now();
+                batcher.ForwardPass(inputRefs, outputRefs);
+                latencies[c].push_back(chrono::duration<double, milli>(chrono::steady_clock::now() - requestStart).count());
+                for (size_t j = 0; j < expected.size(); j++)
+                    numErrors[c] += fabs(output[j] - expected[j]) > 1e-4f;
+            }
+        }));
+    }
+    for (auto& client : clients)
+        client.join();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    vector<double> all;
+    LoadResult result{};
+    for (size_t c = 0; c < numClients; c++)
+    {
+        all.insert(all.end(), latencies[c].begin(), latencies[c].end());
+        result.numErrors += numErrors[c];
+    }
+    sort(all.begin(), all.end());
+    result.requestsPerSecond = all.size() / seconds;
+    result.p50Milliseconds = all[all.size() / 2];
+    result.p99Milliseconds = all[min(all.size() - 1, all.size() * 99 / 100)];
+    return result;
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        size_t maxClients = (argc > 1) ? (size_t) atoi(argv[1]) : 64;
+        size_t numRequestsPerClient = (argc > 2) ? (size_t) atoi(argv[2]) : 200;
+
+        string modelDefinition =
+            "deviceId = -1 \n"
+            "precision = \"float\" \n"
+            "traceLevel = 0 \n"
+            "run=NDLNetworkBuilder \n"
+            "NDLNetworkBuilder=[ \n"
+            "i1 = Input(256) \n"
+            "h1 = Sigmoid(Times(Parameter(512, 256, init=\"uniform\"), i1)) \n"
+            "o1 = Times(Parameter(10, 512, init=\"uniform\"), h1, tag=\"output\") \n"
+            "FeatureNodes = (i1) \n"
+            "] \n";
+
+        IEvaluateModelExtended<float>* eval;
+        GetEvalExtendedF(&eval);
+        eval->CreateNetwork(modelDefinition);
+        VariableSchema outputLayouts = eval->GetOutputSchema();
+        eval->StartForwardEvaluation({ outputLayouts[0].m_name });
+        outputLayouts = eval->GetOutputSchema();
+
+        vector<float> input(256);
+        for (size_t j = 0; j < input.size(); j++)
+            input[j] = (float) (j % 7) / 7;
+
+        // the unbatched reference, which also gives the latency of a single request without batching
+        Values<float> inputBuffer(1);
+        inputBuffer[0].m_buffer = input;
+        Values<float> outputBuffer = outputLayouts.CreateBuffers<float>({ 1 });
+        const size_t numUnbatchedRequests = 1000;
+        eval->ForwardPass(inputBuffer, outputBuffer);
+        auto start = chrono::steady_clock::now();
+        for (size_t r = 0; r < numUnbatchedRequests; r++)
+            eval->ForwardPass(inputBuffer, outputBuffer);
+        double unbatchedSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        vector<float> expected = outputBuffer[0].m_buffer;
+
+        fprintf(stderr, "%d requests per client; unbatched: %.1f requests/s, %.3f ms per request\n",
+                (int) numRequestsPerClient, numUnbatchedRequests / unbatchedSeconds, unbatchedSeconds / numUnbatchedRequests * 1e3);
+        fprintf(stderr, "%9s %11s %8s %14s %10s %10s\n", "batchSize", "latency(us)", "clients", "requests/s", "p50(ms)", "p99(ms)");
+
+        size_t numErrors = 0;
+        for (size_t maxBatchSize : { 1, 8, 32, 128 })
+        {
+            for (int maxLatency : { 100, 1000, 5000 })
+            {
+                EvalBatcher<float> batcher(eval, maxBatchSize, chrono::microseconds(maxLatency));
+                for (size_t numClients = 1; numClients <= maxClients; numClients *= 4)
+                {
+                    LoadResult result = GenerateLoad(batcher, numClients, numRequestsPerClient, input, expected);
+                    fprintf(stderr, "%9d %11d %8d %14.1f %10.3f %10.3f\n", (int) maxBatchSize, maxLatency, (int) numClients,
+                            result.requestsPerSecond, result.p50Milliseconds, result.p99Milliseconds);
+                    numErrors += result.numErrors;
+                }
+            }
+        }
+
+        eval->Destroy();
+        if (numErrors > 0)
+        {
+            fprintf(stderr, "EvalBatcher returned %d wrong output values\n", (int) numErrors);
+            return EXIT_FAILURE;
+        }
+    }
+    catch (const exception& e)
+    {
+        fprintf(stderr, "EXCEPTION occurred: %s\n", e.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
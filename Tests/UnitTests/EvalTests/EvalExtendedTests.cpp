@@ -4,9 +4,12 @@
 //
 #include "stdafx.h"
 #include "EvalTestHelper.h"
+#include "EvalBatcher.h"
 #include "ComputationNode.h"
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
+#include <thread>
+#include <chrono>
 
 using namespace Microsoft::MSR::CNTK;
 
@@ -60,7 +63,7 @@ BOOST_AUTO_TEST_CASE(CheckModelVersion)
     // This is a watch guard to make sure that any change in the model version will be detected. 
     // If you change the CNTK model version, please do not silently adapt this test. 
     // Instead, please do notify the CNTK release team (AlexeyO, Wolfgang, Zhou, Mark) to prepare required steps for the next release.
-    BOOST_REQUIRE_MESSAGE(CURRENT_CNTK_MODEL_VERSION == 28, "The model version has been changed. Before making changes in this test, please first notify the CNTK release team to prepare required steps in the next release. Thanks!\n");
+    BOOST_REQUIRE_MESSAGE(CURRENT_CNTK_MODEL_VERSION == 29, "The model version has been changed. Before making changes in this test, please first notify the CNTK release team to prepare required steps in the next release. Thanks!\n");
 }
 
 BOOST_AUTO_TEST_CASE(EvalConstantPlusTest)
@@ -175,6 +178,57 @@ BOOST_AUTO_TEST_CASE(EvalScalarTimesDualOutputTest)
     eval->Destroy();
 }
 
+BOOST_AUTO_TEST_CASE(EvalConcurrentSessionsTest)
+{
+    std::string modelDefinition =
+        "deviceId = -1 \n"
+        "precision = \"float\" \n"
+        "traceLevel = 1 \n"
+        "run=NDLNetworkBuilder \n"
+        "NDLNetworkBuilder=[ \n"
+        "i1 = Input(1) \n"
+        "o1 = Times(Constant(3), i1, tag=\"output\") \n"
+        "FeatureNodes = (i1) \n"
+        "] \n";
+
+    VariableSchema inputLayouts;
+    VariableSchema outputLayouts;
+    IEvaluateModelExtended<float> *eval;
+    eval = SetupNetworkAndGetLayouts(modelDefinition, inputLayouts, outputLayouts);
+
+    // Every session evaluates its own input on its own thread, sharing the parameters of 'eval'.
+    const size_t numSessions = 4;
+    std::vector<IEvaluateModelExtended<float>*> sessions;
+    for (size_t i = 0; i < numSessions; i++)
+        sessions.push_back(eval->CreateSession());
+
+    std::vector<float> results(numSessions);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numSessions; i++)
+    {
+        threads.push_back(std::thread([&, i]()
+        {
+            Values<float> inputBuffer(1);
+            Values<float> outputBuffer = outputLayouts.CreateBuffers<float>({ 1 });
+            for (size_t k = 0; k < 100; k++)
+            {
+                inputBuffer[0].m_buffer = { (float)i };
+                sessions[i]->ForwardPass(inputBuffer, outputBuffer);
+            }
+            results[i] = outputBuffer[0].m_buffer[0];
+        }));
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    for (size_t i = 0; i < numSessions; i++)
+    {
+        BOOST_CHECK_EQUAL(results[i], 3.0f * i);
+        sessions[i]->Destroy();
+    }
+    eval->Destroy();
+}
+
 BOOST_AUTO_TEST_CASE(EvalDenseTimesTest)
 {
     std::string modelDefinition =
@@ -227,6 +281,113 @@ BOOST_AUTO_TEST_CASE(EvalDenseTimesTest)
     eval->Destroy();
 }
 
+BOOST_AUTO_TEST_CASE(EvalDenseTimesBatchTest)
+{
+    std::string modelDefinition =
+        "deviceId = -1 \n"
+        "precision = \"float\" \n"
+        "traceLevel = 1 \n"
+        "run=NDLNetworkBuilder \n"
+        "NDLNetworkBuilder=[ \n"
+        "i1 = Input(4) \n"
+        "o1 = Times(Constant(2, rows=1, cols=4), i1, tag=\"output\") \n"
+        "FeatureNodes = (i1) \n"
+        "] \n";
+
+    VariableSchema inputLayouts;
+    VariableSchema outputLayouts;
+    IEvaluateModelExtended<float> *eval;
+    eval = SetupNetworkAndGetLayouts(modelDefinition, inputLayouts, outputLayouts);
+
+    // three sequences of different lengths in one minibatch
+    std::vector<std::vector<float>> inputData = { { 1, 2, 3, 4 }, { 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3 }, { 0, 0, 0, 1, 0, 0, 1, 0 } };
+    std::vector<std::vector<float>> expected = { { 20 }, { 8, 16, 24 }, { 2, 2 } };
+    std::vector<std::vector<float>> outputData(inputData.size(), std::vector<float>(3));
+
+    std::vector<ValueRefs<float>> inputRefs(inputData.size(), ValueRefs<float>(1));
+    std::vector<ValueRefs<float>> outputRefs(inputData.size(), ValueRefs<float>(1));
+    for (size_t k = 0; k < inputData.size(); k++)
+    {
+        inputRefs[k][0].m_buffer.InitFrom(inputData[k]);
+        outputRefs[k][0].m_buffer.InitFrom(outputData[k].data(), outputData[k].size(), 0);
+    }
+    eval->ForwardPassBatch(inputRefs, outputRefs);
+
+    for (size_t k = 0; k < inputData.size(); k++)
+    {
+        auto& buf = outputRefs[k][0].m_buffer;
+        BOOST_CHECK_EQUAL_COLLECTIONS(buf.begin(), buf.end(), expected[k].begin(), expected[k].end());
+    }
+
+    eval->Destroy();
+}
+
+BOOST_AUTO_TEST_CASE(EvalBatcherTest)
+{
+    std::string modelDefinition =
+        "deviceId = -1 \n"
+        "precision = \"float\" \n"
+        "traceLevel = 1 \n"
+        "run=NDLNetworkBuilder \n"
+        "NDLNetworkBuilder=[ \n"
+        "i1 = Input(4) \n"
+        "o1 = Times(Constant(2, rows=1, cols=4), i1, tag=\"output\") \n"
+        "FeatureNodes = (i1) \n"
+        "] \n";
+
+    VariableSchema inputLayouts;
+    VariableSchema outputLayouts;
+    IEvaluateModelExtended<float> *eval;
+    eval = SetupNetworkAndGetLayouts(modelDefinition, inputLayouts, outputLayouts);
+
+    // Concurrent clients with sequences of different lengths. The minibatch is only evaluated once all valid requests
+    // have arrived, so they are evaluated together with the one whose output buffer is too small.
+    std::vector<std::vector<float>> inputData = { { 1, 2, 3, 4 }, { 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3 }, { 0, 0, 0, 1, 0, 0, 1, 0 },
+                                                  { 1, 1, 1, 1, 2, 2, 2, 2 }, { 1, 2, 3, 4, 5 } };
+    std::vector<std::vector<float>> expected = { { 20 }, { 8, 16, 24 }, { 2, 2 }, {}, {} };
+    std::vector<size_t> outputCapacity = { 3, 3, 3, 1, 3 };
+    std::vector<bool> expectError = { false, false, false, true, true };
+
+    std::vector<std::vector<float>> outputData(inputData.size());
+    std::vector<size_t> outputSize(inputData.size(), 0);
+    std::vector<int> hasError(inputData.size(), 0);
+    {
+        EvalBatcher<float> batcher(eval, 4, std::chrono::minutes(1));
+        std::vector<std::thread> clients;
+        for (size_t k = 0; k < inputData.size(); k++)
+        {
+            clients.push_back(std::thread([&, k]()
+            {
+                ValueRefs<float> inputRefs(1);
+                ValueRefs<float> outputRefs(1);
+                outputData[k].resize(outputCapacity[k]);
+                inputRefs[0].m_buffer.InitFrom(inputData[k]);
+                outputRefs[0].m_buffer.InitFrom(outputData[k].data(), outputData[k].size(), 0);
+                try
+                {
+                    batcher.ForwardPass(inputRefs, outputRefs);
+                    outputSize[k] = outputRefs[0].m_buffer.size();
+                }
+                catch (const std::exception&)
+                {
+                    hasError[k] = 1;
+                }
+            }));
+        }
+        for (auto& client : clients)
+            client.join();
+    }
+
+    for (size_t k = 0; k < inputData.size(); k++)
+    {
+        BOOST_CHECK_EQUAL(hasError[k] != 0, (bool)expectError[k]);
+        if (!expectError[k])
+            BOOST_CHECK_EQUAL_COLLECTIONS(outputData[k].begin(), outputData[k].begin() + outputSize[k], expected[k].begin(), expected[k].end());
+    }
+
+    eval->Destroy();
+}
+
 BOOST_AUTO_TEST_CASE(EvalSparseTimesTest)
 {
     std::string modelDefinition =
@@ -11,6 +11,7 @@
 #include "CPUMatrix.h"
 #include "TensorView.h"
 #include "Sequences.h"
+#include "QuantizedOperations.h"
 #include <chrono>
 #include <iostream>
 #include <vector>
@@ -336,8 +337,54 @@ void MandSTest(int count, int devId)
     delete[] data3;
 }
 
+// compares the quantized (16-bit integer) product used by QuantizedMultiplier with sgemm/dgemm
+// A is treated as constant (weights), i.e. it is quantized and packed once outside the timed loop
+template <class ElemType>
+void QuantizedMultiplyTest(int m, int k, int n, int count)
+{
+    cout << "A(" << m << "x" << k << ") and B(" << k << "x" << n << "), " << count << " iterations" << endl;
+    CPUMatrix<ElemType> A(m, k);
+    randomInitializeCPUMatrix<ElemType>(A);
+    CPUMatrix<ElemType> B(k, n);
+    randomInitializeCPUMatrix<ElemType>(B);
+    CPUMatrix<ElemType> C(m, n);
+
+    auto t_start = chrono::high_resolution_clock::now();
+    for (int i = 0; i < count; ++i)
+        CPUMatrix<ElemType>::MultiplyAndWeightedAdd(1, A, false, B, false, 0, C);
+    auto t_end = chrono::high_resolution_clock::now();
+    double gemmSeconds = chrono::duration<double>(t_end - t_start).count() / count;
+
+    shared_ptr<QuantizerBase<ElemType, short>> quantA(new SymmetricQuantizer<ElemType, short>(1));
+    shared_ptr<QuantizerBase<ElemType, short>> quantB(new SymmetricQuantizer<ElemType, short>(1));
+    auto mult = make_shared<QuantizedMultiplier<ElemType>>(quantA, true, quantB, false);
+    CPUMatrix<ElemType> CQ(m, n);
+    CPUMatrix<ElemType>::MultiplyAndWeightedAdd(1, A, false, B, false, 0, CQ, mult); // warm-up, packs A
+
+    t_start = chrono::high_resolution_clock::now();
+    for (int i = 0; i < count; ++i)
+        CPUMatrix<ElemType>::MultiplyAndWeightedAdd(1, A, false, B, false, 0, CQ, mult);
+    t_end = chrono::high_resolution_clock::now();
+    double quantizedSeconds = chrono::duration<double>(t_end - t_start).count() / count;
+
+    double maxAbsDiff = 0;
+    foreach_coord (i, j, C)
+        maxAbsDiff = max(maxAbsDiff, (double)fabs(C(i, j) - CQ(i, j)));
+
+    double gops = 2.0 * m * n * k * 1e-9;
+    cout << "gemm:      " << gemmSeconds * 1000 << " ms, " << gops / gemmSeconds << " GOp/s" << endl;
+    cout << "quantized: " << quantizedSeconds * 1000 << " ms, " << gops / quantizedSeconds << " GOp/s"
+         << " (" << Int16Gemm::KernelName(Int16Gemm::GetKernel()) << " kernel), max abs difference " << maxAbsDiff << endl;
+}
+
 int wmain()
 {
+    cout << endl << "********************Quantized MultiplyAndWeightedAdd TEST********************" << endl;
+    QuantizedMultiplyTest<float>(512, 512, 1, 1000);
+    QuantizedMultiplyTest<float>(512, 512, 32, 200);
+    QuantizedMultiplyTest<float>(1024, 1024, 128, 50);
+    QuantizedMultiplyTest<float>(2048, 2048, 256, 10);
+
     // MandSTest<float>(100, 2);
 
     /*cout<<endl<<"********************Matrix SquareMultiplyAndWeightedAdd10TimesAvg TEST********************"<<endl;
@@ -4,6 +4,9 @@
 //
 #include "stdafx.h"
 #include "../../../Source/Math/CPUMatrix.h"
+#include "../../../Source/Math/RNNCommon.h"
+#include "../../../Source/Math/CPUMemAllocator.h"
+#include <functional>
 
 using namespace Microsoft::MSR::CNTK;
 
@@ -28,6 +31,7 @@ BOOST_FIXTURE_TEST_CASE(CPUMatrixConstructorNoFlags, RandomSeedFixture)
     BOOST_CHECK_EQUAL(m.GetNumCols(), 3);
     BOOST_CHECK_EQUAL(m.GetNumElements(), 6);
 
+    m.SetValue(0); // content after Resize() is undefined
     m(0, 0) = 1;
     m(1, 2) = 2;
     BOOST_CHECK_EQUAL(m(0, 0), 1);
@@ -1127,6 +1131,256 @@ BOOST_FIXTURE_TEST_CASE(CPUMatrixGatherFromTarget, RandomSeedFixture)
     BOOST_CHECK(m2.IsEqualTo(expect, 1e-6));
 }
 
+
+BOOST_FIXTURE_TEST_CASE(CPUMatrixRNNGradientCheck, RandomSeedFixture)
+{
+    // two stacked bidirectional layers, three sequences of lengths 3, 2 and 1, packed longest first
+    const size_t xDim = 3, hiddenSize = 2, yDim = 2 * hiddenSize;
+    const vector<size_t> numSequencesForFrame = { 3, 2, 1 };
+    const size_t numCols = 6;
+    const double epsilon = 1e-6;
+
+    for (const wstring recurrentOp : { L"lstm", L"gru", L"rnnTanh", L"rnnReLU" })
+    {
+        RnnAttributes rnnAttributes(/*bidirectional=*/true, /*numLayers=*/2, hiddenSize, recurrentOp, /*axis=*/-1);
+        auto numParameters = rnnAttributes.GetNumParameters(xDim);
+
+        DMatrix w(numParameters.first * numParameters.second, 1);
+        w.SetUniformRandomValue(-0.5, 0.5, IncrementCounter());
+        DMatrix x(xDim, numCols);
+        x.SetUniformRandomValue(-1, 1, IncrementCounter());
+        DMatrix dy(yDim, numCols);
+        dy.SetUniformRandomValue(-1, 1, IncrementCounter());
+
+        // loss = sum(dy .* y)
+        auto loss = [&]()
+        {
+            DMatrix y(yDim, numCols), reserve, workspace;
+            y.RNNForward(x, w, xDim, yDim, numSequencesForFrame, rnnAttributes, reserve, workspace);
+            return y.ElementMultiplyWith(dy).SumOfElements();
+        };
+
+        DMatrix y(yDim, numCols), reserve, workspace;
+        y.RNNForward(x, w, xDim, yDim, numSequencesForFrame, rnnAttributes, reserve, workspace);
+        DMatrix dx(xDim, numCols);
+        DMatrix dw(w.GetNumRows(), 1);
+        dw.SetValue(0);
+        y.RNNBackwardData(dy, w, dx, rnnAttributes, reserve, workspace);
+        y.RNNBackwardWeights(x, y, dw, rnnAttributes, reserve, workspace);
+
+        for (size_t i = 0; i < w.GetNumRows(); i++)
+        {
+            double value = w(i, 0);
+            w(i, 0) = value + epsilon;
+            double lossPlus = loss();
+            w(i, 0) = value - epsilon;
+            double lossMinus = loss();
+            w(i, 0) = value;
+            BOOST_CHECK_SMALL((lossPlus - lossMinus) / (2 * epsilon) - dw(i, 0), 1e-6);
+        }
+        for (size_t j = 0; j < numCols; j++)
+        {
+            for (size_t i = 0; i < xDim; i++)
+            {
+                double value = x(i, j);
+                x(i, j) = value + epsilon;
+                double lossPlus = loss();
+                x(i, j) = value - epsilon;
+                double lossMinus = loss();
+                x(i, j) = value;
+                BOOST_CHECK_SMALL((lossPlus - lossMinus) / (2 * epsilon) - dx(i, j), 1e-6);
+            }
+        }
+    }
+}
+
+static double CRFLogAdd(double x, double y)
+{
+    double m = std::max(x, y);
+    return m + log(exp(x - m) + exp(y - m));
+}
+
+// brute force over all label paths of one sequence: total score of the paths (log), score and posteriors
+static double CRFPathScore(const DMatrix& pos, const DMatrix& pair, const std::vector<size_t>& cols, const std::vector<int>& path, int startLbl)
+{
+    double score = 0;
+    int prev = startLbl;
+    for (size_t t = 0; t < cols.size(); t++)
+    {
+        score += pos(path[t], cols[t]);
+        if (prev >= 0)
+            score += pair(path[t], prev);
+        prev = path[t];
+    }
+    return score;
+}
+
+static void ForAllCRFPaths(size_t numLabels, size_t numFrames, const std::function<void(const std::vector<int>&)>& f)
+{
+    std::vector<int> path(numFrames, 0);
+    for (;;)
+    {
+        f(path);
+        size_t t = 0;
+        while (t < numFrames && ++path[t] == (int) numLabels)
+            path[t++] = 0;
+        if (t == numFrames)
+            return;
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(CPUMatrixRCRFBatched, RandomSeedFixture)
+{
+    // two parallel sequences over 4 time steps; the second one starts at t = 1, leaving a gap
+    const size_t numLabels = 3, numParallelSequences = 2, numTimeSteps = 4;
+    const std::vector<size_t> uttToChanInd = { 0, 1 }, uttBeginFrame = { 0, 1 }, uttFrameNum = { 4, 3 };
+    const std::vector<std::vector<int>> labels = { { 1, 0, 2, 2 }, { 2, 1, 0 } };
+
+    DMatrix pos(numLabels, numTimeSteps * numParallelSequences);
+    pos.SetUniformRandomValue(-1, 1, IncrementCounter());
+    DMatrix pair(numLabels, numLabels);
+    pair.SetUniformRandomValue(-1, 1, IncrementCounter());
+    DMatrix lbls(numLabels, numTimeSteps * numParallelSequences);
+    lbls.SetValue(0);
+    std::vector<std::vector<size_t>> cols(2);
+    for (size_t i = 0; i < 2; i++)
+    {
+        for (size_t t = 0; t < uttFrameNum[i]; t++)
+        {
+            cols[i].push_back((uttBeginFrame[i] + t) * numParallelSequences + uttToChanInd[i]);
+            lbls(labels[i][t], cols[i].back()) = 1;
+        }
+    }
+
+    auto loss = [&]()
+    {
+        double total = 0;
+        for (size_t i = 0; i < 2; i++)
+        {
+            double logZ = LZERO;
+            ForAllCRFPaths(numLabels, uttFrameNum[i], [&](const std::vector<int>& path) { logZ = CRFLogAdd(logZ, CRFPathScore(pos, pair, cols[i], path, labels[i][0])); });
+            total += logZ - CRFPathScore(pos, pair, cols[i], labels[i], labels[i][0]);
+        }
+        return total;
+    };
+
+    DMatrix alpha, beta;
+    double score = DMatrix::RCRFForwardBackwardCompute(lbls, pos, pair, alpha, beta, uttToChanInd, uttBeginFrame, uttFrameNum, numParallelSequences);
+    BOOST_CHECK_CLOSE(score, loss(), 1e-8);
+
+    // posteriors, zero in the gap
+    for (size_t i = 0; i < 2; i++)
+    {
+        DMatrix posteriors(numLabels, numTimeSteps * numParallelSequences);
+        double logZ = LZERO;
+        ForAllCRFPaths(numLabels, uttFrameNum[i], [&](const std::vector<int>& path) { logZ = CRFLogAdd(logZ, CRFPathScore(pos, pair, cols[i], path, labels[i][0])); });
+        ForAllCRFPaths(numLabels, uttFrameNum[i], [&](const std::vector<int>& path)
+        {
+            double p = exp(CRFPathScore(pos, pair, cols[i], path, labels[i][0]) - logZ);
+            for (size_t t = 0; t < uttFrameNum[i]; t++)
+                posteriors(path[t], cols[i][t]) += p;
+        });
+        for (size_t t = 0; t < uttFrameNum[i]; t++)
+            for (size_t k = 0; k < numLabels; k++)
+                BOOST_CHECK_SMALL(exp(beta(k, cols[i][t])) - posteriors(k, cols[i][t]), 1e-8);
+    }
+    for (size_t k = 0; k < numLabels; k++)
+        BOOST_CHECK_EQUAL(exp(beta(k, 1)), 0);
+
+    // gradient w.r.t. the transition scores
+    DMatrix grd(numLabels, numLabels);
+    grd.SetValue(0);
+    DMatrix::RCRFTransGrdCompute(lbls, pos, alpha, beta, pair, grd, uttToChanInd, uttBeginFrame, uttFrameNum, numParallelSequences);
+    const double epsilon = 1e-6;
+    for (size_t j = 0; j < numLabels; j++)
+    {
+        for (size_t i = 0; i < numLabels; i++)
+        {
+            double value = pair(j, i);
+            pair(j, i) = value + epsilon;
+            double lossPlus = loss();
+            pair(j, i) = value - epsilon;
+            double lossMinus = loss();
+            pair(j, i) = value;
+            BOOST_CHECK_SMALL((lossPlus - lossMinus) / (2 * epsilon) - grd(j, i), 1e-6);
+        }
+    }
+
+    // Viterbi: best path between the labels of the first and the last frame
+    DMatrix decoded;
+    DMatrix::RCRFViterbiDecode(lbls, pos, pair, decoded, uttToChanInd, uttBeginFrame, uttFrameNum, numParallelSequences);
+    for (size_t i = 0; i < 2; i++)
+    {
+        std::vector<int> best;
+        double bestScore = LZERO;
+        ForAllCRFPaths(numLabels, uttFrameNum[i], [&](const std::vector<int>& path)
+        {
+            if (path.front() != labels[i].front() || path.back() != labels[i].back())
+                return;
+            double s = CRFPathScore(pos, pair, cols[i], path, -1);
+            if (s > bestScore)
+            {
+                bestScore = s;
+                best = path;
+            }
+        });
+        for (size_t t = 0; t < uttFrameNum[i]; t++)
+            for (size_t k = 0; k < numLabels; k++)
+                BOOST_CHECK_EQUAL(decoded(k, cols[i][t]), (int) k == best[t] ? 1 : 0);
+    }
+    for (size_t k = 0; k < numLabels; k++)
+        BOOST_CHECK_EQUAL(decoded(k, 1), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(CPUMatrixAllocator, RandomSeedFixture)
+{
+    // storage is aligned, and zero after construction
+    for (size_t numRows : {1, 7, 100, 1000})
+    {
+        SMatrix m(numRows, 300);
+        BOOST_CHECK_EQUAL((size_t) m.Data() % 64, 0);
+        for (size_t i = 0; i < m.GetNumElements(); i++)
+            BOOST_CHECK_EQUAL(m.Data()[i], 0);
+        m.SetValue(1);
+    }
+
+    // a freed block is reused by the next allocation of its size class, also through a matrix that was written to before
+    auto before = CPUMemAllocator::GetStatistics();
+    {
+        SMatrix m(100, 20);
+        m.SetValue(3);
+    }
+    {
+        SMatrix m(99, 20);
+        BOOST_CHECK_EQUAL(m(98, 19), 0);
+    }
+    auto after = CPUMemAllocator::GetStatistics();
+    BOOST_CHECK_GE(after.cacheHits, before.cacheHits + 1);
+    BOOST_CHECK_EQUAL(after.bytesInUse, before.bytesInUse);
+    BOOST_CHECK_GE(after.peakBytesInUse, after.bytesInUse + 100 * 20 * sizeof(float));
+
+    CPUMemAllocator::ReleaseCachedMemory();
+    BOOST_CHECK_LE(CPUMemAllocator::GetStatistics().bytesCached, after.bytesCached);
+}
+
+BOOST_FIXTURE_TEST_CASE(CPUMatrixAddSignOfResized, RandomSeedFixture)
+{
+    // the block of 'junk' goes to the allocator cache and comes back, with its content, as the storage of 'm'
+    DMatrix a = DMatrix::RandomUniform(3, 4, -1, 1, IncrementCounter());
+    {
+        DMatrix junk(3, 4);
+        junk.SetValue(7);
+    }
+    DMatrix m;
+    m.AddSignOf(a); // a resized target starts from zero
+    foreach_coord (i, j, a)
+        BOOST_CHECK_EQUAL(m(i, j), a(i, j) > 0 ? 1 : -1);
+
+    m.AddSignOf(a); // same size: accumulates
+    foreach_coord (i, j, a)
+        BOOST_CHECK_EQUAL(m(i, j), a(i, j) > 0 ? 2 : -2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }
 } } }
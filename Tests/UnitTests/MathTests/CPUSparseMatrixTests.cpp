@@ -147,6 +147,48 @@ BOOST_FIXTURE_TEST_CASE(CPUSparseMatrixDoGatherColumnsOf, RandomSeedFixture)
     }
 }
 
+BOOST_FIXTURE_TEST_CASE(CPUSparseMatrixAdjustCol2BlockId, RandomSeedFixture)
+{
+    const size_t m = 20;
+    const size_t n = 10;
+
+    DenseMatrix dm0(m, n);
+    dm0.SetUniformRandomValue(-1, 1, IncrementCounter());
+
+    // only columns 2 and 5 of the product are non-zero
+    SparseMatrix sm1(MatrixFormat::matrixFormatSparseCSC, m, n, 0);
+    sm1.SetValue(2, 1, 1);
+    sm1.SetValue(5, 3, 1);
+
+    SparseMatrix smMul(MatrixFormat::matrixFormatSparseBlockCol, m, m, 0);
+    SparseMatrix::MultiplyAndAdd(1, dm0, false, sm1, true, smMul);
+
+    std::vector<size_t> columns = smMul.GetBlockColumns();
+    BOOST_CHECK_EQUAL(columns.size(), 2);
+
+    DenseMatrix expected(m, m);
+    foreach_coord(row, col, expected)
+    {
+        expected(row, col) = smMul(row, col);
+    }
+
+    // union with columns 0 and 7 from another worker
+    std::vector<GPUSPARSE_INDEX_TYPE> col2BlockId(m, SparseIndex_NotAssigned);
+    col2BlockId[0] = 0;
+    col2BlockId[2] = 1;
+    col2BlockId[5] = 2;
+    col2BlockId[7] = 3;
+    smMul.AdjustCol2BlockId(col2BlockId.data(), 4);
+
+    BOOST_CHECK_EQUAL(smMul.GetBlockSize(), 4);
+    columns = smMul.GetBlockColumns();
+    BOOST_CHECK(columns == std::vector<size_t>({ 0, 2, 5, 7 }));
+    foreach_coord(row, col, expected)
+    {
+        BOOST_CHECK_EQUAL(smMul(row, col), expected(row, col));
+    }
+}
+
 BOOST_FIXTURE_TEST_CASE(CPUSparseMatrixOneHot, RandomSeedFixture)
 {
     const size_t num_class = 6;
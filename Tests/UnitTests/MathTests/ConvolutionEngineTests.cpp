@@ -163,6 +163,51 @@ std::vector<ConvolveGeometryPtr> GeneratePoolTestConfigs()
     return res;
 }
 
+std::vector<ConvolveGeometryPtr> GenerateDirectConvTestConfigs()
+{
+    std::vector<ConvolveGeometryPtr> res;
+    // 3x3, stride 1 (Winograd): outputs smaller and larger than a tile, with and without padding.
+    for (size_t inW : {3, 5, 9})
+    {
+        for (bool pad : {false, true})
+        {
+            res.push_back(std::make_shared<ConvolveGeometry>(TensorShape(inW, inW + 3, 4),
+                TensorShape(3, 3, 4), TensorShape(6), TensorShape(1),
+                ConvolveGeometry::BoolVec{true}, ConvolveGeometry::BoolVec{pad, pad, false},
+                TensorShape(0), TensorShape(0)));
+        }
+    }
+    // Explicit, asymmetric padding; ConvolveGeometry requires a lower pad of at most (kernel - 1) / 2 and an output no larger than the input.
+    res.push_back(std::make_shared<ConvolveGeometry>(TensorShape(10, 7, 3),
+        TensorShape(3, 3, 3), TensorShape(5), TensorShape(1),
+        ConvolveGeometry::BoolVec{true}, ConvolveGeometry::BoolVec{false},
+        TensorShape(1, 1, 0), TensorShape(1, 0, 0)));
+    // 1x1, with and without stride.
+    for (size_t stride : {1, 2})
+    {
+        res.push_back(std::make_shared<ConvolveGeometry>(TensorShape(7, 6, 5),
+            TensorShape(1, 1, 5), TensorShape(3), TensorShape(stride, stride, 5),
+            ConvolveGeometry::BoolVec{true}, ConvolveGeometry::BoolVec{false},
+            TensorShape(0), TensorShape(0)));
+    }
+    // Depthwise, with a kernel per channel (no sharing along channels) and with one shared kernel.
+    for (bool shareChannels : {false, true})
+    {
+        for (size_t stride : {1, 2})
+        {
+            res.push_back(std::make_shared<ConvolveGeometry>(TensorShape(9, 8, 3),
+                TensorShape(3, 3, 1), TensorShape(1), TensorShape(stride, stride, 1),
+                ConvolveGeometry::BoolVec{true, true, shareChannels}, ConvolveGeometry::BoolVec{true, true, false},
+                TensorShape(0), TensorShape(0)));
+        }
+        res.push_back(std::make_shared<ConvolveGeometry>(TensorShape(9, 8, 2),
+            TensorShape(5, 3, 1), TensorShape(1), TensorShape(1),
+            ConvolveGeometry::BoolVec{true, true, shareChannels}, ConvolveGeometry::BoolVec{false},
+            TensorShape(0), TensorShape(0)));
+    }
+    return res;
+}
+
 BOOST_AUTO_TEST_SUITE(ConvolutionSuite)
 
 BOOST_AUTO_TEST_CASE(ConvolutionForward)
@@ -511,6 +556,66 @@ BOOST_AUTO_TEST_CASE(PoolingBackward)
     }
 }
 
+// Direct engine is CPU-only and covers configurations that cuDNN does not (depthwise), so it is compared with the reference engine.
+BOOST_AUTO_TEST_CASE(DirectConvolution)
+{
+    std::mt19937 rng(0);
+    boost::random::uniform_int_distribution<> batchSizeG(1, 8);
+    boost::random::normal_distribution<float> nd;
+
+    auto initMat = [&](size_t r, size_t c, vec& data) -> SingleMatrix
+    {
+        data.resize(r * c);
+        std::generate(begin(data), end(data), [&] { return nd(rng); });
+        return SingleMatrix(r, c, data.data(), CPUDEVICE, matrixFlagNormal);
+    };
+
+    for (const auto& g : GenerateDirectConvTestConfigs())
+    {
+        auto baseEng = ConvEng::Create(g, CPUDEVICE, ImageLayoutKind::CHW, 0, PoolKind::None, ConvolutionEngineKind::Reference);
+        // Throws if the direct engine does not support the geometry.
+        auto testEng = ConvEng::Create(g, CPUDEVICE, ImageLayoutKind::CHW, 0, PoolKind::None, ConvolutionEngineKind::Direct);
+
+        size_t n = batchSizeG(rng);
+        size_t crowIn = g->InputShape().GetNumElements();
+        size_t crowOut = g->OutputShape().GetNumElements();
+        vec buf;
+        SingleMatrix in = initMat(crowIn, n, buf);
+        SingleMatrix kernel = initMat(g->KernelCount(), g->KernelShape().GetNumElements(), buf);
+        SingleMatrix srcGrad = initMat(crowOut, n, buf);
+
+        SingleMatrix out(crowOut, n, CPUDEVICE);
+        SingleMatrix outB(crowOut, n, CPUDEVICE);
+        SingleMatrix grad = initMat(crowIn, n, buf);
+        SingleMatrix gradB(grad.DeepClone(), CPUDEVICE);
+        SingleMatrix kernelGrad = initMat(kernel.GetNumRows(), kernel.GetNumCols(), buf);
+        SingleMatrix kernelGradB(kernelGrad.DeepClone(), CPUDEVICE);
+
+        SingleMatrix workspace(CPUDEVICE);
+        SingleMatrix workspaceB(CPUDEVICE);
+
+        testEng->Forward(in, kernel, out, workspace);
+        baseEng->Forward(in, kernel, outB, workspaceB);
+        testEng->BackwardData(srcGrad, kernel, grad, true, workspace);
+        baseEng->BackwardData(srcGrad, kernel, gradB, true, workspaceB);
+        testEng->BackwardKernel(srcGrad, in, kernelGrad, true, false, workspace);
+        baseEng->BackwardKernel(srcGrad, in, kernelGradB, true, false, workspaceB);
+
+        std::stringstream tmsg;
+        tmsg << "Geometry: " << (std::string)(*g) << ", Batch: " << n;
+        std::string msg = " are not equal, " + tmsg.str();
+
+        float relErr = Err<float>::Rel;
+        float absErr = Err<float>::Abs;
+        std::string emsg;
+
+        // Winograd F(4x4, 3x3) needs fewer multiplications at the cost of precision, its error grows with the magnitude of the outputs.
+        BOOST_REQUIRE_MESSAGE(CheckEqual(out, outB, emsg, relErr * 4, absErr * 1024), "out" << msg << ". " << emsg);
+        BOOST_REQUIRE_MESSAGE(CheckEqual(grad, gradB, emsg, relErr * 16, absErr * 16), "grad" << msg << ". " << emsg);
+        BOOST_REQUIRE_MESSAGE(CheckEqual(kernelGrad, kernelGradB, emsg, relErr * 192, absErr * 64), "kernel" << msg << ". " << emsg);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(MaxUnpooling)
 {
     using IntMatrix = Matrix<int>;
@@ -34,6 +34,35 @@ BOOST_FIXTURE_TEST_CASE(CPUMatrixFileWriteRead, RandomSeedFixture)
     BOOST_CHECK(matrixCpuCopy.IsEqualTo(matrixCpuRead, c_epsilonFloatE5));
 }
 
+BOOST_FIXTURE_TEST_CASE(CPUMatrixBinaryFileMappedRead, RandomSeedFixture)
+{
+    CPUMatrix<float> matrixCpu = CPUMatrix<float>::RandomUniform(43, 10, -26.3f, 30.2f, IncrementCounter());
+
+    std::wstring fileNameCpu(L"MCPU.bin");
+    {
+        File fileCpu(fileNameCpu, fileOptionsBinary | fileOptionsWrite);
+        fileCpu << 'x' << matrixCpu << matrixCpu; // 'x' misaligns the header
+    }
+
+    File fileCpu(fileNameCpu, fileOptionsBinary | fileOptionsRead);
+    BOOST_REQUIRE(fileCpu.MemoryMap(/*shareReadOnlyData=*/true));
+    char x;
+    fileCpu >> x;
+
+    // in place: the elements are aligned within the mapping
+    CPUMatrix<float> matrixCpuMapped;
+    matrixCpuMapped.Read(fileCpu, /*useMappedStorage=*/true);
+    BOOST_CHECK(!matrixCpuMapped.OwnBuffer());
+    BOOST_CHECK_EQUAL(((uintptr_t) matrixCpuMapped.Data()) % 64, 0);
+    BOOST_CHECK(matrixCpu.IsEqualTo(matrixCpuMapped, 0));
+
+    // copied
+    CPUMatrix<float> matrixCpuRead;
+    fileCpu >> matrixCpuRead;
+    BOOST_CHECK(matrixCpuRead.OwnBuffer());
+    BOOST_CHECK(matrixCpu.IsEqualTo(matrixCpuRead, 0));
+}
+
 BOOST_FIXTURE_TEST_CASE(MatrixFileWriteRead, RandomSeedFixture)
 {
     // Test Matrix in Dense mode
@@ -5,6 +5,7 @@
 #include "stdafx.h"
 #include "../../../Source/Math/QuantizedOperations.h"
 #include "../../../Source/Math/Helpers.h"
+#include <random>
 
 using namespace Microsoft::MSR::CNTK;
 namespace Microsoft { namespace MSR { namespace CNTK { namespace Test {
@@ -50,6 +51,48 @@ BOOST_FIXTURE_TEST_CASE(MultiplyIntToShort, RandomSeedFixture)
         BOOST_CHECK_EQUAL(round(C_upd[i]), C_expected_upd[i]);
 }
 
+BOOST_FIXTURE_TEST_CASE(Int16GemmKernelsMatchReference, RandomSeedFixture)
+{
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> dim(1, 70);
+    std::uniform_int_distribution<int> value(-2000, 2000);
+
+    auto defaultKernel = Int16Gemm::GetKernel();
+    for (auto kernel : { Int16Gemm::Kernel::Scalar, Int16Gemm::Kernel::SSE2, Int16Gemm::Kernel::AVX2, Int16Gemm::Kernel::AVX512VNNI })
+    {
+        if (!Int16Gemm::IsKernelSupported(kernel))
+            continue;
+        Int16Gemm::SetKernel(kernel);
+
+        for (int trial = 0; trial < 10; trial++)
+        {
+            // odd and non-multiple-of-tile sizes exercise the padding
+            int m = dim(rng), n = dim(rng), k = dim(rng);
+            std::vector<short> A(m * k), B(k * n);
+            for (auto& a : A)
+                a = (short)value(rng);
+            for (auto& b : B)
+                b = (short)value(rng);
+
+            Int16PackedA packedA;
+            Int16PackedB packedB;
+            Int16Gemm::PackA(m, k, A.data(), packedA);
+            Int16Gemm::PackB(k, n, B.data(), packedB);
+            std::vector<int> C(m * n);
+            Int16Gemm::Multiply(packedA, packedB, C.data());
+
+            for (int i = 0; i < m; i++)
+                for (int j = 0; j < n; j++)
+                {
+                    int dotProduct = 0;
+                    for (int l = 0; l < k; l++)
+                        dotProduct += A[i + l * m] * B[l + k * j];
+                    BOOST_REQUIRE_MESSAGE(C[i + j * m] == dotProduct, "Int16Gemm " << Int16Gemm::KernelName(kernel) << " kernel differs from reference");
+                }
+        }
+    }
+    Int16Gemm::SetKernel(defaultKernel);
+}
 
 BOOST_AUTO_TEST_SUITE_END()
 
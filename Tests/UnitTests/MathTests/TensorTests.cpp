@@ -85,6 +85,21 @@ BOOST_AUTO_TEST_CASE(BiasGradient2)
     });
 }
 
+BOOST_AUTO_TEST_CASE(FusedElementwise)
+{
+    Test::TensorTest<float> tensorTester;
+    const DEVICEID_TYPE deviceId = CPUDEVICE;
+
+    // elementwise with bias and row broadcasting
+    tensorTester.FusedElementwiseTest(TensorShape{ 300, 64 }, TensorShape(300), TensorShape{ 1, 64 }, TensorShape{ 300, 64 }, deviceId);
+    // reduction over the columns, e.g. a bias gradient
+    tensorTester.FusedElementwiseTest(TensorShape{ 300, 64 }, TensorShape(300), TensorShape{ 300, 64 }, TensorShape(300), deviceId);
+    // reduction into a short vector
+    tensorTester.FusedElementwiseTest(TensorShape{ 3, 1000 }, TensorShape(3), TensorShape{ 3, 1000 }, TensorShape(3), deviceId);
+    // reduction into a scalar
+    tensorTester.FusedElementwiseTest(TensorShape{ 20, 50 }, TensorShape(1), TensorShape{ 20, 50 }, TensorShape(1), deviceId);
+}
+
 BOOST_AUTO_TEST_CASE(ColumnSliceMultAndAdd)
 {
     ColumnSliceMultAndAddTest<float>(2048, 2048, 256, 0);
@@ -87,6 +87,31 @@ struct TensorTest
         result.AssignSumOf(input, bias);
         return result;
     }
+
+    // test a fused elementwise program, sigmoid(x + b) .* tanh(y) - x, against its execution one operation at a time
+    // The result shape may inverse-broadcast (reduce).
+    void FusedElementwiseTest(TensorShape xShape, TensorShape bShape, TensorShape yShape, TensorShape resultShape, DEVICEID_TYPE deviceId)
+    {
+        int randomSeed = 1;
+        let x = CreateTensor(xShape, randomSeed++, deviceId);
+        let b = CreateTensor(bShape, randomSeed++, deviceId);
+        let y = CreateTensor(yShape, randomSeed++, deviceId);
+        vector<TensorView<ElemType>> inputs{ x, b, y };
+
+        ElementWiseProgram program;
+        program.numInputs = inputs.size();
+        let sum = program.Add(ElementWiseOperator::opSum, 0, 1);
+        let sigmoid = program.Add(ElementWiseOperator::opSigmoid, sum);
+        let tanh = program.Add(ElementWiseOperator::opTanh, 2);
+        let product = program.Add(ElementWiseOperator::opElementwiseProduct, sigmoid, tanh);
+        program.Add(ElementWiseOperator::opDifference, product, 0);
+
+        auto fused = CreateTensor(resultShape, randomSeed, deviceId);
+        auto reference = CreateTensor(resultShape, randomSeed, deviceId, true);
+        fused.DoFusedOpOf(0.5, inputs, 2, program);
+        reference.DoFusedOpOfByOperation(0.5, inputs, 2, program);
+        BOOST_CHECK(fused.GetSOB().IsEqualTo(reference.GetSOB(), (ElemType)1e-4));
+    }
 };
 
 template <class ElemType>
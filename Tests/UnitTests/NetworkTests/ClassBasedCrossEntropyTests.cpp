@@ -0,0 +1,189 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+
+#include "stdafx.h"
+
+#include "../../../Source/ComputationNetworkLib/TrainingNodes.h"
+#include "TestHelpers.h"
+#include <cmath>
+#include <memory>
+#include <random>
+
+using namespace Microsoft::MSR::CNTK;
+using namespace std;
+
+namespace Microsoft { namespace MSR { namespace CNTK { namespace Test {
+
+// We perform test on CPU.
+const DEVICEID_TYPE c_deviceId = CPUDEVICE;
+
+// Input node with the given layout and data; without a layout, the data is a [numRows x (data.size() / numRows)] parameter.
+template <class ElemType>
+class DataNodeTest : public DummyNodeTest<ElemType>
+{
+public:
+    DataNodeTest(const MBLayoutPtr& pMBLayout, size_t numRows, vector<ElemType> data)
+        : DummyNodeTest<ElemType>(c_deviceId, L"Data")
+    {
+        const size_t numCols = data.size() / numRows;
+        this->LinkToMBLayout(pMBLayout);
+        if (pMBLayout)
+            this->SetDims(TensorShape(numRows), true);
+        else
+            this->SetDims(TensorShape(numRows, numCols), false);
+        this->CreateValueMatrixIfNull();
+        this->Value().SetValue(numRows, numCols, c_deviceId, data.data());
+        this->CreateGradientMatrixIfNull();
+        this->Gradient().Resize(numRows, numCols);
+        this->Gradient().SetValue(0);
+    }
+};
+
+// Extends the class-based criterion node to run it outside of a network.
+template <class ElemType>
+class ClassBasedCrossEntropyWithSoftmaxNodeTest : public ClassBasedCrossEntropyWithSoftmaxNode<ElemType>
+{
+public:
+    ClassBasedCrossEntropyWithSoftmaxNodeTest()
+        : ClassBasedCrossEntropyWithSoftmaxNode<ElemType>(c_deviceId, L"ClassBasedCrossEntropyWithSoftmaxNodeTest")
+    {
+    }
+
+    // forward pass, then backward pass to inputs 1 to 3 with the given gradient of the objective
+    ElemType ForwardBackward(ElemType gradient)
+    {
+        this->CreateValueMatrixIfNull();
+        this->Value().Resize(1, 1);
+        this->ForwardProp(FrameRange());
+        ElemType objective = this->Value().Get00Element();
+
+        this->CreateGradientMatrixIfNull();
+        this->Gradient().Resize(1, 1);
+        this->Gradient().SetValue(gradient);
+        for (size_t inputIndex = 1; inputIndex <= 3; inputIndex++)
+            this->BackpropTo(inputIndex, FrameRange());
+        return objective;
+    }
+};
+
+// log softmax of the given scores
+static vector<double> LogSoftmax(const vector<double>& scores)
+{
+    double maxScore = scores[0];
+    for (double score : scores)
+        maxScore = max(maxScore, score);
+    double sum = 0;
+    for (double score : scores)
+        sum += exp(score - maxScore);
+    vector<double> result;
+    for (double score : scores)
+        result.push_back(score - maxScore - log(sum));
+    return result;
+}
+
+template <class ElemType>
+void ClassBasedCrossEntropyWithSoftmaxTestImpl(float threshold)
+{
+    // 7 words in 3 classes: {0, 1}, {2, 3, 4}, {5, 6}
+    const size_t c_numClasses = 3, c_vocabSize = 7, c_hiddenSize = 4;
+    const size_t wordClass[c_vocabSize] = { 0, 0, 1, 1, 1, 2, 2 };
+    const size_t classBegin[c_numClasses + 1] = { 0, 2, 5, 7 };
+    const ElemType c_criterionGradient = (ElemType)1.5;
+
+    // 3 parallel sequences with gaps at their ends and at the start of the third one
+    const size_t numParallelSequences = 3, numTimeSteps = 5, numCols = numParallelSequences * numTimeSteps;
+    MBLayoutPtr pMBLayout = make_shared<MBLayout>(numParallelSequences, numTimeSteps, L"X");
+    pMBLayout->AddSequence(0, 0, 0, 5);
+    pMBLayout->AddSequence(1, 1, 0, 3);
+    pMBLayout->AddGap(1, 3, 5);
+    pMBLayout->AddGap(2, 0, 1);
+    pMBLayout->AddSequence(2, 2, 1, 5);
+    auto isGap = [&](size_t j) { return pMBLayout->IsGap(FrameRange(pMBLayout, j / numParallelSequences).Sequence(j % numParallelSequences)); };
+
+    // random words, all classes occurring in several sequences; labels are left zero in gaps, which would be an invalid class
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(-1, 1);
+    vector<ElemType> labels(4 * numCols, 0), hidden(c_hiddenSize * numCols), weights(c_hiddenSize * c_vocabSize), classScores(c_numClasses * numCols);
+    for (size_t j = 0; j < numCols; j++)
+    {
+        if (!isGap(j))
+        {
+            size_t word = (j * 5 + 3) % c_vocabSize;
+            labels[4 * j + 0] = (ElemType)word;
+            labels[4 * j + 1] = (ElemType)wordClass[word];
+            labels[4 * j + 2] = (ElemType)classBegin[wordClass[word]];
+            labels[4 * j + 3] = (ElemType)classBegin[wordClass[word] + 1];
+        }
+    }
+    for (auto& value : hidden)
+        value = (ElemType)uniform(rng);
+    for (auto& value : weights)
+        value = (ElemType)uniform(rng);
+    for (auto& value : classScores)
+        value = (ElemType)uniform(rng);
+
+    auto labelNode = make_shared<DataNodeTest<ElemType>>(pMBLayout, 4, labels);
+    auto hiddenNode = make_shared<DataNodeTest<ElemType>>(pMBLayout, c_hiddenSize, hidden);
+    auto weightNode = make_shared<DataNodeTest<ElemType>>(nullptr, c_hiddenSize, weights);
+    auto classScoreNode = make_shared<DataNodeTest<ElemType>>(pMBLayout, c_numClasses, classScores);
+    auto node = make_shared<ClassBasedCrossEntropyWithSoftmaxNodeTest<ElemType>>();
+    node->AttachInputs({ labelNode, hiddenNode, weightNode, classScoreNode });
+    node->Validate(true);
+
+    ElemType objective = node->ForwardBackward(c_criterionGradient);
+
+    // reference: frame by frame, -log P(class) - log P(word | class), and its gradients
+    double expectedObjective = 0;
+    vector<double> hiddenGradient(hidden.size(), 0), weightGradient(weights.size(), 0), classScoreGradient(classScores.size(), 0);
+    for (size_t j = 0; j < numCols; j++)
+    {
+        if (isGap(j))
+            continue;
+        size_t word = (size_t)labels[4 * j], wordCls = (size_t)labels[4 * j + 1];
+        size_t begin = classBegin[wordCls], end = classBegin[wordCls + 1];
+
+        vector<double> scores(classScores.begin() + j * c_numClasses, classScores.begin() + (j + 1) * c_numClasses);
+        vector<double> logProbs = LogSoftmax(scores);
+        expectedObjective -= logProbs[wordCls];
+        for (size_t c = 0; c < c_numClasses; c++)
+            classScoreGradient[j * c_numClasses + c] = c_criterionGradient * (exp(logProbs[c]) - (c == wordCls ? 1 : 0));
+
+        scores.assign(end - begin, 0);
+        for (size_t k = begin; k < end; k++)
+            for (size_t i = 0; i < c_hiddenSize; i++)
+                scores[k - begin] += weights[k * c_hiddenSize + i] * hidden[j * c_hiddenSize + i];
+        logProbs = LogSoftmax(scores);
+        expectedObjective -= logProbs[word - begin];
+        for (size_t k = begin; k < end; k++)
+        {
+            double scoreGradient = c_criterionGradient * (exp(logProbs[k - begin]) - (k == word ? 1 : 0));
+            for (size_t i = 0; i < c_hiddenSize; i++)
+            {
+                hiddenGradient[j * c_hiddenSize + i] += weights[k * c_hiddenSize + i] * scoreGradient;
+                weightGradient[k * c_hiddenSize + i] += hidden[j * c_hiddenSize + i] * scoreGradient;
+            }
+        }
+    }
+
+    BOOST_REQUIRE_MESSAGE(abs(objective - expectedObjective) < threshold, "ClassBasedCrossEntropyWithSoftmax objective is invalid");
+    vector<ElemType> expected(hiddenGradient.begin(), hiddenGradient.end());
+    BOOST_REQUIRE_MESSAGE(AreEqual(expected.data(), hiddenNode->GetGradient().Data(), expected.size(), threshold), "Gradient to the hidden activations is invalid");
+    expected.assign(weightGradient.begin(), weightGradient.end());
+    BOOST_REQUIRE_MESSAGE(AreEqual(expected.data(), weightNode->GetGradient().Data(), expected.size(), threshold), "Gradient to the weights is invalid");
+    expected.assign(classScoreGradient.begin(), classScoreGradient.end());
+    BOOST_REQUIRE_MESSAGE(AreEqual(expected.data(), classScoreNode->GetGradient().Data(), expected.size(), threshold), "Gradient to the class scores is invalid");
+}
+
+BOOST_AUTO_TEST_SUITE(ClassBasedCrossEntropyTestSuite)
+
+BOOST_AUTO_TEST_CASE(ClassBasedCrossEntropyWithSoftmaxTest)
+{
+    ClassBasedCrossEntropyWithSoftmaxTestImpl<float>(1e-4f);
+    ClassBasedCrossEntropyWithSoftmaxTestImpl<double>(1e-10f);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} } } }
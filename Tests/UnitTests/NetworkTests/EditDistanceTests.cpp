@@ -4,6 +4,7 @@
 //
 #include "stdafx.h"
 #include "EvaluationNodes.h"
+#include <random>
 
 using namespace Microsoft::MSR::CNTK;
 namespace Microsoft { namespace MSR { namespace CNTK { namespace Test {
@@ -44,6 +45,67 @@ BOOST_AUTO_TEST_CASE(ComputeEditDistanceErrorTest)
     assert((int)ed == 1);
 }
 
+BOOST_AUTO_TEST_CASE(LevenshteinDistanceTest)
+{
+    const string kitten = "kitten", sitting = "sitting";
+    BOOST_CHECK_EQUAL(LevenshteinDistance(kitten.data(), kitten.size(), sitting.data(), sitting.size()), (size_t)3);
+
+    // the bit-parallel algorithm against the DP, across the word boundaries of the bit vectors
+    std::mt19937 rng(0);
+    for (size_t firstSize : { 0, 1, 63, 64, 65, 128, 200, 1000 })
+    {
+        for (size_t secondSize : { 0, 1, 64, 150, 1000 })
+        {
+            for (int alphabetSize : { 2, 40 })
+            {
+                vector<int> first(firstSize), second(secondSize);
+                for (auto& label : first)
+                    label = (int)(rng() % alphabetSize);
+                for (size_t j = 0; j < secondSize; j++) // mostly the first sequence, with random edits
+                    second[j] = (j < firstSize && rng() % 4 != 0) ? first[j] : (int)(rng() % alphabetSize);
+
+                float expected = EditOperationCount(first.data(), firstSize, second.data(), secondSize, 1, 1, 1);
+                BOOST_CHECK_EQUAL(LevenshteinDistance(first.data(), firstSize, second.data(), secondSize), (size_t)expected);
+                BOOST_CHECK_EQUAL(EditDistanceErrorCount(first, second, 0.5f, 0.5f, 0.5f), expected);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ComputeEditDistanceErrorParallelSequencesTest)
+{
+    // two parallel sequences: 1 2 3 4 5 6 vs. 1 2 9 4 5 6, and 7 8 9 10 vs. 7 9 10 11 followed by a gap
+    const size_t numParallelSequences = 2, numTimeSteps = 6;
+    const float firstLabels[2][numTimeSteps] = { { 1, 2, 3, 4, 5, 6 }, { 7, 8, 9, 10, 0, 0 } };
+    const float secondLabels[2][numTimeSteps] = { { 1, 2, 9, 4, 5, 6 }, { 7, 9, 10, 11, 0, 0 } };
+    Matrix<float> firstSeq(CPUDEVICE);
+    Matrix<float> secondSeq(CPUDEVICE);
+    firstSeq.Resize(1, numParallelSequences * numTimeSteps);
+    secondSeq.Resize(1, numParallelSequences * numTimeSteps);
+    for (size_t t = 0; t < numTimeSteps; t++)
+    {
+        for (size_t s = 0; s < numParallelSequences; s++)
+        {
+            firstSeq(0, t * numParallelSequences + s) = firstLabels[s][t];
+            secondSeq(0, t * numParallelSequences + s) = secondLabels[s][t];
+        }
+    }
+    MBLayoutPtr pMBLayout = make_shared<MBLayout>(numParallelSequences, numTimeSteps, L"X");
+    pMBLayout->AddSequence(0, 0, 0, numTimeSteps);
+    pMBLayout->AddSequence(1, 1, 0, 4);
+    pMBLayout->AddGap(1, 4, numTimeSteps);
+    unique_ptr<EditDistanceErrorNode<float>> pEDNode(new EditDistanceErrorNode<float>(-1, L"ednode"));
+    vector<size_t> tokensToIgnore;
+
+    // uniform penalties: one substitution, and one deletion plus one insertion
+    float ed = pEDNode->ComputeEditDistanceError(firstSeq, secondSeq, pMBLayout, 1, 1, 1, false, tokensToIgnore);
+    BOOST_CHECK_EQUAL(ed, 3);
+
+    // expensive deletions and insertions: three substitutions in the second sequence instead
+    ed = pEDNode->ComputeEditDistanceError(firstSeq, secondSeq, pMBLayout, 1, 2, 2, false, tokensToIgnore);
+    BOOST_CHECK_EQUAL(ed, 4);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } } } }
\ No newline at end of file
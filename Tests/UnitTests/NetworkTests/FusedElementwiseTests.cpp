@@ -0,0 +1,264 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+
+#include "stdafx.h"
+
+#include "../../../Source/ComputationNetworkLib/ComputationNetwork.h"
+#include "../../../Source/ComputationNetworkLib/ComputationNetworkBuilder.h"
+#include "../../../Source/ComputationNetworkLib/NonlinearityNodes.h"
+#include "TestHelpers.h"
+#include "Globals.h"
+#include <boost/filesystem.hpp>
+#include <memory>
+#include <random>
+
+using namespace Microsoft::MSR::CNTK;
+using namespace std;
+
+namespace Microsoft { namespace MSR { namespace CNTK { namespace Test {
+
+// We perform test on CPU.
+const DEVICEID_TYPE c_deviceId = CPUDEVICE;
+
+const size_t c_inputDim = 3;
+const size_t c_outputDim = 4;
+
+static size_t CountFusedNodes(const ComputationNetworkPtr& net)
+{
+    size_t numFusedNodes = 0;
+    for (const auto& node : net->GetAllNodes())
+        numFusedNodes += node->OperationName() == OperationNameOf(FusedElementwiseNode);
+    return numFusedNodes;
+}
+
+// Builds the network with elementwise fusion enabled or disabled, and allocates its matrices.
+// The fused network contains FusedElementwiseNodes in place of chains of the elementwise nodes.
+template <class ElemType>
+static ComputationNetworkPtr CompileTestNetwork(const function<void(ComputationNetwork&)>& buildNetwork, bool fuse)
+{
+    auto net = make_shared<ComputationNetwork>(c_deviceId);
+    buildNetwork(*net);
+
+    bool wasFusing = Globals::ShouldFuseElementwiseOperations();
+    Globals::SetFuseElementwiseOperations(fuse);
+    net->CompileNetwork();
+    Globals::SetFuseElementwiseOperations(wasFusing);
+
+    size_t numFusedNodes = CountFusedNodes(net);
+    BOOST_REQUIRE_MESSAGE(fuse ? numFusedNodes > 0 : numFusedNodes == 0, "Elementwise fusion did not fuse as requested");
+
+    vector<ComputationNodeBasePtr> outputNodes;
+    if (net->NodeNameExists(L"h"))
+        outputNodes.push_back(net->GetNodeFromName(L"h"));
+    net->AllocateAllMatrices({}, outputNodes, net->GetNodeFromName(L"criterion"));
+    return net;
+}
+
+// Sets the minibatch layout, three parallel sequences with a gap, and fills inputs and parameters with random values.
+// Each node's values are derived from its name, so that the fused and the unfused networks get the same values.
+template <class ElemType>
+static void SetTestValues(const ComputationNetworkPtr& net)
+{
+    const size_t numParallelSequences = 3, numTimeSteps = 4;
+    auto pMBLayout = net->GetMBLayoutPtrOfNetwork();
+    pMBLayout->Init(numParallelSequences, numTimeSteps);
+    pMBLayout->AddSequence(0, 0, 0, numTimeSteps);
+    pMBLayout->AddSequence(1, 1, 0, 2);
+    pMBLayout->AddGap(1, 2, numTimeSteps);
+    pMBLayout->AddSequence(2, 2, 0, numTimeSteps);
+
+    for (const auto& nodeBase : net->GetAllNodes())
+    {
+        auto node = dynamic_pointer_cast<ComputationNode<ElemType>>(nodeBase);
+        size_t numRows, numCols;
+        if (node->OperationName() == OperationNameOf(InputValue))
+        {
+            numRows = node->GetSampleMatrixNumRows();
+            numCols = numParallelSequences * numTimeSteps;
+        }
+        else if (node->OperationName() == OperationNameOf(LearnableParameter))
+        {
+            numRows = node->GetAsMatrixNumRows();
+            numCols = node->GetAsMatrixNumCols();
+        }
+        else
+            continue;
+
+        const wstring& name = node->NodeName();
+        seed_seq seed(name.begin(), name.end());
+        mt19937 rng(seed);
+        uniform_real_distribution<double> uniform(-1, 1);
+        vector<ElemType> values(numRows * numCols);
+        for (auto& value : values)
+            value = (ElemType)uniform(rng);
+        node->Value().SetValue(numRows, numCols, c_deviceId, values.data());
+    }
+}
+
+// Runs the forward pass of the network, and the backward pass if requested. Returns the criterion.
+template <class ElemType>
+static ElemType ForwardBackward(const ComputationNetworkPtr& net, bool backprop)
+{
+    auto criterion = net->GetNodeFromName(L"criterion");
+    ScopedNetworkOperationMode modeGuard(net, NetworkOperationMode::training);
+    net->StartEvaluateMinibatchLoop(criterion);
+    net->SetEvalTimeStampsOutdatedWithRegardToAll();
+    net->ForwardProp(criterion);
+    if (backprop)
+        net->Backprop(criterion);
+    return dynamic_pointer_cast<ComputationNode<ElemType>>(criterion)->Value().Get00Element();
+}
+
+template <class ElemType>
+static vector<ElemType> GetValues(const ComputationNetworkPtr& net, const wstring& nodeName, bool gradient)
+{
+    auto node = dynamic_pointer_cast<ComputationNode<ElemType>>(net->GetNodeFromName(nodeName));
+    const Matrix<ElemType>& matrix = gradient ? node->Gradient() : node->Value();
+    return vector<ElemType>(matrix.Data(), matrix.Data() + matrix.GetNumElements());
+}
+
+// The elementwise part uses every fusible operation, and broadcasts a per-row and a scalar parameter over the minibatch.
+// y = exp(-(ReLU(W x - b) .* s)) + sigmoid(W x) .* tanh(b)
+// (node names are not case sensitive, so none of the intermediate names may equal a parameter name)
+template <class ElemType>
+static void BuildElementwiseNetwork(ComputationNetwork& net)
+{
+    ComputationNetworkBuilder<ElemType> builder(net);
+    auto x = builder.CreateInputNode(L"x", c_inputDim);
+    auto W = builder.CreateLearnableParameter(L"W", c_outputDim, c_inputDim);
+    auto b = builder.CreateLearnableParameter(L"b", c_outputDim, 1);
+    auto s = builder.CreateLearnableParameter(L"s", 1, 1);
+
+    auto a = builder.Times(W, x, 1, L"a");
+    auto scaled = builder.ElementTimes(builder.RectifiedLinear(builder.Minus(a, b, L"u"), L"v"), s, L"scaled");
+    auto e = builder.Exp(builder.Negate(scaled, L"minusScaled"), L"e");
+    auto q = builder.Sigmoid(builder.Pass(a, L"passA"), L"q");
+    auto y = builder.Plus(e, builder.ElementTimes(q, builder.Tanh(b, L"t"), L"qt"), L"y");
+    auto criterion = builder.Sum(y, L"criterion");
+    net.AddToNodeGroup(L"criterion", criterion);
+}
+
+// An LSTM cell without recurrence; the previous cell state c is an input.
+// h = sigmoid(Wo x + bo) .* tanh(sigmoid(Wf x + bf) .* c + sigmoid(Wi x + bi) .* tanh(Wg x + bg))
+template <class ElemType>
+static void BuildLstmCellNetwork(ComputationNetwork& net)
+{
+    ComputationNetworkBuilder<ElemType> builder(net);
+    auto x = builder.CreateInputNode(L"x", c_inputDim);
+    auto c = builder.CreateInputNode(L"c", c_outputDim);
+    auto r = builder.CreateInputNode(L"r", c_outputDim);
+    auto gate = [&](const wstring& name)
+    {
+        auto W = builder.CreateLearnableParameter(L"W" + name, c_outputDim, c_inputDim);
+        auto b = builder.CreateLearnableParameter(L"b" + name, c_outputDim, 1);
+        return builder.Plus(builder.Times(W, x, 1, L"z" + name), b, L"p" + name);
+    };
+    auto inputGate = builder.Sigmoid(gate(L"i"), L"inputGate");
+    auto forgetGate = builder.Sigmoid(gate(L"f"), L"forgetGate");
+    auto outputGate = builder.Sigmoid(gate(L"o"), L"outputGate");
+    auto cellInput = builder.Tanh(gate(L"g"), L"cellInput");
+    auto cellState = builder.Plus(builder.ElementTimes(forgetGate, c, L"fc"), builder.ElementTimes(inputGate, cellInput, L"ig"), L"cellState");
+    auto h = builder.ElementTimes(outputGate, builder.Tanh(cellState, L"tanhCellState"), L"h");
+    auto criterion = builder.Sum(builder.ElementTimes(h, r, L"hr"), L"criterion");
+    net.AddToNodeGroup(L"output", h);
+    net.AddToNodeGroup(L"criterion", criterion);
+}
+
+BOOST_AUTO_TEST_SUITE(FusedElementwiseTestSuite)
+
+// the gradients of the fused network against finite differences, for the full-size and the broadcast inputs of the fused nodes
+BOOST_AUTO_TEST_CASE(FusedElementwiseNumericGradientTest)
+{
+    const double epsilon = 1e-5;
+    auto net = CompileTestNetwork<double>(BuildElementwiseNetwork<double>, /*fuse=*/ true);
+    SetTestValues<double>(net);
+    ForwardBackward<double>(net, /*backprop=*/ true);
+
+    for (const wstring& name : { L"W", L"b", L"s" })
+    {
+        vector<double> gradient = GetValues<double>(net, name, /*gradient=*/ true);
+        double* values = dynamic_pointer_cast<ComputationNode<double>>(net->GetNodeFromName(name))->Value().Data();
+        for (size_t k = 0; k < gradient.size(); k++)
+        {
+            double value = values[k];
+            values[k] = value + epsilon;
+            double plus = ForwardBackward<double>(net, /*backprop=*/ false);
+            values[k] = value - epsilon;
+            double minus = ForwardBackward<double>(net, /*backprop=*/ false);
+            values[k] = value;
+
+            double numericGradient = (plus - minus) / (2 * epsilon);
+            BOOST_REQUIRE_MESSAGE(abs(gradient[k] - numericGradient) < 1e-6,
+                                  "Gradient of the fused network differs from finite differences for " << string(name.begin(), name.end()) << "[" << k << "]");
+        }
+    }
+}
+
+// fused and unfused LSTM cell give the same values and gradients
+BOOST_AUTO_TEST_CASE(FusedElementwiseLstmCellTest)
+{
+    const float threshold = 1e-5f;
+    auto net = CompileTestNetwork<float>(BuildLstmCellNetwork<float>, /*fuse=*/ false);
+    auto fusedNet = CompileTestNetwork<float>(BuildLstmCellNetwork<float>, /*fuse=*/ true);
+    SetTestValues<float>(net);
+    SetTestValues<float>(fusedNet);
+
+    float criterion = ForwardBackward<float>(net, /*backprop=*/ true);
+    float fusedCriterion = ForwardBackward<float>(fusedNet, /*backprop=*/ true);
+    BOOST_REQUIRE_MESSAGE(abs(criterion - fusedCriterion) < threshold, "Criterion of the fused network is invalid");
+
+    vector<float> h = GetValues<float>(net, L"h", /*gradient=*/ false);
+    vector<float> fusedH = GetValues<float>(fusedNet, L"h", /*gradient=*/ false);
+    BOOST_REQUIRE_MESSAGE(h.size() == fusedH.size() && AreEqual(h.data(), fusedH.data(), h.size(), threshold), "Output of the fused network is invalid");
+
+    for (const auto& parameter : net->LearnableParameterNodes(net->GetNodeFromName(L"criterion")))
+    {
+        const wstring& name = parameter->NodeName();
+        vector<float> gradient = GetValues<float>(net, name, /*gradient=*/ true);
+        vector<float> fusedGradient = GetValues<float>(fusedNet, name, /*gradient=*/ true);
+        BOOST_REQUIRE_MESSAGE(AreEqual(gradient.data(), fusedGradient.data(), gradient.size(), threshold),
+                              "Gradient of the fused network is invalid for " << string(name.begin(), name.end()));
+    }
+}
+
+// a saved fused network contains the unfused nodes, and loads without fusion
+BOOST_AUTO_TEST_CASE(FusedElementwiseSaveLoadTest)
+{
+    const float threshold = 1e-5f;
+    auto net = CompileTestNetwork<float>(BuildLstmCellNetwork<float>, /*fuse=*/ false);
+    auto fusedNet = CompileTestNetwork<float>(BuildLstmCellNetwork<float>, /*fuse=*/ true);
+    SetTestValues<float>(net);
+    float criterion = ForwardBackward<float>(net, /*backprop=*/ false);
+    vector<float> h = GetValues<float>(net, L"h", /*gradient=*/ false);
+
+    auto fileName = boost::filesystem::unique_path(boost::filesystem::temp_directory_path() / "FusedElementwise-%%%%-%%%%.dnn").wstring();
+    fusedNet->Save(fileName);
+    bool wasFusing = Globals::ShouldFuseElementwiseOperations();
+    Globals::SetFuseElementwiseOperations(false);
+    auto loadedNet = make_shared<ComputationNetwork>(c_deviceId);
+    loadedNet->Load<float>(fileName);
+    Globals::SetFuseElementwiseOperations(wasFusing);
+    boost::filesystem::remove(fileName);
+
+    BOOST_REQUIRE_MESSAGE(CountFusedNodes(loadedNet) == 0, "The saved fused network contains fused nodes");
+    BOOST_REQUIRE_MESSAGE(loadedNet->GetAllNodes().size() == net->GetAllNodes().size(), "The saved fused network does not contain the unfused nodes");
+    for (const auto& node : net->GetAllNodes())
+    {
+        BOOST_REQUIRE_MESSAGE(loadedNet->NodeNameExists(node->NodeName()) && loadedNet->GetNodeFromName(node->NodeName())->OperationName() == node->OperationName(),
+                              "The saved fused network does not contain the unfused node " << string(node->NodeName().begin(), node->NodeName().end()));
+    }
+
+    loadedNet->AllocateAllMatrices({}, { loadedNet->GetNodeFromName(L"h") }, loadedNet->GetNodeFromName(L"criterion"));
+    SetTestValues<float>(loadedNet);
+
+    float loadedCriterion = ForwardBackward<float>(loadedNet, /*backprop=*/ false);
+    BOOST_REQUIRE_MESSAGE(abs(criterion - loadedCriterion) < threshold, "Criterion of the reloaded fused network is invalid");
+    vector<float> loadedH = GetValues<float>(loadedNet, L"h", /*gradient=*/ false);
+    BOOST_REQUIRE_MESSAGE(h.size() == loadedH.size() && AreEqual(h.data(), loadedH.data(), h.size(), threshold), "Output of the reloaded fused network is invalid");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} } } }
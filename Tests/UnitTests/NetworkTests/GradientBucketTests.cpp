@@ -0,0 +1,303 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+#include "stdafx.h"
+
+#include "Matrix.h"
+#include "MPIWrapper.h"
+#include "DistGradHeader.h"
+#include "SimpleDistGradAggregator.h"
+#include <cstring>
+#include <memory>
+#include <random>
+
+using namespace Microsoft::MSR::CNTK;
+using namespace std;
+
+namespace Microsoft { namespace MSR { namespace CNTK { namespace Test {
+
+// A single worker whose sums are those of c_numWorkers identical workers: every reduction multiplies the data
+// by c_numWorkers. So each gradient must end up multiplied exactly once, whichever bucket it was reduced in.
+// Point-to-point operations and barriers do nothing, since there are no other workers to talk to.
+class ReplicatingMPIWrapper : public MPIWrapper
+{
+public:
+    static const int c_numWorkers = 3;
+
+    // ranks on the host of this worker and on the most crowded host
+    ReplicatingMPIWrapper(size_t numLocalRanks = 1, size_t maxNumLocalRanks = 1)
+        : m_numLocalRanks(numLocalRanks), m_maxNumLocalRanks(maxNumLocalRanks), m_numHierarchicalAllReduces(0)
+    {
+    }
+
+    size_t NumHierarchicalAllReduces() const { return m_numHierarchicalAllReduces; }
+
+    size_t NumNodesInUse() const override { return 1; }
+    size_t CurrentNodeRank() const override { return 0; }
+    bool IsMainNode() const override { return true; }
+    std::wstring CurrentNodeName() const override { return L"localhost"; }
+    bool IsIdle() const override { return false; }
+    bool UsingAllNodes() const override { return true; }
+    size_t MainNodeRank() const override { return 0; }
+    bool IsMultiHost() const override { return false; }
+    bool UseGpuGdr() override { return false; }
+
+    int Finalize(void) override { return 0; }
+    int Wait(MPI_Request*, MPI_Status*) override { return 0; }
+    int Test(MPI_Request*, int* flag, MPI_Status*) override { *flag = 1; return 0; }
+    int Waitany(int, MPI_Request[], int* index, MPI_Status*) override { *index = MPI_UNDEFINED; return 0; }
+    int Waitall(int, MPI_Request[], MPI_Status[]) override { return 0; }
+    int Isend(const void*, int, MPI_Datatype, int, int, MPI_Request*) override { return 0; }
+    int Recv(void*, int, MPI_Datatype, int, int, MPI_Status*) override { return 0; }
+    int Irecv(void*, int, MPI_Datatype, int, int, MPI_Request*) override { return 0; }
+    int Iallreduce(const void* sendbuf, void* recvbuf, int count, MPI_Datatype datatype, MPI_Op, MPI_Request*) override
+    {
+        // (called on the communication thread of the aggregator, so errors are reported by exceptions)
+        if (sendbuf != MPI_IN_PLACE)
+            LogicError("ReplicatingMPIWrapper: only in-place Iallreduce is supported.");
+        if (datatype == MPI_FLOAT)
+            Replicate((float*) recvbuf, count);
+        else if (datatype == MPI_DOUBLE)
+            Replicate((double*) recvbuf, count);
+        else
+            LogicError("ReplicatingMPIWrapper: unexpected data type in Iallreduce.");
+        return 0;
+    }
+    int Abort(int) override { return 0; }
+    int Error_string(int, char* string, int* resultlen) override { *string = '\0'; *resultlen = 0; return 0; }
+
+    void AllReduce(std::vector<size_t>& accumulator) const override { Replicate(accumulator.data(), accumulator.size()); }
+    void AllReduce(std::vector<int>& accumulator) const override { Replicate(accumulator.data(), accumulator.size()); }
+    void AllReduce(std::vector<double>& accumulator) const override { Replicate(accumulator.data(), accumulator.size()); }
+    void AllReduce(std::vector<float>& accumulator) const override { Replicate(accumulator.data(), accumulator.size()); }
+
+    void AllReduce(size_t* sendData, size_t numElements, MPI_Op) const override { Replicate(sendData, numElements); }
+    void AllReduce(int* sendData, size_t numElements, MPI_Op) const override { Replicate(sendData, numElements); }
+    void AllReduce(double* sendData, size_t numElements, MPI_Op) const override { Replicate(sendData, numElements); }
+    void AllReduce(float* sendData, size_t numElements, MPI_Op) const override { Replicate(sendData, numElements); }
+
+    void AllReduce(size_t* sendData, size_t* receiveData, size_t numElements, MPI_Op) const override { Replicate(sendData, receiveData, numElements); }
+    void AllReduce(int* sendData, int* receiveData, size_t numElements, MPI_Op) const override { Replicate(sendData, receiveData, numElements); }
+    void AllReduce(double* sendData, double* receiveData, size_t numElements, MPI_Op) const override { Replicate(sendData, receiveData, numElements); }
+    void AllReduce(float* sendData, float* receiveData, size_t numElements, MPI_Op) const override { Replicate(sendData, receiveData, numElements); }
+
+    void AllReduceAsync(size_t* sendData, size_t numElements, MPI_Request*, MPI_Op) const override { Replicate(sendData, numElements); }
+    void AllReduceAsync(int* sendData, size_t numElements, MPI_Request*, MPI_Op) const override { Replicate(sendData, numElements); }
+    void AllReduceAsync(double* sendData, size_t numElements, MPI_Request*, MPI_Op) const override { Replicate(sendData, numElements); }
+    void AllReduceAsync(float* sendData, size_t numElements, MPI_Request*, MPI_Op) const override { Replicate(sendData, numElements); }
+
+    void AllReduceAsync(size_t* sendData, size_t* receiveData, size_t numElements, MPI_Request*, MPI_Op) const override { Replicate(sendData, receiveData, numElements); }
+    void AllReduceAsync(int* sendData, int* receiveData, size_t numElements, MPI_Request*, MPI_Op) const override { Replicate(sendData, receiveData, numElements); }
+    void AllReduceAsync(double* sendData, double* receiveData, size_t numElements, MPI_Request*, MPI_Op) const override { Replicate(sendData, receiveData, numElements); }
+    void AllReduceAsync(float* sendData, float* receiveData, size_t numElements, MPI_Request*, MPI_Op) const override { Replicate(sendData, receiveData, numElements); }
+
+    void HierarchicalAllReduce(float* data, size_t numElements) override { m_numHierarchicalAllReduces++; Replicate(data, numElements); }
+    void HierarchicalAllReduce(double* data, size_t numElements) override { m_numHierarchicalAllReduces++; Replicate(data, numElements); }
+    size_t NumLocalRanks() const override { return m_numLocalRanks; }
+    size_t MaxNumLocalRanks() const override { return m_maxNumLocalRanks; }
+
+    void Bcast(size_t*, size_t, size_t) override {}
+    void Bcast(double*, size_t, size_t) override {}
+    void Bcast(float*, size_t, size_t) override {}
+    void Bcast(void*, int, MPI_Datatype, int) override {}
+
+    void AllGatherAsync(const size_t* sendData, size_t numSendElements, size_t* receiveData, size_t, MPI_Request*) const override { Copy(sendData, receiveData, numSendElements); }
+    void AllGatherAsync(const int* sendData, size_t numSendElements, int* receiveData, size_t, MPI_Request*) const override { Copy(sendData, receiveData, numSendElements); }
+    void AllGatherAsync(const float* sendData, size_t numSendElements, float* receiveData, size_t, MPI_Request*) const override { Copy(sendData, receiveData, numSendElements); }
+    void AllGatherAsync(const double* sendData, size_t numSendElements, double* receiveData, size_t, MPI_Request*) const override { Copy(sendData, receiveData, numSendElements); }
+
+    void AllGather(const size_t* sendData, size_t numSendElements, size_t* receiveData, size_t) const override { Copy(sendData, receiveData, numSendElements); }
+    void AllGather(const int* sendData, size_t numSendElements, int* receiveData, size_t) const override { Copy(sendData, receiveData, numSendElements); }
+    void AllGather(const float* sendData, size_t numSendElements, float* receiveData, size_t) const override { Copy(sendData, receiveData, numSendElements); }
+    void AllGather(const double* sendData, size_t numSendElements, double* receiveData, size_t) const override { Copy(sendData, receiveData, numSendElements); }
+    void Allgather(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int, MPI_Datatype) const override
+    {
+        size_t elementSize = (sendtype == MPI_CHAR) ? sizeof(char) : (sendtype == MPI_INT) ? sizeof(int) : (sendtype == MPI_FLOAT) ? sizeof(float) : sizeof(double);
+        memcpy(recvbuf, sendbuf, elementSize * sendcount);
+    }
+    void AllGatherv(const int* sendData, size_t numSendElements, int* receiveData, int[], int[]) const override { Copy(sendData, receiveData, numSendElements); }
+
+    void Gather(const size_t* sendData, size_t numSendElements, size_t* receiveData, size_t, size_t) const override { Copy(sendData, receiveData, numSendElements); }
+    void Gather(const int* sendData, size_t numSendElements, int* receiveData, size_t, size_t) const override { Copy(sendData, receiveData, numSendElements); }
+    void Gather(const float* sendData, size_t numSendElements, float* receiveData, size_t, size_t) const override { Copy(sendData, receiveData, numSendElements); }
+    void Gather(const double* sendData, size_t numSendElements, double* receiveData, size_t, size_t) const override { Copy(sendData, receiveData, numSendElements); }
+
+    void Gatherv(const size_t* sendData, size_t numSendElements, size_t* receiveData, int[], int[], size_t) const override { Copy(sendData, receiveData, numSendElements); }
+    void Gatherv(const char* sendData, size_t numSendElements, char* receiveData, int[], int[], size_t) const override { Copy(sendData, receiveData, numSendElements); }
+    void Gatherv(const int* sendData, size_t numSendElements, int* receiveData, int[], int[], size_t) const override { Copy(sendData, receiveData, numSendElements); }
+    void Gatherv(const float* sendData, size_t numSendElements, float* receiveData, int[], int[], size_t) const override { Copy(sendData, receiveData, numSendElements); }
+    void Gatherv(const double* sendData, size_t numSendElements, double* receiveData, int[], int[], size_t) const override { Copy(sendData, receiveData, numSendElements); }
+
+    int WaitAll() override { return 0; }
+    void WaitAny(MPI_Request*, int, int* index) override { *index = MPI_UNDEFINED; }
+    void Wait(MPI_Request*) override {}
+    int WaitAll(std::vector<MPI_Request>&) override { return 0; }
+
+private:
+    size_t m_numLocalRanks;
+    size_t m_maxNumLocalRanks;
+    size_t m_numHierarchicalAllReduces;
+
+    template <class T>
+    static void Replicate(T* data, size_t numElements)
+    {
+        for (size_t i = 0; i < numElements; i++)
+            data[i] *= c_numWorkers;
+    }
+
+    template <class T>
+    static void Replicate(const T* sendData, T* receiveData, size_t numElements)
+    {
+        for (size_t i = 0; i < numElements; i++)
+            receiveData[i] = sendData[i] * c_numWorkers;
+    }
+
+    template <class T>
+    static void Copy(const T* sendData, T* receiveData, size_t numElements)
+    {
+        memcpy(receiveData, sendData, sizeof(T) * numElements);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(GradientBucketSuite)
+
+BOOST_AUTO_TEST_CASE(GradientBucketPartitioning)
+{
+    typedef SimpleDistGradAggregator<float> Aggregator;
+    typedef vector<vector<size_t>> Buckets;
+
+    // 128 bytes are 32 floats; 100 does not fit anywhere and gets its own bucket, which closes the previous one
+    BOOST_REQUIRE(Aggregator::PartitionIntoBuckets({ 10, 10, 10, 100, 5, 5 }, 128) == Buckets({ { 0, 1, 2 }, { 3 }, { 4, 5 } }));
+    BOOST_REQUIRE(Aggregator::PartitionIntoBuckets({ 10, 10, 10, 100, 5, 5 }, 64) == Buckets({ { 0 }, { 1 }, { 2 }, { 3 }, { 4, 5 } }));
+    BOOST_REQUIRE(Aggregator::PartitionIntoBuckets({ 8, 8, 8, 8 }, 64) == Buckets({ { 0, 1 }, { 2, 3 } }));
+    BOOST_REQUIRE(Aggregator::PartitionIntoBuckets({ 100, 1 }, 1 << 20) == Buckets({ { 0, 1 } }));
+    BOOST_REQUIRE(Aggregator::PartitionIntoBuckets({}, 128).empty());
+
+    // each gradient is in exactly one bucket, in backprop order, and only single-gradient buckets exceed the size
+    mt19937 rng(0);
+    uniform_int_distribution<size_t> numElementsDistribution(1, 300);
+    vector<size_t> numElements(200);
+    for (auto& n : numElements)
+        n = numElementsDistribution(rng);
+    const size_t bucketSizeInBytes = 1024;
+    size_t next = 0;
+    for (const auto& bucket : Aggregator::PartitionIntoBuckets(numElements, bucketSizeInBytes))
+    {
+        BOOST_REQUIRE(!bucket.empty());
+        size_t bucketNumElements = 0;
+        for (size_t i : bucket)
+        {
+            BOOST_REQUIRE_EQUAL(i, next++);
+            bucketNumElements += numElements[i];
+        }
+        BOOST_REQUIRE(bucket.size() == 1 || sizeof(float) * bucketNumElements <= bucketSizeInBytes);
+    }
+    BOOST_REQUIRE_EQUAL(next, numElements.size());
+}
+
+// Gradients reported during backprop, and those that are not, are each reduced exactly once, also when they
+// share a bucket, over several minibatches.
+BOOST_AUTO_TEST_CASE(GradientBucketAggregation)
+{
+    const size_t numWorkers = ReplicatingMPIWrapper::c_numWorkers;
+    auto mpi = make_shared<ReplicatingMPIWrapper>();
+    SimpleDistGradAggregator<float> aggregator(mpi, false, CPUDEVICE, 0, DEFAULT_PACK_THRESHOLD_SIZE_IN_BYTES, /*bucketSizeInBytes=*/ 128);
+    BOOST_REQUIRE(aggregator.OverlapsWithBackprop());
+
+    const vector<pair<size_t, size_t>> shapes = { { 4, 3 }, { 4, 1 }, { 10, 10 }, { 2, 2 }, { 3, 5 }, { 1, 1 }, { 7, 1 } };
+    vector<unique_ptr<Matrix<float>>> gradientMatrices;
+    vector<Matrix<float>*> gradients;
+    for (const auto& shape : shapes)
+    {
+        gradientMatrices.push_back(make_unique<Matrix<float>>(shape.first, shape.second, CPUDEVICE));
+        gradients.push_back(gradientMatrices.back().get());
+    }
+
+    unique_ptr<DistGradHeader, void (*)(DistGradHeader*)> header(DistGradHeader::Create(0), DistGradHeader::Destroy);
+    mt19937 rng(0);
+    uniform_real_distribution<float> uniform(-1, 1);
+    for (size_t minibatch = 0; minibatch < 4; minibatch++)
+    {
+        vector<vector<float>> expected;
+        for (auto gradient : gradients)
+        {
+            vector<float> values(gradient->GetNumElements());
+            for (auto& value : values)
+                value = uniform(rng);
+            gradient->SetValue(gradient->GetNumRows(), gradient->GetNumCols(), CPUDEVICE, values.data());
+            for (auto& value : values)
+                value *= numWorkers;
+            expected.push_back(values);
+        }
+
+        // backprop finalizes the gradients in order; leave out every other one in odd minibatches
+        for (size_t i = 0; i < gradients.size(); i++)
+        {
+            if (minibatch % 2 == 0 || i % 2 == 0)
+                aggregator.OnGradientReady(gradients[i]);
+        }
+
+        header->numSamples = 1;
+        header->numSamplesWithLabel = 1;
+        header->criterion = 0;
+        BOOST_REQUIRE(aggregator.AggregateGradients(gradients, header.get(), minibatch == 0));
+
+        for (size_t i = 0; i < gradients.size(); i++)
+        {
+            vector<float> values(gradients[i]->Data(), gradients[i]->Data() + gradients[i]->GetNumElements());
+            BOOST_REQUIRE_MESSAGE(values == expected[i], "Gradient " << i << " was not reduced exactly once in minibatch " << minibatch);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(HierarchicalAllReduceSuite)
+
+// HierarchicalAllReduce() must be called by all ranks or by none. So whether the aggregator uses it may only depend on
+// the largest number of ranks on a host, which all ranks agree on, and not on the number of ranks on the own host.
+BOOST_AUTO_TEST_CASE(HierarchicalAllReduceDecision)
+{
+    struct TestCase
+    {
+        size_t numLocalRanks;
+        size_t maxNumLocalRanks;
+        bool useHierarchicalAllReduce;
+        bool expectHierarchicalAllReduce;
+    };
+    const vector<TestCase> testCases = {
+        { 1, 1, true, false },  // every rank alone on its host
+        { 1, 2, true, true },   // alone on this host, but not on another one
+        { 2, 2, true, true },
+        { 3, 4, true, true },   // uneven ranks per host
+        { 4, 4, false, false }, // not requested
+    };
+
+    const size_t numWorkers = ReplicatingMPIWrapper::c_numWorkers;
+    unique_ptr<DistGradHeader, void (*)(DistGradHeader*)> header(DistGradHeader::Create(0), DistGradHeader::Destroy);
+    for (const auto& testCase : testCases)
+    {
+        auto mpi = make_shared<ReplicatingMPIWrapper>(testCase.numLocalRanks, testCase.maxNumLocalRanks);
+        SimpleDistGradAggregator<float> aggregator(mpi, false, CPUDEVICE, 0, DEFAULT_PACK_THRESHOLD_SIZE_IN_BYTES,
+                                                   /*bucketSizeInBytes=*/ 0, /*sparseGradientDensityThreshold=*/ 0.5, testCase.useHierarchicalAllReduce);
+
+        vector<float> values = { 1, 2, 3, 4, 5, 6 };
+        Matrix<float> gradient(2, 3, CPUDEVICE);
+        gradient.SetValue(2, 3, CPUDEVICE, values.data());
+        vector<Matrix<float>*> gradients = { &gradient };
+
+        header->numSamples = 1;
+        header->numSamplesWithLabel = 1;
+        header->criterion = 0;
+        BOOST_REQUIRE(aggregator.AggregateGradients(gradients, header.get(), true));
+
+        for (size_t i = 0; i < values.size(); i++)
+            BOOST_REQUIRE_EQUAL(gradient.Data()[i], values[i] * numWorkers);
+        BOOST_REQUIRE_EQUAL(mpi->NumHierarchicalAllReduces() > 0, testCase.expectHierarchicalAllReduce);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} } } }
@@ -0,0 +1,286 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+
+#include "stdafx.h"
+
+#include "../../../Source/ComputationNetworkLib/ComputationNetwork.h"
+#include "../../../Source/ComputationNetworkLib/ComputationNetworkBuilder.h"
+#include "TestHelpers.h"
+#include "Globals.h"
+#include "WorkStealingThreadPool.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <set>
+#include <thread>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Microsoft::MSR::CNTK;
+using namespace std;
+
+namespace Microsoft { namespace MSR { namespace CNTK { namespace Test {
+
+// We perform test on CPU.
+const DEVICEID_TYPE c_deviceId = CPUDEVICE;
+
+const size_t c_inputDim = 3;
+const size_t c_hiddenDim = 4;
+const size_t c_interOpThreads = 4;
+
+BOOST_AUTO_TEST_SUITE(WorkStealingThreadPoolTestSuite)
+
+// tasks submitted from outside the pool all run, on more than one thread, and the waiting thread helps
+BOOST_AUTO_TEST_CASE(WorkStealingThreadPoolRunsAllTasks)
+{
+    const size_t numTasks = 64;
+    WorkStealingThreadPool threadPool(4);
+    atomic<size_t> numDone(0);
+    mutex threadIdsMutex;
+    set<thread::id> threadIds;
+    for (size_t i = 0; i < numTasks; i++)
+    {
+        threadPool.Submit([&]()
+        {
+            this_thread::sleep_for(chrono::milliseconds(1));
+            {
+                lock_guard<mutex> lock(threadIdsMutex);
+                threadIds.insert(this_thread::get_id());
+            }
+            numDone++;
+        });
+    }
+    threadPool.WaitWhileHelping([&]() { return numDone == numTasks; });
+
+    BOOST_REQUIRE_EQUAL(numDone, numTasks);
+    BOOST_REQUIRE_MESSAGE(threadIds.size() > 1, "All tasks ran on a single thread");
+}
+
+// tasks that submit tasks and wait for them (a fork-join tree, and ParallelFor() inside a task)
+BOOST_AUTO_TEST_CASE(WorkStealingThreadPoolNestedTasks)
+{
+    WorkStealingThreadPool threadPool(3);
+
+    // sum of [begin, end) by recursive halving; waiting inside a task runs the pending halves
+    function<size_t(size_t, size_t)> sum = [&](size_t begin, size_t end) -> size_t
+    {
+        if (end - begin <= 4)
+        {
+            size_t result = 0;
+            for (size_t i = begin; i < end; i++)
+                result += i;
+            return result;
+        }
+        size_t middle = (begin + end) / 2;
+        atomic<bool> done(false);
+        size_t upper = 0;
+        threadPool.Submit([&]()
+        {
+            upper = sum(middle, end);
+            done = true;
+        });
+        size_t lower = sum(begin, middle);
+        threadPool.WaitWhileHelping([&]() { return done.load(); });
+        return lower + upper;
+    };
+    BOOST_REQUIRE_EQUAL(sum(0, 1000), 999 * 1000 / 2);
+
+    vector<size_t> squares(100, 0);
+    atomic<bool> done(false);
+    threadPool.Submit([&]()
+    {
+        threadPool.ParallelFor(0, squares.size(), 8, [&](size_t i) { squares[i] = i * i; });
+        done = true;
+    });
+    threadPool.WaitWhileHelping([&]() { return done.load(); });
+    for (size_t i = 0; i < squares.size(); i++)
+        BOOST_REQUIRE_EQUAL(squares[i], i * i);
+}
+
+#ifdef _OPENMP
+// tasks run with the OpenMP team size of the pool, also when the waiting thread runs them
+BOOST_AUTO_TEST_CASE(WorkStealingThreadPoolCapsOpenMPThreads)
+{
+    const int ompThreads = omp_get_max_threads();
+    WorkStealingThreadPool threadPool(2, 1);
+    BOOST_REQUIRE_EQUAL(threadPool.OmpThreadsPerWorker(), 1);
+
+    atomic<size_t> numTooLarge(0);
+    threadPool.ParallelFor(0, 64, 64, [&](size_t)
+    {
+        if (omp_get_max_threads() != 1)
+            numTooLarge++;
+    });
+    BOOST_REQUIRE_EQUAL(numTooLarge, 0);
+    BOOST_REQUIRE_EQUAL(omp_get_max_threads(), ompThreads);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// Two branches share the bias and two share a hidden node, one branch is a recurrent loop.
+// y = h1 .* s + ReLU(a) + tanh(a), with h1 = tanh(W1 x + b), a = U x,
+// s = tanh(R PastValue(s) + h2), h2 = sigmoid(W2 x + b2), where b2 is b itself if 'shareBias'.
+template <class ElemType>
+static void BuildMultiBranchNetwork(ComputationNetwork& net, bool shareBias)
+{
+    ComputationNetworkBuilder<ElemType> builder(net);
+    auto x = builder.CreateInputNode(L"x", c_inputDim);
+    auto W1 = builder.CreateLearnableParameter(L"W1", c_hiddenDim, c_inputDim);
+    auto W2 = builder.CreateLearnableParameter(L"W2", c_hiddenDim, c_inputDim);
+    auto U = builder.CreateLearnableParameter(L"U", c_hiddenDim, c_inputDim);
+    auto R = builder.CreateLearnableParameter(L"R", c_hiddenDim, c_hiddenDim);
+    auto b = builder.CreateLearnableParameter(L"b", c_hiddenDim, 1);
+    auto b2 = shareBias ? b : builder.CreateLearnableParameter(L"b2", c_hiddenDim, 1);
+
+    auto h1 = builder.Tanh(builder.Plus(builder.Times(W1, x, 1, L"z1"), b, L"p1"), L"h1");
+    auto h2 = builder.Sigmoid(builder.Plus(builder.Times(W2, x, 1, L"z2"), b2, L"p2"), L"h2");
+    auto a = builder.Times(U, x, 1, L"a");
+    auto prev = builder.PastValue(h2, 0.1f, c_hiddenDim, 1, L"prev"); // its input is set to s below
+    auto s = builder.Tanh(builder.Plus(builder.Times(R, prev, 1, L"rs"), h2, L"ps"), L"s");
+    ComputationNodeBasePtr(prev)->SetInput(0, s); // close the loop through the public base-class interface
+    auto y = builder.Plus(builder.Plus(builder.ElementTimes(h1, s, L"h1s"), builder.RectifiedLinear(a, L"h3"), L"y1"), builder.Tanh(a, L"h4"), L"y");
+    auto criterion = builder.Sum(y, L"criterion");
+    net.AddToNodeGroup(L"output", y);
+    net.AddToNodeGroup(L"criterion", criterion);
+}
+
+// Compiles the network, with inter-op parallelism if 'interOpThreads' > 1, and allocates its matrices.
+template <class ElemType>
+static ComputationNetworkPtr CompileMultiBranchNetwork(bool shareBias, size_t interOpThreads)
+{
+    auto net = make_shared<ComputationNetwork>(c_deviceId);
+    BuildMultiBranchNetwork<ElemType>(*net, shareBias);
+
+    size_t wasInterOpThreads = Globals::GetInterOpThreads();
+    Globals::SetInterOpThreads(interOpThreads);
+    net->CompileNetwork();
+    net->AllocateAllMatrices({}, { net->GetNodeFromName(L"y") }, net->GetNodeFromName(L"criterion"));
+    bool usesInterOpParallelism = net->UsesInterOpParallelism();
+    Globals::SetInterOpThreads(wasInterOpThreads);
+
+    BOOST_REQUIRE_MESSAGE(usesInterOpParallelism == (interOpThreads > 1), "Inter-op parallelism was not enabled as requested");
+    return net;
+}
+
+// Sets the minibatch layout, three parallel sequences with a gap, and fills inputs and parameters with random values.
+// Each node's values are derived from its name, so that all networks get the same values; b2 gets the values of b.
+template <class ElemType>
+static void SetMultiBranchValues(const ComputationNetworkPtr& net)
+{
+    const size_t numParallelSequences = 3, numTimeSteps = 5;
+    auto pMBLayout = net->GetMBLayoutPtrOfNetwork();
+    pMBLayout->Init(numParallelSequences, numTimeSteps);
+    pMBLayout->AddSequence(0, 0, 0, numTimeSteps);
+    pMBLayout->AddSequence(1, 1, 0, 3);
+    pMBLayout->AddGap(1, 3, numTimeSteps);
+    pMBLayout->AddSequence(2, 2, 0, numTimeSteps);
+
+    for (const auto& nodeBase : net->GetAllNodes())
+    {
+        auto node = dynamic_pointer_cast<ComputationNode<ElemType>>(nodeBase);
+        size_t numRows, numCols;
+        if (node->OperationName() == OperationNameOf(InputValue))
+        {
+            numRows = node->GetSampleMatrixNumRows();
+            numCols = numParallelSequences * numTimeSteps;
+        }
+        else if (node->OperationName() == OperationNameOf(LearnableParameter))
+        {
+            numRows = node->GetAsMatrixNumRows();
+            numCols = node->GetAsMatrixNumCols();
+        }
+        else
+            continue;
+
+        const wstring name = node->NodeName() == L"b2" ? L"b" : node->NodeName();
+        seed_seq seed(name.begin(), name.end());
+        mt19937 rng(seed);
+        uniform_real_distribution<double> uniform(-1, 1);
+        vector<ElemType> values(numRows * numCols);
+        for (auto& value : values)
+            value = (ElemType)uniform(rng);
+        node->Value().SetValue(numRows, numCols, c_deviceId, values.data());
+    }
+}
+
+template <class ElemType>
+static void ForwardBackward(const ComputationNetworkPtr& net)
+{
+    auto criterion = net->GetNodeFromName(L"criterion");
+    ScopedNetworkOperationMode modeGuard(net, NetworkOperationMode::training);
+    net->StartEvaluateMinibatchLoop(criterion);
+    net->SetEvalTimeStampsOutdatedWithRegardToAll();
+    net->ForwardProp(criterion);
+    net->Backprop(criterion);
+}
+
+template <class ElemType>
+static vector<ElemType> GetValues(const ComputationNetworkPtr& net, const wstring& nodeName, bool gradient)
+{
+    auto node = dynamic_pointer_cast<ComputationNode<ElemType>>(net->GetNodeFromName(nodeName));
+    const Matrix<ElemType>& matrix = gradient ? node->Gradient() : node->Value();
+    return vector<ElemType>(matrix.Data(), matrix.Data() + matrix.GetNumElements());
+}
+
+BOOST_AUTO_TEST_SUITE(InterOpParallelTestSuite)
+
+// forward and backward pass on the thread pool give bit-identical values and gradients to sequential execution
+BOOST_AUTO_TEST_CASE(InterOpParallelMatchesSequential)
+{
+    auto net = CompileMultiBranchNetwork<float>(/*shareBias=*/ true, 0);
+    SetMultiBranchValues<float>(net);
+    ForwardBackward<float>(net);
+
+    const vector<wstring> parameterNames = { L"W1", L"W2", L"U", L"R", L"b" };
+    auto parallelNet = CompileMultiBranchNetwork<float>(/*shareBias=*/ true, c_interOpThreads);
+    SetMultiBranchValues<float>(parallelNet);
+    for (size_t iteration = 0; iteration < 20; iteration++) // repeated, since the order of execution varies
+    {
+        ForwardBackward<float>(parallelNet);
+
+        for (const wstring& name : { L"criterion", L"y" })
+        {
+            vector<float> values = GetValues<float>(net, name, /*gradient=*/ false);
+            vector<float> parallelValues = GetValues<float>(parallelNet, name, /*gradient=*/ false);
+            BOOST_REQUIRE_MESSAGE(values == parallelValues, "Value of " << string(name.begin(), name.end()) << " differs from sequential execution");
+        }
+        for (const wstring& name : parameterNames)
+        {
+            vector<float> gradient = GetValues<float>(net, name, /*gradient=*/ true);
+            vector<float> parallelGradient = GetValues<float>(parallelNet, name, /*gradient=*/ true);
+            BOOST_REQUIRE_MESSAGE(gradient == parallelGradient, "Gradient of " << string(name.begin(), name.end()) << " differs from sequential execution");
+        }
+    }
+}
+
+// the gradient of the shared bias is the sum of the gradients of two separate biases with the same values
+BOOST_AUTO_TEST_CASE(InterOpParallelSharedInputGradient)
+{
+    const float threshold = 1e-6f;
+    auto splitNet = CompileMultiBranchNetwork<float>(/*shareBias=*/ false, 0);
+    SetMultiBranchValues<float>(splitNet);
+    ForwardBackward<float>(splitNet);
+    vector<float> expected = GetValues<float>(splitNet, L"b", /*gradient=*/ true);
+    vector<float> b2Gradient = GetValues<float>(splitNet, L"b2", /*gradient=*/ true);
+    for (size_t i = 0; i < expected.size(); i++)
+        expected[i] += b2Gradient[i];
+
+    auto parallelNet = CompileMultiBranchNetwork<float>(/*shareBias=*/ true, c_interOpThreads);
+    SetMultiBranchValues<float>(parallelNet);
+    for (size_t iteration = 0; iteration < 20; iteration++)
+    {
+        ForwardBackward<float>(parallelNet);
+        vector<float> gradient = GetValues<float>(parallelNet, L"b", /*gradient=*/ true);
+        BOOST_REQUIRE_MESSAGE(gradient.size() == expected.size() && AreEqual(expected.data(), gradient.data(), expected.size(), threshold),
+                              "Gradient of the shared bias is invalid");
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} } } }
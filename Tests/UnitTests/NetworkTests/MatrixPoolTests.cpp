@@ -0,0 +1,166 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.md file in the project root for full license information.
+//
+#include "stdafx.h"
+
+#include "../../../Source/ComputationNetworkLib/ComputationNode.h"
+#include "../../../Source/ComputationNetworkLib/MatrixPool.h"
+#include <memory>
+
+using namespace Microsoft::MSR::CNTK;
+using namespace std;
+
+namespace Microsoft { namespace MSR { namespace CNTK { namespace Test {
+
+const DEVICEID_TYPE c_deviceId = CPUDEVICE;
+
+struct TestRequest
+{
+    size_t matrixSize;
+    bool mbScale;
+    int allocStep;
+    int releaseStep; // INT_MAX: never released
+};
+
+// Replays the requests in step order against the pool, as the network does when allocating its matrices.
+template <class ElemType>
+void RequestMatrices(MatrixPool& pool, const vector<TestRequest>& requests, vector<shared_ptr<Matrix<ElemType>>>& matrices)
+{
+    matrices.resize(requests.size());
+    for (int step = 0; ; step++)
+    {
+        bool done = true;
+        for (size_t i = 0; i < requests.size(); i++)
+        {
+            if (requests[i].allocStep == step)
+                pool.RequestAllocate(c_deviceId, &matrices[i], requests[i].matrixSize, requests[i].mbScale, false);
+            else if (requests[i].releaseStep == step)
+                pool.RequestRelease(&matrices[i]);
+            if (requests[i].allocStep >= step || (requests[i].releaseStep != INT_MAX && requests[i].releaseStep >= step))
+                done = false;
+        }
+        if (done)
+            break;
+    }
+}
+
+// Steps are only consumed by requests, so allocStep/releaseStep must be a permutation of the used steps.
+vector<TestRequest> GetTestRequests()
+{
+    return vector<TestRequest>{
+        { 10,   true,  0,  5 },
+        { 100,  false, 1,  INT_MAX },
+        { 20,   true,  2,  8 },
+        { 5,    true,  3,  6 },
+        { 4000, false, 4,  10 },
+        { 30,   true,  7,  12 },
+        { 10,   true,  9,  13 },
+        { 1,    false, 11, 14 },
+    };
+}
+
+template <class ElemType>
+void CheckNoOverlappingSharing(const vector<TestRequest>& requests, const vector<shared_ptr<Matrix<ElemType>>>& matrices)
+{
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        BOOST_REQUIRE(matrices[i] != nullptr);
+        for (size_t j = i + 1; j < requests.size(); j++)
+        {
+            bool overlap = requests[i].allocStep <= requests[j].releaseStep && requests[j].allocStep <= requests[i].releaseStep;
+            if (overlap)
+                BOOST_REQUIRE_MESSAGE(matrices[i] != matrices[j], "Requests with overlapping lifetimes share a matrix");
+        }
+    }
+}
+
+template <class ElemType>
+void CheckStatistics(MatrixPool& pool, size_t numColumns, size_t numRequests)
+{
+    auto stats = pool.GetMemoryPlanStatistics(numColumns);
+    BOOST_REQUIRE_EQUAL(stats.numRequests, numRequests);
+    BOOST_REQUIRE(stats.numMatrices <= stats.numRequests);
+    BOOST_REQUIRE(stats.peakOfRequests <= stats.plannedMemory);
+    BOOST_REQUIRE(stats.plannedMemory <= stats.sumOfRequests);
+}
+
+template <class ElemType>
+void MatrixPoolReplanTestImpl()
+{
+    MatrixPool pool;
+    auto requests = GetTestRequests();
+    vector<shared_ptr<Matrix<ElemType>>> matrices;
+    RequestMatrices(pool, requests, matrices);
+
+    pool.OptimizedMemoryAllocation();
+    CheckNoOverlappingSharing(requests, matrices);
+    CheckStatistics<ElemType>(pool, 1, requests.size());
+    auto pinnedMatrix = matrices[1];
+
+    // a small minibatch: the fixed-size 4000 element matrix dominates
+    BOOST_REQUIRE(pool.OptimizeMemoryForNumColumns(3));
+    CheckNoOverlappingSharing(requests, matrices);
+    CheckStatistics<ElemType>(pool, 3, requests.size());
+    BOOST_REQUIRE(matrices[1] == pinnedMatrix);
+
+    // a large minibatch: the minibatch-scaled matrices dominate
+    BOOST_REQUIRE(pool.OptimizeMemoryForNumColumns(1000));
+    CheckNoOverlappingSharing(requests, matrices);
+    CheckStatistics<ElemType>(pool, 1000, requests.size());
+    BOOST_REQUIRE(matrices[1] == pinnedMatrix);
+    auto stats = pool.GetMemoryPlanStatistics(1000);
+    // requests 5 and 2 overlap and get the two large matrices, requests 0, 6 and 7 fit into those or into the one of request 4
+    BOOST_REQUIRE_EQUAL(stats.plannedMemory, (100 + 30 * 1000 + 20 * 1000 + 5 * 1000 + 4000) * sizeof(ElemType));
+
+    // the same bucket does not trigger re-planning; known buckets reuse their cached plan
+    BOOST_REQUIRE(!pool.OptimizeMemoryForNumColumns(1000));
+    BOOST_REQUIRE(!pool.OptimizeMemoryForNumColumns(1020));
+    BOOST_REQUIRE(!pool.OptimizeMemoryForNumColumns(3));
+    CheckNoOverlappingSharing(requests, matrices);
+    BOOST_REQUIRE(matrices[1] == pinnedMatrix);
+}
+
+template <class ElemType>
+void MatrixPoolSharingDisabledTestImpl()
+{
+    MatrixPool pool;
+    pool.EnableMemorySharing(false);
+    auto requests = GetTestRequests();
+    vector<shared_ptr<Matrix<ElemType>>> matrices;
+    RequestMatrices(pool, requests, matrices);
+
+    pool.OptimizedMemoryAllocation();
+    BOOST_REQUIRE(!pool.OptimizeMemoryForNumColumns(100));
+    auto stats = pool.GetMemoryPlanStatistics(100);
+    BOOST_REQUIRE_EQUAL(stats.numMatrices, requests.size());
+    BOOST_REQUIRE_EQUAL(stats.plannedMemory, stats.sumOfRequests);
+}
+
+BOOST_AUTO_TEST_SUITE(MatrixPoolTestSuite)
+
+BOOST_AUTO_TEST_CASE(MatrixPoolNumColumnsBucket)
+{
+    BOOST_REQUIRE_EQUAL(MatrixPool::GetNumColumnsBucket(0), 0);
+    BOOST_REQUIRE_EQUAL(MatrixPool::GetNumColumnsBucket(3), 3);
+    BOOST_REQUIRE_EQUAL(MatrixPool::GetNumColumnsBucket(9), 10);
+    BOOST_REQUIRE_EQUAL(MatrixPool::GetNumColumnsBucket(16), 16);
+    BOOST_REQUIRE_EQUAL(MatrixPool::GetNumColumnsBucket(1000), 1024);
+    BOOST_REQUIRE_EQUAL(MatrixPool::GetNumColumnsBucket(1025), 1280);
+}
+
+BOOST_AUTO_TEST_CASE(MatrixPoolReplanTest)
+{
+    MatrixPoolReplanTestImpl<float>();
+    MatrixPoolReplanTestImpl<double>();
+}
+
+BOOST_AUTO_TEST_CASE(MatrixPoolSharingDisabledTest)
+{
+    MatrixPoolSharingDisabledTestImpl<float>();
+    MatrixPoolSharingDisabledTestImpl<double>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} } } }
@@ -6,6 +6,8 @@
 #include <algorithm>
 #include <boost/scope_exit.hpp>
 #include "Common/ReaderTestHelper.h"
+#include "FileWrapper.h"
+#include "../../../Source/Readers/CNTKBinaryReader/BinaryChunkDeserializer.h"
 
 using namespace Microsoft::MSR::CNTK;
 
@@ -131,6 +133,164 @@ BOOST_AUTO_TEST_CASE(CNTKBinaryReader_50x20_jagged_sequences_sparse)
         true);
 };
 
+// Same data as above, with chunks read from a memory mapped file.
+BOOST_AUTO_TEST_CASE(CNTKBinaryReader_MNIST_dense_memory_mapped)
+{
+    HelperRunReaderTest<double>(
+        testDataPath() + "/Config/CNTKBinaryReader/test.cntk",
+        testDataPath() + "/Control/CNTKTextFormatReader/MNIST_dense.txt",
+        testDataPath() + "/Control/CNTKBinaryReader/MNIST_dense_memory_mapped_Output.txt",
+        "MNIST_memory_mapped",
+        "reader",
+        1000, // epoch size
+        1000,  // mb size
+        1,   // num epochs
+        1,
+        1,
+        0,
+        1);
+};
+
+BOOST_AUTO_TEST_CASE(CNTKBinaryReader_50x20_jagged_sequences_sparse_memory_mapped)
+{
+    HelperRunReaderTest<float>(
+        testDataPath() + "/Config/CNTKBinaryReader/test.cntk",
+        testDataPath() + "/Control/CNTKTextFormatReader/50x20_jagged_sequences_sparse.txt",
+        testDataPath() + "/Control/CNTKBinaryReader/50x20_jagged_sequences_sparse_memory_mapped_Output.txt",
+        "50x20_jagged_sequences_sparse_memory_mapped",
+        "reader",
+        564,  // epoch size
+        564,  // mb size 
+        1,  // num epochs
+        1,
+        0,
+        0,
+        1,
+        true);
+};
+
+BOOST_AUTO_TEST_CASE(CNTKBinaryReader_50x20_jagged_sequences_sparse_compressed)
+{
+    HelperRunReaderTest<float>(
+        testDataPath() + "/Config/CNTKBinaryReader/test.cntk",
+        testDataPath() + "/Control/CNTKTextFormatReader/50x20_jagged_sequences_sparse.txt",
+        testDataPath() + "/Control/CNTKBinaryReader/50x20_jagged_sequences_sparse_compressed_Output.txt",
+        "50x20_jagged_sequences_sparse_compressed",
+        "reader",
+        564,  // epoch size
+        564,  // mb size 
+        1,  // num epochs
+        1,
+        0,
+        0,
+        1,
+        true);
+};
+
+// Reads the 50x20_jagged_sequences_sparse data from a file whose chunks are compressed with the given codec.
+// A reader built with the codec reads the same data as from the uncompressed file; a reader built without it
+// must fail with an error that names the codec, instead of returning garbage.
+static void RunCompressedChunkTest(CNTKBinaryReaderFixture& fixture, const string& codec, bool codecIsBuiltIn)
+{
+    auto test = [&]()
+    {
+        fixture.HelperRunReaderTest<float>(
+            fixture.testDataPath() + "/Config/CNTKBinaryReader/test.cntk",
+            fixture.testDataPath() + "/Control/CNTKTextFormatReader/50x20_jagged_sequences_sparse.txt",
+            fixture.testDataPath() + "/Control/CNTKBinaryReader/50x20_jagged_sequences_sparse_" + codec + "_Output.txt",
+            "50x20_jagged_sequences_sparse_" + codec,
+            "reader",
+            564,  // epoch size
+            564,  // mb size
+            1,  // num epochs
+            1,
+            0,
+            0,
+            1,
+            true);
+    };
+
+    if (codecIsBuiltIn)
+    {
+        test();
+        return;
+    }
+
+    BOOST_REQUIRE_EXCEPTION(
+        test(),
+        std::runtime_error,
+        [&codec](std::runtime_error const& ex)
+    {
+        return string(ex.what()).find("built without " + codec + " support") != string::npos;
+    });
+}
+
+BOOST_AUTO_TEST_CASE(CNTKBinaryReader_50x20_jagged_sequences_sparse_lz4)
+{
+#ifdef USE_LZ4
+    RunCompressedChunkTest(*this, "lz4", true);
+#else
+    RunCompressedChunkTest(*this, "lz4", false);
+#endif
+};
+
+BOOST_AUTO_TEST_CASE(CNTKBinaryReader_50x20_jagged_sequences_sparse_zstd)
+{
+#ifdef USE_ZSTD
+    RunCompressedChunkTest(*this, "zstd", true);
+#else
+    RunCompressedChunkTest(*this, "zstd", false);
+#endif
+};
+
+// A compressed sparse chunk that ends before its sequence does must fail instead of being read past its end.
+BOOST_AUTO_TEST_CASE(CNTKBinaryReader_compressed_sparse_truncated_chunk)
+{
+    // stream header: name "x", float values, sample dimension 10
+    const wstring headerFileName = L"compressed_sparse_header.tmp";
+    {
+        auto f = ::CNTK::FileWrapper::OpenOrDie(headerFileName, L"wb");
+        uint32_t nameLength = 1, sampleDimension = 10;
+        unsigned char dataType = 0;
+        f.WriteOrDie(&nameLength, sizeof(nameLength), 1);
+        f.WriteOrDie("x", 1, 1);
+        f.WriteOrDie(&dataType, sizeof(dataType), 1);
+        f.WriteOrDie(&sampleDimension, sizeof(sampleDimension), 1);
+    }
+    BOOST_SCOPE_EXIT(&headerFileName) { _wunlink(headerFileName.c_str()); } BOOST_SCOPE_EXIT_END
+
+    auto f = ::CNTK::FileWrapper::OpenOrDie(headerFileName, L"rb");
+    ::CNTK::CompressedSparseBinaryDataDeserializer deserializer(f);
+
+    // one sequence: 2 samples, 3 values, rows { 1, 4 } and { 7 }
+    vector<unsigned char> chunk = { 2, 3 };
+    float values[] = { 1, 2, 3 };
+    chunk.insert(chunk.end(), (unsigned char*)values, (unsigned char*)(values + 3));
+    chunk.insert(chunk.end(), { 2, 1, 3, 1, 7 });
+
+    vector<::CNTK::SequenceDataPtr> result;
+    BOOST_REQUIRE_EQUAL(deserializer.GetSequenceDataForChunk(1, chunk.data(), chunk.size(), result), chunk.size());
+    auto sequence = dynamic_pointer_cast<::CNTK::SparseSequenceData>(result[0]);
+    BOOST_REQUIRE_EQUAL(sequence->m_numberOfSamples, 2);
+    BOOST_REQUIRE_EQUAL(sequence->m_nnzCounts.size(), 2);
+    BOOST_REQUIRE_EQUAL(sequence->m_nnzCounts[0], 2);
+    BOOST_REQUIRE_EQUAL(sequence->m_nnzCounts[1], 1);
+    BOOST_REQUIRE_EQUAL(sequence->m_indices[0], 1);
+    BOOST_REQUIRE_EQUAL(sequence->m_indices[1], 4);
+    BOOST_REQUIRE_EQUAL(sequence->m_indices[2], 7);
+
+    // The chunk is copied for each size, so that reading past its end is caught by memory checkers, too.
+    for (size_t size = 0; size < chunk.size(); size++)
+    {
+        vector<unsigned char> truncated(chunk.begin(), chunk.begin() + size);
+        BOOST_CHECK_THROW(deserializer.GetSequenceDataForChunk(1, truncated.data(), truncated.size(), result), std::runtime_error);
+    }
+
+    // a sample count far beyond the chunk
+    vector<unsigned char> corrupt = { 0xff, 0xff, 0xff, 0xff, 0x0f, 0 };
+    BOOST_CHECK_THROW(deserializer.GetSequenceDataForChunk(1, corrupt.data(), corrupt.size(), result), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } } } }
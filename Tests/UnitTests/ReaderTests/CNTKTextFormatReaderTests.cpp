@@ -13,6 +13,8 @@
 #define _fileno fileno
 #endif
 #include <cstdio>
+#include <chrono>
+#include <random>
 #include <boost/scope_exit.hpp>
 #include "Common/ReaderTestHelper.h"
 #include "TextParser.h"
@@ -33,11 +35,13 @@ namespace CNTK {
         ChunkPtr m_chunk;
 
         CNTKTextFormatReaderTestRunner(const string& filename,
-            const vector<StreamDescriptor>& streams, unsigned int maxErrors) :
+            const vector<StreamDescriptor>& streams, unsigned int maxErrors,
+            unsigned int traceLevel = TextParser<ElemType>::TraceLevel::Info, bool fastParsing = true) :
             m_parser(std::make_shared<CorpusDescriptor>(true), wstring(filename.begin(), filename.end()), streams, true)
         {
             m_parser.SetMaxAllowedErrors(maxErrors);
-            m_parser.SetTraceLevel(TextParser<ElemType>::TraceLevel::Info);
+            m_parser.SetTraceLevel(traceLevel);
+            m_parser.SetFastParsing(fastParsing);
             m_parser.SetChunkSize(SIZE_MAX);
             m_parser.SetNumRetries(0);
             m_parser.Initialize();
@@ -903,6 +907,126 @@ BOOST_AUTO_TEST_CASE(CNTKTextFormatReader_extra_input_should_be_ignored)
     }
 };
 
+// Writes a synthetic CTF file with sequences of 1 to 10 rows, each row holding a sample of
+// every input in a mix of number formats. Every 50th sequence also contains a comment, an input
+// not listed in the streams or a dense sample with a sparse suffix. Returns the file size.
+static size_t WriteSyntheticCTFFile(const string& filename, const vector<StreamDescriptor>& streams, size_t numSequences, size_t nnzPerSample)
+{
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<double> values(-100, 100);
+    const char* formats[] = { "%g", "%.9g", "%.3f", "%.6e", "%.0f." };
+    char number[64];
+
+    std::ofstream file(filename, std::ofstream::out | std::ofstream::binary);
+    for (size_t sequence = 0; sequence < numSequences; ++sequence)
+    {
+        size_t numRows = 1 + rng() % 10;
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            file << sequence;
+            for (const auto& stream : streams)
+            {
+                file << " |" << stream.m_alias;
+                bool sparse = stream.m_storageFormat == StorageFormat::SparseCSC;
+                size_t numValues = sparse ? nnzPerSample : stream.m_sampleDimension;
+                if (!sparse && sequence % 50 == 49 && row == 0)
+                    numValues /= 2;
+
+                for (size_t i = 0; i < numValues; ++i)
+                {
+                    sprintf(number, formats[rng() % 5], values(rng));
+                    file << " ";
+                    if (sparse)
+                        file << rng() % stream.m_sampleDimension << ":";
+                    file << number;
+                }
+            }
+            if (sequence % 50 == 1)
+                file << " |# a comment |unknown 1 2 3";
+            file << "\n";
+        }
+    }
+    return (size_t)file.tellp();
+}
+
+template <class ElemType>
+void CheckSequencesEqual(const ChunkPtr& expected, const ChunkPtr& actual, size_t numSequences, const vector<StreamDescriptor>& streams)
+{
+    for (size_t sequence = 0; sequence < numSequences; ++sequence)
+    {
+        vector<SequenceDataPtr> expectedData, actualData;
+        expected->GetSequence(sequence, expectedData);
+        actual->GetSequence(sequence, actualData);
+        BOOST_REQUIRE_EQUAL(expectedData.size(), actualData.size());
+        for (size_t i = 0; i < streams.size(); ++i)
+        {
+            BOOST_REQUIRE_EQUAL(expectedData[i]->m_numberOfSamples, actualData[i]->m_numberOfSamples);
+            BOOST_REQUIRE_EQUAL(expectedData[i]->m_key.m_sequence, actualData[i]->m_key.m_sequence);
+            size_t numValues = expectedData[i]->m_numberOfSamples * streams[i].m_sampleDimension;
+            if (streams[i].m_storageFormat == StorageFormat::SparseCSC)
+            {
+                auto expectedSparse = static_cast<SparseSequenceData*>(expectedData[i].get());
+                auto actualSparse = static_cast<SparseSequenceData*>(actualData[i].get());
+                BOOST_REQUIRE(expectedSparse->m_nnzCounts == actualSparse->m_nnzCounts);
+                numValues = expectedSparse->m_totalNnzCount;
+                BOOST_REQUIRE_EQUAL(numValues, actualSparse->m_totalNnzCount);
+                BOOST_REQUIRE(std::equal(expectedSparse->m_indices, expectedSparse->m_indices + numValues, actualSparse->m_indices));
+            }
+            // the fast path is expected to produce bit-identical values
+            auto expectedValues = static_cast<const ElemType*>(expectedData[i]->GetDataBuffer());
+            auto actualValues = static_cast<const ElemType*>(actualData[i]->GetDataBuffer());
+            BOOST_REQUIRE(memcmp(expectedValues, actualValues, numValues * sizeof(ElemType)) == 0);
+        }
+    }
+}
+
+// Reports the parsing throughput with and without the fast path, and checks that both produce the same data.
+template <class ElemType>
+void RunParsingBenchmark(const string& name, const vector<StreamDescriptor>& streams, size_t numSequences, size_t nnzPerSample)
+{
+    string filename = name + "_benchmark.txt";
+    size_t fileSize = WriteSyntheticCTFFile(filename, streams, numSequences, nnzPerSample);
+
+    {
+        ChunkPtr chunks[2];
+        for (bool fastParsing : { false, true })
+        {
+            CNTKTextFormatReaderTestRunner<ElemType> testRunner(filename, streams, 0, 0, fastParsing);
+            auto start = std::chrono::steady_clock::now();
+            testRunner.LoadChunk();
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            fprintf(stderr, "%s CTF parsing (%s): %.1f MB in %.3f s, %.1f MB/s\n", name.c_str(),
+                fastParsing ? "fast path" : "character by character", fileSize / 1e6, seconds, fileSize / 1e6 / seconds);
+            chunks[fastParsing] = testRunner.m_chunk;
+        }
+
+        CheckSequencesEqual<ElemType>(chunks[0], chunks[1], numSequences, streams);
+    }
+
+    boost::filesystem::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(CNTKTextFormatReader_parsing_benchmark)
+{
+    vector<StreamDescriptor> streams(2);
+    streams[0].m_alias = "features";
+    streams[0].m_name = L"features";
+    streams[0].m_storageFormat = StorageFormat::Dense;
+    streams[0].m_sampleDimension = 100;
+
+    streams[1].m_alias = "labels";
+    streams[1].m_name = L"labels";
+    streams[1].m_storageFormat = StorageFormat::Dense;
+    streams[1].m_sampleDimension = 10;
+
+    RunParsingBenchmark<float>("dense", streams, 2000, 0);
+
+    streams[0].m_storageFormat = StorageFormat::SparseCSC;
+    streams[0].m_sampleDimension = 100000;
+
+    RunParsingBenchmark<double>("sparse", streams, 5000, 20);
+};
+
 // 100 sequences with N samples for each of 3 inputs, where N is chosen at random
 // from [1, 100] for each sequence
 BOOST_AUTO_TEST_CASE(CNTKTextFormatReader_100x100x3)
@@ -15,8 +15,74 @@ struct ImageReaderFixture : ReaderFixture
         : ReaderFixture("/Data")
     {
     }
+
+    // Reads one epoch of the given number of images, not randomized, and returns the features of all of them.
+    template <class ElemType>
+    std::vector<ElemType> ReadFeatures(const std::string& configFileName, const std::string& testSectionName,
+                                       const std::vector<std::wstring>& additionalParameters, size_t numImages)
+    {
+        shared_ptr<StreamMinibatchInputs> inputs = CreateStreamMinibatchInputs<ElemType>(1, 1, false, true, true);
+        shared_ptr<DataReader> reader = GetDataReader(testDataPath() + "/Config/" + configFileName, testSectionName, "reader", additionalParameters);
+
+        std::vector<ElemType> result;
+        reader->StartMinibatchLoop(numImages, 0, inputs->GetStreamDescriptions(), numImages);
+        while (reader->GetMinibatch(*inputs))
+        {
+            const auto& features = inputs->GetInputMatrix<ElemType>(L"features");
+            result.insert(result.end(), features.Data(), features.Data() + features.GetNumElements());
+        }
+        return result;
+    }
+
+    // Checks that the fused CropScaleMeanTranspose transform gives the same features as the chain of transforms it replaces.
+    template <class ElemType>
+    void CompareFusedCropScaleMeanTranspose(const std::wstring& precision, const std::wstring& meanFile);
 };
 
+// Header of a decoded image cache file, as written by DecodedImageCache.
+struct DecodedImageCacheHeader
+{
+    uint64_t m_magic;
+    uint32_t m_version;
+    uint32_t m_grayscale;
+    uint64_t m_shorterSide;
+    uint64_t m_numberOfImages;
+    uint64_t m_tableOffset;
+};
+
+static DecodedImageCacheHeader ReadDecodedImageCacheHeader(const boost::filesystem::path& filename)
+{
+    DecodedImageCacheHeader header = {};
+    std::ifstream file(filename.string(), std::ios::binary);
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    BOOST_REQUIRE_MESSAGE(file.good(), "Decoded image cache " << filename.string() << " cannot be read");
+    return header;
+}
+
+template <class ElemType>
+void CompareFeatures(const std::vector<ElemType>& expected, const std::vector<ElemType>& actual, double tolerance)
+{
+    BOOST_REQUIRE_EQUAL(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+        BOOST_REQUIRE_MESSAGE(std::abs(expected[i] - actual[i]) <= tolerance,
+                              "Features differ at " << i << ": " << expected[i] << " vs " << actual[i]);
+}
+
+template <class ElemType>
+void ImageReaderFixture::CompareFusedCropScaleMeanTranspose(const std::wstring& precision, const std::wstring& meanFile)
+{
+    std::vector<std::wstring> additionalParameters
+    {
+        L"precision=\"" + precision + L"\"",
+        L"MeanFile=\"" + meanFile + L"\""
+    };
+
+    auto expected = ReadFeatures<ElemType>("ImageReaderCropScaleMeanTranspose_Config.cntk", "Chain_Test", additionalParameters, 4);
+    auto actual = ReadFeatures<ElemType>("ImageReaderCropScaleMeanTranspose_Config.cntk", "Fused_Test", additionalParameters, 4);
+    BOOST_REQUIRE_EQUAL(expected.size(), 4 * 4 * 8 * 3);
+    CompareFeatures(expected, actual, 1e-4);
+}
+
 BOOST_FIXTURE_TEST_SUITE(ReaderTestSuite, ImageReaderFixture)
 
 BOOST_AUTO_TEST_CASE(ImageReaderSimple)
@@ -550,6 +616,89 @@ BOOST_AUTO_TEST_CASE(ImageReaderNoMatchingIds)
     });
 }
 
+BOOST_AUTO_TEST_CASE(ImageReaderCropScaleMeanTranspose)
+{
+    for (const std::wstring meanFile : { L"", L"$RootDir$/ImageReaderSimple_mean.xml" })
+    {
+        CompareFusedCropScaleMeanTranspose<float>(L"float", meanFile);
+        CompareFusedCropScaleMeanTranspose<double>(L"double", meanFile);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ImageReaderDecodedImageCache)
+{
+    const std::string config = "ImageReaderDecodedImageCache_Config.cntk";
+    const std::string section = "DecodedImageCache_Test";
+    const size_t imageSize = 4 * 8 * 3; // size of the images of the map file, also of the features per image
+
+    auto cacheFile = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    const std::wstring cacheParameter = L"CacheFile=\"" + cacheFile.wstring() + L"\"";
+
+    // Build: the cache contains all images, and reading them from it gives the same features as decoding them.
+    auto decoded = ReadFeatures<float>(config, section, {}, 4);
+    BOOST_REQUIRE_EQUAL(decoded.size(), 4 * imageSize);
+    auto cached = ReadFeatures<float>(config, section, { cacheParameter }, 4);
+    CompareFeatures(decoded, cached, 0);
+
+    auto header = ReadDecodedImageCacheHeader(cacheFile);
+    BOOST_REQUIRE_EQUAL(header.m_grayscale, 0);
+    BOOST_REQUIRE_EQUAL(header.m_shorterSide, 0);
+    BOOST_REQUIRE_EQUAL(header.m_numberOfImages, 4);
+
+    // Reopen: the file is used as it is. Pixels of the first image (black) start right after the header;
+    // they are overwritten with white, so that only a cache that is not rebuilt returns them.
+    {
+        std::fstream file(cacheFile.string(), std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(sizeof(DecodedImageCacheHeader));
+        std::vector<char> white(imageSize, (char)255);
+        file.write(white.data(), white.size());
+        BOOST_REQUIRE(file.good());
+    }
+
+    cached = ReadFeatures<float>(config, section, { cacheParameter }, 4);
+    BOOST_REQUIRE_EQUAL(cached.size(), decoded.size());
+    CompareFeatures(std::vector<float>(imageSize, 255.0f), std::vector<float>(cached.begin(), cached.begin() + imageSize), 0);
+    CompareFeatures(std::vector<float>(decoded.begin() + imageSize, decoded.end()), std::vector<float>(cached.begin() + imageSize, cached.end()), 0);
+
+    // Rebuild on a grayscale mismatch: the cache has grayscale images again equal to the decoded ones.
+    std::vector<std::wstring> grayscaleParameters { L"Grayscale=true", L"Channels=1" };
+    decoded = ReadFeatures<float>(config, section, grayscaleParameters, 4);
+    BOOST_REQUIRE_EQUAL(decoded.size(), 4 * 4 * 8);
+    grayscaleParameters.push_back(cacheParameter);
+    cached = ReadFeatures<float>(config, section, grayscaleParameters, 4);
+    CompareFeatures(decoded, cached, 0);
+
+    header = ReadDecodedImageCacheHeader(cacheFile);
+    BOOST_REQUIRE_EQUAL(header.m_grayscale, 1);
+    BOOST_REQUIRE_EQUAL(header.m_shorterSide, 0);
+    BOOST_REQUIRE_EQUAL(header.m_numberOfImages, 4);
+
+    // Rebuild on a shorter side mismatch: the 4x8 images are downscaled to 2x4 in the cache.
+    grayscaleParameters.push_back(L"CacheShorterSide=2");
+    cached = ReadFeatures<float>(config, section, grayscaleParameters, 4);
+    BOOST_REQUIRE_EQUAL(cached.size(), decoded.size());
+
+    header = ReadDecodedImageCacheHeader(cacheFile);
+    BOOST_REQUIRE_EQUAL(header.m_grayscale, 1);
+    BOOST_REQUIRE_EQUAL(header.m_shorterSide, 2);
+    BOOST_REQUIRE_EQUAL(header.m_numberOfImages, 4);
+
+    // Fallback: the cache is rebuilt for the color images of the simple map, an image that is not in it is decoded.
+    ReadFeatures<float>(config, section, { cacheParameter }, 4);
+    const std::wstring mapParameter = L"MapFile=\"$RootDir$/ImageReaderDecodedImageCache_map.txt\"";
+    decoded = ReadFeatures<float>(config, section, { mapParameter }, 5);
+    BOOST_REQUIRE_EQUAL(decoded.size(), 5 * imageSize);
+    cached = ReadFeatures<float>(config, section, { mapParameter, cacheParameter }, 5);
+    CompareFeatures(decoded, cached, 0);
+
+    header = ReadDecodedImageCacheHeader(cacheFile);
+    BOOST_REQUIRE_EQUAL(header.m_grayscale, 0);
+    BOOST_REQUIRE_EQUAL(header.m_shorterSide, 0);
+    BOOST_REQUIRE_EQUAL(header.m_numberOfImages, 4);
+
+    boost::filesystem::remove(cacheFile);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 namespace
@@ -10,6 +10,7 @@
 #include "NoRandomizer.h"
 #include "DataDeserializer.h"
 #include "BlockRandomizer.h"
+#include "ChunkCache.h"
 #include "CorpusDescriptor.h"
 #include "FramePacker.h"
 #include "SequencePacker.h"
@@ -849,6 +850,98 @@ BOOST_AUTO_TEST_CASE(RandomizerChaosMonkey)
     RandomizerChaosMonkeyTest(norandomizer, sweepSize, 44);
 }
 
+BOOST_AUTO_TEST_CASE(BlockRandomizerDeepPrefetch)
+{
+    const int numChunks = 100;
+    const int numSequencesPerChunk = 10;
+    const int windowSize = 18;
+    vector<float> data(numChunks * numSequencesPerChunk);
+    iota(data.begin(), data.end(), 0.0f);
+    auto mockDeserializer = make_shared<MockDeserializer>(numChunks, numSequencesPerChunk, data);
+
+    auto expected = make_shared<BlockRandomizer>(0, windowSize, mockDeserializer, true, false);
+    auto underTest = make_shared<BlockRandomizer>(0, windowSize, mockDeserializer, true, false);
+    ChunkPrefetchConfiguration prefetch;
+    prefetch.m_depth = 4;
+    underTest->SetPrefetchConfiguration(prefetch);
+
+    // Prefetching deeper must not change the data.
+    for (size_t epoch = 0; epoch < 3; epoch++)
+    {
+        auto expectedEpoch = ReadFullEpoch(expected, data.size(), epoch);
+        auto actualEpoch = ReadFullEpoch(underTest, data.size(), epoch);
+        BOOST_CHECK_EQUAL_COLLECTIONS(expectedEpoch.begin(), expectedEpoch.end(), actualEpoch.begin(), actualEpoch.end());
+
+        const auto& stats = underTest->GetPrefetchStatistics();
+        // Chunks whose prefetch has not started yet when they are needed are loaded directly.
+        BOOST_CHECK_GT(stats.m_numPrefetchedChunks + stats.m_numSynchronousChunks, 0u);
+        BOOST_CHECK_LE(stats.m_numPrefetchedChunks + stats.m_numSynchronousChunks, (size_t)numChunks);
+        BOOST_CHECK_LE(stats.m_numStalls, stats.m_numPrefetchedChunks + stats.m_numSynchronousChunks);
+    }
+
+    // A memory budget below the size of a chunk still prefetches one chunk at a time.
+    prefetch.m_memoryBudget = 1;
+    prefetch.m_numThreads = 2;
+    BlockRandomizer budgeted(0, windowSize, mockDeserializer, true, false);
+    budgeted.SetPrefetchConfiguration(prefetch);
+    RandomizerChaosMonkeyTest(budgeted, data.size(), 45);
+
+    prefetch.m_memoryBudget = 0;
+    BlockRandomizer deep(0, windowSize, mockDeserializer, true, false);
+    deep.SetPrefetchConfiguration(prefetch);
+    RandomizerChaosMonkeyTest(deep, data.size(), 46);
+}
+
+BOOST_AUTO_TEST_CASE(BlockRandomizerWithBoundedChunkCache)
+{
+    const int numChunks = 20;
+    const int numSequencesPerChunk = 10;
+    const int windowSize = 4;
+    vector<float> data(numChunks * numSequencesPerChunk);
+    iota(data.begin(), data.end(), 0.0f);
+    auto mockDeserializer = make_shared<MockDeserializer>(numChunks, numSequencesPerChunk, data);
+
+    // A limit below the size of a chunk keeps only the most recently used chunk in memory.
+    ChunkCacheConfiguration spilling;
+    spilling.m_maxSizeInBytes = 1;
+    spilling.m_spillDirectory = L".";
+    auto spillingCache = make_shared<ChunkCache>(mockDeserializer, spilling);
+
+    ChunkCacheConfiguration dropping;
+    dropping.m_maxSizeInBytes = 1;
+    auto droppingCache = make_shared<ChunkCache>(mockDeserializer, dropping);
+
+    auto expected = make_shared<BlockRandomizer>(0, windowSize, mockDeserializer, false, false);
+    auto withSpilling = make_shared<BlockRandomizer>(0, windowSize, spillingCache, false, false);
+    auto withDropping = make_shared<BlockRandomizer>(0, windowSize, droppingCache, false, false);
+    for (size_t epoch = 0; epoch < 3; epoch++)
+    {
+        auto expectedEpoch = ReadFullEpoch(expected, data.size(), epoch);
+        auto spillingEpoch = ReadFullEpoch(withSpilling, data.size(), epoch);
+        auto droppingEpoch = ReadFullEpoch(withDropping, data.size(), epoch);
+        BOOST_CHECK_EQUAL_COLLECTIONS(expectedEpoch.begin(), expectedEpoch.end(), spillingEpoch.begin(), spillingEpoch.end());
+        BOOST_CHECK_EQUAL_COLLECTIONS(expectedEpoch.begin(), expectedEpoch.end(), droppingEpoch.begin(), droppingEpoch.end());
+    }
+
+    // Spilled chunks are only loaded from the deserializer once.
+    auto stats = spillingCache->GetStatistics();
+    BOOST_CHECK_EQUAL(stats.m_numMisses, (size_t)numChunks);
+    BOOST_CHECK_GT(stats.m_numSpillReads, 0u);
+    BOOST_CHECK_GT(stats.m_spilledSizeInBytes, 0u);
+
+    stats = droppingCache->GetStatistics();
+    BOOST_CHECK_GT(stats.m_numMisses, (size_t)numChunks);
+    BOOST_CHECK_EQUAL(stats.m_numSpillReads, 0u);
+    BOOST_CHECK_EQUAL(stats.m_spilledSizeInBytes, 0u);
+
+    // Without a limit all chunks stay in memory.
+    auto unbounded = make_shared<ChunkCache>(mockDeserializer);
+    auto withUnbounded = make_shared<BlockRandomizer>(0, windowSize, unbounded, false, false);
+    auto unboundedEpoch = ReadFullEpoch(withUnbounded, data.size(), 0);
+    auto expectedEpoch = ReadFullEpoch(expected, data.size(), 0);
+    BOOST_CHECK_EQUAL_COLLECTIONS(expectedEpoch.begin(), expectedEpoch.end(), unboundedEpoch.begin(), unboundedEpoch.end());
+}
+
 void BlockRandomizerOneEpochLegacyRandomizationTest(bool prefetch)
 {
     vector<float> data(10);
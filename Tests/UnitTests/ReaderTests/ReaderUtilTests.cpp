@@ -11,6 +11,8 @@
 #include "Platform.h"
 #include "IndexBuilder.h"
 #include "ReaderUtil.h"
+#include "CorpusDescriptor.h"
+#include "../../../Source/Readers/HTKDeserializers/MLFIndexBuilder.h"
 #include "Common/ReaderTestHelper.h"
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string.hpp>
@@ -354,8 +356,8 @@ static void CheckIdentical(const shared_ptr<Index>& index1, const shared_ptr<Ind
         Check(chunk1, chunk2.NumberOfSequences(), chunk2.NumberOfSamples(), chunk2.StartOffset(), chunk2.SizeInBytes());
         for (int j = 0; j < chunk1.NumberOfSequences(); j++)
         {
-            auto& seq1 = chunk1[i];
-            auto& seq2 = chunk2[i];
+            auto& seq1 = chunk1[j];
+            auto& seq2 = chunk2[j];
             Check(seq1, seq2.m_key, seq2.NumberOfSamples(), seq2.OffsetInChunk(), seq2.SizeInBytes());
         }
     }
@@ -504,6 +506,105 @@ BOOST_AUTO_TEST_CASE(Index_with_different_chunk_sizes)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Index_with_different_range_sizes)
+{
+    // Ranges split the input at arbitrary sequence boundaries; the index must be the same as when
+    // the whole input is read in one go.
+    for (const string& str : { s_textData, boost::replace_all_copy(s_textData, "|", "@| "), string("1\n\n\n2\n \n \n3|abc\n|abc\n3 |abc"),
+                               string("1\n1\n1\n1\n1 \n2\n\n\n\n3\n\n3\n3\n4 abc\n4 def\nghj\n4") })
+    {
+        auto expected = GetIndexBuilder(str)->SetRangeSize(0).SetChunkSize(30).Build();
+        for (size_t rangeSize = 1; rangeSize <= str.size(); rangeSize++)
+        {
+            CheckIdentical(GetIndexBuilder(str)->SetRangeSize(rangeSize).SetChunkSize(30).Build(), expected);
+            CheckIdentical(GetIndexBuilder(str)->SetRangeSize(rangeSize).SetBufferSize(7).SetChunkSize(30).Build(), expected);
+        }
+    }
+
+    // every line is a sequence, keyed by its line number
+    string lines = "\n\n|a 1\n|a 2\n|b 3\n\n|a 4|b 4\n|a 5";
+    auto expected = GetIndexBuilder(lines)->SetMainStream("a").SetRangeSize(0).Build();
+    Check(expected, 1, 4, 4, ANY);
+    Check((*expected)[0][0], 2, 1, 0, 5);
+    Check((*expected)[0][3], 7, 1, ANY, 4);
+    for (size_t rangeSize = 1; rangeSize <= lines.size(); rangeSize++)
+        CheckIdentical(GetIndexBuilder(lines)->SetMainStream("a").SetRangeSize(rangeSize).Build(), expected);
+}
+
+using MLFIndexBuilderPtr = unique_ptr<MLFIndexBuilder, std::function<void(MLFIndexBuilder*)>>;
+
+static MLFIndexBuilderPtr GetMLFIndexBuilder(const std::string& input, CorpusDescriptorPtr corpus)
+{
+    static size_t id = 0;
+    std::wstring filename = std::to_wstring(id++) + L".mlf.test.tmp";
+    CreateTestFile(input, filename);
+
+    auto f = FileWrapper::OpenOrDie(filename, L"rb");
+    BOOST_REQUIRE_EQUAL(input.size(), f.Filesize());
+
+    return MLFIndexBuilderPtr(new MLFIndexBuilder(f, corpus),
+        [filename](MLFIndexBuilder* builder)
+    {
+        delete builder;
+        _wunlink(filename.c_str());
+    });
+}
+
+BOOST_AUTO_TEST_CASE(MLFIndex_with_different_range_sizes)
+{
+    // Every range size puts an utterance boundary on a range edge somewhere; the index and the ids the
+    // utterance keys get in the corpus must be the same as when the whole file is read in one go.
+    const string mlf =
+        "#!MLF!#\n"
+        "\"a.lab\"\n0 2 s1\n2 5 s2\n.\n"
+        "\"b.lab\"\n0 3 s1\n.\n"
+        "\"*/c.lab\"\n0 1 s3\n1 4 s1\n4 6 s2\n.\n";
+
+    // Blank lines, a header between utterances, an utterance without frames, a dot as the key of an
+    // utterance and an unterminated utterance at the end of the file.
+    const string irregularMlf =
+        "#!MLF!#\n\n"
+        "\"a.lab\"\n0 2 s1\n\n.\n"
+        "#!MLF!#\n"
+        "\"d.lab\"\n.\n"
+        ".\n0 1 s1\n.\n\n"
+        "\"b.lab\"\n0 3 s1\n.\n"
+        "\"e.lab\"\n0 1 s1\n";
+
+    // input, number of indexed utterances, number of frames, keys in the order they are registered
+    using TestCase = tuple<string, size_t, size_t, vector<string>>;
+    for (const auto& test : { TestCase{ mlf, 3, 14, { "a", "b", "c" } },
+                              TestCase{ boost::replace_all_copy(mlf, "\n", "\r\n"), 3, 14, { "a", "b", "c" } },
+                              TestCase{ irregularMlf, 2, 5, { "a", "d", "b", "e" } } })
+    {
+        const string& str = get<0>(test);
+        const vector<string>& expectedKeys = get<3>(test);
+
+        auto expectedCorpus = make_shared<CorpusDescriptor>(false);
+        auto expected = GetMLFIndexBuilder(str, expectedCorpus)->SetRangeSize(0).SetChunkSize(30).Build();
+        Check(expected, ANY, get<1>(test), get<2>(test), ANY);
+
+        // A key the corpus has not seen yet gets the next free id.
+        auto checkCorpus = [&expectedKeys](const CorpusDescriptorPtr& corpus)
+        {
+            for (size_t id = 0; id < expectedKeys.size(); id++)
+                BOOST_REQUIRE_EQUAL(corpus->IdToKey(id), expectedKeys[id]);
+            BOOST_REQUIRE_EQUAL(corpus->KeyToId("not in the mlf"), expectedKeys.size());
+        };
+        checkCorpus(expectedCorpus);
+
+        for (size_t rangeSize = 1; rangeSize <= str.size(); rangeSize++)
+        {
+            auto corpus = make_shared<CorpusDescriptor>(false);
+            CheckIdentical(GetMLFIndexBuilder(str, corpus)->SetRangeSize(rangeSize).SetChunkSize(30).Build(), expected);
+            checkCorpus(corpus);
+
+            corpus = make_shared<CorpusDescriptor>(false);
+            CheckIdentical(GetMLFIndexBuilder(str, corpus)->SetRangeSize(rangeSize).SetBufferSize(7).SetChunkSize(30).Build(), expected);
+            checkCorpus(corpus);
+        }
+    }
+}
 
 BOOST_AUTO_TEST_CASE(Index_with_non_empty_main_stream_1)
 {
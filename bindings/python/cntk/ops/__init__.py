@@ -1841,8 +1841,9 @@ def optimized_rnnstack(operand, weights, hidden_size, num_layers,
                        bidirectional=False, recurrent_op='lstm', name=''):
     '''
     An RNN implementation that uses the primitives in cuDNN.
-    If cuDNN is not available it fails. You can use :class:`~cntk.misc.optimized_rnnstack_converter.convert_optimized_rnnstack`
-    to convert a model to GEMM-based implementation when no cuDNN.
+    On CPU, an implementation that uses the same weights layout is used instead. You can also use
+    :class:`~cntk.misc.optimized_rnnstack_converter.convert_optimized_rnnstack` to convert a model
+    to a GEMM-based implementation built from regular recurrences.
 
     Args:
         operand: input of the optimized RNN stack.
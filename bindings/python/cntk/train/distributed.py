@@ -202,3 +202,17 @@ def mpi_communicator():
     Creates a non quantized MPI communicator.
     '''
     return cntk_py.mpicommunicator()
+
+@typemap
+def compressed_mpi_communicator(num_quantization_bits, zero_threshold_for_1bit=False):
+    '''
+    Creates an MPI communicator that aggregates dense CPU gradients quantized
+    to ``num_quantization_bits`` (1, 2, 4 or 8), with error feedback. It can be
+    passed to :func:`~cntk.cntk_py.create_data_parallel_distributed_learner`
+    and does not require the 1BitSGD build.
+
+    Args:
+        num_quantization_bits (int): number of bits per gradient value
+        zero_threshold_for_1bit (bool): use 0 as the threshold for 1-bit quantization
+    '''
+    return cntk_py.compressed_mpicommunicator(num_quantization_bits, zero_threshold_for_1bit)